@@ -0,0 +1,51 @@
+#ifndef _GROUP_SYNC_H_INCLUDED_
+#define _GROUP_SYNC_H_INCLUDED_
+
+/*++
+/* NAME
+/*	group_sync 3h
+/* SUMMARY
+/*	coalesce file system sync operations across processes
+/* SYNOPSIS
+/*	#include <group_sync.h>
+/* DESCRIPTION
+/* .nf
+
+ /*
+  * System library.
+  */
+#include <sys/types.h>
+
+ /*
+  * External interface.
+  */
+typedef struct GROUP_SYNC_STATE {
+    unsigned count;			/* completed syncs */
+    dev_t   dev;			/* file system of last sync */
+} GROUP_SYNC_STATE;
+
+typedef struct GROUP_SYNC {
+    char   *path;			/* coordination file */
+    int     fd;				/* coordination file */
+    volatile GROUP_SYNC_STATE *state;	/* shared memory */
+    long    calls;			/* group_sync() calls */
+    long    syncs;			/* file system syncs */
+    int     use_syncfs;			/* syncfs() is usable */
+} GROUP_SYNC;
+
+extern GROUP_SYNC *group_sync_open(const char *);
+extern int group_sync(GROUP_SYNC *, int);
+extern void group_sync_close(GROUP_SYNC *);
+
+#define GROUP_SYNC_COUNT(gs)	((gs)->state->count)
+
+/* LICENSE
+/* .ad
+/* .fi
+/*	The Secure Mailer license must be distributed with this software.
+/* AUTHOR(S)
+/*	agent
+/*	agent@local
+/*--*/
+
+#endif
@@ -0,0 +1,25 @@
+/*++
+/* NAME
+/*	mail_dict 3h
+/* SUMMARY
+/*	register application-specific dictionaries
+/* SYNOPSIS
+/*	#include <mail_dict.h>
+/* DESCRIPTION
+/* .nf
+
+ /*
+  * External interface.
+  */
+extern void mail_dict_init(void);
+
+/* LICENSE
+/* .ad
+/* .fi
+/*	The Secure Mailer license must be distributed with this software.
+/* AUTHOR(S)
+/*	Wietse Venema
+/*	IBM T.J. Watson Research
+/*	P.O. Box 704
+/*	Yorktown Heights, NY 10598, USA
+/*--*/
@@ -0,0 +1,36 @@
+#ifndef _MAIL_SHARD_H_INCLUDED_
+#define _MAIL_SHARD_H_INCLUDED_
+
+/*++
+/* NAME
+/*	mail_shard 3h
+/* SUMMARY
+/*	queue manager shard support
+/* SYNOPSIS
+/*	#include <mail_shard.h>
+/* DESCRIPTION
+/* .nf
+
+ /*
+  * Utility library.
+  */
+#include <vstring.h>
+
+ /*
+  * External interface.
+  */
+extern int mail_shard_index(const char *);
+extern const char *mail_shard_service(VSTRING *, const char *, int);
+extern int mail_shard_parse(const char *, const char *);
+extern int mail_shard_trigger(const char *, const char *, ssize_t);
+
+/* LICENSE
+/* .ad
+/* .fi
+/*	The Secure Mailer license must be distributed with this software.
+/* AUTHOR(S)
+/*	agent
+/*	agent@local
+/*--*/
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef _NBDB_SURROGATE_H_
+#define _NBDB_SURROGATE_H_
+
+/*++
+/* NAME
+/*	nbdb_surrogate 3h
+/* SUMMARY
+/*	surrogate Berkeley DB handlers that log hints
+/* SYNOPSIS
+/*	#include <nbdb_surrogate.h>
+/* DESCRIPTION
+* .nf
+
+ /*
+  * External interface.
+  */
+extern void nbdb_surr_init(void);
+
+/* LICENSE
+/* .ad
+/* .fi
+/*	The Secure Mailer license must be distributed with this software.
+/* AUTHOR(S)
+/*	Wietse Venema
+/*	porcupine.org
+/*--*/
+
+#endif
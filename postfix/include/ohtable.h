@@ -0,0 +1,57 @@
+#ifndef _OHTABLE_H_INCLUDED_
+#define _OHTABLE_H_INCLUDED_
+
+/*++
+/* NAME
+/*	ohtable 3h
+/* SUMMARY
+/*	open-addressing hash table manager
+/* SYNOPSIS
+/*	#include <ohtable.h>
+/* DESCRIPTION
+/* .nf
+
+ /* Structure of one hash table entry. */
+
+typedef struct OHTABLE_INFO {
+    char   *key;			/* lookup key */
+    void   *value;			/* associated value */
+    size_t  hash;			/* private: key hash value */
+} OHTABLE_INFO;
+
+ /* Structure of one hash table. */
+
+typedef struct OHTABLE {
+    ssize_t size;			/* length of entries array */
+    ssize_t used;			/* number of entries in table */
+    OHTABLE_INFO *data;			/* entries array, auto-resized */
+    OHTABLE_INFO *old_data;		/* entries array being migrated */
+    ssize_t old_size;			/* length of old entries array */
+    ssize_t old_next;			/* next old entry to migrate */
+    ssize_t old_used;			/* entries not yet migrated */
+    int     flags;			/* see below */
+    struct OHTABLE_POOL *pool;		/* interned key storage */
+} OHTABLE;
+
+#define OHTABLE_FLAG_NONE	0
+#define OHTABLE_FLAG_INTERN	(1<<0)	/* keys in table-owned string pool */
+
+extern OHTABLE *ohtable_create(ssize_t, int);
+extern OHTABLE_INFO *ohtable_enter(OHTABLE *, const char *, void *);
+extern OHTABLE_INFO *ohtable_locate(OHTABLE *, const char *);
+extern void *ohtable_find(OHTABLE *, const char *);
+extern void ohtable_delete(OHTABLE *, const char *, void (*) (void *));
+extern void ohtable_free(OHTABLE *, void (*) (void *));
+extern void ohtable_walk(OHTABLE *, void (*) (OHTABLE_INFO *, void *), void *);
+extern OHTABLE_INFO **ohtable_list(OHTABLE *);
+
+/* LICENSE
+/* .ad
+/* .fi
+/*	The Secure Mailer license must be distributed with this software.
+/* AUTHOR(S)
+/*	agent
+/*	agent@local
+/*--*/
+
+#endif
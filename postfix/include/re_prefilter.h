@@ -0,0 +1,61 @@
+#ifndef _RE_PREFILTER_H_INCLUDED_
+#define _RE_PREFILTER_H_INCLUDED_
+
+/*++
+/* NAME
+/*	re_prefilter 3h
+/* SUMMARY
+/*	literal substring prefilter for regular expression tables
+/* SYNOPSIS
+/*	#include <re_prefilter.h>
+/* DESCRIPTION
+/* .nf
+
+ /*
+  * Utility library.
+  */
+#include <vstring.h>
+
+ /*
+  * External interface.
+  */
+typedef struct RE_PREFILTER {
+    struct RE_PREFILTER_STATE *states;	/* automaton states */
+    int     state_count;		/* states in use */
+    int     state_size;			/* states allocated */
+    int     root[256];			/* dense root transitions */
+    int     literal_count;		/* number of distinct literals */
+    unsigned *seen;			/* per-literal scan generation */
+    unsigned generation;		/* current scan generation */
+    int     compiled;			/* failure links are ready */
+    VSTRING *buf;			/* literal extraction buffer */
+} RE_PREFILTER;
+
+#define RE_PREFILTER_FLAG_NONE	0
+#define RE_PREFILTER_FLAG_PCRE	(1<<0)	/* PCRE syntax, not POSIX ERE */
+
+#define RE_PREFILTER_NONE	(-1)	/* no required literal */
+#define RE_PREFILTER_MIN_LEN	3	/* shorter literals are not used */
+
+extern int re_prefilter_enable;
+
+extern RE_PREFILTER *re_prefilter_create(void);
+extern int re_prefilter_add(RE_PREFILTER *, const char *, int);
+extern void re_prefilter_compile(RE_PREFILTER *);
+extern void re_prefilter_scan(RE_PREFILTER *, const char *);
+extern void re_prefilter_free(RE_PREFILTER *);
+extern char *re_prefilter_literal(VSTRING *, const char *, int);
+
+#define re_prefilter_count(pf)	((pf)->literal_count)
+#define re_prefilter_found(pf, id) ((pf)->seen[id] == (pf)->generation)
+
+/* LICENSE
+/* .ad
+/* .fi
+/*	The Secure Mailer license must be distributed with this software.
+/* AUTHOR(S)
+/*	agent
+/*	agent@local
+/*--*/
+
+#endif
@@ -239,6 +239,18 @@
 /*	Optional list of \fIname=value\fR pairs that specify default
 /*	values for arbitrary macros that Postfix may send to Milter
 /*	applications.
+/* .PP
+/*	Available in Postfix version 3.12 and later:
+/* .IP "\fBmilter_parallel_events (no)\fR"
+/*	Send each event to all Milter applications before receiving
+/*	their replies, instead of one application at a time.
+/* .IP "\fBmilter_latency_logging (no)\fR"
+/*	Log a per-Milter latency histogram when a Milter session ends.
+/* .IP "\fBmilter_connection_reuse (no)\fR"
+/*	Keep a Milter connection open for the next session in the same
+/*	process, when the Milter supports protocol version 6.
+/* .IP "\fBmilter_connection_cache_time_limit (10s)\fR"
+/*	The maximal time that an unused Milter connection is kept open.
 /* MIME PROCESSING CONTROLS
 /* .ad
 /* .fi
@@ -468,6 +480,12 @@
 /*	Convert body content that claims to be 8-bit into quoted-printable,
 /*	before header_checks, body_checks, Milters, and before after-queue
 /*	content filters.
+/* .PP
+/*	Available in Postfix 3.12 and later:
+/* .IP "\fBcleanup_group_commit (no)\fR"
+/*	Share file system sync operations between cleanup(8) processes,
+/*	instead of making each new queue file durable with its own
+/*	fsync() call.
 /* FILES
 /*	/etc/postfix/canonical*, canonical mapping table
 /*	/etc/postfix/virtual*, virtual mapping table
@@ -21,6 +21,7 @@
 #include <vstream.h>
 #include <argv.h>
 #include <nvtable.h>
+#include <marena.h>
 
  /*
   * Global library.
@@ -41,6 +42,31 @@
   */
 #include <milter.h>
 
+ /*
+  * Recipient batch index. Each entry describes a contiguous sequence of
+  * recipient record groups in the queue file. See REC_TYPE_RIDX_FORMAT.
+  */
+typedef struct CLEANUP_RCPT_BATCH {
+    off_t   start;			/* first recipient record group */
+    off_t   end;			/* after last recipient record group */
+    ssize_t count;			/* recipients in sequence */
+} CLEANUP_RCPT_BATCH;
+
+#define CLEANUP_RCPT_BATCH_SIZE	1000	/* recipients per batch */
+#define CLEANUP_RCPT_BATCH_LIMIT 10000	/* give up when fragmented */
+
+ /*
+  * Primary message header locations, so that Milter header edit requests
+  * don't have to rescan the queue file. The index is built on demand, and
+  * is updated after each header edit.
+  */
+typedef struct CLEANUP_HDR_ENTRY {
+    const char *name;			/* header label (arena) */
+    off_t   start;			/* first header record */
+    off_t   ptr_offset;			/* pointer record to start, or zero */
+    int     hide_mask;			/* matches MTA's own header(s) */
+} CLEANUP_HDR_ENTRY;
+
  /*
   * These state variables are accessed by many functions, and there is only
   * one instance of each per message.
@@ -51,13 +77,14 @@ typedef struct CLEANUP_STATE {
     VSTRING *temp2;			/* scratch buffer, local use only */
     VSTRING *temp3;			/* scratch buffer, local use only */
     VSTRING *stripped_buf;		/* character stripped input */
+    MARENA *arena;			/* storage for per-message strings */
     VSTREAM *src;			/* current input stream */
     VSTREAM *dst;			/* current output stream */
     MAIL_STREAM *handle;		/* mail stream handle */
-    char   *queue_name;			/* queue name */
-    char   *queue_id;			/* queue file basename */
+    char   *queue_name;			/* queue name (arena) */
+    char   *queue_id;			/* queue file basename (arena) */
     struct timeval arrival_time;	/* arrival time */
-    char   *fullname;			/* envelope sender full name */
+    char   *fullname;			/* envelope sender full name (arena) */
     char   *sender;			/* envelope sender address */
     char   *recip;			/* envelope recipient address */
     char   *orig_rcpt;			/* original recipient address */
@@ -88,6 +115,9 @@ typedef struct CLEANUP_STATE {
     off_t   append_meta_pt_offset;	/* append meta record here */
     off_t   append_meta_pt_target;	/* target of above record */
     ssize_t rcpt_count;			/* recipient count */
+    CLEANUP_RCPT_BATCH *rcpt_batch;	/* recipient batch index */
+    ssize_t rcpt_batch_len;		/* batches in use, -1 if disabled */
+    ssize_t rcpt_batch_size;		/* batches allocated */
     char   *reason;			/* failure reason */
     char   *smtp_reply;			/* failure reason, SMTP-style */
     NVTABLE *attr;			/* queue file attribute list */
@@ -96,12 +126,13 @@ typedef struct CLEANUP_STATE {
     char   *hdr_rewrite_context;	/* header rewrite context */
     char   *filter;			/* from header/body patterns */
     char   *redirect;			/* from header/body patterns */
-    char   *message_id;			/* from Message-ID header */
+    const char *priority;		/* from header/body patterns */
+    char   *message_id;			/* from Message-ID header (arena) */
     char   *dsn_envid;			/* DSN envelope ID */
     int     dsn_ret;			/* DSN full/hdrs */
     int     dsn_notify;			/* DSN never/delay/fail/success */
     char   *dsn_orcpt;			/* DSN original recipient */
-    char   *verp_delims;		/* VERP delimiters (optional) */
+    char   *verp_delims;		/* VERP delimiters (arena, optional) */
 #ifdef DELAY_ACTION
     int     defer_delay;		/* deferred delivery */
 #endif
@@ -129,6 +160,14 @@ typedef struct CLEANUP_STATE {
     struct CLEANUP_REGION *body_regions;/* regions with body content */
     struct CLEANUP_REGION *curr_body_region;
 
+    /*
+     * Support for Milter header edit requests.
+     */
+    CLEANUP_HDR_ENTRY *hdr_index;	/* primary header locations */
+    ssize_t hdr_index_len;		/* headers in use, -1 if not built */
+    ssize_t hdr_index_size;		/* headers allocated */
+    off_t   hdr_index_end;		/* after last primary header */
+
     /*
      * Internationalization, RequireTLS, etc.
      */
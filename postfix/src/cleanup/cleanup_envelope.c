@@ -105,7 +105,8 @@ void    cleanup_envelope(CLEANUP_STATE *state, int type,
 		       (REC_TYPE_SIZE_CAST3) 0,	/* recipient count */
 		       (REC_TYPE_SIZE_CAST4) 0,	/* qmgr options */
 		       (REC_TYPE_SIZE_CAST5) 0,	/* content length */
-		       (REC_TYPE_SIZE_CAST6) 0);	/* smtputf8 */
+		       (REC_TYPE_SIZE_CAST6) 0,	/* smtputf8 */
+		       (REC_TYPE_SIZE_CAST7) 0);	/* recipient index */
 
     /*
      * Pass control to the actual envelope processing routine.
@@ -383,7 +384,7 @@ static void cleanup_envelope_process(CLEANUP_STATE *state, int type,
     if (type == REC_TYPE_FULL) {
 	/* First instance wins. */
 	if (state->fullname == 0) {
-	    state->fullname = mystrdup(buf);
+	    state->fullname = marena_strdup(state->arena, buf);
 	    cleanup_out(state, type, buf, len);
 	}
 	return;
@@ -459,7 +460,7 @@ static void cleanup_envelope_process(CLEANUP_STATE *state, int type,
 		msg_warn("%s: ignoring bad VERP request: \"%.100s\"",
 			 state->queue_id, buf);
 	    } else {
-		state->verp_delims = mystrdup(buf);
+		state->verp_delims = marena_strdup(state->arena, buf);
 		cleanup_out(state, type, buf, len);
 	    }
 	}
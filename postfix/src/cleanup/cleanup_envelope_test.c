@@ -119,7 +119,8 @@ static int overrides_size_fields(const TEST_CASE *tp)
 		    (REC_TYPE_SIZE_CAST3) ~ 0,	/* recipient count */
 		    (REC_TYPE_SIZE_CAST4) ~ 0,	/* qmgr options */
 		    (REC_TYPE_SIZE_CAST5) ~ 0,	/* content length */
-		    (REC_TYPE_SIZE_CAST6) SOPT_FLAG_ALL);	/* sendopts */
+		    (REC_TYPE_SIZE_CAST6) SOPT_FLAG_ALL,	/* sendopts */
+		    (REC_TYPE_SIZE_CAST7) ~ 0);	/* recipient index */
 
     /*
      * Instantiate CLEANUP_STATE, and save information that isn't expected to
@@ -187,6 +187,9 @@ void    cleanup_extracted_process(CLEANUP_STATE *state, int type,
 	    cleanup_out_string(state, REC_TYPE_FILT, state->filter);
 	if (state->redirect != 0)
 	    cleanup_out_string(state, REC_TYPE_RDR, state->redirect);
+	if (state->priority != 0)
+	    cleanup_out_format(state, REC_TYPE_ATTR, "%s=%s",
+			       MAIL_ATTR_PRIORITY, state->priority);
 	if (state->message_id != 0) {
 	    cleanup_out_format(state, REC_TYPE_ATTR, "%s=%s",
 			       MAIL_ATTR_MESSAGE_ID, state->message_id);
@@ -11,6 +11,8 @@
 /* DESCRIPTION
 /*	cleanup_final() performs final queue file content (not
 /*	attribute) updates so that the file is ready to be closed.
+/*	With a message that has many recipients, this appends the
+/*	recipient batch index after the end-of-message marker.
 /* LICENSE
 /* .ad
 /* .fi
@@ -40,11 +42,38 @@
 
 #include "cleanup.h"
 
+/* cleanup_final_rcpt_index - append recipient batch index */
+
+static off_t cleanup_final_rcpt_index(CLEANUP_STATE *state)
+{
+    const char *myname = "cleanup_final_rcpt_index";
+    CLEANUP_RCPT_BATCH *bp;
+    off_t   index_offset;
+
+    /*
+     * Don't bother when the queue manager would read all recipients at once.
+     */
+    if (state->rcpt_count <= CLEANUP_RCPT_BATCH_SIZE
+	|| state->rcpt_batch_len <= 0)
+	return (0);
+    if ((index_offset = vstream_fseek(state->dst, (off_t) 0, SEEK_END)) < 0)
+	msg_fatal("%s: vstream_fseek %s: %m", myname, cleanup_path);
+    for (bp = state->rcpt_batch;
+	 bp < state->rcpt_batch + state->rcpt_batch_len; bp++)
+	cleanup_out_format(state, REC_TYPE_RIDX, REC_TYPE_RIDX_FORMAT,
+			   (long) bp->start, (long) bp->end, (long) bp->count);
+    if (msg_verbose)
+	msg_info("%s: %ld recipient batches at offset %ld", state->queue_id,
+		 (long) state->rcpt_batch_len, (long) index_offset);
+    return (index_offset);
+}
+
 /* cleanup_final - final queue file content updates */
 
 void    cleanup_final(CLEANUP_STATE *state)
 {
     const char *myname = "cleanup_final";
+    off_t   rcpt_index_offset;
 
     /*
      * vstream_fseek() would flush the buffer anyway, but the code just reads
@@ -62,6 +91,11 @@ void    cleanup_final(CLEANUP_STATE *state)
 	return;
     }
 
+    /*
+     * Append the recipient batch index.
+     */
+    rcpt_index_offset = cleanup_final_rcpt_index(state);
+
     /*
      * Update the preliminary message size and count fields with the actual
      * values.
@@ -74,5 +108,6 @@ void    cleanup_final(CLEANUP_STATE *state)
 		       (REC_TYPE_SIZE_CAST3) state->rcpt_count,
 		       (REC_TYPE_SIZE_CAST4) state->qmgr_opts,
 		       (REC_TYPE_SIZE_CAST5) state->cont_length,
-		       (REC_TYPE_SIZE_CAST6) state->sendopts);
+		       (REC_TYPE_SIZE_CAST6) state->sendopts,
+		       (REC_TYPE_SIZE_CAST7) rcpt_index_offset);
 }
@@ -97,6 +97,7 @@
 #include <name_code.h>
 #include <name_mask.h>
 #include <stringops.h>
+#include <set_eugid.h>
 
 /* Global library. */
 
@@ -106,6 +107,7 @@
 #include <ext_prop.h>
 #include <flush_clnt.h>
 #include <hfrom_format.h>
+#include <mail_stream.h>
 
 /* Application-specific. */
 
@@ -184,6 +186,7 @@ bool    var_force_mime_iconv;		/* force mime downgrade on input */
 bool    var_cleanup_mask_stray_cr_lf;	/* replace stray CR or LF with space */
 char   *var_non_empty_eoh_action;	/* handle non-empty header terminator */
 bool    var_reqtls_esmtp_hdr;
+bool    var_cleanup_group_commit;	/* share file system syncs */
 
 const CONFIG_INT_TABLE cleanup_int_table[] = {
     VAR_HOPCOUNT_LIMIT, DEF_HOPCOUNT_LIMIT, &var_hopcount_limit, 1, 0,
@@ -202,6 +205,7 @@ const CONFIG_BOOL_TABLE cleanup_bool_table[] = {
     VAR_ALWAYS_ADD_HDRS, DEF_ALWAYS_ADD_HDRS, &var_always_add_hdrs,
     VAR_FORCE_MIME_ICONV, DEF_FORCE_MIME_ICONV, &var_force_mime_iconv,
     VAR_CLEANUP_MASK_STRAY_CR_LF, DEF_CLEANUP_MASK_STRAY_CR_LF, &var_cleanup_mask_stray_cr_lf,
+    VAR_CLEANUP_GROUP_COMMIT, DEF_CLEANUP_GROUP_COMMIT, &var_cleanup_group_commit,
     0,
 };
 
@@ -454,6 +458,19 @@ void    cleanup_pre_jail(char *unused_name, char **unused_argv)
     if (*var_milt_head_checks)
 	cleanup_milter_header_checks_init();
 
+    /*
+     * The group commit coordination file lives outside the queue directory,
+     * so it must be opened before entering the chroot jail.
+     */
+    if (var_cleanup_group_commit) {
+	VSTRING *path = vstring_alloc(100);
+
+	vstring_sprintf(path, "%s/%s", var_data_dir, CLEANUP_GROUP_COMMIT_FILE);
+	SAVE_AND_SET_EUGID(var_owner_uid, var_owner_gid);
+	mail_stream_group_commit(vstring_str(path));
+	RESTORE_SAVED_EUGID();
+	vstring_free(path);
+    }
     flush_init();
 }
 
@@ -97,6 +97,7 @@
 #include <hfrom_format.h>
 #include <rfc2047_code.h>
 #include <sendopts.h>
+#include <mail_priority.h>
 
 /* Application-specific. */
 
@@ -298,6 +299,7 @@ static const char *cleanup_act(CLEANUP_STATE *state, char *context,
 {
     const char *optional_text = value + strcspn(value, " \t");
     int     command_len = optional_text - value;
+    int     priority;
 
 #ifdef DELAY_ACTION
     int     defer_delay;
@@ -362,6 +364,16 @@ static const char *cleanup_act(CLEANUP_STATE *state, char *context,
 	}
 	return (buf);
     }
+    if (STREQUAL(value, "PRIORITY", command_len)) {
+	if ((priority = mail_priority_from_string(optional_text)) < 0) {
+	    msg_warn("bad PRIORITY argument \"%s\" in %s map -- "
+		     "need high, normal or low", optional_text, map_class);
+	} else {
+	    state->priority = mail_priority_to_string(priority);
+	    cleanup_act_log(state, "priority", context, buf, optional_text);
+	}
+	return (buf);
+    }
     if (STREQUAL(value, "PASS", command_len)) {
 	cleanup_act_log(state, "pass", context, buf, optional_text);
 	state->flags &= ~CLEANUP_FLAG_FILTER_ALL;
@@ -639,7 +651,8 @@ static void cleanup_header_callback(void *context, int header_class,
 	    msg_info("%s: message-id=%s", state->queue_id, hdrval);
 	    if (state->message_id == 0 && (len = balpar(hdrval, "<>")) > 0)
 		/* This Message ID may end up in threaded bounces. */
-		state->message_id = printable(mystrndup(hdrval, len), ' ');
+		state->message_id =
+		    printable(marena_strndup(state->arena, hdrval, len), ' ');
 	}
 	if (hdr_opts->type == HDR_RESENT_MESSAGE_ID)
 	    msg_info("%s: resent-message-id=%s", state->queue_id, hdrval);
@@ -794,9 +807,11 @@ static void cleanup_header_done_callback(void *context)
 		 vstring_str(state->temp1));
 	state->headers_seen |= HDRS_SEEN_MASK(state->resent[0] ?
 				    HDR_RESENT_MESSAGE_ID : HDR_MESSAGE_ID);
-	if (state->resent[0] == 0 && state->message_id == 0)
-	    state->message_id = concatenate("<", vstring_str(state->temp1),
-					    ">", (char *) 0);
+	if (state->resent[0] == 0 && state->message_id == 0) {
+	    vstring_sprintf(state->temp2, "<%s>", vstring_str(state->temp1));
+	    state->message_id = marena_strdup(state->arena,
+					      vstring_str(state->temp2));
+	}
 
     }
     if ((state->headers_seen & HDRS_SEEN_MASK(HDR_MESSAGE_ID)) == 0)
@@ -200,7 +200,7 @@ static int test_action(const TEST_CASE *tp, const char *inputs[],
 	ret = FAIL;
     } else {
 	state = cleanup_state_alloc((VSTREAM *) 0);
-	state->queue_id = mystrdup("queue_id");
+	state->queue_id = marena_strdup(state->arena, "queue_id");
 	state->flags |= CLEANUP_FLAG_FILTER;
 	state->sender = mystrdup("sender");
 	state->recip = mystrdup("recip");
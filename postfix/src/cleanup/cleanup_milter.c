@@ -121,6 +121,7 @@
 #include <uxtext.h>
 #include <info_log_addr_form.h>
 #include <header_opts.h>
+#include <mail_priority.h>
 
 /* Application-specific. */
 
@@ -282,6 +283,7 @@ static char *cleanup_milter_hbc_extend(void *context, const char *command,
 {
     CLEANUP_STATE *state = (CLEANUP_STATE *) context;
     const char *map_class = VAR_MILT_HEAD_CHECKS;	/* XXX */
+    int     priority;
 
 #define STREQUAL(x,y,l) (strncasecmp((x), (y), (l)) == 0 && (y)[l] == 0)
 
@@ -389,6 +391,17 @@ static char *cleanup_milter_hbc_extend(void *context, const char *command,
 	}
 	return ((char *) buf);
     }
+    if (STREQUAL(command, "PRIORITY", cmd_len)) {
+	if ((priority = mail_priority_from_string(optional_text)) < 0) {
+	    msg_warn("bad PRIORITY argument \"%s\" in %s map -- "
+		     "need high, normal or low", optional_text, map_class);
+	} else {
+	    state->priority = mail_priority_to_string(priority);
+	    cleanup_milter_hbc_log(context, "priority", where, buf,
+				   optional_text);
+	}
+	return ((char *) buf);
+    }
     if (STREQUAL(command, "REDIRECT", cmd_len)) {
 	if (strchr(optional_text, '@') == 0) {
 	    msg_warn("bad REDIRECT target \"%s\" in %s map -- "
@@ -478,6 +491,9 @@ static void cleanup_milter_hbc_add_meta_records(CLEANUP_STATE *state)
 	cleanup_out_string(state, REC_TYPE_FILT, state->filter);
     if (state->redirect != 0)
 	cleanup_out_string(state, REC_TYPE_RDR, state->redirect);
+    if (state->priority != 0)
+	cleanup_out_format(state, REC_TYPE_ATTR, "%s=%s",
+			   MAIL_ATTR_PRIORITY, state->priority);
     if ((reverse_ptr_offset = vstream_ftell(state->dst)) < 0) {
 	msg_warn("%s: vstream_ftell file %s: %m", myname, cleanup_path);
 	state->errs |= CLEANUP_STAT_WRITE;
@@ -575,6 +591,7 @@ static void cleanup_milter_header_checks_reinit(CLEANUP_STATE *state)
     if (state->redirect)
 	myfree(state->redirect);
     state->redirect = 0;
+    state->priority = 0;
     VSTRING_RESET(cleanup_milter_hbc_reply);
 }
 
@@ -584,7 +601,7 @@ static void cleanup_milter_hbc_finish(CLEANUP_STATE *state)
 {
     if (CLEANUP_OUT_OK(state)
 	&& !CLEANUP_MILTER_REJECTING_OR_DISCARDING_MESSAGE(state)
-	&& (state->filter || state->redirect))
+	&& (state->filter || state->redirect || state->priority))
 	cleanup_milter_hbc_add_meta_records(state);
 }
 
@@ -654,6 +671,214 @@ static const char *cleanup_milter_error(CLEANUP_STATE *state, int err)
 				"%d %s %s", dp->smtp, dp->dsn, dp->text)));
 }
 
+/* hidden_header - respect milter header hiding protocol */
+
+static int hidden_header(int hide_mask, int *hide_done)
+{
+    int     mask;
+
+    /*
+     * Each bit in hide_mask corresponds to one MTA's own header. Use the
+     * first one that has not already been used.
+     */
+    if ((mask = hide_mask & ~*hide_done) == 0)
+	return (0);
+    return (*hide_done |= (mask & -mask));
+}
+
+/* cleanup_hdr_index_drop - forget primary header locations */
+
+static void cleanup_hdr_index_drop(CLEANUP_STATE *state)
+{
+    if (state->hdr_index) {
+	myfree((void *) state->hdr_index);
+	state->hdr_index = 0;
+    }
+    state->hdr_index_len = -1;
+    state->hdr_index_size = 0;
+    state->hdr_index_end = -1;
+}
+
+/* cleanup_hdr_index_text - length of first header record, or zero */
+
+static ssize_t cleanup_hdr_index_text(const char *text)
+{
+    ssize_t len;
+
+    /*
+     * The first queue file record of a header that was written with
+     * cleanup_out_header(). The record is not a primary header if it is
+     * empty, if it starts with whitespace, or if it has no header label.
+     */
+    if ((len = strlen(text)) > var_line_limit)
+	len = var_line_limit;
+    if (len == 0 || IS_SPACE_TAB(*text) || is_header_buf(text, len) == 0)
+	return (0);
+    return (len);
+}
+
+/* cleanup_hdr_index_set - fill in primary header location */
+
+static void cleanup_hdr_index_set(CLEANUP_STATE *state, ssize_t pos,
+				          const char *text, ssize_t len,
+				          off_t start, off_t ptr_offset)
+{
+    CLEANUP_HDR_ENTRY *ep = state->hdr_index + pos;
+    char  **cpp;
+    int     mask;
+
+    /*
+     * The hide mask has one bit for each MTA's own header that has the same
+     * first record. See hidden_header() for how it is used.
+     */
+    ep->name = marena_strndup(state->arena, text, is_header_buf(text, len));
+    ep->start = start;
+    ep->ptr_offset = ptr_offset;
+    for (ep->hide_mask = 0, cpp = state->auto_hdrs->argv, mask = 1;
+	 *cpp; cpp++, mask <<= 1)
+	if (strncmp(*cpp, text, len) == 0)
+	    ep->hide_mask |= mask;
+}
+
+/* cleanup_hdr_index_insert - make room for primary header location */
+
+static void cleanup_hdr_index_insert(CLEANUP_STATE *state, ssize_t pos,
+				             const char *text, ssize_t len,
+				             off_t start, off_t ptr_offset)
+{
+    if (state->hdr_index == 0) {
+	state->hdr_index_size = 10;
+	state->hdr_index = (CLEANUP_HDR_ENTRY *)
+	    mymalloc(state->hdr_index_size * sizeof(*state->hdr_index));
+    } else if (state->hdr_index_len >= state->hdr_index_size) {
+	state->hdr_index_size *= 2;
+	state->hdr_index = (CLEANUP_HDR_ENTRY *)
+	    myrealloc((void *) state->hdr_index,
+		      state->hdr_index_size * sizeof(*state->hdr_index));
+    }
+    memmove((void *) (state->hdr_index + pos + 1),
+	    (void *) (state->hdr_index + pos),
+	    (state->hdr_index_len - pos) * sizeof(*state->hdr_index));
+    state->hdr_index_len += 1;
+    cleanup_hdr_index_set(state, pos, text, len, start, ptr_offset);
+}
+
+/* cleanup_hdr_index_remove - forget one primary header location */
+
+static void cleanup_hdr_index_remove(CLEANUP_STATE *state, ssize_t pos)
+{
+    state->hdr_index_len -= 1;
+    memmove((void *) (state->hdr_index + pos),
+	    (void *) (state->hdr_index + pos + 1),
+	    (state->hdr_index_len - pos) * sizeof(*state->hdr_index));
+}
+
+ /*
+  * XXX We can't use the MIME processor here. It not only buffers up the
+  * input, it also reads the record that follows a complete header before it
+  * invokes the header call-back action. This complicates the way that we
+  * discover header offsets and boundaries. Worse is that the MIME processor
+  * is unaware that multi-record message headers can have PTR records in the
+  * middle.
+  * 
+  * XXX The draw-back of not using the MIME processor is that we have to
+  * duplicate some of its logic here. To minimize the duplication we define
+  * an ugly macro that is used in all code that scans for header boundaries.
+  */
+#define GET_NEXT_TEXT_OR_PTR_RECORD(rec_type, state, buf, curr_offset, quit) \
+    if ((rec_type = rec_get_raw(state->dst, buf, 0, REC_FLAG_NONE)) < 0) { \
+	msg_warn("%s: read file %s: %m", myname, cleanup_path); \
+	cleanup_milter_set_error(state, errno); \
+	do { quit; } while (0); \
+    } \
+    if (msg_verbose > 1) \
+	msg_info("%s: read: %ld: %.*s", myname, (long) curr_offset, \
+		 LEN(buf) > 30 ? 30 : (int) LEN(buf), STR(buf)); \
+    if (rec_type == REC_TYPE_DTXT) \
+	continue; \
+    if (rec_type != REC_TYPE_NORM && rec_type != REC_TYPE_CONT \
+	&& rec_type != REC_TYPE_PTR) \
+	break;
+ /* End of hairy macros. */
+
+/* cleanup_hdr_index_build - scan queue file for primary headers */
+
+static int cleanup_hdr_index_build(CLEANUP_STATE *state)
+{
+    const char *myname = "cleanup_hdr_index_build";
+    VSTRING *buf = vstring_alloc(100);
+    off_t   curr_offset;		/* offset of current record */
+    off_t   ptr_offset;			/* pointer to current record */
+    int     rec_type;
+    int     last_type;
+
+#define CLEANUP_HDR_INDEX_BUILD_RETURN(ret) do { \
+	vstring_free(buf); \
+	return (ret); \
+    } while (0)
+
+    /*
+     * Skip to the start of the message content, and read records until we
+     * hit the end of the primary message headers. Remember where each header
+     * starts, and the last pointer record that was followed before reaching
+     * that header. The index is updated after each header edit, so that we
+     * don't have to scan the queue file again.
+     */
+    cleanup_hdr_index_drop(state);
+    state->hdr_index_len = 0;
+    if (vstream_fseek(state->dst, state->data_offset, SEEK_SET) < 0) {
+	msg_warn("%s: seek file %s: %m", myname, cleanup_path);
+	cleanup_milter_set_error(state, errno);
+	CLEANUP_HDR_INDEX_BUILD_RETURN(-1);
+    }
+    for (ptr_offset = 0, last_type = 0; /* void */ ; /* void */ ) {
+	if ((curr_offset = vstream_ftell(state->dst)) < 0) {
+	    msg_warn("%s: vstream_ftell file %s: %m", myname, cleanup_path);
+	    cleanup_milter_set_error(state, errno);
+	    CLEANUP_HDR_INDEX_BUILD_RETURN(-1);
+	}
+	/* Don't follow the "append header" pointer. */
+	if (curr_offset == state->append_hdr_pt_offset)
+	    break;
+	/* Caution: this macro terminates the loop at end-of-message. */
+	/* Don't do complex processing while breaking out of this loop. */
+	GET_NEXT_TEXT_OR_PTR_RECORD(rec_type, state, buf, curr_offset,
+				    CLEANUP_HDR_INDEX_BUILD_RETURN(-1));
+	/* Caution: don't assume ptr->header. This may be header-ptr->body. */
+	if (rec_type == REC_TYPE_PTR) {
+	    if (rec_goto(state->dst, STR(buf)) < 0) {
+		msg_warn("%s: read file %s: %m", myname, cleanup_path);
+		cleanup_milter_set_error(state, errno);
+		CLEANUP_HDR_INDEX_BUILD_RETURN(-1);
+	    }
+	    /* Save PTR record, in case it points to the start of a header. */
+	    ptr_offset = curr_offset;
+	    /* Don't update last_type; PTR can happen after REC_TYPE_CONT. */
+	    continue;
+	}
+	/* The middle of a multi-record header. */
+	else if (last_type == REC_TYPE_CONT || IS_SPACE_TAB(STR(buf)[0])) {
+	    /* Reset the saved PTR record and update last_type. */
+	}
+	/* No more message headers. */
+	else if (is_header(STR(buf)) == 0) {
+	    break;
+	}
+	/* This the start of a message header. */
+	else {
+	    cleanup_hdr_index_insert(state, state->hdr_index_len, STR(buf),
+				     LEN(buf), curr_offset, ptr_offset);
+	}
+	ptr_offset = 0;
+	last_type = rec_type;
+    }
+    state->hdr_index_end = curr_offset;
+    if (msg_verbose)
+	msg_info("%s: %ld headers end %ld", myname,
+		 (long) state->hdr_index_len, (long) state->hdr_index_end);
+    CLEANUP_HDR_INDEX_BUILD_RETURN(0);
+}
+
 /* cleanup_add_header - append message header */
 
 static const char *cleanup_add_header(void *context, const char *name,
@@ -665,6 +890,7 @@ static const char *cleanup_add_header(void *context, const char *name,
     VSTRING *buf;
     off_t   reverse_ptr_offset;
     off_t   new_hdr_offset;
+    ssize_t new_hdr_len;
 
     /*
      * To simplify implementation, the cleanup server writes a dummy "header
@@ -710,9 +936,10 @@ static const char *cleanup_add_header(void *context, const char *name,
     }
     /* XXX emit prepended header, then clear it. */
     cleanup_out_header(state, buf);		/* Includes padding */
-    vstring_free(buf);
+    new_hdr_len = cleanup_hdr_index_text(STR(buf));
     if ((reverse_ptr_offset = vstream_ftell(state->dst)) < 0) {
 	msg_warn("%s: vstream_ftell file %s: %m", myname, cleanup_path);
+	vstring_free(buf);
 	return (cleanup_milter_error(state, errno));
     }
     cleanup_out_format(state, REC_TYPE_PTR, REC_TYPE_PTR_FORMAT,
@@ -730,11 +957,30 @@ static const char *cleanup_add_header(void *context, const char *name,
      */
     if (vstream_fseek(state->dst, state->append_hdr_pt_offset, SEEK_SET) < 0) {
 	msg_warn("%s: seek file %s: %m", myname, cleanup_path);
+	vstring_free(buf);
 	return (cleanup_milter_error(state, errno));
     }
     cleanup_out_format(state, REC_TYPE_PTR, REC_TYPE_PTR_FORMAT,
 		       (long) new_hdr_offset);
 
+    /*
+     * Update the primary header index, if the new header is reachable from
+     * the last primary header. After cleanup_out_header(), the buffer holds
+     * the new header's first line.
+     */
+    if (state->hdr_index_len >= 0) {
+	if (CLEANUP_OUT_OK(state) == 0 || new_hdr_len == 0) {
+	    cleanup_hdr_index_drop(state);
+	} else if (state->hdr_index_end == state->append_hdr_pt_offset) {
+	    cleanup_hdr_index_insert(state, state->hdr_index_len,
+				     STR(buf), new_hdr_len,
+				     new_hdr_offset,
+				     state->append_hdr_pt_offset);
+	    state->hdr_index_end = reverse_ptr_offset;
+	}
+    }
+    vstring_free(buf);
+
     /*
      * Update the in-memory "header append" pointer record location with the
      * location of the reverse pointer record that follows the new header.
@@ -756,34 +1002,20 @@ static const char *cleanup_add_header(void *context, const char *name,
      */
 }
 
-/* hidden_header - respect milter header hiding protocol */
-
-static int hidden_header(VSTRING *buf, ARGV *auto_hdrs, int *hide_done)
-{
-    char  **cpp;
-    int     mask;
-
-    for (cpp = auto_hdrs->argv, mask = 1; *cpp; cpp++, mask <<= 1)
-	if ((*hide_done & mask) == 0 && strncmp(*cpp, STR(buf), LEN(buf)) == 0)
-	    return (*hide_done |= mask);
-    return (0);
-}
-
 /* cleanup_find_header_start - find specific header instance */
 
 static off_t cleanup_find_header_start(CLEANUP_STATE *state, ssize_t index,
 				               const char *header_label,
 				               VSTRING *buf,
 				               int *prec_type,
-				               int allow_ptr_backup)
+				               int allow_ptr_backup,
+				               ssize_t *hdr_pos)
 {
     const char *myname = "cleanup_find_header_start";
-    off_t   curr_offset;		/* offset after found record */
-    off_t   ptr_offset;			/* pointer to found record */
-    VSTRING *ptr_buf = 0;
-    int     rec_type = REC_TYPE_ERROR;
-    int     last_type;
-    ssize_t len;
+    CLEANUP_HDR_ENTRY *ep;
+    off_t   curr_offset;
+    int     rec_type;
+    int     pad_type;
     int     hide_done = 0;
 
     if (msg_verbose)
@@ -797,20 +1029,20 @@ static off_t cleanup_find_header_start(CLEANUP_STATE *state, ssize_t index,
 	msg_panic("%s: bad header index %ld", myname, (long) index);
 
     /*
-     * Skip to the start of the message content, and read records until we
-     * either find the specified header, or until we hit the end of the
-     * headers.
+     * Look up the specified header in the primary header index, and build
+     * the index if this is the first header edit request.
      * 
      * The index specifies the header instance: 1 is the first one. The header
      * label specifies the header name. A null pointer matches any header.
      * 
      * When the specified header is not found, the result value is -1.
      * 
-     * When the specified header is found, its first record is stored in the
-     * caller-provided read buffer, and the result value is the queue file
-     * offset of that record. The file read position is left at the start of
-     * the next (non-filler) queue file record, which can be the remainder of
-     * a multi-record header.
+     * When the specified header is found, the result value is the queue file
+     * offset of its first record, and *hdr_pos is its position in the
+     * primary header index. If buf is not a null pointer, that record is
+     * stored in the caller-provided read buffer, and the file read position
+     * is left at the start of the next (non-filler) queue file record, which
+     * can be the remainder of a multi-record header.
      * 
      * When a header is found and allow_ptr_backup is non-zero, then the result
      * is either the first record of that header, or it is the pointer record
@@ -819,18 +1051,6 @@ static off_t cleanup_find_header_start(CLEANUP_STATE *state, ssize_t index,
      * to do some optimizations when inserting text multiple times at the
      * same place.
      * 
-     * XXX We can't use the MIME processor here. It not only buffers up the
-     * input, it also reads the record that follows a complete header before
-     * it invokes the header call-back action. This complicates the way that
-     * we discover header offsets and boundaries. Worse is that the MIME
-     * processor is unaware that multi-record message headers can have PTR
-     * records in the middle.
-     * 
-     * XXX The draw-back of not using the MIME processor is that we have to
-     * duplicate some of its logic here and in the routine that finds the end
-     * of the header record. To minimize the duplication we define an ugly
-     * macro that is used in all code that scans for header boundaries.
-     * 
      * XXX Sendmail compatibility (based on Sendmail 8.13.6 measurements).
      * 
      * - When changing Received: header #1, we change the Received: header that
@@ -860,178 +1080,94 @@ static off_t cleanup_find_header_start(CLEANUP_STATE *state, ssize_t index,
 #define CLEANUP_FIND_HEADER_NOTFOUND	(-1)
 #define CLEANUP_FIND_HEADER_IOERROR	(-2)
 
-#define CLEANUP_FIND_HEADER_RETURN(offs) do { \
-	if (ptr_buf) \
-	    vstring_free(ptr_buf); \
-	return (offs); \
-    } while (0)
-
-#define GET_NEXT_TEXT_OR_PTR_RECORD(rec_type, state, buf, curr_offset, quit) \
-    if ((rec_type = rec_get_raw(state->dst, buf, 0, REC_FLAG_NONE)) < 0) { \
-	msg_warn("%s: read file %s: %m", myname, cleanup_path); \
-	cleanup_milter_set_error(state, errno); \
-	do { quit; } while (0); \
-    } \
-    if (msg_verbose > 1) \
-	msg_info("%s: read: %ld: %.*s", myname, (long) curr_offset, \
-		 LEN(buf) > 30 ? 30 : (int) LEN(buf), STR(buf)); \
-    if (rec_type == REC_TYPE_DTXT) \
-	continue; \
-    if (rec_type != REC_TYPE_NORM && rec_type != REC_TYPE_CONT \
-	&& rec_type != REC_TYPE_PTR) \
-	break;
-    /* End of hairy macros. */
-
-    if (vstream_fseek(state->dst, state->data_offset, SEEK_SET) < 0) {
-	msg_warn("%s: seek file %s: %m", myname, cleanup_path);
-	cleanup_milter_set_error(state, errno);
-	CLEANUP_FIND_HEADER_RETURN(CLEANUP_FIND_HEADER_IOERROR);
+    if (state->hdr_index_len < 0 && cleanup_hdr_index_build(state) < 0) {
+	cleanup_hdr_index_drop(state);
+	return (CLEANUP_FIND_HEADER_IOERROR);
     }
-    for (ptr_offset = 0, last_type = 0; /* void */ ; /* void */ ) {
-	if ((curr_offset = vstream_ftell(state->dst)) < 0) {
-	    msg_warn("%s: vstream_ftell file %s: %m", myname, cleanup_path);
-	    cleanup_milter_set_error(state, errno);
-	    CLEANUP_FIND_HEADER_RETURN(CLEANUP_FIND_HEADER_IOERROR);
-	}
-	/* Don't follow the "append header" pointer. */
-	if (curr_offset == state->append_hdr_pt_offset)
-	    break;
-	/* Caution: this macro terminates the loop at end-of-message. */
-	/* Don't do complex processing while breaking out of this loop. */
-	GET_NEXT_TEXT_OR_PTR_RECORD(rec_type, state, buf, curr_offset,
-		   CLEANUP_FIND_HEADER_RETURN(CLEANUP_FIND_HEADER_IOERROR));
-	/* Caution: don't assume ptr->header. This may be header-ptr->body. */
-	if (rec_type == REC_TYPE_PTR) {
-	    if (rec_goto(state->dst, STR(buf)) < 0) {
-		msg_warn("%s: read file %s: %m", myname, cleanup_path);
-		cleanup_milter_set_error(state, errno);
-		CLEANUP_FIND_HEADER_RETURN(CLEANUP_FIND_HEADER_IOERROR);
-	    }
-	    /* Save PTR record, in case it points to the start of a header. */
-	    if (allow_ptr_backup) {
-		ptr_offset = curr_offset;
-		if (ptr_buf == 0)
-		    ptr_buf = vstring_alloc(100);
-		vstring_strcpy(ptr_buf, STR(buf));
-	    }
-	    /* Don't update last_type; PTR can happen after REC_TYPE_CONT. */
-	    continue;
-	}
-	/* The middle of a multi-record header. */
-	else if (last_type == REC_TYPE_CONT || IS_SPACE_TAB(STR(buf)[0])) {
-	    /* Reset the saved PTR record and update last_type. */
+    for (ep = state->hdr_index; /* see below */ ; ep++) {
+	if (ep >= state->hdr_index + state->hdr_index_len) {
+	    if (msg_verbose)
+		msg_info("%s: index %ld name %s not found", myname, (long) index,
+			 header_label ? header_label : "(none)");
+	    return (CLEANUP_FIND_HEADER_NOTFOUND);
 	}
-	/* No more message headers. */
-	else if ((len = is_header(STR(buf))) == 0) {
-	    break;
-	}
-	/* This the start of a message header. */
-	else if ((header_label == 0
-		  || (strncasecmp(header_label, STR(buf), len) == 0
-		      && strlen(header_label) == len
-		      && !hidden_header(buf, state->auto_hdrs, &hide_done)))
-		 && --index == 0) {
-	    /* If we have a saved PTR record, it points to start of header. */
+	if ((header_label == 0
+	     || (strcasecmp(header_label, ep->name) == 0
+		 && !hidden_header(ep->hide_mask, &hide_done)))
+	    && --index == 0)
 	    break;
-	}
-	ptr_offset = 0;
-	last_type = rec_type;
     }
+    *hdr_pos = ep - state->hdr_index;
 
     /*
-     * In case of failure, return negative start position.
+     * Optionally return a pointer to the message header, instead of the start
+     * of the message header itself.
      */
-    if (index > 0) {
-	curr_offset = CLEANUP_FIND_HEADER_NOTFOUND;
+    if (allow_ptr_backup && ep->ptr_offset != 0) {
+	curr_offset = ep->ptr_offset;
     } else {
+	curr_offset = ep->start;
+    }
 
-	/*
-	 * Skip over short-header padding, so that the file read pointer is
-	 * always positioned at the first non-padding record after the header
-	 * record. Insist on padding after short a header record, so that a
-	 * short header record can safely be overwritten by a pointer record.
-	 */
-	if (LEN(buf) < REC_TYPE_PTR_PAYL_SIZE) {
-	    VSTRING *rbuf = (ptr_offset ? buf :
-			     (ptr_buf ? ptr_buf :
-			      (ptr_buf = vstring_alloc(100))));
-	    int     rval;
-
-	    if ((rval = rec_get_raw(state->dst, rbuf, 0, REC_FLAG_NONE)) < 0) {
-		cleanup_milter_set_error(state, errno);
-		CLEANUP_FIND_HEADER_RETURN(CLEANUP_FIND_HEADER_IOERROR);
-	    }
-	    if (rval != REC_TYPE_DTXT)
-		msg_panic("%s: short header without padding", myname);
+    /*
+     * Optionally read the record. Skip over short-header padding, so that
+     * the file read pointer is always positioned at the first non-padding
+     * record after the header record. Insist on padding after short a header
+     * record, so that a short header record can safely be overwritten by a
+     * pointer record.
+     */
+    if (buf != 0) {
+	if (vstream_fseek(state->dst, curr_offset, SEEK_SET) < 0) {
+	    msg_warn("%s: seek file %s: %m", myname, cleanup_path);
+	    cleanup_milter_set_error(state, errno);
+	    return (CLEANUP_FIND_HEADER_IOERROR);
 	}
-
-	/*
-	 * Optionally return a pointer to the message header, instead of the
-	 * start of the message header itself. In that case the file read
-	 * position is undefined (actually it is at the first non-padding
-	 * record that follows the message header record).
-	 */
-	if (ptr_offset != 0) {
-	    rec_type = REC_TYPE_PTR;
-	    curr_offset = ptr_offset;
-	    vstring_strcpy(buf, STR(ptr_buf));
+	if ((rec_type = rec_get_raw(state->dst, buf, 0, REC_FLAG_NONE)) < 0) {
+	    msg_warn("%s: read file %s: %m", myname, cleanup_path);
+	    cleanup_milter_set_error(state, errno);
+	    return (CLEANUP_FIND_HEADER_IOERROR);
+	}
+	if (curr_offset == ep->ptr_offset) {
+	    if (rec_type != REC_TYPE_PTR)
+		msg_panic("%s: no pointer record at offset %ld",
+			  myname, (long) curr_offset);
+	} else {
+	    if (rec_type != REC_TYPE_NORM && rec_type != REC_TYPE_CONT)
+		msg_panic("%s: no header record at offset %ld",
+			  myname, (long) curr_offset);
+	    if (LEN(buf) < REC_TYPE_PTR_PAYL_SIZE) {
+		if ((pad_type = rec_get_raw(state->dst, state->temp1, 0,
+					    REC_FLAG_NONE)) < 0) {
+		    msg_warn("%s: read file %s: %m", myname, cleanup_path);
+		    cleanup_milter_set_error(state, errno);
+		    return (CLEANUP_FIND_HEADER_IOERROR);
+		}
+		if (pad_type != REC_TYPE_DTXT)
+		    msg_panic("%s: short header without padding", myname);
+	    }
 	}
 	*prec_type = rec_type;
     }
     if (msg_verbose)
-	msg_info("%s: index %ld name %s type %d offset %ld",
-		 myname, (long) index, header_label ?
-		 header_label : "(none)", rec_type, (long) curr_offset);
-
-    CLEANUP_FIND_HEADER_RETURN(curr_offset);
+	msg_info("%s: index %ld name %s offset %ld",
+		 myname, (long) *hdr_pos, header_label ?
+		 header_label : "(none)", (long) curr_offset);
+    return (curr_offset);
 }
 
 /* cleanup_find_header_end - find end of header */
 
-static off_t cleanup_find_header_end(CLEANUP_STATE *state,
-				             VSTRING *rec_buf,
-				             int last_type)
+static off_t cleanup_find_header_end(CLEANUP_STATE *state, ssize_t hdr_pos)
 {
-    const char *myname = "cleanup_find_header_end";
-    off_t   read_offset;
-    int     rec_type;
 
     /*
-     * This routine is called immediately after cleanup_find_header_start().
-     * rec_buf is the cleanup_find_header_start() result record; last_type is
-     * the corresponding record type: REC_TYPE_PTR or REC_TYPE_NORM; the file
-     * read position is at the first non-padding record after the result
-     * header record.
+     * A primary header ends where the next one starts. The last one ends
+     * where the scan for primary headers stopped.
      */
-    for (;;) {
-	if ((read_offset = vstream_ftell(state->dst)) < 0) {
-	    msg_warn("%s: read file %s: %m", myname, cleanup_path);
-	    cleanup_milter_error(state, errno);
-	    return (-1);
-	}
-	/* Don't follow the "append header" pointer. */
-	if (read_offset == state->append_hdr_pt_offset)
-	    break;
-	/* Caution: this macro terminates the loop at end-of-message. */
-	/* Don't do complex processing while breaking out of this loop. */
-	GET_NEXT_TEXT_OR_PTR_RECORD(rec_type, state, rec_buf, read_offset,
-	/* Warning and errno->error mapping are done elsewhere. */
-				    return (-1));
-	if (rec_type == REC_TYPE_PTR) {
-	    if (rec_goto(state->dst, STR(rec_buf)) < 0) {
-		msg_warn("%s: read file %s: %m", myname, cleanup_path);
-		cleanup_milter_error(state, errno);
-		return (-1);
-	    }
-	    /* Don't update last_type; PTR may follow REC_TYPE_CONT. */
-	    continue;
-	}
-	/* Start of header or message body. */
-	if (last_type != REC_TYPE_CONT && !IS_SPACE_TAB(STR(rec_buf)[0]))
-	    break;
-	last_type = rec_type;
-    }
-    return (read_offset);
+    if (hdr_pos + 1 < state->hdr_index_len)
+	return (state->hdr_index[hdr_pos + 1].start);
+    else
+	return (state->hdr_index_end);
 }
 
 /* cleanup_patch_header - patch new header into an existing header */
@@ -1043,11 +1179,15 @@ static const char *cleanup_patch_header(CLEANUP_STATE *state,
 					        off_t old_rec_offset,
 					        int old_rec_type,
 					        VSTRING *old_rec_buf,
-					        off_t next_offset)
+					        off_t next_offset,
+					        ssize_t hdr_pos)
 {
     const char *myname = "cleanup_patch_header";
     VSTRING *buf = vstring_alloc(100);
     off_t   new_hdr_offset;
+    off_t   saved_rec_offset;
+    off_t   reverse_ptr_offset;
+    ssize_t new_hdr_len;
 
 #define CLEANUP_PATCH_HEADER_RETURN(ret) do { \
 	vstring_free(buf); \
@@ -1077,6 +1217,10 @@ static const char *cleanup_patch_header(CLEANUP_STATE *state,
      * 
      * next_offset specifies the record that follows the to-be-overwritten
      * record. It is ignored when the to-be-saved record is a pointer record.
+     * 
+     * hdr_pos specifies the primary header index position of the header that
+     * is replaced (old_rec_type is zero) or that the new header is inserted
+     * before (old_rec_type is non-zero).
      */
 
     /*
@@ -1098,9 +1242,14 @@ static const char *cleanup_patch_header(CLEANUP_STATE *state,
     }
     /* XXX emit prepended header, then clear it. */
     cleanup_out_header(state, buf);		/* Includes padding */
+    new_hdr_len = cleanup_hdr_index_text(STR(buf));
     if (msg_verbose > 1)
 	msg_info("%s: %ld: write %.*s", myname, (long) new_hdr_offset,
 		 LEN(buf) > 30 ? 30 : (int) LEN(buf), STR(buf));
+    if ((saved_rec_offset = vstream_ftell(state->dst)) < 0) {
+	msg_warn("%s: vstream_ftell file %s: %m", myname, cleanup_path);
+	CLEANUP_PATCH_HEADER_RETURN(cleanup_milter_error(state, errno));
+    }
 
     /*
      * Optionally, save the existing text record or pointer record that will
@@ -1122,6 +1271,10 @@ static const char *cleanup_patch_header(CLEANUP_STATE *state,
      * after the saved records. A reverse pointer value of -1 means we were
      * confused about what we were going to save.
      */
+    if ((reverse_ptr_offset = vstream_ftell(state->dst)) < 0) {
+	msg_warn("%s: vstream_ftell file %s: %m", myname, cleanup_path);
+	CLEANUP_PATCH_HEADER_RETURN(cleanup_milter_error(state, errno));
+    }
     if (old_rec_type != REC_TYPE_PTR) {
 	if (next_offset < 0)
 	    msg_panic("%s: bad reverse pointer %ld",
@@ -1148,6 +1301,36 @@ static const char *cleanup_patch_header(CLEANUP_STATE *state,
 	msg_info("%s: %ld: write PTR %ld", myname, (long) old_rec_offset,
 		 (long) new_hdr_offset);
 
+    /*
+     * Update the primary header index. The new header is reached through
+     * the forward pointer. An inserted-before header is reached through the
+     * saved record, and the header after a patched text record is reached
+     * through the reverse pointer.
+     */
+#define HDR_INDEX_HAS(state, pos) ((pos) < (state)->hdr_index_len)
+
+    if (CLEANUP_OUT_OK(state) == 0 || new_hdr_len == 0) {
+	cleanup_hdr_index_drop(state);
+    } else if (old_rec_type == 0) {		/* replace */
+	cleanup_hdr_index_set(state, hdr_pos, STR(buf), new_hdr_len,
+			      new_hdr_offset, old_rec_offset);
+	if (HDR_INDEX_HAS(state, hdr_pos + 1)
+	    && state->hdr_index[hdr_pos + 1].start == next_offset)
+	    state->hdr_index[hdr_pos + 1].ptr_offset = reverse_ptr_offset;
+    } else if (old_rec_type == REC_TYPE_PTR) {	/* insert before pointer */
+	cleanup_hdr_index_insert(state, hdr_pos, STR(buf), new_hdr_len,
+				 new_hdr_offset, old_rec_offset);
+	state->hdr_index[hdr_pos + 1].ptr_offset = saved_rec_offset;
+    } else {					/* insert before text */
+	cleanup_hdr_index_insert(state, hdr_pos, STR(buf), new_hdr_len,
+				 new_hdr_offset, old_rec_offset);
+	state->hdr_index[hdr_pos + 1].start = saved_rec_offset;
+	state->hdr_index[hdr_pos + 1].ptr_offset = 0;
+	if (HDR_INDEX_HAS(state, hdr_pos + 2)
+	    && state->hdr_index[hdr_pos + 2].start == next_offset)
+	    state->hdr_index[hdr_pos + 2].ptr_offset = reverse_ptr_offset;
+    }
+
     /*
      * In case of error while doing record output.
      */
@@ -1174,6 +1357,7 @@ static const char *cleanup_ins_header(void *context, ssize_t index,
     off_t   old_rec_offset;
     int     old_rec_type;
     off_t   next_offset;
+    ssize_t hdr_pos;
     const char *ret;
 
 #define CLEANUP_INS_HEADER_RETURN(ret) do { \
@@ -1200,7 +1384,7 @@ static const char *cleanup_ins_header(void *context, ssize_t index,
 	index = 1;
     old_rec_offset = cleanup_find_header_start(state, index, NO_HEADER_NAME,
 					       old_rec_buf, &old_rec_type,
-					       ALLOW_PTR_BACKUP);
+					       ALLOW_PTR_BACKUP, &hdr_pos);
     if (old_rec_offset == CLEANUP_FIND_HEADER_IOERROR)
 	/* Warning and errno->error mapping are done elsewhere. */
 	CLEANUP_INS_HEADER_RETURN(cleanup_milter_error(state, 0));
@@ -1229,7 +1413,7 @@ static const char *cleanup_ins_header(void *context, ssize_t index,
     }
     ret = cleanup_patch_header(state, new_hdr_name, hdr_space, new_hdr_value,
 			       old_rec_offset, old_rec_type,
-			       old_rec_buf, next_offset);
+			       old_rec_buf, next_offset, hdr_pos);
     CLEANUP_INS_HEADER_RETURN(ret);
 }
 
@@ -1242,11 +1426,9 @@ static const char *cleanup_upd_header(void *context, ssize_t index,
 {
     const char *myname = "cleanup_upd_header";
     CLEANUP_STATE *state = (CLEANUP_STATE *) context;
-    VSTRING *rec_buf;
     off_t   old_rec_offset;
     off_t   next_offset;
-    int     last_type;
-    const char *ret;
+    ssize_t hdr_pos;
 
     if (msg_verbose)
 	msg_info("%s: %ld \"%s\" \"%s\"",
@@ -1266,45 +1448,37 @@ static const char *cleanup_upd_header(void *context, ssize_t index,
      * Index 1 is the first matching header instance.
      * 
      * XXX When a header is updated repeatedly we create jumps to jumps. To
-     * eliminate this, rewrite the loop below so that we can start with the
-     * pointer record that points to the header that's being edited.
+     * eliminate this, start with the pointer record that points to the
+     * header that's being edited.
      */
 #define DONT_SAVE_RECORD	0
 #define NO_PTR_BACKUP		0
+#define NO_RECORD_BUF		((VSTRING *) 0)
 
-#define CLEANUP_UPD_HEADER_RETURN(ret) do { \
-	vstring_free(rec_buf); \
-	return (ret); \
-    } while (0)
-
-    rec_buf = vstring_alloc(100);
     old_rec_offset = cleanup_find_header_start(state, index, new_hdr_name,
-					       rec_buf, &last_type,
-					       NO_PTR_BACKUP);
+					       NO_RECORD_BUF, (int *) 0,
+					       NO_PTR_BACKUP, &hdr_pos);
     if (old_rec_offset == CLEANUP_FIND_HEADER_IOERROR)
 	/* Warning and errno->error mapping are done elsewhere. */
-	CLEANUP_UPD_HEADER_RETURN(cleanup_milter_error(state, 0));
+	return (cleanup_milter_error(state, 0));
 
     /*
      * If no old header is found, simply append the new header to the linked
      * list at the "header append" pointer record.
      */
     if (old_rec_offset < 0)
-	CLEANUP_UPD_HEADER_RETURN(cleanup_add_header(context, new_hdr_name,
-						 hdr_space, new_hdr_value));
+	return (cleanup_add_header(context, new_hdr_name, hdr_space,
+				   new_hdr_value));
 
     /*
      * If the old header is found, find the end of the old header, save the
      * new header to new storage at the end of the queue file, and link the
      * new storage with a forward and reverse pointer.
      */
-    if ((next_offset = cleanup_find_header_end(state, rec_buf, last_type)) < 0)
-	/* Warning and errno->error mapping are done elsewhere. */
-	CLEANUP_UPD_HEADER_RETURN(cleanup_milter_error(state, 0));
-    ret = cleanup_patch_header(state, new_hdr_name, hdr_space, new_hdr_value,
-			       old_rec_offset, DONT_SAVE_RECORD,
-			       (VSTRING *) 0, next_offset);
-    CLEANUP_UPD_HEADER_RETURN(ret);
+    next_offset = cleanup_find_header_end(state, hdr_pos);
+    return (cleanup_patch_header(state, new_hdr_name, hdr_space, new_hdr_value,
+				 old_rec_offset, DONT_SAVE_RECORD,
+				 (VSTRING *) 0, next_offset, hdr_pos));
 }
 
 /* cleanup_del_header - delete message header */
@@ -1314,10 +1488,9 @@ static const char *cleanup_del_header(void *context, ssize_t index,
 {
     const char *myname = "cleanup_del_header";
     CLEANUP_STATE *state = (CLEANUP_STATE *) context;
-    VSTRING *rec_buf;
     off_t   header_offset;
     off_t   next_offset;
-    int     last_type;
+    ssize_t hdr_pos;
 
     if (msg_verbose)
 	msg_info("%s: %ld \"%s\"", myname, (long) index, hdr_name);
@@ -1335,17 +1508,12 @@ static const char *cleanup_del_header(void *context, ssize_t index,
      * 
      * Index 1 is the first matching header instance.
      */
-#define CLEANUP_DEL_HEADER_RETURN(ret) do { \
-	vstring_free(rec_buf); \
-	return (ret); \
-    } while (0)
-
-    rec_buf = vstring_alloc(100);
-    header_offset = cleanup_find_header_start(state, index, hdr_name, rec_buf,
-					      &last_type, NO_PTR_BACKUP);
+    header_offset = cleanup_find_header_start(state, index, hdr_name,
+					      NO_RECORD_BUF, (int *) 0,
+					      NO_PTR_BACKUP, &hdr_pos);
     if (header_offset == CLEANUP_FIND_HEADER_IOERROR)
 	/* Warning and errno->error mapping are done elsewhere. */
-	CLEANUP_DEL_HEADER_RETURN(cleanup_milter_error(state, 0));
+	return (cleanup_milter_error(state, 0));
 
     /*
      * Overwrite the beginning of the header record with a pointer to the
@@ -1354,18 +1522,21 @@ static const char *cleanup_del_header(void *context, ssize_t index,
      * there may be a PTR record in the middle of a multi-line header.
      */
     if (header_offset > 0) {
-	if ((next_offset = cleanup_find_header_end(state, rec_buf, last_type)) < 0)
-	    /* Warning and errno->error mapping are done elsewhere. */
-	    CLEANUP_DEL_HEADER_RETURN(cleanup_milter_error(state, 0));
+	next_offset = cleanup_find_header_end(state, hdr_pos);
 	/* Mark the header as deleted. */
 	if (vstream_fseek(state->dst, header_offset, SEEK_SET) < 0) {
 	    msg_warn("%s: seek file %s: %m", myname, cleanup_path);
-	    CLEANUP_DEL_HEADER_RETURN(cleanup_milter_error(state, errno));
+	    return (cleanup_milter_error(state, errno));
 	}
 	rec_fprintf(state->dst, REC_TYPE_PTR, REC_TYPE_PTR_FORMAT,
 		    (long) next_offset);
+	/* The next header is now reached through the deleted one. */
+	cleanup_hdr_index_remove(state, hdr_pos);
+	if (HDR_INDEX_HAS(state, hdr_pos))
+	    state->hdr_index[hdr_pos].ptr_offset = header_offset;
+	if (CLEANUP_OUT_OK(state) == 0)
+	    cleanup_hdr_index_drop(state);
     }
-    vstring_free(rec_buf);
 
     /*
      * In case of error while doing record output.
@@ -2460,6 +2631,7 @@ static void open_queue_file(CLEANUP_STATE *state, const char *path)
 	myfree(cleanup_path);
 	cleanup_path = 0;
     }
+    cleanup_hdr_index_drop(state);
     if ((state->dst = vstream_fopen(path, O_RDWR, 0)) == 0) {
 	msg_warn("open %s: %m", path);
     } else {
@@ -2552,6 +2724,7 @@ static void close_queue_file(CLEANUP_STATE *state)
     state->dst = 0;
     myfree(cleanup_path);
     cleanup_path = 0;
+    cleanup_hdr_index_drop(state);
 }
 
 int     main(int unused_argc, char **argv)
@@ -2563,7 +2736,7 @@ int     main(int unused_argc, char **argv)
     CLEANUP_STATE *state = cleanup_state_alloc((VSTREAM *) 0);
     const char *parens = "{}";
 
-    state->queue_id = mystrdup("NOQUEUE");
+    state->queue_id = marena_strdup(state->arena, "NOQUEUE");
     state->sender = mystrdup("sender");
     state->recip = mystrdup("recipient");
     state->client_name = "client_name";
@@ -20,7 +20,9 @@
 /*	cleanup_out_recipient() performs virtual table expansion
 /*	and recipient duplicate filtering, and appends the
 /*	resulting recipients to the output stream. It also
-/*	generates DSN SUCCESS notifications.
+/*	generates DSN SUCCESS notifications, and maintains the
+/*	recipient batch index that cleanup_final() appends to the
+/*	queue file.
 /*
 /*	Arguments:
 /* .IP state
@@ -69,6 +71,7 @@
 
 #include <argv.h>
 #include <msg.h>
+#include <mymalloc.h>
 
 /* Global library. */
 
@@ -124,6 +127,87 @@ static void cleanup_verify_append(CLEANUP_STATE *state, RECIPIENT *rcpt,
     }
 }
 
+/* cleanup_rcpt_batch_add - update recipient batch index */
+
+static void cleanup_rcpt_batch_add(CLEANUP_STATE *state, off_t start,
+				           off_t end)
+{
+    CLEANUP_RCPT_BATCH *bp;
+
+    if (state->rcpt_batch_len < 0)
+	return;
+
+    /*
+     * Extend the last batch when this recipient record group immediately
+     * follows it. Otherwise there are other records or message content in
+     * between, and we must start a new batch.
+     */
+    if (state->rcpt_batch_len > 0) {
+	bp = state->rcpt_batch + state->rcpt_batch_len - 1;
+	if (bp->end == start && bp->count < CLEANUP_RCPT_BATCH_SIZE) {
+	    bp->end = end;
+	    bp->count += 1;
+	    return;
+	}
+    }
+
+    /*
+     * Don't build a huge index for a fragmented recipient list.
+     */
+    if (state->rcpt_batch_len >= CLEANUP_RCPT_BATCH_LIMIT) {
+	myfree((void *) state->rcpt_batch);
+	state->rcpt_batch = 0;
+	state->rcpt_batch_len = -1;
+	return;
+    }
+    if (state->rcpt_batch_len >= state->rcpt_batch_size) {
+	if (state->rcpt_batch == 0) {
+	    state->rcpt_batch_size = 10;
+	    state->rcpt_batch = (CLEANUP_RCPT_BATCH *)
+		mymalloc(state->rcpt_batch_size * sizeof(*bp));
+	} else {
+	    state->rcpt_batch_size *= 2;
+	    state->rcpt_batch = (CLEANUP_RCPT_BATCH *)
+		myrealloc((void *) state->rcpt_batch,
+			  state->rcpt_batch_size * sizeof(*bp));
+	}
+    }
+    bp = state->rcpt_batch + state->rcpt_batch_len++;
+    bp->start = start;
+    bp->end = end;
+    bp->count = 1;
+}
+
+/* cleanup_out_rcpt_group - write recipient with its attributes */
+
+static void cleanup_out_rcpt_group(CLEANUP_STATE *state,
+				           const char *dsn_orcpt,
+				           int dsn_notify,
+				           const char *orcpt,
+				           const char *recip)
+{
+    const char *myname = "cleanup_out_rcpt_group";
+    off_t   start;
+    off_t   end;
+
+    if ((start = vstream_ftell(state->dst)) < 0)
+	msg_fatal("%s: vstream_ftell %s: %m", myname, cleanup_path);
+    if (dsn_notify)
+	cleanup_out_format(state, REC_TYPE_ATTR, "%s=%d",
+			   MAIL_ATTR_DSN_NOTIFY, dsn_notify);
+    if (*dsn_orcpt)
+	cleanup_out_format(state, REC_TYPE_ATTR, "%s=%s",
+			   MAIL_ATTR_DSN_ORCPT, dsn_orcpt);
+    cleanup_out_string(state, REC_TYPE_ORCP, orcpt);
+    cleanup_out_string(state, REC_TYPE_RCPT, recip);
+    state->rcpt_count++;
+    if (CLEANUP_OUT_OK(state)) {
+	if ((end = vstream_ftell(state->dst)) < 0)
+	    msg_fatal("%s: vstream_ftell %s: %m", myname, cleanup_path);
+	cleanup_rcpt_batch_add(state, start, end);
+    }
+}
+
 /* cleanup_out_recipient - envelope recipient output filter */
 
 void    cleanup_out_recipient(CLEANUP_STATE *state,
@@ -159,17 +243,8 @@ void    cleanup_out_recipient(CLEANUP_STATE *state,
 	if ((var_enable_orcpt ?
 	     been_here(state->dups, "%s\n%d\n%s\n%s",
 		       dsn_orcpt, dsn_notify, orcpt, recip) :
-	     been_here_fixed(state->dups, recip)) == 0) {
-	    if (dsn_notify)
-		cleanup_out_format(state, REC_TYPE_ATTR, "%s=%d",
-				   MAIL_ATTR_DSN_NOTIFY, dsn_notify);
-	    if (*dsn_orcpt)
-		cleanup_out_format(state, REC_TYPE_ATTR, "%s=%s",
-				   MAIL_ATTR_DSN_ORCPT, dsn_orcpt);
-	    cleanup_out_string(state, REC_TYPE_ORCP, orcpt);
-	    cleanup_out_string(state, REC_TYPE_RCPT, recip);
-	    state->rcpt_count++;
-	}
+	     been_here_fixed(state->dups, recip)) == 0)
+	    cleanup_out_rcpt_group(state, dsn_orcpt, dsn_notify, orcpt, recip);
     }
 
     /*
@@ -249,17 +324,9 @@ void    cleanup_out_recipient(CLEANUP_STATE *state,
 	    if ((var_enable_orcpt ?
 		 been_here(state->dups, "%s\n%d\n%s\n%s",
 			   dsn_orcpt, dsn_notify, orcpt, *cpp) :
-		 been_here_fixed(state->dups, *cpp)) == 0) {
-		if (dsn_notify)
-		    cleanup_out_format(state, REC_TYPE_ATTR, "%s=%d",
-				       MAIL_ATTR_DSN_NOTIFY, dsn_notify);
-		if (*dsn_orcpt)
-		    cleanup_out_format(state, REC_TYPE_ATTR, "%s=%s",
-				       MAIL_ATTR_DSN_ORCPT, dsn_orcpt);
-		cleanup_out_string(state, REC_TYPE_ORCP, orcpt);
-		cleanup_out_string(state, REC_TYPE_RCPT, *cpp);
-		state->rcpt_count++;
-	    }
+		 been_here_fixed(state->dups, *cpp)) == 0)
+		cleanup_out_rcpt_group(state, dsn_orcpt, dsn_notify,
+				       orcpt, *cpp);
 	}
 	argv_free(argv);
     }
@@ -18,7 +18,12 @@
 /*
 /*	cleanup_state_alloc() initializes the per-message state variables.
 /*
-/*	cleanup_state_free() cleans up.
+/*	cleanup_state_free() cleans up. Strings that are saved once
+/*	per message (queue name and ID, sender full name, Message-ID,
+/*	VERP delimiters, Milter header labels) are allocated from the
+/*	state->arena memory arena and are released all at once. With
+/*	verbose logging, it reports how many mymalloc() calls those
+/*	strings would have needed, and how many the arena made instead.
 /* LICENSE
 /* .ad
 /* .fi
@@ -44,6 +49,7 @@
 
 /* Utility library. */
 
+#include <msg.h>
 #include <mymalloc.h>
 #include <vstring.h>
 #include <htable.h>
@@ -75,6 +81,7 @@ CLEANUP_STATE *cleanup_state_alloc(VSTREAM *src)
     state->temp3 = vstring_alloc(10);
     if (cleanup_strip_chars)
 	state->stripped_buf = vstring_alloc(10);
+    state->arena = marena_create(0);
     state->src = src;
     state->dst = 0;
     state->handle = 0;
@@ -112,6 +119,9 @@ CLEANUP_STATE *cleanup_state_alloc(VSTREAM *src)
     state->append_meta_pt_offset = -1;
     state->append_meta_pt_target = -1;
     state->rcpt_count = 0;
+    state->rcpt_batch = 0;
+    state->rcpt_batch_len = 0;
+    state->rcpt_batch_size = 0;
     state->reason = 0;
     state->smtp_reply = 0;
     state->attr = nvtable_create(10);
@@ -121,6 +131,7 @@ CLEANUP_STATE *cleanup_state_alloc(VSTREAM *src)
     state->hdr_rewrite_context = MAIL_ATTR_RWR_LOCAL;
     state->filter = 0;
     state->redirect = 0;
+    state->priority = 0;
     state->message_id = 0;
     state->dsn_envid = 0;
     state->dsn_ret = 0;
@@ -140,6 +151,10 @@ CLEANUP_STATE *cleanup_state_alloc(VSTREAM *src)
     state->milter_err_text = 0;
     state->milter_dsn_buf = 0;
     state->free_regions = state->body_regions = state->curr_body_region = 0;
+    state->hdr_index = 0;
+    state->hdr_index_len = -1;
+    state->hdr_index_size = 0;
+    state->hdr_index_end = -1;
     state->sendopts = 0;
     state->reqtls_esmtp_hdr_seen = 0;
     return (state);
@@ -149,14 +164,20 @@ CLEANUP_STATE *cleanup_state_alloc(VSTREAM *src)
 
 void    cleanup_state_free(CLEANUP_STATE *state)
 {
+    if (msg_verbose)
+	msg_info("%s: arena: %ld strings, %ld bytes, mymalloc() calls: "
+		 "%ld without arena, %ld with arena",
+		 state->queue_id ? state->queue_id : "NOQUEUE",
+		 (long) state->arena->alloc_count,
+		 (long) state->arena->bytes,
+		 (long) state->arena->alloc_count,
+		 (long) state->arena->chunk_count + 1);
     vstring_free(state->attr_buf);
     vstring_free(state->temp1);
     vstring_free(state->temp2);
     vstring_free(state->temp3);
     if (cleanup_strip_chars)
 	vstring_free(state->stripped_buf);
-    if (state->fullname)
-	myfree(state->fullname);
     if (state->sender)
 	myfree(state->sender);
     if (state->recip)
@@ -170,10 +191,6 @@ void    cleanup_state_free(CLEANUP_STATE *state)
     argv_free(state->auto_hdrs);
     if (state->hbc_rcpt)
 	argv_free(state->hbc_rcpt);
-    if (state->queue_name)
-	myfree(state->queue_name);
-    if (state->queue_id)
-	myfree(state->queue_id);
     been_here_free(state->dups);
     if (state->reason)
 	myfree(state->reason);
@@ -186,14 +203,14 @@ void    cleanup_state_free(CLEANUP_STATE *state)
 	myfree(state->filter);
     if (state->redirect)
 	myfree(state->redirect);
-    if (state->message_id)
-	myfree(state->message_id);
     if (state->dsn_envid)
 	myfree(state->dsn_envid);
     if (state->dsn_orcpt)
 	myfree(state->dsn_orcpt);
-    if (state->verp_delims)
-	myfree(state->verp_delims);
+    if (state->rcpt_batch)
+	myfree((void *) state->rcpt_batch);
+    if (state->hdr_index)
+	myfree((void *) state->hdr_index);
     if (state->milters)
 	milter_free(state->milters);
     if (state->milter_ext_from)
@@ -205,5 +222,6 @@ void    cleanup_state_free(CLEANUP_STATE *state)
     if (state->milter_dsn_buf)
 	vstring_free(state->milter_dsn_buf);
     cleanup_region_done(state);
+    marena_free(state->arena);
     myfree((void *) state);
 }
@@ -195,6 +195,7 @@
 #include <flush_clnt.h>
 #include <mail_conf.h>
 #include <mail_scan_dir.h>
+#include <mail_shard.h>
 #include <maps.h>
 #include <domain_list.h>
 #include <match_parent_style.h>
@@ -541,8 +542,8 @@ static int flush_send_path(const char *path, int how)
      * chance to expedite its delivery.
      */
     if (how & UNTHROTTLE_BEFORE)
-	mail_trigger(MAIL_CLASS_PUBLIC, var_queue_service,
-		     qmgr_flush_trigger, sizeof(qmgr_flush_trigger));
+	mail_shard_trigger(var_queue_service,
+			   qmgr_flush_trigger, sizeof(qmgr_flush_trigger));
 
     /*
      * This is the part that dominates running time: schedule the listed
@@ -611,8 +612,8 @@ static int flush_send_path(const char *path, int how)
     if (count > 0) {
 	if (msg_verbose)
 	    msg_info("%s: requesting delivery for logfile %s", myname, path);
-	mail_trigger(MAIL_CLASS_PUBLIC, var_queue_service,
-		     qmgr_scan_trigger, sizeof(qmgr_scan_trigger));
+	mail_shard_trigger(var_queue_service,
+			   qmgr_scan_trigger, sizeof(qmgr_scan_trigger));
     }
     return (FLUSH_STAT_OK);
 }
@@ -640,7 +641,9 @@ static int flush_send_file_service(const char *queue_id)
     queue_file = vstring_alloc(30);
     tbuf.actime = tbuf.modtime = event_time();
     if (flush_one_file(queue_id, queue_file, &tbuf, UNTHROTTLE_AFTER) > 0)
-	mail_trigger(MAIL_CLASS_PUBLIC, var_queue_service,
+	mail_trigger(MAIL_CLASS_PUBLIC,
+		     mail_shard_service(queue_file, var_queue_service,
+					mail_shard_index(queue_id)),
 		     qmgr_scan_trigger, sizeof(qmgr_scan_trigger));
     vstring_free(queue_file);
 
@@ -5,7 +5,7 @@
 /*	measure directory operation overhead
 /* SYNOPSIS
 /* .fi
-/*	\fBfsstone\fR [\fB-cr\fR] [\fB-s \fIsize\fR]
+/*	\fBfsstone\fR [\fB-cgr\fR] [\fB-p \fIprocs\fR] [\fB-s \fIsize\fR]
 /*		\fImsg_count files_per_dir\fR
 /* DESCRIPTION
 /*	The \fBfsstone\fR command measures the cost of creating, renaming
@@ -19,6 +19,16 @@
 /*	Options:
 /* .IP \fB-c\fR
 /*	Create and delete files.
+/* .IP \fB-g\fR
+/*	Make files durable with \fBgroup_sync\fR(3) instead of
+/*	\fBfsync\fR(2), as the cleanup(8) daemon does with
+/*	"cleanup_group_commit = yes". The processes coordinate
+/*	through the file \fBfsstone.sync\fR in the current directory.
+/* .IP "\fB-p \fIprocs\fR"
+/*	Run \fIprocs\fR processes in parallel, each with its own
+/*	subdirectory of the current directory, and each simulating
+/*	the arrival of \fImsg_count\fR messages. The program reports
+/*	the elapsed time for all processes together.
 /* .IP \fB-r\fR
 /*	Rename files twice (requires \fB-c\fR).
 /* .IP \fB-s \fIsize\fR
@@ -49,17 +59,32 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include <string.h>
+#include <errno.h>
 #include <sys/time.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
 
 /* Utility library. */
 
 #include <msg.h>
 #include <msg_vstream.h>
+#include <group_sync.h>
 
 /* Global directory. */
 
 #include <mail_version.h>
 
+#define SYNC_FILE	"fsstone.sync"
+
+static GROUP_SYNC *group;
+
+/* sync_file - make file durable */
+
+static int sync_file(int fd)
+{
+    return (group ? group_sync(group, fd) : fsync(fd));
+}
+
 /* rename_file - rename a file */
 
 static void rename_file(int old, int new)
@@ -89,7 +114,7 @@ static void make_file(int seqno, int size)
     for (i = 0; i < size; i++)
 	if (fwrite(buf, 1, sizeof(buf), fp) != sizeof(buf))
 	    msg_fatal("fwrite: %m");
-    if (fsync(fileno(fp)))
+    if (sync_file(fileno(fp)))
 	msg_fatal("fsync: %m");
     if (fclose(fp))
 	msg_fatal("fclose: %m");
@@ -114,7 +139,7 @@ static void use_file(int seqno)
 	msg_fatal("open %s: %m", path);
     for (i = 0; i < 400; i++)
 	fprintf(fp, "hello");
-    if (fsync(fileno(fp)))
+    if (sync_file(fileno(fp)))
 	msg_fatal("fsync: %m");
     if (fclose(fp))
 	msg_fatal("fclose: %m");
@@ -149,11 +174,55 @@ static void remove_silent(int seq)
     (void) remove(path);
 }
 
+/* populate - populate the directory with little files */
+
+static void populate(int max_file, int size)
+{
+    int     seq;
+
+    for (seq = 0; seq < max_file; seq++)
+	make_file(seq, size);
+}
+
+/* simulate - simulate arrival and delivery of mail messages */
+
+static void simulate(int op_count, int max_file, int size,
+		             int do_create, int do_rename)
+{
+    int     seq = 0;
+
+    while (op_count > 0) {
+	seq %= max_file;
+	if (do_create) {
+	    remove_file(seq);
+	    make_file(seq, size);
+	    if (do_rename) {
+		rename_file(seq, seq + max_file);
+		rename_file(seq + max_file, seq);
+	    }
+	} else {
+	    use_file(seq);
+	}
+	seq++;
+	op_count--;
+    }
+}
+
+/* depopulate - clean up directory fillers */
+
+static void depopulate(int max_file)
+{
+    int     seq;
+
+    for (seq = 0; seq < max_file; seq++)
+	remove_silent(seq);
+}
+
 /* usage - explain */
 
 static void usage(char *myname)
 {
-    msg_fatal("usage: %s [-cr] [-s size] messages directory_entries", myname);
+    msg_fatal("usage: %s [-cgr] [-p procs] [-s size] messages directory_entries", myname);
 }
 
 MAIL_VERSION_STAMP_DECLARE;
@@ -165,9 +234,17 @@ int     main(int argc, char **argv)
     struct timeval start, end;
     int     do_rename = 0;
     int     do_create = 0;
-    int     seq;
-    int     ch;
+    int     do_group = 0;
+    int     procs = 1;
     int     size = 2;
+    unsigned syncs = 0;
+    int     ready_pipe[2];
+    int     go_pipe[2];
+    char    dir[BUFSIZ];
+    char    ch;
+    int     status;
+    double  secs;
+    int     n;
 
     /*
      * Fingerprint executables and core dumps.
@@ -175,11 +252,18 @@ int     main(int argc, char **argv)
     MAIL_VERSION_STAMP_ALLOCATE;
 
     msg_vstream_init(argv[0], VSTREAM_ERR);
-    while ((ch = GETOPT(argc, argv, "crs:")) != EOF) {
-	switch (ch) {
+    while ((n = GETOPT(argc, argv, "cgp:rs:")) != EOF) {
+	switch (n) {
 	case 'c':
 	    do_create++;
 	    break;
+	case 'g':
+	    do_group++;
+	    break;
+	case 'p':
+	    if ((procs = atoi(optarg)) <= 0)
+		usage(argv[0]);
+	    break;
 	case 'r':
 	    do_rename++;
 	    break;
@@ -200,31 +284,74 @@ int     main(int argc, char **argv)
 	usage(argv[0]);
 
     /*
-     * Populate the directory with little files.
+     * Each process must open the coordination file for itself, because
+     * file locks are shared between processes that share an open file.
      */
-    for (seq = 0; seq < max_file; seq++)
-	make_file(seq, size);
+    if (do_group && (group = group_sync_open(SYNC_FILE)) == 0)
+	msg_fatal("open %s: %m", SYNC_FILE);
 
-    /*
-     * Simulate arrival and delivery of mail messages.
-     */
-    GETTIMEOFDAY(&start);
-    while (op_count > 0) {
-	seq %= max_file;
-	if (do_create) {
-	    remove_file(seq);
-	    make_file(seq, size);
-	    if (do_rename) {
-		rename_file(seq, seq + max_file);
-		rename_file(seq + max_file, seq);
+    if (procs == 1) {
+	populate(max_file, size);
+	if (group)
+	    syncs = GROUP_SYNC_COUNT(group);
+	GETTIMEOFDAY(&start);
+	simulate(op_count, max_file, size, do_create, do_rename);
+	GETTIMEOFDAY(&end);
+	depopulate(max_file);
+    } else {
+
+	/*
+	 * Each child process reports when it is ready to start, waits until
+	 * the parent closes the go pipe, and reports when it is done.
+	 */
+	if (pipe(ready_pipe) < 0 || pipe(go_pipe) < 0)
+	    msg_fatal("pipe: %m");
+	for (n = 0; n < procs; n++) {
+	    switch (fork()) {
+	    case -1:
+		msg_fatal("fork: %m");
+	    case 0:
+		(void) close(go_pipe[1]);
+		if (group) {
+		    group_sync_close(group);
+		    if ((group = group_sync_open(SYNC_FILE)) == 0)
+			msg_fatal("open %s: %m", SYNC_FILE);
+		}
+		sprintf(dir, "fsstone.%d", n);
+		if (mkdir(dir, 0700) < 0 && errno != EEXIST)
+		    msg_fatal("mkdir %s: %m", dir);
+		if (chdir(dir) < 0)
+		    msg_fatal("chdir %s: %m", dir);
+		populate(max_file, size);
+		if (write(ready_pipe[1], "", 1) != 1)
+		    msg_fatal("write: %m");
+		(void) read(go_pipe[0], &ch, 1);
+		simulate(op_count, max_file, size, do_create, do_rename);
+		if (write(ready_pipe[1], "", 1) != 1)
+		    msg_fatal("write: %m");
+		depopulate(max_file);
+		if (chdir("..") < 0 || rmdir(dir) < 0)
+		    msg_warn("remove %s: %m", dir);
+		_exit(0);
 	    }
-	} else {
-	    use_file(seq);
 	}
-	seq++;
-	op_count--;
+	(void) close(ready_pipe[1]);
+	(void) close(go_pipe[0]);
+	for (n = 0; n < procs; n++)
+	    if (read(ready_pipe[0], &ch, 1) != 1)
+		msg_fatal("child process terminated before it was ready");
+	if (group)
+	    syncs = GROUP_SYNC_COUNT(group);
+	GETTIMEOFDAY(&start);
+	(void) close(go_pipe[1]);
+	for (n = 0; n < procs; n++)
+	    if (read(ready_pipe[0], &ch, 1) != 1)
+		msg_fatal("child process terminated before it was done");
+	GETTIMEOFDAY(&end);
+	while (wait(&status) > 0)
+	    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+		msg_fatal("child process failed with status 0x%x", status);
     }
-    GETTIMEOFDAY(&end);
     if (end.tv_usec < start.tv_usec) {
 	end.tv_sec--;
 	end.tv_usec += 1000000;
@@ -232,11 +359,13 @@ int     main(int argc, char **argv)
     printf("elapsed time: %ld.%06ld\n",
 	   (long) (end.tv_sec - start.tv_sec),
 	   (long) (end.tv_usec - start.tv_usec));
-
-    /*
-     * Clean up directory fillers.
-     */
-    for (seq = 0; seq < max_file; seq++)
-	remove_silent(seq);
+    secs = (end.tv_sec - start.tv_sec) + (end.tv_usec - start.tv_usec) / 1e6;
+    if (secs > 0)
+	printf("messages/s: %.0f\n", (double) op_count * procs / secs);
+    if (group) {
+	printf("file system syncs: %u\n", GROUP_SYNC_COUNT(group) - syncs);
+	group_sync_close(group);
+	(void) unlink(SYNC_FILE);
+    }
     return (0);
 }
@@ -62,6 +62,8 @@
 /*	const char *relay;
 /*	const POL_STATS *tstats;
 /*	DSN	*dsn;
+/*
+/*	DEFER_STATS defer_stats;
 /* DESCRIPTION
 /*	This module implements a client interface to the defer service,
 /*	which maintains a per-message logfile with status records for
@@ -92,6 +94,14 @@
 /*
 /*	defer_append_intern() is for use after the DSN filter.
 /*
+/*	defer_stats counts the recipients that were deferred with
+/*	defer_append() or defer_one(), by deferral class: "throttle"
+/*	for a receiver that asks the sender to slow down (enhanced
+/*	status code 4.7.X, or an SMTP 421 reply), and "other" for
+/*	all other temporary errors. The delivery agent reports these
+/*	counts to the queue manager with the final delivery status
+/*	(see deliver_request(3)), and resets them.
+/*
 /*	Arguments:
 /* .IP flags
 /*	The bit-wise OR of zero or more of the following (specify
@@ -197,6 +207,20 @@
 
 #define STR(x)	vstring_str(x)
 
+DEFER_STATS defer_stats;
+
+/* defer_count - update deferral class counts */
+
+static void defer_count(DSN *dsn)
+{
+    if (strncmp(dsn->status, "4.7.", 4) == 0
+	|| (strcmp(dsn->dtype, "smtp") == 0
+	    && strncmp(dsn->dtext, "421", 3) == 0))
+	defer_stats.throttle += 1;
+    else
+	defer_stats.other += 1;
+}
+
 /* defer_append - defer message delivery */
 
 int     defer_append(int flags, const char *id, MSG_STATS *stats,
@@ -224,6 +248,7 @@ int     defer_append(int flags, const char *id, MSG_STATS *stats,
 					 dsn_res));
 	my_dsn = *dsn_res;
     }
+    defer_count(&my_dsn);
     return (defer_append_intern(flags, id, stats, rcpt, relay, tstats,
 				&my_dsn));
 }
@@ -392,6 +417,7 @@ int     defer_one(int flags, const char *queue, const char *id,
 				      rcpt, relay, tstats, dsn_res));
 	my_dsn = *dsn_res;
     }
+    defer_count(&my_dsn);
     return (defer_append_intern(flags, id, stats, rcpt, relay, tstats,
 				&my_dsn));
 }
@@ -30,6 +30,16 @@ extern int defer_one(int, const char *, const char *, const char *, int,
 		             int, MSG_STATS *, RECIPIENT *,
 		             const char *, const POL_STATS *, DSN *);
 
+ /*
+  * Deferral classes, for destination concurrency feedback.
+  */
+typedef struct DEFER_STATS {
+    int     throttle;			/* receiver asks us to slow down */
+    int     other;			/* other temporary errors */
+} DEFER_STATS;
+
+extern DEFER_STATS defer_stats;
+
  /*
   * Start of private API.
   */
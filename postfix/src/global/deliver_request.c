@@ -43,6 +43,11 @@
 /*	VSTREAM *stream;
 /*	DELIVER_REQUEST *request;
 /*	int	status;
+/*
+/*	DELIVER_REQUEST *deliver_request_next(stream, request, status)
+/*	VSTREAM *stream;
+/*	DELIVER_REQUEST *request;
+/*	int	status;
 /* DESCRIPTION
 /*	This module implements the delivery agent side of the `queue manager
 /*	to delivery agent' protocol. In this game, the queue manager is
@@ -67,6 +72,15 @@
 /*	Delete bounced recipients from the queue file. Currently,
 /*	this flag is non-functional.
 /* .PP
+/* .IP \fBDEL_REQ_FLAG_DEFER_STATS\fR
+/*	Report the number of deferred recipients by deferral class
+/*	(see defer(3)) with the final delivery status. The queue
+/*	manager uses this for destination concurrency feedback.
+/* .IP \fBDEL_REQ_FLAG_BATCH\fR
+/*	The queue manager may send another delivery request for the
+/*	same destination over the same connection, if the delivery
+/*	agent reports that it is willing to receive one.
+/* .PP
 /*	The \fBDEL_REQ_FLAG_DEFLT\fR constant provides a convenient shorthand
 /*	for the most common case: delete successful and bounced recipients.
 /*
@@ -79,6 +93,16 @@
 /*	closes the queue file,
 /*	and destroys the DELIVER_REQUEST structure. The result is
 /*	non-zero when the status could not be reported to the client.
+/*
+/*	deliver_request_next() is called instead of deliver_request_done()
+/*	by a delivery agent that can handle a batch of delivery
+/*	requests over one connection. When the request has the
+/*	DEL_REQ_FLAG_BATCH flag, deliver_request_next() reports the
+/*	delivery status as deliver_request_done() does, tells the
+/*	client that it is ready for another request, and reads that
+/*	request. The result is a null pointer when the client did
+/*	not ask for a batch, when it sent no further request, or in
+/*	case of error.
 /* DIAGNOSTICS
 /*	Warnings: bad data sent by the client. Fatal errors: out of
 /*	memory, queue file open errors.
@@ -130,6 +154,7 @@
 #include "dsn_print.h"
 #include "deliver_request.h"
 #include "rcpt_buf.h"
+#include "defer.h"
 
 /* deliver_request_initial - send initial status code */
 
@@ -157,7 +182,7 @@ static int deliver_request_initial(VSTREAM *stream)
 /* deliver_request_final - send final delivery request status */
 
 static int deliver_request_final(VSTREAM *stream, DELIVER_REQUEST *request,
-				         int status)
+				         int status, int more)
 {
     DSN    *hop_status;
     int     err;
@@ -173,10 +198,22 @@ static int deliver_request_final(VSTREAM *stream, DELIVER_REQUEST *request,
     if (msg_verbose)
 	msg_info("deliver_request_final: send: \"%s\" %d",
 		 hop_status->reason, status);
-    attr_print(stream, ATTR_FLAG_NONE,
+    attr_print(stream, ATTR_FLAG_MORE,
 	       SEND_ATTR_FUNC(dsn_print, (const void *) hop_status),
 	       SEND_ATTR_INT(MAIL_ATTR_STATUS, status),
 	       ATTR_TYPE_END);
+    if (request->flags & DEL_REQ_FLAG_DEFER_STATS)
+	attr_print(stream, ATTR_FLAG_MORE,
+		   SEND_ATTR_INT(MAIL_ATTR_DEFER_THROTTLE,
+				 defer_stats.throttle),
+		   SEND_ATTR_INT(MAIL_ATTR_DEFER_OTHER, defer_stats.other),
+		   ATTR_TYPE_END);
+    if (request->flags & DEL_REQ_FLAG_BATCH)
+	attr_print(stream, ATTR_FLAG_MORE,
+		   SEND_ATTR_INT(MAIL_ATTR_BATCH, more),
+		   ATTR_TYPE_END);
+    attr_print(stream, ATTR_FLAG_NONE, ATTR_TYPE_END);
+    defer_stats.throttle = defer_stats.other = 0;
     if ((err = vstream_fflush(stream)) != 0)
 	if (msg_verbose)
 	    msg_warn("send final status: %m");
@@ -186,9 +223,12 @@ static int deliver_request_final(VSTREAM *stream, DELIVER_REQUEST *request,
      * immediately after writing to them. That is not how sockets are
      * supposed to behave! The workaround is to wait until the receiver
      * closes the connection. Calling VSTREAM_GETC() has the benefit of using
-     * whatever timeout is specified in the ipc_timeout parameter.
+     * whatever timeout is specified in the ipc_timeout parameter. When the
+     * client may send another request, that request or the end of the
+     * connection are read by the caller.
      */
-    (void) VSTREAM_GETC(stream);
+    if (more == 0)
+	(void) VSTREAM_GETC(stream);
     return (err);
 }
 
@@ -443,18 +483,12 @@ static void deliver_request_free(DELIVER_REQUEST *request)
     myfree((void *) request);
 }
 
-/* deliver_request_read - create and read delivery request */
+/* deliver_request_receive - wait for and read delivery request */
 
-DELIVER_REQUEST *deliver_request_read(VSTREAM *stream)
+static DELIVER_REQUEST *deliver_request_receive(VSTREAM *stream)
 {
     DELIVER_REQUEST *request;
 
-    /*
-     * Tell the queue manager that we are ready for this request.
-     */
-    if (deliver_request_initial(stream) != 0)
-	return (0);
-
     /*
      * Be prepared for the queue manager to change its mind after contacting
      * us. This can happen when a transport or host goes bad.
@@ -476,13 +510,44 @@ DELIVER_REQUEST *deliver_request_read(VSTREAM *stream)
     return (request);
 }
 
+/* deliver_request_read - create and read delivery request */
+
+DELIVER_REQUEST *deliver_request_read(VSTREAM *stream)
+{
+
+    /*
+     * Tell the queue manager that we are ready for this request.
+     */
+    if (deliver_request_initial(stream) != 0)
+	return (0);
+    return (deliver_request_receive(stream));
+}
+
 /* deliver_request_done - finish delivery request */
 
 int     deliver_request_done(VSTREAM *stream, DELIVER_REQUEST *request, int status)
 {
     int     err;
 
-    err = deliver_request_final(stream, request, status);
+    err = deliver_request_final(stream, request, status, 0);
     deliver_request_free(request);
     return (err);
 }
+
+/* deliver_request_next - finish delivery request, read next one */
+
+DELIVER_REQUEST *deliver_request_next(VSTREAM *stream,
+				              DELIVER_REQUEST *request,
+				              int status)
+{
+    int     more = (request->flags & DEL_REQ_FLAG_BATCH) != 0;
+
+    /*
+     * The final status of this request doubles as the "ready" response for
+     * the next request.
+     */
+    if (deliver_request_final(stream, request, status, more) != 0)
+	more = 0;
+    deliver_request_free(request);
+    return (more ? deliver_request_receive(stream) : 0);
+}
@@ -80,6 +80,8 @@ typedef struct DELIVER_REQUEST {
 #define DEL_REQ_FLAG_CONN_LOAD	(1<<11)	/* Consult opportunistic cache */
 #define DEL_REQ_FLAG_CONN_STORE	(1<<12)	/* Update opportunistic cache */
 #define DEL_REQ_FLAG_REC_DLY_SENT	(1<<13)	/* Record delayed delivery */
+#define DEL_REQ_FLAG_DEFER_STATS	(1<<14)	/* Report deferral classes */
+#define DEL_REQ_FLAG_BATCH	(1<<15)	/* More requests may follow */
 
  /*
   * Cache Load and Store as value or mask. Use explicit _MASK for multi-bit
@@ -133,6 +135,7 @@ typedef struct DELIVER_REQUEST {
 typedef struct VSTREAM _deliver_vstream_;
 extern DELIVER_REQUEST *deliver_request_read(_deliver_vstream_ *);
 extern int deliver_request_done(_deliver_vstream_ *, DELIVER_REQUEST *, int);
+extern DELIVER_REQUEST *deliver_request_next(_deliver_vstream_ *, DELIVER_REQUEST *, int);
 
 extern int PRINTFLIKE(4, 5) reject_deliver_request(const char *,
 		         DELIVER_REQUEST *, const char *, const char *,...);
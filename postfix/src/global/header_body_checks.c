@@ -433,10 +433,22 @@ void    _hbc_checks_free(HBC_CHECKS *hbc, ssize_t len)
 
 #ifdef TEST
 
+ /*
+  * Usage: header_body_checks [-p] [-t rounds] header_checks
+  * mime_header_checks nested_header_checks body_checks <message
+  * 
+  * With -p, build a literal substring prefilter for regexp: and pcre:
+  * tables. With -t, read the message into memory, process it the specified
+  * number of times with output discarded, and report the elapsed time on
+  * the standard error stream.
+  */
+#include <sys/time.h>
 #include <stdlib.h>
+#include <fcntl.h>
 #include <stringops.h>
 #include <vstream.h>
 #include <msg_vstream.h>
+#include <re_prefilter.h>
 #include <rec_streamlf.h>
 #include <mail_params.h>
 
@@ -448,8 +460,14 @@ typedef struct {
     VSTRING *buf;
     const char *queueid;
     int     recno;
+    int     quiet;			/* don't log actions */
 } HBC_TEST_CONTEXT;
 
+typedef struct {
+    int     rec_type;
+    VSTRING *buf;
+} HBC_TEST_RECORD;
+
 /*#define REC_LEN	40*/
 #define REC_LEN	1024
 
@@ -460,6 +478,8 @@ static void log_cb(void *context, const char *action, const char *where,
 {
     const HBC_TEST_CONTEXT *dp = (HBC_TEST_CONTEXT *) context;
 
+    if (dp->quiet)
+	return;
     if (*text) {
 	msg_info("%s: %s: %s %.200s: %s",
 		 dp->queueid, action, where, content, text);
@@ -568,23 +588,65 @@ int     var_mime_maxdepth = 20;
 int     var_mime_bound_len = 2000;
 char   *var_drop_hdrs = DEF_DROP_HDRS;
 
+/* usage - explain and terminate */
+
+static NORETURN usage(char *myname)
+{
+    msg_fatal("usage: %s [-p] [-t rounds] header_checks mime_header_checks nested_header_checks body_checks", myname);
+}
+
+/* elapsed - return elapsed time in seconds */
+
+static double elapsed(struct timeval *start)
+{
+    struct timeval now;
+
+    if (gettimeofday(&now, (struct timezone *) 0) < 0)
+	msg_fatal("gettimeofday: %m");
+    return ((now.tv_sec - start->tv_sec)
+	    + (now.tv_usec - start->tv_usec) / 1000000.0);
+}
+
 int     main(int argc, char **argv)
 {
     int     rec_type;
     VSTRING *buf;
-    int     err;
+    int     err = 0;
     MIME_STATE *mime_state;
     HBC_TEST_CONTEXT context;
     static HBC_CALL_BACKS call_backs[1] = {
 	log_cb,				/* logger */
 	out_cb,				/* prepend */
     };
+    HBC_TEST_RECORD *records = 0;
+    ssize_t record_count = 0;
+    ssize_t record_size = 0;
+    ssize_t n;
+    int     rounds = 0;
+    int     round;
+    struct timeval start;
+    int     ch;
 
     /*
      * Sanity check.
      */
-    if (argc != 5)
-	msg_fatal("usage: %s header_checks mime_header_checks nested_header_checks body_checks", argv[0]);
+    msg_vstream_init(basename(argv[0]), VSTREAM_OUT);
+    while ((ch = GETOPT(argc, argv, "pt:")) > 0) {
+	switch (ch) {
+	case 'p':
+	    re_prefilter_enable = 1;
+	    break;
+	case 't':
+	    if ((rounds = atoi(optarg)) <= 0)
+		usage(argv[0]);
+	    break;
+	default:
+	    usage(argv[0]);
+	}
+    }
+    if (argc - optind != 4)
+	usage(argv[0]);
+    argv += optind - 1;
 
     /*
      * Initialize.
@@ -596,13 +658,7 @@ int     main(int argc, char **argv)
             | MIME_OPT_REPORT_TRUNC_HEADER \
             | MIME_OPT_REPORT_NESTING \
             | MIME_OPT_DOWNGRADE)
-    msg_vstream_init(basename(argv[0]), VSTREAM_OUT);
     buf = vstring_alloc(10);
-    mime_state = mime_state_alloc(MIME_OPTIONS,
-				  head_out, head_end,
-				  body_out, body_end,
-				  err_print,
-				  (void *) &context);
     context.header_checks =
 	hbc_header_checks_create("header_checks", argv[1],
 				 "mime_header_checks", argv[2],
@@ -614,16 +670,67 @@ int     main(int argc, char **argv)
     context.fp = VSTREAM_OUT;
     context.queueid = "test-queueID";
     context.recno = 0;
+    context.quiet = 0;
+
+    /*
+     * Timing mode: read the message into memory, and discard the output.
+     */
+    if (rounds > 0) {
+	do {
+	    if (record_count >= record_size) {
+		record_size = record_size ? 2 * record_size : 100;
+		records = (HBC_TEST_RECORD *) (records ?
+			    myrealloc((void *) records,
+				      record_size * sizeof(*records)) :
+			    mymalloc(record_size * sizeof(*records)));
+	    }
+	    rec_type = rec_streamlf_get(VSTREAM_IN, buf, REC_LEN);
+	    VSTRING_TERMINATE(buf);
+	    records[record_count].rec_type = rec_type;
+	    records[record_count].buf = vstring_alloc(LEN(buf) + 1);
+	    vstring_memcpy(records[record_count].buf, STR(buf), LEN(buf));
+	    VSTRING_TERMINATE(records[record_count].buf);
+	    record_count += 1;
+	} while (rec_type > 0);
+	if ((context.fp = vstream_fopen("/dev/null", O_WRONLY, 0)) == 0)
+	    msg_fatal("open /dev/null: %m");
+	context.quiet = 1;
+    } else {
+	rounds = 1;
+    }
 
     /*
      * Main loop.
      */
-    do {
-	rec_type = rec_streamlf_get(VSTREAM_IN, buf, REC_LEN);
-	VSTRING_TERMINATE(buf);
-	err = mime_state_update(mime_state, rec_type, STR(buf), LEN(buf));
-	vstream_fflush(VSTREAM_OUT);
-    } while (rec_type > 0);
+    gettimeofday(&start, (struct timezone *) 0);
+    for (round = 0; round < rounds; round++) {
+	mime_state = mime_state_alloc(MIME_OPTIONS,
+				      head_out, head_end,
+				      body_out, body_end,
+				      err_print,
+				      (void *) &context);
+	context.recno = 0;
+	if (records) {
+	    for (n = 0; n < record_count; n++)
+		err = mime_state_update(mime_state, records[n].rec_type,
+					STR(records[n].buf),
+					LEN(records[n].buf));
+	} else {
+	    do {
+		rec_type = rec_streamlf_get(VSTREAM_IN, buf, REC_LEN);
+		VSTRING_TERMINATE(buf);
+		err = mime_state_update(mime_state, rec_type,
+					STR(buf), LEN(buf));
+		vstream_fflush(VSTREAM_OUT);
+	    } while (rec_type > 0);
+	}
+	mime_state_free(mime_state);
+    }
+    if (records) {
+	vstream_fprintf(VSTREAM_ERR, "%d rounds of %ld records in %.3f s\n",
+			rounds, (long) record_count, elapsed(&start));
+	vstream_fflush(VSTREAM_ERR);
+    }
 
     /*
      * Error reporting.
@@ -646,8 +753,13 @@ int     main(int argc, char **argv)
 	hbc_header_checks_free(context.header_checks);
     if (context.body_checks)
 	hbc_body_checks_free(context.body_checks);
+    if (records) {
+	for (n = 0; n < record_count; n++)
+	    vstring_free(records[n].buf);
+	myfree((void *) records);
+	(void) vstream_fclose(context.fp);
+    }
     vstring_free(context.buf);
-    mime_state_free(mime_state);
     vstring_free(buf);
     exit(0);
 }
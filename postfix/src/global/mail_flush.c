@@ -13,7 +13,8 @@
 /*	This module triggers delivery of backed up mail.
 /*
 /*	mail_flush_deferred() triggers delivery of all deferred
-/*	or incoming mail. This function tickles the queue manager.
+/*	or incoming mail. This function tickles all queue manager
+/*	shards.
 /*
 /*	mail_flush_maildrop() triggers delivery of all mail in
 /*	the maildrop directory. This function tickles the pickup
@@ -47,6 +48,7 @@
 #include <mail_params.h>
 #include <mail_proto.h>
 #include <mail_flush.h>
+#include <mail_shard.h>
 
 /* mail_flush_deferred - flush deferred/incoming queue */
 
@@ -62,8 +64,8 @@ int     mail_flush_deferred(void)
     /*
      * Trigger the flush queue service.
      */
-    return (mail_trigger(MAIL_CLASS_PUBLIC, var_queue_service,
-			 qmgr_trigger, sizeof(qmgr_trigger)));
+    return (mail_shard_trigger(var_queue_service,
+			       qmgr_trigger, sizeof(qmgr_trigger)));
 }
 
 /* mail_flush_maildrop - flush maildrop queue */
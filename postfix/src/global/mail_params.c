@@ -90,6 +90,7 @@
 /*	char   *var_defer_service;
 /*	char   *var_pickup_service;
 /*	char   *var_queue_service;
+/*	int	var_qmgr_shard_count;
 /*	char   *var_rewrite_service;
 /*	char   *var_showq_service;
 /*	char   *var_error_service;
@@ -101,6 +102,7 @@
 /*	int	var_db_create_buf;
 /*	int	var_db_read_buf;
 /*	long	var_lmdb_map_size;
+/*	int	var_pcre_stat_interval;
 /*	int	var_proc_limit;
 /*	int	var_mime_maxdepth;
 /*	int	var_mime_bound_len;
@@ -125,6 +127,7 @@
 /*	bool	var_multi_enable;
 /*	bool	var_long_queue_ids;
 /*	bool	var_daemon_open_fatal;
+/*	bool	var_table_prefilter;
 /*	char	*var_dsn_filter;
 /*	int	var_smtputf8_enable;
 /*	int	var_strict_smtputf8;
@@ -174,6 +177,13 @@
 /*	char	*var_nbdb_service;
 /*	char	*var_nbdb_cust_map;
 /*	bool	var_nbdb_log_redirect;
+/*
+/*	bool	var_milt_parallel;
+/*	bool	var_milt_lat_log;
+/*	bool	var_milt_conn_reuse;
+/*	int	var_milt_cache_time;
+/*	int	var_rwr_cache_size;
+/*	int	var_rwr_stat_interval;
 /* DESCRIPTION
 /*	This module (actually the associated include file) defines
 /*	the names and defaults of all mail configuration parameters.
@@ -234,6 +244,7 @@
 #include <dict.h>
 #include <dict_db.h>
 #include <dict_lmdb.h>
+#include <dict_pcre.h>
 #include <dict_sockmap.h>
 #include <inet_proto.h>
 #include <vstring_vstream.h>
@@ -241,6 +252,7 @@
 #include <midna_domain.h>
 #include <logwriter.h>
 #include <mac_midna.h>
+#include <re_prefilter.h>
 
 /* Global library. */
 
@@ -342,6 +354,7 @@ char   *var_cleanup_service;
 char   *var_defer_service;
 char   *var_pickup_service;
 char   *var_queue_service;
+int     var_qmgr_shard_count;
 char   *var_rewrite_service;
 char   *var_showq_service;
 char   *var_error_service;
@@ -353,6 +366,7 @@ char   *var_proxywrite_service;
 int     var_db_create_buf;
 int     var_db_read_buf;
 long    var_lmdb_map_size;
+int     var_pcre_stat_interval;
 int     var_proc_limit;
 int     var_mime_maxdepth;
 int     var_mime_bound_len;
@@ -379,6 +393,7 @@ char   *var_multi_name;
 bool    var_multi_enable;
 bool    var_long_queue_ids;
 bool    var_daemon_open_fatal;
+bool    var_table_prefilter;
 bool    var_dns_ncache_ttl_fix;
 char   *var_dsn_filter;
 bool    var_smtputf8_enable;
@@ -408,6 +423,13 @@ char   *var_nbdb_service;
 char   *var_nbdb_cust_map;
 bool    var_nbdb_log_redirect;
 
+bool    var_milt_parallel;
+bool    var_milt_lat_log;
+bool    var_milt_conn_reuse;
+int     var_milt_cache_time;
+int     var_rwr_cache_size;
+int     var_rwr_stat_interval;
+
 const char null_format_string[1] = "";
 
  /*
@@ -804,6 +826,7 @@ void    mail_params_init()
 	/* read and process the following before opening tables. */
 	VAR_DAEMON_OPEN_FATAL, DEF_DAEMON_OPEN_FATAL, &var_daemon_open_fatal,
 	VAR_DNS_NCACHE_TTL_FIX, DEF_DNS_NCACHE_TTL_FIX, &var_dns_ncache_ttl_fix,
+	VAR_TABLE_PREFILTER, DEF_TABLE_PREFILTER, &var_table_prefilter,
 	0,
     };
     static const CONFIG_NBOOL_TABLE first_nbool_defaults[] = {
@@ -905,6 +928,10 @@ void    mail_params_init()
 	VAR_INET_WINDOW, DEF_INET_WINDOW, &var_inet_windowsize, 0, 0,
 	VAR_SOCKMAP_MAX_REPLY, DEF_SOCKMAP_MAX_REPLY, &var_sockmap_max_reply, 1, 0,
 	VAR_SOCKMAP_MAX_QUERY, DEF_SOCKMAP_MAX_QUERY, &var_sockmap_max_query, 1, 0,
+	VAR_PCRE_STAT_INTERVAL, DEF_PCRE_STAT_INTERVAL, &var_pcre_stat_interval, 0, 0,
+	VAR_RWR_CACHE_SIZE, DEF_RWR_CACHE_SIZE, &var_rwr_cache_size, 0, 0,
+	VAR_RWR_STAT_INTERVAL, DEF_RWR_STAT_INTERVAL, &var_rwr_stat_interval, 0, 0,
+	VAR_QMGR_SHARD_COUNT, DEF_QMGR_SHARD_COUNT, &var_qmgr_shard_count, 1, MAX_QMGR_SHARD_COUNT,
 	0,
     };
     static const CONFIG_LONG_TABLE long_defaults[] = {
@@ -924,6 +951,7 @@ void    mail_params_init()
 	VAR_FLOCK_STALE, DEF_FLOCK_STALE, &var_flock_stale, 1, 0,
 	VAR_DAEMON_TIMEOUT, DEF_DAEMON_TIMEOUT, &var_daemon_timeout, 1, 0,
 	VAR_IN_FLOW_DELAY, DEF_IN_FLOW_DELAY, &var_in_flow_delay, 0, 10,
+	VAR_MILT_CACHE_TIME, DEF_MILT_CACHE_TIME, &var_milt_cache_time, 1, 0,
 	0,
     };
     static const CONFIG_BOOL_TABLE bool_defaults[] = {
@@ -944,6 +972,9 @@ void    mail_params_init()
 	VAR_LONG_QUEUE_IDS, DEF_LONG_QUEUE_IDS, &var_long_queue_ids,
 	VAR_STRICT_SMTPUTF8, DEF_STRICT_SMTPUTF8, &var_strict_smtputf8,
 	VAR_ENABLE_ORCPT, DEF_ENABLE_ORCPT, &var_enable_orcpt,
+	VAR_MILT_PARALLEL, DEF_MILT_PARALLEL, &var_milt_parallel,
+	VAR_MILT_LAT_LOG, DEF_MILT_LAT_LOG, &var_milt_lat_log,
+	VAR_MILT_CONN_REUSE, DEF_MILT_CONN_REUSE, &var_milt_conn_reuse,
 	0,
     };
     const char *cp;
@@ -981,6 +1012,7 @@ void    mail_params_init()
     get_mail_conf_bool_table(first_bool_defaults);
     if (var_daemon_open_fatal)
 	dict_allow_surrogate = 0;
+    re_prefilter_enable = var_table_prefilter;
 
     /*
      * Should we open tables with UTF8 support, or in the legacy 8-bit clean
@@ -1058,6 +1090,7 @@ void    mail_params_init()
     check_overlap();
     dict_db_cache_size = var_db_read_buf;
     dict_lmdb_map_size = var_lmdb_map_size;
+    dict_pcre_stat_interval = var_pcre_stat_interval;
     dict_sockmap_max_reply = var_sockmap_max_reply;
     dict_sockmap_max_query = var_sockmap_max_query;
     inet_windowsize = var_inet_windowsize;
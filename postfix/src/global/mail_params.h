@@ -812,6 +812,37 @@ extern int var_max_backoff_time;
 #define DEF_MAX_QUEUE_TIME	"5d"
 extern int var_max_queue_time;
 
+ /*
+  * Deferred queue retry index. With a large deferred queue, this saves the
+  * queue manager from looking at every deferred queue file every
+  * $queue_run_delay seconds.
+  */
+#define VAR_QMGR_DEFER_INDEX	"qmgr_deferred_index"
+#define DEF_QMGR_DEFER_INDEX	0
+extern bool var_qmgr_defer_index;
+
+#define VAR_QMGR_DEFER_RESCAN	"qmgr_deferred_rescan_time"
+#define DEF_QMGR_DEFER_RESCAN	"1h"
+extern int var_qmgr_defer_rescan;
+
+ /*
+  * Active queue snapshot. With a large active queue, this saves the queue
+  * manager from moving every active queue file to the incoming queue and
+  * back after a restart.
+  */
+#define VAR_QMGR_ACT_SNAPSHOT	"qmgr_active_snapshot"
+#define DEF_QMGR_ACT_SNAPSHOT	0
+extern bool var_qmgr_act_snapshot;
+
+ /*
+  * Queue manager status report, for "postqueue -S". The socket lives in the
+  * public directory, so that postqueue can reach it from outside the chroot
+  * jail. Specify an empty name to disable.
+  */
+#define VAR_QMGR_STATUS_SERVICE	"qmgr_status_service_name"
+#define DEF_QMGR_STATUS_SERVICE	"qstatus"
+extern char *var_qmgr_status_service;
+
  /*
   * XXX The default can't be $maximal_queue_lifetime, because that panics
   * when a non-default maximal_queue_lifetime setting contains no time unit.
@@ -2973,12 +3004,33 @@ extern char *var_pickup_service;
 #define DEF_QUEUE_SERVICE		MAIL_SERVICE_QUEUE
 extern char *var_queue_service;
 
+ /*
+  * Queue manager shards. Each shard handles the queue files whose queue ID
+  * hashes to its index. Shard 0 is $queue_service_name, shard N is
+  * $queue_service_name-N.
+  */
+#define VAR_QMGR_SHARD_COUNT		"qmgr_shard_count"
+#define DEF_QMGR_SHARD_COUNT		1
+#define MAX_QMGR_SHARD_COUNT		64
+extern int var_qmgr_shard_count;
+
  /* XXX resolve does not exist as a separate service */
 
 #define VAR_REWRITE_SERVICE		"rewrite_service_name"
 #define DEF_REWRITE_SERVICE		MAIL_SERVICE_REWRITE
 extern char *var_rewrite_service;
 
+ /*
+  * Address rewriting and resolving client cache.
+  */
+#define VAR_RWR_CACHE_SIZE		"rewrite_client_cache_size"
+#define DEF_RWR_CACHE_SIZE		100
+extern int var_rwr_cache_size;
+
+#define VAR_RWR_STAT_INTERVAL		"rewrite_client_statistics_interval"
+#define DEF_RWR_STAT_INTERVAL		0
+extern int var_rwr_stat_interval;
+
 #define VAR_SHOWQ_SERVICE		"showq_service_name"
 #define DEF_SHOWQ_SERVICE		MAIL_SERVICE_SHOWQ
 extern char *var_showq_service;
@@ -3152,6 +3204,13 @@ extern int var_db_read_buf;
 #define DEF_LMDB_MAP_SIZE		(16 * 1024 *1024)
 extern long var_lmdb_map_size;
 
+ /*
+  * PCRE table statistics.
+  */
+#define VAR_PCRE_STAT_INTERVAL		"pcre_table_statistics_interval"
+#define DEF_PCRE_STAT_INTERVAL		0
+extern int var_pcre_stat_interval;
+
  /*
   * Named queue file attributes.
   */
@@ -3689,6 +3748,22 @@ extern char *var_milt_head_checks;
 #define DEF_MILT_MACRO_DEFLTS		""
 extern char *var_milt_macro_deflts;
 
+#define VAR_MILT_PARALLEL		"milter_parallel_events"
+#define DEF_MILT_PARALLEL		0
+extern bool var_milt_parallel;
+
+#define VAR_MILT_LAT_LOG		"milter_latency_logging"
+#define DEF_MILT_LAT_LOG		0
+extern bool var_milt_lat_log;
+
+#define VAR_MILT_CONN_REUSE		"milter_connection_reuse"
+#define DEF_MILT_CONN_REUSE		0
+extern bool var_milt_conn_reuse;
+
+#define VAR_MILT_CACHE_TIME		"milter_connection_cache_time_limit"
+#define DEF_MILT_CACHE_TIME		"10s"
+extern int var_milt_cache_time;
+
  /*
   * What internal mail do we inspect/stamp/etc.? This is not yet safe enough
   * to enable world-wide.
@@ -3776,6 +3851,13 @@ extern int var_conc_cohort_limit;
 #define DEF_CONC_FDBACK_DEBUG	0
 extern bool var_conc_feedback_debug;
 
+#define VAR_CONC_FDBACK_MODE	"default_destination_concurrency_feedback_mode"
+#define _CONC_FDBACK_MODE	"_destination_concurrency_feedback_mode"
+#define CONC_FDBACK_MODE_CLASSIC "classic"
+#define CONC_FDBACK_MODE_LATENCY "latency"
+#define DEF_CONC_FDBACK_MODE	CONC_FDBACK_MODE_CLASSIC
+extern char *var_conc_feedback_mode;
+
 #define VAR_DEST_RATE_DELAY	"default_destination_rate_delay"
 #define _DEST_RATE_DELAY	"_destination_rate_delay"
 #define DEF_DEST_RATE_DELAY	"0s"
@@ -3786,6 +3868,43 @@ extern int var_dest_rate_delay;
 #define DEF_XPORT_RATE_DELAY	"0s"
 extern int var_xport_rate_delay;
 
+#define VAR_DEST_RATE_LIMIT	"default_destination_rate_limit"
+#define _DEST_RATE_LIMIT	"_destination_rate_limit"
+#define DEF_DEST_RATE_LIMIT	"0"
+extern char *var_dest_rate_limit;
+
+#define VAR_DEST_RATE_BURST	"default_destination_rate_burst"
+#define _DEST_RATE_BURST	"_destination_rate_burst"
+#define DEF_DEST_RATE_BURST	1
+extern int var_dest_rate_burst;
+
+#define VAR_XPORT_RATE_LIMIT	"default_transport_rate_limit"
+#define _XPORT_RATE_LIMIT	"_transport_rate_limit"
+#define DEF_XPORT_RATE_LIMIT	"0"
+extern char *var_xport_rate_limit;
+
+#define VAR_XPORT_RATE_BURST	"default_transport_rate_burst"
+#define _XPORT_RATE_BURST	"_transport_rate_burst"
+#define DEF_XPORT_RATE_BURST	1
+extern int var_xport_rate_burst;
+
+#define VAR_DEST_BATCH_LIMIT	"default_destination_batch_limit"
+#define _DEST_BATCH_LIMIT	"_destination_batch_limit"
+#define DEF_DEST_BATCH_LIMIT	1
+extern int var_dest_batch_limit;
+
+#define VAR_PRIO_LANE_MODE	"default_priority_lane_mode"
+#define _PRIO_LANE_MODE		"_priority_lane_mode"
+#define PRIO_LANE_MODE_STRICT	"strict"
+#define PRIO_LANE_MODE_WEIGHTED	"weighted"
+#define DEF_PRIO_LANE_MODE	PRIO_LANE_MODE_STRICT
+extern char *var_prio_lane_mode;
+
+#define VAR_PRIO_LANE_WEIGHTS	"default_priority_lane_weights"
+#define _PRIO_LANE_WEIGHTS	"_priority_lane_weights"
+#define DEF_PRIO_LANE_WEIGHTS	"high=8, normal=4, low=1"
+extern char *var_prio_lane_weights;
+
  /*
   * Stress handling.
   */
@@ -4366,6 +4485,14 @@ extern char *var_sm_fix_eol;
 #define DEF_DAEMON_OPEN_FATAL	0
 extern bool var_daemon_open_fatal;
 
+ /*
+  * Skip regexp: and pcre: table patterns whose required literal substring
+  * is absent from the lookup string.
+  */
+#define VAR_TABLE_PREFILTER	"regexp_table_literal_prefilter"
+#define DEF_TABLE_PREFILTER	0
+extern bool var_table_prefilter;
+
  /*
   * Optional delivery status filter.
   */
@@ -4420,6 +4547,15 @@ extern char *var_smtpd_dns_re_filter;
 #define DEF_CLEANUP_MASK_STRAY_CR_LF	1
 extern bool var_cleanup_mask_stray_cr_lf;
 
+ /*
+  * Share file system syncs between cleanup(8) processes.
+  */
+#define VAR_CLEANUP_GROUP_COMMIT	"cleanup_group_commit"
+#define DEF_CLEANUP_GROUP_COMMIT	0
+extern bool var_cleanup_group_commit;
+
+#define CLEANUP_GROUP_COMMIT_FILE	"cleanup_group_commit"
+
  /*
   * Share TLS sessions through tlsproxy(8).
   */
@@ -0,0 +1,69 @@
+/*++
+/* NAME
+/*	mail_priority 3
+/* SUMMARY
+/*	message priority names
+/* SYNOPSIS
+/*	#include <mail_priority.h>
+/*
+/*	int	mail_priority_from_string(const char *priority_name)
+/*
+/*	const char *mail_priority_to_string(int priority)
+/* DESCRIPTION
+/*	A message priority selects the queue manager scheduling lane
+/*	of a message. It is stored in the queue file as a named
+/*	attribute. Messages without priority attribute have normal
+/*	priority.
+/*
+/*	mail_priority_from_string() converts a symbolic priority
+/*	name ("high", "normal", "low") into the corresponding
+/*	internal code. The result is -1 if an unrecognized name
+/*	was specified. Names are case-insensitive.
+/*
+/*	mail_priority_to_string() converts from internal code
+/*	to the corresponding symbolic name. The result is null if
+/*	an unrecognized code was specified.
+/* LICENSE
+/* .ad
+/* .fi
+/*	The Secure Mailer license must be distributed with this software.
+/* AUTHOR(S)
+/*	agent
+/*	agent@local
+/*--*/
+
+ /*
+  * System library.
+  */
+#include <sys_defs.h>
+
+ /*
+  * Utility library.
+  */
+#include <name_code.h>
+
+ /*
+  * Global library.
+  */
+#include <mail_priority.h>
+
+static const NAME_CODE priority_table[] = {
+    "high", MAIL_PRIORITY_HIGH,
+    "normal", MAIL_PRIORITY_NORMAL,
+    "low", MAIL_PRIORITY_LOW,
+    0, -1,
+};
+
+/* mail_priority_from_string - symbolic priority to internal form */
+
+int     mail_priority_from_string(const char *priority_name)
+{
+    return (name_code(priority_table, NAME_CODE_FLAG_NONE, priority_name));
+}
+
+/* mail_priority_to_string - internal form to symbolic priority */
+
+const char *mail_priority_to_string(int priority)
+{
+    return (str_name_code(priority_table, priority));
+}
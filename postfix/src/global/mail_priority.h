@@ -0,0 +1,35 @@
+#ifndef _MAIL_PRIORITY_H_INCLUDED_
+#define _MAIL_PRIORITY_H_INCLUDED_
+
+/*++
+/* NAME
+/*	mail_priority 3h
+/* SUMMARY
+/*	message priority names
+/* SYNOPSIS
+/*	#include <mail_priority.h>
+/* DESCRIPTION
+/* .nf
+
+ /*
+  * External interface. Lower codes are scheduled first.
+  */
+#define MAIL_PRIORITY_HIGH	0
+#define MAIL_PRIORITY_NORMAL	1
+#define MAIL_PRIORITY_LOW	2
+
+#define MAIL_PRIORITY_COUNT	3
+
+extern int mail_priority_from_string(const char *);
+extern const char *mail_priority_to_string(int);
+
+/* LICENSE
+/* .ad
+/* .fi
+/*	The Secure Mailer license must be distributed with this software.
+/* AUTHOR(S)
+/*	agent
+/*	agent@local
+/*--*/
+
+#endif
@@ -153,6 +153,9 @@ extern char *mail_pathname(const char *, const char *);
 #define MAIL_ATTR_REQ		"request"
 #define MAIL_ATTR_NREQ		"nrequest"
 #define MAIL_ATTR_STATUS	"status"
+#define MAIL_ATTR_DEFER_THROTTLE "defer_throttle"
+#define MAIL_ATTR_DEFER_OTHER	"defer_other"
+#define MAIL_ATTR_BATCH		"batch"
 
 #define MAIL_ATTR_FLAGS		"flags"
 #define MAIL_ATTR_QUEUE		"queue_name"
@@ -239,6 +242,8 @@ extern char *mail_pathname(const char *, const char *);
 #define MAIL_ATTR_ENC_7BIT	"7bit"	/* 7BIT equivalent */
 #define MAIL_ATTR_ENC_NONE	""	/* encoding unknown */
 
+#define MAIL_ATTR_PRIORITY	"priority"	/* scheduling lane */
+
 #define MAIL_ATTR_LOG_CLIENT_NAME "log_client_name"	/* client hostname */
 #define MAIL_ATTR_LOG_CLIENT_ADDR "log_client_address"	/* client address */
 #define MAIL_ATTR_LOG_CLIENT_PORT "log_client_port"	/* client port */
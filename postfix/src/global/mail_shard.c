@@ -0,0 +1,149 @@
+/*++
+/* NAME
+/*	mail_shard 3
+/* SUMMARY
+/*	queue manager shard support
+/* SYNOPSIS
+/*	#include <mail_shard.h>
+/*
+/*	int	mail_shard_index(queue_id)
+/*	const char *queue_id;
+/*
+/*	const char *mail_shard_service(buf, base, index)
+/*	VSTRING	*buf;
+/*	const char *base;
+/*	int	index;
+/*
+/*	int	mail_shard_parse(base, service)
+/*	const char *base;
+/*	const char *service;
+/*
+/*	int	mail_shard_trigger(base, request, length)
+/*	const char *base;
+/*	const char *request;
+/*	ssize_t	length;
+/* DESCRIPTION
+/*	With "qmgr_shard_count = N", N queue manager processes share
+/*	the work. Each queue manager ("shard") handles the queue files
+/*	whose queue ID maps to its shard index. A queue file keeps its
+/*	queue ID when it moves between the incoming, active and
+/*	deferred queues, and therefore it stays with the same shard.
+/*
+/*	Shard 0 uses the service name $queue_service_name; shard
+/*	\fIn\fR uses the service name $queue_service_name-\fIn\fR.
+/*
+/*	mail_shard_index() returns the shard index of the specified
+/*	queue ID. The result is 0 when sharding is turned off.
+/*
+/*	mail_shard_service() formats the name of the specified shard
+/*	of the named service, and returns a pointer to the result.
+/*
+/*	mail_shard_parse() returns the shard index that corresponds
+/*	to the specified service name, or -1 when the service name
+/*	does not belong to a shard of the named base service.
+/*
+/*	mail_shard_trigger() sends the specified trigger request to
+/*	all shards of the named public service. The result is 0 in
+/*	case of success, -1 when at least one shard could not be
+/*	reached.
+/* SEE ALSO
+/*	mail_trigger(3), trigger a service
+/* LICENSE
+/* .ad
+/* .fi
+/*	The Secure Mailer license must be distributed with this software.
+/* AUTHOR(S)
+/*	agent
+/*	agent@local
+/*--*/
+
+/* System library. */
+
+#include <sys_defs.h>
+#include <string.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <errno.h>
+
+/* Utility library. */
+
+#include <vstring.h>
+#include <stringops.h>
+
+/* Global library. */
+
+#include <mail_params.h>
+#include <mail_proto.h>
+#include <mail_shard.h>
+
+/* mail_shard_index - map queue ID to shard */
+
+int     mail_shard_index(const char *queue_id)
+{
+    unsigned long hash = 2166136261UL;
+    const unsigned char *cp;
+
+    /*
+     * FNV-1a. The result must not depend on the program or on the platform,
+     * because different programs must agree on the shard of a queue file.
+     */
+    if (var_qmgr_shard_count <= 1)
+	return (0);
+    for (cp = (const unsigned char *) queue_id; *cp; cp++)
+	hash = ((hash ^ *cp) * 16777619UL) & 0xffffffffUL;
+    return (hash % var_qmgr_shard_count);
+}
+
+/* mail_shard_service - format shard service name */
+
+const char *mail_shard_service(VSTRING *buf, const char *base, int index)
+{
+    if (index == 0)
+	vstring_strcpy(buf, base);
+    else
+	vstring_sprintf(buf, "%s-%d", base, index);
+    return (vstring_str(buf));
+}
+
+/* mail_shard_parse - map service name to shard */
+
+int     mail_shard_parse(const char *base, const char *service)
+{
+    size_t  len = strlen(base);
+    const char *cp;
+    char   *end;
+    long    index;
+
+    if (strncmp(service, base, len) != 0)
+	return (-1);
+    cp = service + len;
+    if (*cp == 0)
+	return (0);
+    if (*cp++ != '-' || !ISDIGIT(*cp) || *cp == '0')
+	return (-1);
+    errno = 0;
+    index = strtol(cp, &end, 10);
+    if (*end != 0 || errno != 0 || index >= MAX_QMGR_SHARD_COUNT)
+	return (-1);
+    return ((int) index);
+}
+
+/* mail_shard_trigger - trigger all shards */
+
+int     mail_shard_trigger(const char *base, const char *request,
+			           ssize_t length)
+{
+    VSTRING *buf;
+    int     status = 0;
+    int     index;
+
+    if (var_qmgr_shard_count <= 1)
+	return (mail_trigger(MAIL_CLASS_PUBLIC, base, request, length));
+    buf = vstring_alloc(100);
+    for (index = 0; index < var_qmgr_shard_count; index++)
+	if (mail_trigger(MAIL_CLASS_PUBLIC, mail_shard_service(buf, base, index),
+			 request, length) < 0)
+	    status = -1;
+    vstring_free(buf);
+    return (status);
+}
@@ -38,6 +38,9 @@
 /*	void	mail_stream_ctl(info, op, ...)
 /*	MAIL_STREAM *info;
 /*	int	op;
+/*
+/*	void	mail_stream_group_commit(path)
+/*	const char *path;
 /* DESCRIPTION
 /*	This module provides a generic interface to Postfix queue file
 /*	format messages to file, to Postfix server, or to external command.
@@ -96,6 +99,19 @@
 /*	file modification time stamp by this amount.  This has
 /*	effect only within the deferred mail queue.
 /*	This feature may have no effect with remote file systems.
+/* .PP
+/*	mail_stream_group_commit() changes how mail_stream_finish()
+/*	makes a queue file durable: instead of one fsync() call per
+/*	file, concurrent processes share file system syncs through
+/*	the named coordination file (see group_sync(3)). The result
+/*	still becomes available only after the queue file is durable.
+/*	This function should be called before the process enters
+/*	a chroot jail. It logs a warning and has no effect when the
+/*	coordination file cannot be opened, when the system does
+/*	not support file system syncs, or when the kernel is older
+/*	than Linux 5.8, whose syncfs(2) does not report writeback
+/*	errors. When a file system sync fails, mail_stream_finish()
+/*	falls back to fsync() for that file.
 /* LICENSE
 /* .ad
 /* .fi
@@ -132,6 +148,7 @@
 #include <argv.h>
 #include <sane_fsops.h>
 #include <warn_stat.h>
+#include <group_sync.h>
 
 /* Global library. */
 
@@ -146,6 +163,7 @@
 /* Application-specific. */
 
 static VSTRING *id_buf;
+static GROUP_SYNC *mail_stream_group;
 
 #define FREE_AND_WIPE(free, arg) do { if (arg) free(arg); arg = 0; } while (0)
 
@@ -301,7 +319,9 @@ static int mail_stream_finish_file(MAIL_STREAM *info, VSTRING *unused_why)
 #endif
 	|| fchmod(vstream_fileno(info->stream), 0700 | info->mode)
 #ifdef HAS_FSYNC
-	|| fsync(vstream_fileno(info->stream))
+	|| (mail_stream_group ?
+	    group_sync(mail_stream_group, vstream_fileno(info->stream)) :
+	    fsync(vstream_fileno(info->stream)))
 #endif
 	|| (check_incoming_fs_clock
 	    && fstat(vstream_fileno(info->stream), &st) < 0)
@@ -399,6 +419,19 @@ static int mail_stream_finish_ipc(MAIL_STREAM *info, VSTRING *why)
     return (status);
 }
 
+/* mail_stream_group_commit - share file system syncs with other processes */
+
+void    mail_stream_group_commit(const char *path)
+{
+#ifdef HAS_SYNCFS
+    if (mail_stream_group == 0
+	&& (mail_stream_group = group_sync_open(path)) == 0)
+	msg_warn("open %s: %m -- group commit is disabled", path);
+#else
+    msg_warn("group commit is not supported on this system");
+#endif
+}
+
 /* mail_stream_finish - finish action */
 
 int     mail_stream_finish(MAIL_STREAM *info, VSTRING *why)
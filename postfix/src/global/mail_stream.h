@@ -75,6 +75,7 @@ extern MAIL_STREAM *mail_stream_command(const char *);
 extern void mail_stream_cleanup(MAIL_STREAM *);
 extern int mail_stream_finish(MAIL_STREAM *, VSTRING *);
 extern void mail_stream_ctl(MAIL_STREAM *, int,...);
+extern void mail_stream_group_commit(const char *);
 
 
 /* LICENSE
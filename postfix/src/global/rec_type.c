@@ -71,6 +71,8 @@ REC_TYPE_NAME rec_type_names[] = {
     REC_TYPE_DSN_ENVID, "dsn_envelope_id",
     REC_TYPE_DSN_ORCPT, "dsn_original_recipient",
     REC_TYPE_DSN_NOTIFY, "dsn_notify_flags",
+    REC_TYPE_RIDX, "recipient_index",
+    REC_TYPE_DIDX, "done_recipient_index",
     0, 0,
 };
 
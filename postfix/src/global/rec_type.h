@@ -74,6 +74,9 @@
 
 #define REC_TYPE_MILT_COUNT	'm'
 
+#define REC_TYPE_RIDX	'b'		/* recipient batch index entry */
+#define REC_TYPE_DIDX	'B'		/* delivered recipient batch */
+
 #define REC_TYPE_END	'E'		/* terminator, required */
 
  /*
@@ -122,15 +125,19 @@
   * fixed-width fields so they can be updated in place. Queue manager hints
   * are defined in qmgr_user.h
   * 
+  * The recipient index offset specifies where the recipient batch index
+  * starts, or zero if there is none. See REC_TYPE_RIDX_FORMAT below.
+  * 
   * See also: REC_TYPE_PTR_FORMAT below.
   */
-#define REC_TYPE_SIZE_FORMAT	"%15ld %15ld %15ld %15ld %15ld %15ld"
+#define REC_TYPE_SIZE_FORMAT	"%15ld %15ld %15ld %15ld %15ld %15ld %15ld"
 #define REC_TYPE_SIZE_CAST1	long	/* Vmailer extra offs - data offs */
 #define REC_TYPE_SIZE_CAST2	long	/* Postfix 1.0 data offset */
 #define REC_TYPE_SIZE_CAST3	long	/* Postfix 1.0 recipient count */
 #define REC_TYPE_SIZE_CAST4	long	/* Postfix 2.1 qmgr flags */
 #define REC_TYPE_SIZE_CAST5	long	/* Postfix 2.4 content length */
 #define REC_TYPE_SIZE_CAST6	long	/* Postfix 3.0 smtputf8 flags */
+#define REC_TYPE_SIZE_CAST7	long	/* Postfix 3.12 recipient index */
 
  /*
   * The warn record specifies when the next warning that the message was
@@ -180,6 +187,18 @@
 #define REC_TYPE_PTR_PAYL_SIZE	15	/* Payload only, excludes record
 					 * header. */
 
+ /*
+  * A queue file with many recipients may have a recipient batch index in
+  * the heap after the end-of-message marker, where it is invisible to
+  * programs that stop reading at that marker. Each index entry specifies
+  * the start and end offset of a contiguous sequence of recipient record
+  * groups, and the number of recipients in that sequence. The queue manager
+  * changes the record type from REC_TYPE_RIDX into REC_TYPE_DIDX when it
+  * finds that all recipients in the sequence are done, so that it can skip
+  * the sequence next time.
+  */
+#define REC_TYPE_RIDX_FORMAT	"%ld %ld %ld"
+
  /*
   * Programmatic interface.
   */
@@ -71,16 +71,23 @@
 /*	recipient_list_add() and to recipient_list_free(). The variant
 /*	argument specifies how list elements should be initialized;
 /*	specify RCPT_LIST_INIT_STATUS to zero the status field, and
-/*	RCPT_LIST_INIT_QUEUE to zero the queue field.
+/*	RCPT_LIST_INIT_QUEUE to zero the queue field. Specify
+/*	RCPT_LIST_INIT_QUEUE | RCPT_LIST_FLAG_NOCOPY for a list that
+/*	does not own its recipient address information (see below).
 /*
 /*	recipient_list_add() adds a recipient to the specified list.
-/*	Recipient address information is copied with mystrdup().
+/*	Recipient address information is copied with mystrdup(),
+/*	unless the list was created with RCPT_LIST_FLAG_NOCOPY. In
+/*	that case the caller's pointers are stored as is, and the
+/*	caller must guarantee that the information outlives the list,
+/*	for example by allocating it from a memory arena.
 /*
 /*	recipient_list_swap() swaps the recipients between
 /*	the given two recipient lists.
 /*
 /*	recipient_list_free() releases memory for the specified list
-/*	of recipient structures.
+/*	of recipient structures. With RCPT_LIST_FLAG_NOCOPY, recipient
+/*	address information is left alone.
 /*
 /*	RECIPIENT_ASSIGN() assigns the fields of a recipient structure
 /*	without making copies of its arguments.
@@ -131,7 +138,8 @@ void    recipient_list_init(RECIPIENT_LIST *list, int variant)
     list->avail = 1;
     list->len = 0;
     list->info = (RECIPIENT *) mymalloc(sizeof(RECIPIENT));
-    list->variant = variant;
+    list->variant = (variant & ~RCPT_LIST_FLAG_MASK);
+    list->flags = (variant & RCPT_LIST_FLAG_MASK);
 }
 
 /* recipient_list_add - add rcpt to list */
@@ -148,10 +156,16 @@ void    recipient_list_add(RECIPIENT_LIST *list, long offset,
 	    myrealloc((void *) list->info, new_avail * sizeof(RECIPIENT));
 	list->avail = new_avail;
     }
-    list->info[list->len].orig_addr = mystrdup(orig_rcpt);
-    list->info[list->len].address = mystrdup(rcpt);
+    if (list->flags & RCPT_LIST_FLAG_NOCOPY) {
+	list->info[list->len].orig_addr = orig_rcpt;
+	list->info[list->len].address = rcpt;
+	list->info[list->len].dsn_orcpt = dsn_orcpt;
+    } else {
+	list->info[list->len].orig_addr = mystrdup(orig_rcpt);
+	list->info[list->len].address = mystrdup(rcpt);
+	list->info[list->len].dsn_orcpt = mystrdup(dsn_orcpt);
+    }
     list->info[list->len].offset = offset;
-    list->info[list->len].dsn_orcpt = mystrdup(dsn_orcpt);
     list->info[list->len].dsn_notify = dsn_notify;
     if (list->variant == RCPT_LIST_INIT_STATUS)
 	list->info[list->len].u.status = 0;
@@ -166,7 +180,7 @@ void    recipient_list_add(RECIPIENT_LIST *list, long offset,
 
 void    recipient_list_swap(RECIPIENT_LIST *a, RECIPIENT_LIST *b)
 {
-    if (b->variant != a->variant)
+    if (b->variant != a->variant || b->flags != a->flags)
 	msg_panic("recipient_lists_swap: incompatible recipient list variants");
 
 #define SWAP(t, x)  do { t x = b->x; b->x = a->x ; a->x = x; } while (0)
@@ -182,10 +196,11 @@ void    recipient_list_free(RECIPIENT_LIST *list)
 {
     RECIPIENT *rcpt;
 
-    for (rcpt = list->info; rcpt < list->info + list->len; rcpt++) {
-	myfree((void *) rcpt->dsn_orcpt);
-	myfree((void *) rcpt->orig_addr);
-	myfree((void *) rcpt->address);
-    }
+    if ((list->flags & RCPT_LIST_FLAG_NOCOPY) == 0)
+	for (rcpt = list->info; rcpt < list->info + list->len; rcpt++) {
+	    myfree((void *) rcpt->dsn_orcpt);
+	    myfree((void *) rcpt->orig_addr);
+	    myfree((void *) rcpt->address);
+	}
     myfree((void *) list->info);
 }
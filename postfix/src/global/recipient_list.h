@@ -51,6 +51,7 @@ typedef struct RECIPIENT_LIST {
     int     len;
     int     avail;
     int     variant;
+    int     flags;
 } RECIPIENT_LIST;
 
 extern void recipient_list_init(RECIPIENT_LIST *, int);
@@ -62,6 +63,9 @@ extern void recipient_list_free(RECIPIENT_LIST *);
 #define RCPT_LIST_INIT_QUEUE	2
 #define RCPT_LIST_INIT_ADDR	3
 
+#define RCPT_LIST_FLAG_NOCOPY	(1<<8)	/* list does not own strings */
+#define RCPT_LIST_FLAG_MASK	(RCPT_LIST_FLAG_NOCOPY)
+
 /* LICENSE
 /* .ad
 /* .fi
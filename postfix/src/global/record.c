@@ -84,6 +84,11 @@
 /*	the application.
 /* .IP REC_FLAG_SEEK_END
 /*	Seek to the end-of-file upon reading a REC_TYPE_END record.
+/* .IP REC_FLAG_APPEND
+/*	Append the record content to the result buffer, instead of
+/*	overwriting it. This allows an application to collect the
+/*	content of multiple records in one buffer without making an
+/*	extra copy.
 /* .PP
 /*	Specify REC_FLAG_NONE to request no special processing,
 /*	and REC_FLAG_DEFAULT for normal use.
@@ -240,6 +245,7 @@ int     rec_get_raw(VSTREAM *stream, VSTRING *buf, ssize_t maxsize, int flags)
     ssize_t len;
     ssize_t len_byte;
     unsigned shift;
+    ssize_t base = (flags & REC_FLAG_APPEND) ? VSTRING_LEN(buf) : 0;
 
     /*
      * Sanity check.
@@ -287,7 +293,9 @@ int     rec_get_raw(VSTREAM *stream, VSTRING *buf, ssize_t maxsize, int flags)
 	 * Reserve buffer space for the result, and read the record data into
 	 * the buffer.
 	 */
-	if (vstream_fread_buf(stream, buf, len) != len) {
+	if (((flags & REC_FLAG_APPEND) ?
+	     vstream_fread_app(stream, buf, len) :
+	     vstream_fread_buf(stream, buf, len)) != len) {
 	    msg_warn("%s: unexpected EOF in data, record type %d length %ld",
 		     VSTREAM_PATH(stream), type, (long) len);
 	    return (REC_TYPE_ERROR);
@@ -295,18 +303,25 @@ int     rec_get_raw(VSTREAM *stream, VSTRING *buf, ssize_t maxsize, int flags)
 	VSTRING_TERMINATE(buf);
 	if (msg_verbose > 2)
 	    msg_info("%s: type %c len %ld data %.10s", myname,
-		     type, (long) len, vstring_str(buf));
+		     type, (long) len, vstring_str(buf) + base);
 
 	/*
-	 * Transparency options.
+	 * Transparency options. With REC_FLAG_APPEND, discard the content of
+	 * records that aren't exposed to the application.
 	 */
-	if (flags == 0)
+	if ((flags & ~REC_FLAG_APPEND) == 0)
 	    break;
 	if (type == REC_TYPE_PTR && (flags & REC_FLAG_FOLLOW_PTR) != 0
-	    && (type = rec_goto(stream, vstring_str(buf))) != REC_TYPE_ERROR)
+	  && (type = rec_goto(stream, vstring_str(buf) + base)) != REC_TYPE_ERROR) {
+	    vstring_truncate(buf, base);
+	    VSTRING_TERMINATE(buf);
 	    continue;
-	if (type == REC_TYPE_DTXT && (flags & REC_FLAG_SKIP_DTXT) != 0)
+	}
+	if (type == REC_TYPE_DTXT && (flags & REC_FLAG_SKIP_DTXT) != 0) {
+	    vstring_truncate(buf, base);
+	    VSTRING_TERMINATE(buf);
 	    continue;
+	}
 	if (type == REC_TYPE_END && (flags & REC_FLAG_SEEK_END) != 0
 	    && vstream_fseek(stream, (off_t) 0, SEEK_END) < 0) {
 	    msg_warn("%s: seek error after reading END record: %m",
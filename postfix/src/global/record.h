@@ -46,6 +46,7 @@ extern int rec_pad(VSTREAM *, int, ssize_t);
 #define REC_FLAG_FOLLOW_PTR	(1<<0)	/* follow PTR records */
 #define REC_FLAG_SKIP_DTXT	(1<<1)	/* skip DTXT records */
 #define REC_FLAG_SEEK_END	(1<<2)	/* seek EOF after END record */
+#define REC_FLAG_APPEND	(1<<3)	/* append to result buffer */
 
 #define REC_FLAG_DEFAULT \
 	(REC_FLAG_FOLLOW_PTR | REC_FLAG_SKIP_DTXT | REC_FLAG_SEEK_END)
@@ -86,6 +86,13 @@
 /* .PP
 /*	For convenience, the constant RESOLVE_CLASS_FINAL includes all
 /*	cases where the local machine is the final destination.
+/*
+/*	Results are kept in a least-recently used cache with up to
+/*	\fBrewrite_client_cache_size\fR entries, keyed by request
+/*	class, sender and address. A cache entry expires after 30
+/*	seconds, and is ignored under the same conditions as a
+/*	rewrite_clnt(3) cache entry. The cache logs statistics
+/*	with the same \fBrewrite_client_statistics_interval\fR.
 /* DIAGNOSTICS
 /*	Warnings: communication failure. Fatal error: mail system is down.
 /* SEE ALSO
@@ -116,11 +123,13 @@
 /* Utility library. */
 
 #include <msg.h>
+#include <mymalloc.h>
 #include <vstream.h>
 #include <vstring.h>
 #include <vstring_vstream.h>
 #include <events.h>
 #include <iostuff.h>
+#include <ctable.h>
 
 /* Global library. */
 
@@ -135,12 +144,31 @@
   * XXX this is shared with the rewrite client to save a file descriptor.
   */
 extern CLNT_STREAM *rewrite_clnt_stream;
+extern int rewrite_clnt_generation;
 
-static time_t last_expire;
-static VSTRING *last_class;
-static VSTRING *last_sender;
-static VSTRING *last_addr;
-static RESOLVE_REPLY last_reply;
+ /*
+  * Multi-entry result cache, keyed by request class, sender and address.
+  */
+typedef struct {
+    RESOLVE_REPLY reply;		/* resolver result */
+    time_t  expire;			/* time of expiration */
+    int     generation;			/* server connection generation */
+} RESOLVE_CACHE_ENTRY;
+
+typedef struct {
+    const char *class;			/* query class */
+    const char *sender;			/* query sender */
+    const char *addr;			/* query address */
+    RESOLVE_REPLY *reply;		/* query result */
+} RESOLVE_CACHE_QUERY;
+
+static CTABLE *resolve_cache;
+static RESOLVE_CACHE_QUERY resolve_cache_query;
+static VSTRING *resolve_cache_key;
+static long resolve_cache_lookups;
+static long resolve_cache_misses;
+
+#define RESOLVE_CACHE_TTL	30	/* XXX make configurable */
 
 /* resolve_clnt_init - initialize reply */
 
@@ -156,69 +184,26 @@ void    resolve_clnt_init(RESOLVE_REPLY *reply)
 
 static int resolve_clnt_handshake(VSTREAM *stream)
 {
+    /* A new server process may have a new configuration. */
+    rewrite_clnt_generation += 1;
     return (attr_scan(stream, ATTR_FLAG_STRICT,
 		  RECV_ATTR_STREQ(MAIL_ATTR_PROTO, MAIL_ATTR_PROTO_TRIVIAL),
 		      ATTR_TYPE_END));
 }
 
-/* resolve_clnt - resolve address to (transport, next hop, recipient) */
+#define STR vstring_str
+#define IFSET(flag, text) ((reply->flags & (flag)) ? (text) : "")
 
-void    resolve_clnt(const char *class, const char *sender,
-		             const char *addr, RESOLVE_REPLY *reply)
+/* resolve_clnt_query - ask the resolve service */
+
+static void resolve_clnt_query(const char *class, const char *sender,
+			               const char *addr, RESOLVE_REPLY *reply)
 {
     const char *myname = "resolve_clnt";
     VSTREAM *stream;
     int     server_flags;
     int     count = 0;
 
-    /*
-     * One-entry cache.
-     */
-    if (last_addr == 0) {
-	last_class = vstring_alloc(10);
-	last_sender = vstring_alloc(10);
-	last_addr = vstring_alloc(100);
-	resolve_clnt_init(&last_reply);
-    }
-
-    /*
-     * Sanity check. The result must not clobber the input because we may
-     * have to retransmit the request.
-     */
-#define STR vstring_str
-
-    if (addr == STR(reply->recipient))
-	msg_panic("%s: result clobbers input", myname);
-
-    /*
-     * Peek at the cache.
-     */
-#define IFSET(flag, text) ((reply->flags & (flag)) ? (text) : "")
-
-    if (time((time_t *) 0) < last_expire
-	&& *addr && strcmp(addr, STR(last_addr)) == 0
-	&& strcmp(class, STR(last_class)) == 0
-	&& strcmp(sender, STR(last_sender)) == 0) {
-	vstring_strcpy(reply->transport, STR(last_reply.transport));
-	vstring_strcpy(reply->nexthop, STR(last_reply.nexthop));
-	vstring_strcpy(reply->recipient, STR(last_reply.recipient));
-	reply->flags = last_reply.flags;
-	if (msg_verbose)
-	    msg_info("%s: cached: `%s' -> `%s' -> transp=`%s' host=`%s' rcpt=`%s' flags=%s%s%s%s class=%s%s%s%s%s",
-		     myname, sender, addr, STR(reply->transport),
-		     STR(reply->nexthop), STR(reply->recipient),
-		     IFSET(RESOLVE_FLAG_FINAL, "final"),
-		     IFSET(RESOLVE_FLAG_ROUTED, "routed"),
-		     IFSET(RESOLVE_FLAG_ERROR, "error"),
-		     IFSET(RESOLVE_FLAG_FAIL, "fail"),
-		     IFSET(RESOLVE_CLASS_LOCAL, "local"),
-		     IFSET(RESOLVE_CLASS_ALIAS, "alias"),
-		     IFSET(RESOLVE_CLASS_VIRTUAL, "virtual"),
-		     IFSET(RESOLVE_CLASS_RELAY, "relay"),
-		     IFSET(RESOLVE_CLASS_DEFAULT, "default"));
-	return;
-    }
-
     /*
      * Keep trying until we get a complete response. The resolve service is
      * CPU bound; making the client asynchronous would just complicate the
@@ -279,18 +264,134 @@ void    resolve_clnt(const char *class, const char *sender,
 	sleep(1);				/* XXX make configurable */
 	clnt_stream_recover(rewrite_clnt_stream);
     }
+}
+
+/* resolve_clnt_copy - copy resolver result */
+
+static void resolve_clnt_copy(RESOLVE_REPLY *dst, RESOLVE_REPLY *src)
+{
+    vstring_strcpy(dst->transport, STR(src->transport));
+    vstring_strcpy(dst->nexthop, STR(src->nexthop));
+    vstring_strcpy(dst->recipient, STR(src->recipient));
+    dst->flags = src->flags;
+}
+
+/* resolve_clnt_cache_create - cache miss, ask the resolve service */
+
+static void *resolve_clnt_cache_create(const char *unused_key, void *context)
+{
+    RESOLVE_CACHE_QUERY *query = (RESOLVE_CACHE_QUERY *) context;
+    RESOLVE_CACHE_ENTRY *entry;
+
+    resolve_clnt_query(query->class, query->sender, query->addr,
+		       query->reply);
+    entry = (RESOLVE_CACHE_ENTRY *) mymalloc(sizeof(*entry));
+    resolve_clnt_init(&entry->reply);
+    resolve_clnt_copy(&entry->reply, query->reply);
+    /* Don't reuse a temporary failure result. */
+    entry->expire = (query->reply->flags & RESOLVE_FLAG_FAIL) ? 0 :
+	time((time_t *) 0) + RESOLVE_CACHE_TTL;
+    entry->generation = rewrite_clnt_generation;
+    resolve_cache_misses += 1;
+    return ((void *) entry);
+}
+
+/* resolve_clnt_cache_delete - destroy cache entry */
+
+static void resolve_clnt_cache_delete(void *value, void *unused_context)
+{
+    RESOLVE_CACHE_ENTRY *entry = (RESOLVE_CACHE_ENTRY *) value;
+
+    resolve_clnt_free(&entry->reply);
+    myfree((void *) entry);
+}
+
+/* resolve_clnt_cache_stats - log and reset cache statistics */
+
+static void resolve_clnt_cache_stats(void)
+{
+    if (resolve_cache_lookups > 0)
+	msg_info("statistics: address resolve cache: %ld lookups, "
+		 "%ld hits (%ld%%), size limit %d",
+		 resolve_cache_lookups,
+		 resolve_cache_lookups - resolve_cache_misses,
+		 100 * (resolve_cache_lookups - resolve_cache_misses)
+		 / resolve_cache_lookups, var_rwr_cache_size);
+    resolve_cache_lookups = resolve_cache_misses = 0;
+}
+
+/* resolve_clnt - resolve address to (transport, next hop, recipient) */
+
+void    resolve_clnt(const char *class, const char *sender,
+		             const char *addr, RESOLVE_REPLY *reply)
+{
+    const char *myname = "resolve_clnt";
+    RESOLVE_CACHE_ENTRY *entry;
+    long    misses = resolve_cache_misses;
 
     /*
-     * Update the cache.
+     * Sanity check. The result must not clobber the input because we may
+     * have to retransmit the request.
      */
-    vstring_strcpy(last_class, class);
-    vstring_strcpy(last_sender, sender);
-    vstring_strcpy(last_addr, addr);
-    vstring_strcpy(last_reply.transport, STR(reply->transport));
-    vstring_strcpy(last_reply.nexthop, STR(reply->nexthop));
-    vstring_strcpy(last_reply.recipient, STR(reply->recipient));
-    last_reply.flags = reply->flags;
-    last_expire = time((time_t *) 0) + 30;	/* XXX make configurable */
+    if (addr == STR(reply->recipient))
+	msg_panic("%s: result clobbers input", myname);
+
+    /*
+     * Without cache. Don't cache the result for a null address.
+     */
+    if (var_rwr_cache_size <= 0 || *addr == 0) {
+	resolve_clnt_query(class, sender, addr, reply);
+	return;
+    }
+
+    if (resolve_cache == 0) {
+	resolve_cache_key = vstring_alloc(100);
+	resolve_cache = ctable_create(var_rwr_cache_size,
+				      resolve_clnt_cache_create,
+				      resolve_clnt_cache_delete,
+				      (void *) &resolve_cache_query);
+    }
+
+    /*
+     * Look up the cache, and ask the resolve service if the result is not
+     * cached, if the cached result has expired, or if the cached result was
+     * produced before we (re)connected to the resolve service. The class
+     * name does not contain newline; the sender length makes the key
+     * unambiguous.
+     */
+    resolve_cache_query.class = class;
+    resolve_cache_query.sender = sender;
+    resolve_cache_query.addr = addr;
+    resolve_cache_query.reply = reply;
+    vstring_sprintf(resolve_cache_key, "%s\n%ld\n%s\n%s",
+		    class, (long) strlen(sender), sender, addr);
+    entry = (RESOLVE_CACHE_ENTRY *)
+	ctable_locate(resolve_cache, STR(resolve_cache_key));
+    if (resolve_cache_misses == misses
+	&& (entry->expire <= time((time_t *) 0)
+	    || entry->generation != rewrite_clnt_generation))
+	entry = (RESOLVE_CACHE_ENTRY *)
+	    ctable_refresh(resolve_cache, STR(resolve_cache_key));
+    if (resolve_cache_misses == misses) {
+	resolve_clnt_copy(reply, &entry->reply);
+	if (msg_verbose)
+	    msg_info("%s: cached: `%s' -> `%s' -> transp=`%s' host=`%s' rcpt=`%s' flags=%s%s%s%s class=%s%s%s%s%s",
+		     myname, sender, addr, STR(reply->transport),
+		     STR(reply->nexthop), STR(reply->recipient),
+		     IFSET(RESOLVE_FLAG_FINAL, "final"),
+		     IFSET(RESOLVE_FLAG_ROUTED, "routed"),
+		     IFSET(RESOLVE_FLAG_ERROR, "error"),
+		     IFSET(RESOLVE_FLAG_FAIL, "fail"),
+		     IFSET(RESOLVE_CLASS_LOCAL, "local"),
+		     IFSET(RESOLVE_CLASS_ALIAS, "alias"),
+		     IFSET(RESOLVE_CLASS_VIRTUAL, "virtual"),
+		     IFSET(RESOLVE_CLASS_RELAY, "relay"),
+		     IFSET(RESOLVE_CLASS_DEFAULT, "default"));
+    }
+    resolve_cache_lookups += 1;
+    if (var_rwr_stat_interval > 0
+	&& resolve_cache_lookups >= var_rwr_stat_interval)
+	resolve_clnt_cache_stats();
 }
 
 /* resolve_clnt_free - destroy reply */
@@ -26,6 +26,15 @@
 /*	rewrite_clnt_internal() performs the same functionality but takes
 /*	input in internal (unquoted) form, and produces output in internal
 /*	(unquoted) form.
+/*
+/*	Results are kept in a least-recently used cache with up to
+/*	\fBrewrite_client_cache_size\fR entries. A cache entry expires
+/*	after 30 seconds. A cache entry is also ignored after the
+/*	client (re)connects to the rewriting service, for example
+/*	after a server-initiated disconnect, because the new server
+/*	process may have a different configuration. With a positive
+/*	\fBrewrite_client_statistics_interval\fR, cache hit statistics
+/*	are logged and reset after that many lookups.
 /* DIAGNOSTICS
 /*	Warnings: communication failure. Fatal error: mail system is down.
 /* SEE ALSO
@@ -56,11 +65,13 @@
 /* Utility library. */
 
 #include <msg.h>
+#include <mymalloc.h>
 #include <vstring.h>
 #include <vstream.h>
 #include <vstring_vstream.h>
 #include <events.h>
 #include <iostuff.h>
+#include <ctable.h>
 #include <quote_822_local.h>
 
 /* Global library. */
@@ -77,61 +88,59 @@
   */
 CLNT_STREAM *rewrite_clnt_stream = 0;
 
-static time_t last_expire;
-static VSTRING *last_rule;
-static VSTRING *last_addr;
-static VSTRING *last_result;
+ /*
+  * XXX this is also shared with the resolver client. It changes whenever we
+  * connect to the service, because the server process at the other end may
+  * have a different configuration than the one that produced our cached
+  * results.
+  */
+int     rewrite_clnt_generation = 0;
+
+ /*
+  * Multi-entry result cache, keyed by rule and address.
+  */
+typedef struct {
+    char   *result;			/* rewritten address */
+    time_t  expire;			/* time of expiration */
+    int     generation;			/* server connection generation */
+} REWRITE_CACHE_ENTRY;
+
+typedef struct {
+    const char *rule;			/* query rule */
+    const char *addr;			/* query address */
+    VSTRING *result;			/* query result */
+} REWRITE_CACHE_QUERY;
+
+static CTABLE *rewrite_cache;
+static REWRITE_CACHE_QUERY rewrite_cache_query;
+static VSTRING *rewrite_cache_key;
+static long rewrite_cache_lookups;
+static long rewrite_cache_misses;
+
+#define REWRITE_CACHE_TTL	30	/* XXX make configurable */
 
 /* rewrite_clnt_handshake - receive server protocol announcement */
 
 static int rewrite_clnt_handshake(VSTREAM *stream)
 {
+    /* A new server process may have a new configuration. */
+    rewrite_clnt_generation += 1;
     return (attr_scan(stream, ATTR_FLAG_STRICT,
 		  RECV_ATTR_STREQ(MAIL_ATTR_PROTO, MAIL_ATTR_PROTO_TRIVIAL),
 		      ATTR_TYPE_END));
 }
 
-/* rewrite_clnt - rewrite address to (transport, next hop, recipient) */
+#define STR vstring_str
 
-VSTRING *rewrite_clnt(const char *rule, const char *addr, VSTRING *result)
+/* rewrite_clnt_query - ask the rewrite service */
+
+static void rewrite_clnt_query(const char *rule, const char *addr,
+			               VSTRING *result)
 {
     VSTREAM *stream;
     int     server_flags;
     int     count = 0;
 
-    /*
-     * One-entry cache.
-     */
-    if (last_addr == 0) {
-	last_rule = vstring_alloc(10);
-	last_addr = vstring_alloc(100);
-	last_result = vstring_alloc(100);
-    }
-
-    /*
-     * Sanity check. An address must be in externalized form. The result must
-     * not clobber the input, because we may have to retransmit the query.
-     */
-#define STR vstring_str
-
-    if (*addr == 0)
-	addr = "";
-    if (addr == STR(result))
-	msg_panic("rewrite_clnt: result clobbers input");
-
-    /*
-     * Peek at the cache.
-     */
-    if (time((time_t *) 0) < last_expire
-	&& strcmp(addr, STR(last_addr)) == 0
-	&& strcmp(rule, STR(last_rule)) == 0) {
-	vstring_strcpy(result, STR(last_result));
-	if (msg_verbose)
-	    msg_info("rewrite_clnt: cached: %s: %s -> %s",
-		     rule, addr, vstring_str(result));
-	return (result);
-    }
-
     /*
      * Keep trying until we get a complete response. The rewrite service is
      * CPU bound and making the client asynchronous would just complicate the
@@ -174,15 +183,109 @@ VSTRING *rewrite_clnt(const char *rule, const char *addr, VSTRING *result)
 	sleep(1);				/* XXX make configurable */
 	clnt_stream_recover(rewrite_clnt_stream);
     }
+}
+
+/* rewrite_clnt_cache_create - cache miss, ask the rewrite service */
+
+static void *rewrite_clnt_cache_create(const char *unused_key, void *context)
+{
+    REWRITE_CACHE_QUERY *query = (REWRITE_CACHE_QUERY *) context;
+    REWRITE_CACHE_ENTRY *entry;
+
+    rewrite_clnt_query(query->rule, query->addr, query->result);
+    entry = (REWRITE_CACHE_ENTRY *) mymalloc(sizeof(*entry));
+    entry->result = mystrdup(STR(query->result));
+    entry->expire = time((time_t *) 0) + REWRITE_CACHE_TTL;
+    entry->generation = rewrite_clnt_generation;
+    rewrite_cache_misses += 1;
+    return ((void *) entry);
+}
+
+/* rewrite_clnt_cache_delete - destroy cache entry */
+
+static void rewrite_clnt_cache_delete(void *value, void *unused_context)
+{
+    REWRITE_CACHE_ENTRY *entry = (REWRITE_CACHE_ENTRY *) value;
+
+    myfree(entry->result);
+    myfree((void *) entry);
+}
+
+/* rewrite_clnt_cache_stats - log and reset cache statistics */
+
+static void rewrite_clnt_cache_stats(void)
+{
+    if (rewrite_cache_lookups > 0)
+	msg_info("statistics: address rewrite cache: %ld lookups, "
+		 "%ld hits (%ld%%), size limit %d",
+		 rewrite_cache_lookups,
+		 rewrite_cache_lookups - rewrite_cache_misses,
+		 100 * (rewrite_cache_lookups - rewrite_cache_misses)
+		 / rewrite_cache_lookups, var_rwr_cache_size);
+    rewrite_cache_lookups = rewrite_cache_misses = 0;
+}
+
+/* rewrite_clnt - rewrite address to (transport, next hop, recipient) */
+
+VSTRING *rewrite_clnt(const char *rule, const char *addr, VSTRING *result)
+{
+    const REWRITE_CACHE_ENTRY *entry;
+    long    misses = rewrite_cache_misses;
 
     /*
-     * Update the cache.
+     * Sanity check. An address must be in externalized form. The result must
+     * not clobber the input, because we may have to retransmit the query.
      */
-    vstring_strcpy(last_rule, rule);
-    vstring_strcpy(last_addr, addr);
-    vstring_strcpy(last_result, STR(result));
-    last_expire = time((time_t *) 0) + 30;	/* XXX make configurable */
+    if (*addr == 0)
+	addr = "";
+    if (addr == STR(result))
+	msg_panic("rewrite_clnt: result clobbers input");
+
+    /*
+     * Without cache.
+     */
+    if (var_rwr_cache_size <= 0) {
+	rewrite_clnt_query(rule, addr, result);
+	return (result);
+    }
 
+    if (rewrite_cache == 0) {
+	rewrite_cache_key = vstring_alloc(100);
+	rewrite_cache = ctable_create(var_rwr_cache_size,
+				      rewrite_clnt_cache_create,
+				      rewrite_clnt_cache_delete,
+				      (void *) &rewrite_cache_query);
+    }
+
+    /*
+     * Look up the cache, and ask the rewrite service if the result is not
+     * cached, if the cached result has expired, or if the cached result was
+     * produced before we (re)connected to the rewrite service, whose
+     * configuration may have changed. An entry records the generation after
+     * its query completes, so that a query that itself reconnects does not
+     * invalidate its own result. The rule name does not contain newline.
+     */
+    rewrite_cache_query.rule = rule;
+    rewrite_cache_query.addr = addr;
+    rewrite_cache_query.result = result;
+    vstring_sprintf(rewrite_cache_key, "%s\n%s", rule, addr);
+    entry = (const REWRITE_CACHE_ENTRY *)
+	ctable_locate(rewrite_cache, STR(rewrite_cache_key));
+    if (rewrite_cache_misses == misses
+	&& (entry->expire <= time((time_t *) 0)
+	    || entry->generation != rewrite_clnt_generation))
+	entry = (const REWRITE_CACHE_ENTRY *)
+	    ctable_refresh(rewrite_cache, STR(rewrite_cache_key));
+    if (rewrite_cache_misses == misses) {
+	vstring_strcpy(result, entry->result);
+	if (msg_verbose)
+	    msg_info("rewrite_clnt: cached: %s: %s -> %s",
+		     rule, addr, vstring_str(result));
+    }
+    rewrite_cache_lookups += 1;
+    if (var_rwr_stat_interval > 0
+	&& rewrite_cache_lookups >= var_rwr_stat_interval)
+	rewrite_clnt_cache_stats();
     return (result);
 }
 
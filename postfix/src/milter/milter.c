@@ -133,6 +133,29 @@
 /*	state as specified with the def_action parameter (i.e.
 /*	reject, tempfail or accept all subsequent events).
 /*
+/*	A milter client with the per-milter "parallel_events = yes"
+/*	setting (default: milter_parallel_events) receives an event
+/*	before the replies for that event are received from the
+/*	preceding milter clients, so that the applications can work
+/*	concurrently. Replies are still processed in the configured
+/*	order, and the first reply that is not "no news" wins. A
+/*	milter client without that setting waits until all preceding
+/*	replies are received. Only envelope events, and the
+/*	end-of-message event for applications that did not negotiate
+/*	any message editing actions, are sent in this manner. With
+/*	milter_latency_logging, the time from sending an event until
+/*	receiving its reply is logged per milter client as a
+/*	histogram, when the client disconnects or is destroyed.
+/*
+/*	A milter client with the per-milter "connection_reuse = yes"
+/*	setting (default: milter_connection_reuse) does not close
+/*	its connection after milter_disc_event(), but keeps it in
+/*	a per-process cache for up to milter_connection_cache_time_limit
+/*	seconds. A later milter_conn_event() for the same application
+/*	and protocol, including one from a different MILTERS
+/*	instance, then skips the connection setup and protocol
+/*	negotiation.
+/*
 /*	milter_free() disconnects from the milter instances that
 /*	are still opened, and destroys the data structures created
 /*	by milter_create(). This function is safe to call at any
@@ -240,6 +263,11 @@
 /* System library. */
 
 #include <sys_defs.h>
+#include <string.h>
+
+#ifdef STRCASECMP_IN_STRINGS_H
+#include <strings.h>
+#endif
 
 /* Utility library. */
 
@@ -257,6 +285,7 @@
 #include <rec_type.h>
 #include <mail_params.h>
 #include <attr_override.h>
+#include <mail_conf.h>
 
 /* Postfix Milter library. */
 
@@ -269,6 +298,145 @@
   */
 #define STR(x)	vstring_str(x)
 
+ /*
+  * Per-milter latency statistics, from sending an event until receiving
+  * the reply. The histogram bucket limits are in milliseconds; the last
+  * bucket has no upper limit.
+  */
+#define MILTER_LATENCY_HIST_SIZE	8
+
+static const int milter_latency_limits[MILTER_LATENCY_HIST_SIZE] = {
+    1, 5, 10, 50, 100, 500, 1000, 0,
+};
+static const char *milter_latency_names[MILTER_LATENCY_HIST_SIZE] = {
+    "<1ms", "<5ms", "<10ms", "<50ms", "<100ms", "<500ms", "<1s", ">=1s",
+};
+
+typedef struct MILTER_LATENCY {
+    struct timeval start;		/* event start time */
+    int     count;			/* completed events */
+    double  total;			/* total latency, ms */
+    double  max;			/* maximal latency, ms */
+    int     hist[MILTER_LATENCY_HIST_SIZE];
+} MILTER_LATENCY;
+
+/* milter_latency_start - remember when event was sent */
+
+static void milter_latency_start(MILTER *m)
+{
+    if (m->latency == 0) {
+	m->latency = (MILTER_LATENCY *) mymalloc(sizeof(*m->latency));
+	memset((void *) m->latency, 0, sizeof(*m->latency));
+    }
+    GETTIMEOFDAY(&m->latency->start);
+}
+
+/* milter_latency_done - update statistics after event reply */
+
+static void milter_latency_done(MILTER *m)
+{
+    MILTER_LATENCY *lp = m->latency;
+    struct timeval now;
+    double  ms;
+    int     n;
+
+    if (lp == 0 || lp->start.tv_sec == 0)
+	return;
+    GETTIMEOFDAY(&now);
+    ms = (now.tv_sec - lp->start.tv_sec) * 1000.0
+	+ (now.tv_usec - lp->start.tv_usec) / 1000.0;
+    if (ms < 0)
+	ms = 0;
+    lp->start.tv_sec = 0;
+    lp->count += 1;
+    lp->total += ms;
+    if (ms > lp->max)
+	lp->max = ms;
+    for (n = 0; n < MILTER_LATENCY_HIST_SIZE - 1; n++)
+	if (ms < milter_latency_limits[n])
+	    break;
+    lp->hist[n] += 1;
+}
+
+/* milter_latency_log - log and reset statistics */
+
+static void milter_latency_log(MILTER *m)
+{
+    MILTER_LATENCY *lp = m->latency;
+    VSTRING *buf;
+    int     n;
+
+    if (lp == 0 || lp->count == 0)
+	return;
+    buf = vstring_alloc(100);
+    for (n = 0; n < MILTER_LATENCY_HIST_SIZE; n++)
+	if (lp->hist[n] > 0)
+	    vstring_sprintf_append(buf, " %s=%d",
+				   milter_latency_names[n], lp->hist[n]);
+    msg_info("milter %s: latency events=%d avg=%.1fms max=%.1fms%s%s",
+	     m->name, lp->count, lp->total / lp->count, lp->max,
+	     (m->flags & MILTER_FLAG_PARALLEL) ? " parallel" : "", STR(buf));
+    vstring_free(buf);
+    memset((void *) lp, 0, sizeof(*lp));
+}
+
+/* milter_event_collect - receive deferred replies in configured order */
+
+static const char *milter_event_collect(MILTERS *milters, MILTER *stop,
+					        const char *resp)
+{
+    MILTER *m;
+    const char *reply;
+    const char *first = 0;
+
+    /*
+     * Receive every deferred reply, to stay in sync with each milter. The
+     * milters with deferred replies precede the milter that produced the
+     * caller's reply, so the first non-null deferred reply wins.
+     */
+    for (m = milters->milter_list; m != stop; m = m->next) {
+	if ((m->flags & MILTER_FLAG_REPLY_PENDING) != 0) {
+	    reply = m->pending_reply(m);
+	    if (var_milt_lat_log)
+		milter_latency_done(m);
+	    if (first == 0)
+		first = reply;
+	}
+    }
+    return (first ? first : resp);
+}
+
+/* milter_event_begin - prepare to send event to one milter */
+
+static const char *milter_event_begin(MILTERS *milters, MILTER *m)
+{
+    const char *resp;
+
+    /*
+     * A milter that does not receive events concurrently must see the
+     * result from the milters before it, as if all were sequential.
+     */
+    if ((m->flags & MILTER_FLAG_PARALLEL) != 0)
+	m->flags |= MILTER_FLAG_DEFER_REPLY;
+    else if ((resp = milter_event_collect(milters, m, (char *) 0)) != 0)
+	return (resp);
+    if (var_milt_lat_log)
+	milter_latency_start(m);
+    return (0);
+}
+
+/* milter_event_end - finish sending event to one milter */
+
+static const char *milter_event_end(MILTER *m, const char *resp)
+{
+    m->flags &= ~MILTER_FLAG_DEFER_REPLY;
+    if ((m->flags & MILTER_FLAG_REPLY_PENDING) != 0)
+	return (0);
+    if (var_milt_lat_log)
+	milter_latency_done(m);
+    return (resp);
+}
+
 /* milter_macro_defaults_create - parse default macro entries */
 
 HTABLE *milter_macro_defaults_create(const char *macro_defaults)
@@ -417,14 +585,18 @@ const char *milter_conn_event(MILTERS *milters,
     if (msg_verbose)
 	msg_info("report connect to all milters");
     for (resp = 0, m = milters->milter_list; resp == 0 && m != 0; m = m->next) {
+	if ((resp = milter_event_begin(milters, m)) != 0)
+	    break;
 	if (m->connect_on_demand != 0)
 	    m->connect_on_demand(m);
 	any_macros = MILTER_MACRO_EVAL(global_macros, m, milters, conn_macros);
-	resp = m->conn_event(m, client_name, client_addr, client_port,
-			     addr_family, any_macros);
+	resp = milter_event_end(m, m->conn_event(m, client_name, client_addr,
+						 client_port, addr_family,
+						 any_macros));
 	if (any_macros != global_macros)
 	    argv_free(any_macros);
     }
+    resp = milter_event_collect(milters, (MILTER *) 0, resp);
     if (global_macros)
 	argv_free(global_macros);
     return (resp);
@@ -443,11 +615,15 @@ const char *milter_helo_event(MILTERS *milters, const char *helo_name,
     if (msg_verbose)
 	msg_info("report helo to all milters");
     for (resp = 0, m = milters->milter_list; resp == 0 && m != 0; m = m->next) {
+	if ((resp = milter_event_begin(milters, m)) != 0)
+	    break;
 	any_macros = MILTER_MACRO_EVAL(global_macros, m, milters, helo_macros);
-	resp = m->helo_event(m, helo_name, esmtp_flag, any_macros);
+	resp = milter_event_end(m, m->helo_event(m, helo_name, esmtp_flag,
+						 any_macros));
 	if (any_macros != global_macros)
 	    argv_free(any_macros);
     }
+    resp = milter_event_collect(milters, (MILTER *) 0, resp);
     if (global_macros)
 	argv_free(global_macros);
     return (resp);
@@ -465,11 +641,14 @@ const char *milter_mail_event(MILTERS *milters, const char **argv)
     if (msg_verbose)
 	msg_info("report sender to all milters");
     for (resp = 0, m = milters->milter_list; resp == 0 && m != 0; m = m->next) {
+	if ((resp = milter_event_begin(milters, m)) != 0)
+	    break;
 	any_macros = MILTER_MACRO_EVAL(global_macros, m, milters, mail_macros);
-	resp = m->mail_event(m, argv, any_macros);
+	resp = milter_event_end(m, m->mail_event(m, argv, any_macros));
 	if (any_macros != global_macros)
 	    argv_free(any_macros);
     }
+    resp = milter_event_collect(milters, (MILTER *) 0, resp);
     if (global_macros)
 	argv_free(global_macros);
     return (resp);
@@ -489,13 +668,16 @@ const char *milter_rcpt_event(MILTERS *milters, int flags, const char **argv)
     for (resp = 0, m = milters->milter_list; resp == 0 && m != 0; m = m->next) {
 	if ((flags & MILTER_FLAG_WANT_RCPT_REJ) == 0
 	    || (m->flags & MILTER_FLAG_WANT_RCPT_REJ) != 0) {
+	    if ((resp = milter_event_begin(milters, m)) != 0)
+		break;
 	    any_macros =
 		MILTER_MACRO_EVAL(global_macros, m, milters, rcpt_macros);
-	    resp = m->rcpt_event(m, argv, any_macros);
+	    resp = milter_event_end(m, m->rcpt_event(m, argv, any_macros));
 	    if (any_macros != global_macros)
 		argv_free(any_macros);
 	}
     }
+    resp = milter_event_collect(milters, (MILTER *) 0, resp);
     if (global_macros)
 	argv_free(global_macros);
     return (resp);
@@ -513,11 +695,14 @@ const char *milter_data_event(MILTERS *milters)
     if (msg_verbose)
 	msg_info("report data to all milters");
     for (resp = 0, m = milters->milter_list; resp == 0 && m != 0; m = m->next) {
+	if ((resp = milter_event_begin(milters, m)) != 0)
+	    break;
 	any_macros = MILTER_MACRO_EVAL(global_macros, m, milters, data_macros);
-	resp = m->data_event(m, any_macros);
+	resp = milter_event_end(m, m->data_event(m, any_macros));
 	if (any_macros != global_macros)
 	    argv_free(any_macros);
     }
+    resp = milter_event_collect(milters, (MILTER *) 0, resp);
     if (global_macros)
 	argv_free(global_macros);
     return (resp);
@@ -535,11 +720,15 @@ const char *milter_unknown_event(MILTERS *milters, const char *command)
     if (msg_verbose)
 	msg_info("report unknown command to all milters");
     for (resp = 0, m = milters->milter_list; resp == 0 && m != 0; m = m->next) {
+	if ((resp = milter_event_begin(milters, m)) != 0)
+	    break;
 	any_macros = MILTER_MACRO_EVAL(global_macros, m, milters, unk_macros);
-	resp = m->unknown_event(m, command, any_macros);
+	resp = milter_event_end(m, m->unknown_event(m, command,
+						    any_macros));
 	if (any_macros != global_macros)
 	    argv_free(any_macros);
     }
+    resp = milter_event_collect(milters, (MILTER *) 0, resp);
     if (global_macros)
 	argv_free(global_macros);
     return (resp);
@@ -574,15 +763,19 @@ const char *milter_message(MILTERS *milters, VSTREAM *fp, off_t data_offset,
     if (msg_verbose)
 	msg_info("inspect content by all milters");
     for (resp = 0, m = milters->milter_list; resp == 0 && m != 0; m = m->next) {
+	if ((resp = milter_event_begin(milters, m)) != 0)
+	    break;
 	any_eoh_macros = MILTER_MACRO_EVAL(global_eoh_macros, m, milters, eoh_macros);
 	any_eod_macros = MILTER_MACRO_EVAL(global_eod_macros, m, milters, eod_macros);
-	resp = m->message(m, fp, data_offset, any_eoh_macros, any_eod_macros,
-			  auto_hdrs);
+	resp = milter_event_end(m, m->message(m, fp, data_offset,
+					      any_eoh_macros, any_eod_macros,
+					      auto_hdrs));
 	if (any_eoh_macros != global_eoh_macros)
 	    argv_free(any_eoh_macros);
 	if (any_eod_macros != global_eod_macros)
 	    argv_free(any_eod_macros);
     }
+    resp = milter_event_collect(milters, (MILTER *) 0, resp);
     if (global_eoh_macros)
 	argv_free(global_eoh_macros);
     if (global_eod_macros)
@@ -610,8 +803,11 @@ void    milter_disc_event(MILTERS *milters)
 
     if (msg_verbose)
 	msg_info("disconnect event to all milters");
-    for (m = milters->milter_list; m != 0; m = m->next)
+    for (m = milters->milter_list; m != 0; m = m->next) {
 	m->disc_event(m);
+	if (var_milt_lat_log)
+	    milter_latency_log(m);
+    }
 }
 
  /*
@@ -628,6 +824,8 @@ static ATTR_OVER_TIME time_table[] = {
 static ATTR_OVER_STR str_table[] = {
     7 + (const char *) VAR_MILT_PROTOCOL, 0, 1, 0,
     7 + (const char *) VAR_MILT_DEF_ACTION, 0, 1, 0,
+    7 + (const char *) VAR_MILT_PARALLEL, 0, 1, 0,
+    7 + (const char *) VAR_MILT_CONN_REUSE, 0, 1, 0,
     0,
 };
 
@@ -640,6 +838,8 @@ static ATTR_OVER_STR str_table[] = {
 
 #define	my_protocol_offset	0
 #define	my_def_action_offset	1
+#define	my_parallel_offset	2
+#define	my_conn_reuse_offset	3
 
 /* milter_new - create milter list */
 
@@ -664,6 +864,8 @@ MILTERS *milter_new(const char *names,
     int     my_msg_timeout;
     const char *my_protocol;
     const char *my_def_action;
+    const char *my_parallel;
+    const char *my_conn_reuse;
 
     /*
      * Initialize.
@@ -673,6 +875,8 @@ MILTERS *milter_new(const char *names,
     link_override_table_to_variable(time_table, my_msg_timeout);
     link_override_table_to_variable(str_table, my_protocol);
     link_override_table_to_variable(str_table, my_def_action);
+    link_override_table_to_variable(str_table, my_parallel);
+    link_override_table_to_variable(str_table, my_conn_reuse);
 
     /*
      * Parse the milter list.
@@ -693,6 +897,9 @@ MILTERS *milter_new(const char *names,
 	    my_msg_timeout = msg_timeout;
 	    my_protocol = protocol;
 	    my_def_action = def_action;
+	    my_parallel = var_milt_parallel ? CONFIG_BOOL_YES : CONFIG_BOOL_NO;
+	    my_conn_reuse = var_milt_conn_reuse ?
+		CONFIG_BOOL_YES : CONFIG_BOOL_NO;
 	    if (name[0] == parens[0]) {
 		op = name;
 		if ((err = extpar(&op, parens, EXTPAR_FLAG_NONE)) != 0)
@@ -707,6 +914,16 @@ MILTERS *milter_new(const char *names,
 	    milter = milter8_create(name, my_conn_timeout, my_cmd_timeout,
 				    my_msg_timeout, my_protocol,
 				    my_def_action, milters);
+	    if (strcasecmp(my_parallel, CONFIG_BOOL_YES) == 0)
+		milter->flags |= MILTER_FLAG_PARALLEL;
+	    else if (strcasecmp(my_parallel, CONFIG_BOOL_NO) != 0)
+		msg_fatal("milter %s: bad %s value: %s",
+			  name, 7 + VAR_MILT_PARALLEL, my_parallel);
+	    if (strcasecmp(my_conn_reuse, CONFIG_BOOL_YES) == 0)
+		milter->flags |= MILTER_FLAG_REUSE;
+	    else if (strcasecmp(my_conn_reuse, CONFIG_BOOL_NO) != 0)
+		msg_fatal("milter %s: bad %s value: %s",
+			  name, 7 + VAR_MILT_CONN_REUSE, my_conn_reuse);
 	    if (head == 0) {
 		head = milter;
 	    } else {
@@ -739,8 +956,14 @@ void    milter_free(MILTERS *milters)
 
     if (msg_verbose)
 	msg_info("free all milters");
-    for (m = milters->milter_list; m != 0; m = next)
-	next = m->next, m->free(m);
+    for (m = milters->milter_list; m != 0; m = next) {
+	next = m->next;
+	if (m->latency) {
+	    milter_latency_log(m);
+	    myfree((void *) m->latency);
+	}
+	m->free(m);
+    }
     if (milters->macros)
 	milter_macros_free(milters->macros);
     if (milters->macro_defaults)
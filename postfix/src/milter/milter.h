@@ -49,10 +49,16 @@ typedef struct MILTER {
     int     (*active) (struct MILTER *);
     int     (*send) (struct MILTER *, VSTREAM *);
     void    (*free) (struct MILTER *);
+    const char *(*pending_reply) (struct MILTER *);
+    struct MILTER_LATENCY *latency;	/* private */
 } MILTER;
 
 #define MILTER_FLAG_NONE		(0)
 #define MILTER_FLAG_WANT_RCPT_REJ	(1<<0)	/* see S8_RCPT_MAILER_ERROR */
+#define MILTER_FLAG_PARALLEL		(1<<1)	/* concurrent events allowed */
+#define MILTER_FLAG_DEFER_REPLY		(1<<2)	/* send event, reply later */
+#define MILTER_FLAG_REPLY_PENDING	(1<<3)	/* deferred reply not yet read */
+#define MILTER_FLAG_REUSE		(1<<4)	/* keep connection after session */
 
 extern MILTER *milter8_create(const char *, int, int, int, const char *, const char *, struct MILTERS *);
 extern MILTER *milter8_receive(VSTREAM *, struct MILTERS *);
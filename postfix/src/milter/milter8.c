@@ -40,6 +40,7 @@
 /*	Panic: interface violation.  Fatal errors: out of memory.
 /* CONFIGURATION PARAMETERS
 /*	milter8_protocol, protocol version and extensions
+/*	milter_connection_cache_time_limit, idle connection time limit
 /* SEE ALSO
 /*	milter(3) generic Milter interface
 /* LICENSE
@@ -62,7 +63,9 @@
 
 #include <sys_defs.h>
 #include <sys/socket.h>
+#include <sys/uio.h>			/* writev() */
 #include <netinet/in.h>
+#include <netinet/tcp.h>		/* TCP_NODELAY */
 #include <arpa/inet.h>
 #include <errno.h>
 #include <stddef.h>			/* offsetof() */
@@ -70,6 +73,7 @@
 #include <string.h>
 #include <stdarg.h>
 #include <limits.h>			/* INT_MAX */
+#include <time.h>
 
 #ifndef SHUT_RDWR
 #define SHUT_RDWR	2
@@ -90,6 +94,9 @@
 #include <name_code.h>
 #include <stringops.h>
 #include <compat_va_copy.h>
+#include <iostuff.h>
+#include <htable.h>
+#include <events.h>
 
 /* Global library. */
 
@@ -301,6 +308,16 @@ static const NAME_MASK smfif_table[] = {
     0, 0,
 };
 
+ /*
+  * Actions that change the message. A filter that did not negotiate any of
+  * these sees the same message content no matter what other filters do,
+  * and its end-of-message reply may be received after other filters have
+  * received the message.
+  */
+#define SMFIF_EDIT_MASK \
+	(SMFIF_ADDHDRS | SMFIF_CHGBODY | SMFIF_ADDRCPT | SMFIF_DELRCPT \
+	| SMFIF_CHGHDRS | SMFIF_CHGFROM | SMFIF_ADDRCPT_PAR)
+
  /*
   * Network protocol families, used when sending CONNECT information.
   */
@@ -354,6 +371,11 @@ static const size_t milter8_macro_offsets[] = {
   */
 #define MILTER_CHUNK_SIZE	65535	/* body chunk size */
 
+ /*
+  * Packets with at least this much data bypass the VSTREAM buffer.
+  */
+#define MILTER_DIRECT_MIN	VSTREAM_BUFSIZE
+
 /*#define msg_verbose 2*/
 
  /*
@@ -381,6 +403,7 @@ typedef struct {
     int     state;			/* MILTER8_STAT_mumble */
     char   *def_reply;			/* error response or null */
     int     skip_event_type;		/* skip operations of this type */
+    int     pending_event;		/* event with deferred reply */
 } MILTER8;
 
  /*
@@ -391,6 +414,30 @@ typedef struct {
   */
 #define LIBMILTER_AUTO_DISCONNECT
 
+ /*
+  * With connection reuse, the disconnect event sends SMFIC_QUIT_NC instead
+  * of SMFIC_QUIT, and the negotiated connection is saved in a per-process
+  * cache. The next connect event for the same Milter application and
+  * protocol picks it up, instead of opening a new connection and repeating
+  * the protocol negotiation. SMFIC_QUIT_NC requires protocol version 6. A
+  * timer closes a cached connection after milter_connection_cache_time_limit,
+  * also when the process handles no more sessions.
+  */
+typedef struct {
+    char   *key;			/* cache lookup key */
+    VSTREAM *fp;			/* open stream */
+    int     version;			/* application protocol version */
+    int     rq_mask;			/* application requests (SMFIF_*) */
+    int     ev_mask;			/* application events (SMFIP_*) */
+    int     np_mask;			/* events outside my protocol version */
+    MILTER_MACROS *macros;		/* negotiated macro lists */
+    time_t  expires;			/* cache time limit */
+} MILTER8_IDLE;
+
+static HTABLE *milter8_idle_cache;
+
+#define MILTER8_REUSE_VERSION	6
+
  /*
   * Milter internal state. For the external representation we use SMTP
   * replies (4XX X.Y.Z text, 5XX X.Y.Z text) and one-letter strings
@@ -829,6 +876,57 @@ static ssize_t vmilter8_size_data(va_list ap)
     return (data_len);
 }
 
+/* milter8_write_direct - write command with large payload */
+
+static int milter8_write_direct(MILTER8 *milter, int command, VSTRING *buf)
+{
+    UINT32_TYPE pkt_len;
+    unsigned char hdr[UINT32_SIZE + 1];
+    struct iovec iov[2];
+    struct iovec *iop = iov;
+    int     iovcnt = 2;
+    int     fd = vstream_fileno(milter->fp);
+    ssize_t count;
+
+    /*
+     * Send the packet header and payload with one system call, instead of
+     * copying the payload through the VSTREAM buffer one block at a time.
+     * Earlier output, such as the macros for this event, is flushed first.
+     * Large payloads are sent only with message content, so we use the
+     * content inspection timeout.
+     */
+    pkt_len = htonl(1 + LEN(buf));
+    memcpy((void *) hdr, (void *) &pkt_len, UINT32_SIZE);
+    hdr[UINT32_SIZE] = command;
+    iov[0].iov_base = (void *) hdr;
+    iov[0].iov_len = sizeof(hdr);
+    iov[1].iov_base = (void *) STR(buf);
+    iov[1].iov_len = LEN(buf);
+    if (vstream_fflush(milter->fp) != 0) {
+	msg_warn("milter %s: error writing command: %m", milter->m.name);
+	milter8_comm_error(milter);
+	return (milter->state == MILTER8_STAT_ERROR);
+    }
+    while (iovcnt > 0) {
+	if ((milter->msg_timeout > 0
+	     && write_wait(fd, milter->msg_timeout) < 0)
+	    || ((count = writev(fd, iop, iovcnt)) < 0 && errno != EINTR)) {
+	    msg_warn("milter %s: error writing command: %m", milter->m.name);
+	    milter8_comm_error(milter);
+	    break;
+	}
+	for ( /* void */ ; count > 0 && iovcnt > 0; iop++, iovcnt--) {
+	    if ((size_t) count < iop->iov_len) {
+		iop->iov_base = (char *) iop->iov_base + count;
+		iop->iov_len -= count;
+		break;
+	    }
+	    count -= iop->iov_len;
+	}
+    }
+    return (milter->state == MILTER8_STAT_ERROR);
+}
+
 /* vmilter8_write_cmd - write command to Sendmail 8 Milter */
 
 static int vmilter8_write_cmd(MILTER8 *milter, int command, ssize_t data_len,
@@ -844,6 +942,21 @@ static int vmilter8_write_cmd(MILTER8 *milter, int command, ssize_t data_len,
     const char *str;
     const char **cpp;
     char    ch;
+    va_list ap2;
+
+    /*
+     * Fast path for a packet with one large buffer (body content).
+     */
+    VA_COPY(ap2, ap);
+    if (va_arg(ap2, int) == MILTER8_DATA_BUFFER
+	&& (buf = va_arg(ap2, VSTRING *)) != 0
+	&& LEN(buf) >= MILTER_DIRECT_MIN
+	&& va_arg(ap2, int) == MILTER8_DATA_END) {
+	va_end(ap2);
+	va_end(ap);
+	return (milter8_write_direct(milter, command, buf));
+    }
+    va_end(ap2);
 
     /*
      * Deliver the packet.
@@ -1015,6 +1128,8 @@ static int milter8_valid_smtp_reply(VSTRING *buf)
 
 /* milter8_event - report event and receive reply */
 
+static const char *milter8_event_reply(MILTER8 *, int);
+
 static const char *milter8_event(MILTER8 *milter, int event,
 				         int skip_event_flag,
 				         int skip_reply,
@@ -1025,20 +1140,17 @@ static const char *milter8_event(MILTER8 *milter, int event,
     va_list ap2;
     ssize_t data_len;
     int     err;
-    unsigned char cmd;
-    ssize_t data_size;
     const char *smfic_name;
-    const char *smfir_name;
-    MILTERS *parent = milter->m.parent;
-    UINT32_TYPE index;
-    const char *edit_resp = 0;
-    const char *retval = 0;
-    VSTRING *body_line_buf = 0;
-    int     done = 0;
-    int     body_edit_lockout = 0;
 
 #define DONT_SKIP_REPLY	0
 
+#define MILTER8_CAN_DEFER(milter, event) \
+	((event) == SMFIC_CONNECT || (event) == SMFIC_HELO \
+	|| (event) == SMFIC_MAIL || (event) == SMFIC_RCPT \
+	|| (event) == SMFIC_DATA || (event) == SMFIC_UNKNOWN \
+	|| ((event) == SMFIC_BODYEOB \
+	    && ((milter)->rq_mask & SMFIF_EDIT_MASK) == 0))
+
     /*
      * Sanity check.
      */
@@ -1157,6 +1269,47 @@ static const char *milter8_event(MILTER8 *milter, int event,
 	return (milter->def_reply);
     }
 
+    /*
+     * Opt-in concurrency: send the event now, and receive the reply after
+     * the same event was sent to other mail filters. Only envelope events,
+     * and the end-of-message event for filters that can't edit the
+     * message, are eligible. The caller collects the reply with
+     * milter8_pending_reply(), in the configured order of mail filters.
+     */
+    if ((milter->m.flags & MILTER_FLAG_DEFER_REPLY) != 0
+	&& MILTER8_CAN_DEFER(milter, event)) {
+	if (vstream_fflush(milter->fp) != 0) {
+	    msg_warn("milter %s: error writing command: %m", milter->m.name);
+	    milter8_comm_error(milter);
+	    return (milter->def_reply);
+	}
+	if (msg_verbose)
+	    msg_info("deferring reply for event %s from milter %s",
+		     (smfic_name = str_name_code(smfic_table, event)) != 0 ?
+		     smfic_name : "(unknown MTA event)", milter->m.name);
+	milter->pending_event = event;
+	milter->m.flags |= MILTER_FLAG_REPLY_PENDING;
+	return (milter->def_reply);
+    }
+    return (milter8_event_reply(milter, event));
+}
+
+/* milter8_event_reply - receive event reply */
+
+static const char *milter8_event_reply(MILTER8 *milter, int event)
+{
+    unsigned char cmd;
+    ssize_t data_size;
+    const char *smfic_name;
+    const char *smfir_name;
+    MILTERS *parent = milter->m.parent;
+    UINT32_TYPE index;
+    const char *edit_resp = 0;
+    const char *retval = 0;
+    VSTRING *body_line_buf = 0;
+    int     done = 0;
+    int     body_edit_lockout = 0;
+
     /*
      * Receive the reply or replies.
      * 
@@ -1671,7 +1824,7 @@ static const char *milter8_event(MILTER8 *milter, int event,
 	 */
 	msg_warn("milter %s: reply %s was followed by %ld data bytes",
 	milter->m.name, (smfir_name = str_name_code(smfir_table, cmd)) != 0 ?
-		 smfir_name : "unknown", (long) data_len);
+		 smfir_name : "unknown", (long) data_size);
 	milter8_comm_error(milter);
 	MILTER8_EVENT_BREAK(milter->def_reply);
     }
@@ -1697,6 +1850,124 @@ static const char *milter8_event(MILTER8 *milter, int event,
     return (retval);
 }
 
+/* milter8_idle_key - connection cache lookup key */
+
+static const char *milter8_idle_key(MILTER8 *milter)
+{
+    vstring_sprintf(milter->buf, "%s %s", milter->m.name, milter->protocol);
+    return (STR(milter->buf));
+}
+
+static void milter8_idle_event(int, void *);
+
+/* milter8_idle_free - destroy cached connection */
+
+static void milter8_idle_free(void *ptr)
+{
+    MILTER8_IDLE *idle = (MILTER8_IDLE *) ptr;
+
+    event_cancel_timer(milter8_idle_event, ptr);
+    if (idle->fp)
+	(void) vstream_fclose(idle->fp);
+    if (idle->macros)
+	milter_macros_free(idle->macros);
+    myfree(idle->key);
+    myfree((void *) idle);
+}
+
+/* milter8_idle_event - close cached connection after time limit */
+
+static void milter8_idle_event(int unused_event, void *context)
+{
+    const char *myname = "milter8_idle_event";
+    MILTER8_IDLE *idle = (MILTER8_IDLE *) context;
+
+    if (msg_verbose)
+	msg_info("%s: close expired cached connection %s", myname, idle->key);
+    htable_delete(milter8_idle_cache, idle->key, milter8_idle_free);
+}
+
+/* milter8_idle_save - save negotiated connection for later reuse */
+
+static void milter8_idle_save(MILTER8 *milter)
+{
+    MILTER8_IDLE *idle;
+    const char *key;
+
+    if (milter8_idle_cache == 0)
+	milter8_idle_cache = htable_create(1);
+    key = milter8_idle_key(milter);
+    if (htable_locate(milter8_idle_cache, key) != 0)
+	htable_delete(milter8_idle_cache, key, milter8_idle_free);
+    idle = (MILTER8_IDLE *) mymalloc(sizeof(*idle));
+    idle->key = mystrdup(key);
+    idle->fp = milter->fp;
+    idle->version = milter->version;
+    idle->rq_mask = milter->rq_mask;
+    idle->ev_mask = milter->ev_mask;
+    idle->np_mask = milter->np_mask;
+    idle->macros = milter->m.macros;
+    idle->expires = time((time_t *) 0) + var_milt_cache_time;
+    (void) htable_enter(milter8_idle_cache, key, (void *) idle);
+    event_request_timer(milter8_idle_event, (void *) idle, var_milt_cache_time);
+    milter->fp = 0;
+    milter->m.macros = 0;
+    milter->state = MILTER8_STAT_CLOSED;
+}
+
+/* milter8_idle_restore - reuse cached connection */
+
+static int milter8_idle_restore(MILTER8 *milter)
+{
+    const char *myname = "milter8_idle_restore";
+    MILTER8_IDLE *idle;
+    const char *key;
+
+    if (milter8_idle_cache == 0 || (milter->m.flags & MILTER_FLAG_REUSE) == 0)
+	return (0);
+    key = milter8_idle_key(milter);
+    if ((idle = (MILTER8_IDLE *) htable_find(milter8_idle_cache, key)) == 0)
+	return (0);
+
+    /*
+     * Don't reuse a connection that has expired. Nothing should arrive on
+     * an idle connection; if there is input, then the application closed
+     * the connection, or it sent a late reply after an error.
+     */
+    if (idle->expires < time((time_t *) 0)
+	|| vstream_peek(idle->fp) > 0
+	|| readable(vstream_fileno(idle->fp))) {
+	if (msg_verbose)
+	    msg_info("%s: milter %s: discard cached connection",
+		     myname, milter->m.name);
+	htable_delete(milter8_idle_cache, key, milter8_idle_free);
+	return (0);
+    }
+    if (msg_verbose)
+	msg_info("%s: milter %s: reuse cached connection",
+		 myname, milter->m.name);
+    milter->fp = idle->fp;
+    milter->version = idle->version;
+    milter->rq_mask = idle->rq_mask;
+    milter->ev_mask = idle->ev_mask;
+    milter->np_mask = idle->np_mask;
+    if (milter->m.macros)
+	milter_macros_free(milter->m.macros);
+    milter->m.macros = idle->macros;
+    idle->fp = 0;
+    idle->macros = 0;
+    htable_delete(milter8_idle_cache, key, milter8_idle_free);
+    vstream_control(milter->fp,
+		    CA_VSTREAM_CTL_TIMEOUT(milter->cmd_timeout),
+		    CA_VSTREAM_CTL_END);
+    if (milter->ev_mask & SMFIP_RCPT_REJ)
+	milter->m.flags |= MILTER_FLAG_WANT_RCPT_REJ;
+    milter->state = MILTER8_STAT_READY;
+    milter8_def_reply(milter, 0);
+    milter->skip_event_type = 0;
+    return (1);
+}
+
 /* milter8_connect - connect to filter */
 
 static void milter8_connect(MILTER8 *milter)
@@ -1729,6 +2000,12 @@ static void milter8_connect(MILTER8 *milter)
 	msg_panic("%s: milter %s: socket is not closed",
 		  myname, milter->m.name);
 
+    /*
+     * Skip the connection setup and negotiation if we can.
+     */
+    if (milter8_idle_restore(milter))
+	return;
+
     /*
      * For user friendliness reasons the milter_protocol configuration
      * parameter can specify both the protocol version and protocol
@@ -1823,9 +2100,21 @@ static void milter8_connect(MILTER8 *milter)
 		    CA_VSTREAM_CTL_TIMEOUT(milter->cmd_timeout),
 		    CA_VSTREAM_CTL_END);
     /* Avoid poor performance when TCP MSS > VSTREAM_BUFSIZE. */
-    if (connect_fn == inet_connect)
+    if (connect_fn == inet_connect) {
+	int     nodelay = 1;
+
 	vstream_tweak_tcp(milter->fp);
 
+	/*
+	 * Body chunks bypass the VSTREAM buffer, and are written after the
+	 * macros for the same event. Without TCP_NODELAY, the end of a chunk
+	 * can be held back until the Milter acknowledges the macros.
+	 */
+	if (setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, (void *) &nodelay,
+		       sizeof(nodelay)) < 0)
+	    msg_warn("milter %s: setsockopt TCP_NODELAY: %m", milter->m.name);
+    }
+
     /*
      * Open the negotiations by sending what actions the Milter may request
      * and what events the Milter can receive.
@@ -2330,8 +2619,25 @@ static void milter8_disc_event(MILTER *m)
     /*
      * XXX Sendmail 8 libmilter closes the MTA-to-filter socket when it finds
      * out that the SMTP client has disconnected. Because of this, Postfix
-     * has to open a new MTA-to-filter socket for each SMTP client.
+     * has to open a new MTA-to-filter socket for each SMTP client, unless
+     * the application supports SMFIC_QUIT_NC.
      */
+#ifdef LIBMILTER_AUTO_DISCONNECT
+    if ((milter->m.flags & MILTER_FLAG_REUSE) != 0
+	&& milter->version >= MILTER8_REUSE_VERSION
+	&& (milter->state == MILTER8_STAT_ENVELOPE
+	    || milter->state == MILTER8_STAT_ACCEPT_MSG)) {
+	if (msg_verbose)
+	    msg_info("%s: quit milter %s, keep connection",
+		     myname, milter->m.name);
+	if (milter8_write_cmd(milter, SMFIC_QUIT_NC, MILTER8_DATA_END) == 0
+	    && vstream_fflush(milter->fp) == 0) {
+	    milter8_idle_save(milter);
+	    milter8_def_reply(milter, 0);
+	    return;
+	}
+    }
+#endif
     switch (milter->state) {
     case MILTER8_STAT_CLOSED:
     case MILTER8_STAT_READY:
@@ -2509,10 +2815,10 @@ static void milter8_body(void *ptr, int rec_type,
      * call-back can invoke milter8_event() with the right arguments when the
      * MILTER_CHUNK_SIZE buffer reaches capacity. That's just too ugly.
      * 
-     * To recover the cost of making an extra copy of body content from Milter
-     * buffer to VSTREAM buffer, we could make vstream_fwrite() a little
-     * smarter so that it does large transfers directly from the user buffer
-     * instead of copying the data one block at a time into a VSTREAM buffer.
+     * Full body chunks are sent directly from the Milter buffer, instead of
+     * being copied one block at a time into a VSTREAM buffer. See
+     * milter8_write_direct(). Only the first body record(s) arrive here;
+     * milter8_message_body() handles the remainder.
      */
     if (msg_verbose > 1)
 	msg_info("%s: body milter %s: %.100s", myname, milter->m.name, buf);
@@ -2594,6 +2900,83 @@ static void milter8_eob(void *ptr)
 		      MILTER8_DATA_END);
 }
 
+/* milter8_message_body - send body records without MIME processing */
+
+static int milter8_message_body(MILTER_MSG_CONTEXT *msg_ctx, VSTREAM *qfile)
+{
+    const char *myname = "milter8_message_body";
+    MILTER8 *milter = msg_ctx->milter;
+    VSTRING *body = milter->body;
+    VSTRING *tail = 0;
+    ssize_t start;
+    int     rec_type;
+    int     skip_reply;
+
+    /*
+     * With MIME processing disabled, mime_state(3) passes body records
+     * through unchanged. Instead of copying each record from a record
+     * buffer into the body chunk buffer, read the record content directly
+     * into the body chunk buffer, and send each full chunk without copying
+     * it into the VSTREAM buffer. See also milter8_body().
+     */
+    skip_reply = ((milter->ev_mask & SMFIP_NR_BODY) != 0);
+    for (;;) {
+	start = LEN(body);
+	if ((rec_type = rec_get_raw(qfile, body, 0,
+				    REC_FLAG_DEFAULT | REC_FLAG_APPEND)) < 0)
+	    break;
+	if (rec_type != REC_TYPE_NORM && rec_type != REC_TYPE_CONT) {
+	    vstring_truncate(body, start);
+	    VSTRING_TERMINATE(body);
+	    milter8_eob((void *) msg_ctx);
+	    break;
+	}
+	if (rec_type == REC_TYPE_NORM)
+	    vstring_memcat(body, "\r\n", 2);
+
+	/*
+	 * Flush body chunk buffer when full, and carry over the excess.
+	 */
+	while (LEN(body) >= MILTER_CHUNK_SIZE) {
+	    if (tail == 0)
+		tail = vstring_alloc(100);
+	    vstring_memcpy(tail, STR(body) + MILTER_CHUNK_SIZE,
+			   LEN(body) - MILTER_CHUNK_SIZE);
+	    vstring_truncate(body, MILTER_CHUNK_SIZE);
+	    if (msg_verbose > 1)
+		msg_info("%s: body milter %s: %ld bytes",
+			 myname, milter->m.name, (long) LEN(body));
+	    msg_ctx->resp =
+		milter8_event(milter, SMFIC_BODY, SMFIP_NOBODY,
+			      skip_reply, msg_ctx->eod_macros,
+			      MILTER8_DATA_BUFFER, body,
+			      MILTER8_DATA_END);
+	    if (MILTER8_MESSAGE_DONE(milter, msg_ctx))
+		break;
+	    vstring_memcpy(body, STR(tail), LEN(tail));
+	}
+	if (MILTER8_MESSAGE_DONE(milter, msg_ctx))
+	    break;
+    }
+    if (tail)
+	vstring_free(tail);
+    return (rec_type);
+}
+
+/* milter8_message_done - restore envelope state after message */
+
+static void milter8_message_done(MILTER8 *milter)
+{
+    if (milter->fp)
+	vstream_control(milter->fp,
+			CA_VSTREAM_CTL_DOUBLE,
+			CA_VSTREAM_CTL_TIMEOUT(milter->cmd_timeout),
+			CA_VSTREAM_CTL_END);
+    if (milter->state == MILTER8_STAT_MESSAGE
+	|| milter->state == MILTER8_STAT_ACCEPT_MSG)
+	milter->state = MILTER8_STAT_ENVELOPE;
+}
+
 /* milter8_message - send message content and receive reply */
 
 static const char *milter8_message(MILTER *m, VSTREAM *qfile,
@@ -2684,17 +3067,23 @@ static const char *milter8_message(MILTER *m, VSTREAM *qfile,
 		break;
 	    if (rec_type != REC_TYPE_NORM && rec_type != REC_TYPE_CONT)
 		break;
+
+	    /*
+	     * After the first body record, bypass MIME processing.
+	     */
+	    if (msg_ctx.first_body == 0) {
+		if (milter8_message_body(&msg_ctx, qfile) < 0) {
+		    msg_warn("%s: error reading %s: %m",
+			     myname, VSTREAM_PATH(qfile));
+		    msg_ctx.resp = "450 4.3.0 Queue file write error";
+		}
+		break;
+	    }
 	}
 	mime_state_free(mime_state);
 	vstring_free(buf);
-	if (milter->fp)
-	    vstream_control(milter->fp,
-			    CA_VSTREAM_CTL_DOUBLE,
-			    CA_VSTREAM_CTL_TIMEOUT(milter->cmd_timeout),
-			    CA_VSTREAM_CTL_END);
-	if (milter->state == MILTER8_STAT_MESSAGE
-	    || milter->state == MILTER8_STAT_ACCEPT_MSG)
-	    milter->state = MILTER8_STAT_ENVELOPE;
+	if ((milter->m.flags & MILTER_FLAG_REPLY_PENDING) == 0)
+	    milter8_message_done(milter);
 	return (msg_ctx.resp);
     default:
 	msg_panic("%s: milter %s: bad state %d",
@@ -2717,6 +3106,25 @@ static const char *milter8_message(MILTER *m, VSTREAM *qfile,
 #define MAIL_ATTR_MILT_MSG	"milter_msg_timeout"
 #define MAIL_ATTR_MILT_ACT	"milter_action"
 #define MAIL_ATTR_MILT_MAC	"milter_macro_list"
+#define MAIL_ATTR_MILT_FLAGS	"milter_flags"
+
+/* milter8_pending_reply - receive deferred event reply */
+
+static const char *milter8_pending_reply(MILTER *m)
+{
+    const char *myname = "milter8_pending_reply";
+    MILTER8 *milter = (MILTER8 *) m;
+    const char *resp;
+
+    if ((milter->m.flags & MILTER_FLAG_REPLY_PENDING) == 0)
+	msg_panic("%s: milter %s: no pending reply", myname, milter->m.name);
+    milter->m.flags &= ~MILTER_FLAG_REPLY_PENDING;
+    resp = milter8_event_reply(milter, milter->pending_event);
+    if (milter->pending_event == SMFIC_BODYEOB)
+	milter8_message_done(milter);
+    milter->pending_event = 0;
+    return (resp);
+}
 
 /* milter8_active - report if this milter still wants events */
 
@@ -2758,6 +3166,8 @@ static int milter8_send(MILTER *m, VSTREAM *stream)
 		   SEND_ATTR_INT(MAIL_ATTR_MILT_MSG, milter->msg_timeout),
 		   SEND_ATTR_STR(MAIL_ATTR_MILT_ACT, milter->def_action),
 		   SEND_ATTR_INT(MAIL_ATTR_MILT_MAC, milter->m.macros != 0),
+		   SEND_ATTR_INT(MAIL_ATTR_MILT_FLAGS,
+				 milter->m.flags & MILTER_FLAG_PARALLEL),
 		   ATTR_TYPE_END) != 0
 	|| (milter->m.macros != 0
 	    && attr_print(stream, ATTR_FLAG_NONE,
@@ -2810,6 +3220,7 @@ MILTER *milter8_receive(VSTREAM *stream, MILTERS *parent)
     int     msg_timeout;
     int     fd;
     int     has_macros;
+    int     flags;
     MILTER_MACROS *macros = 0;
 
 #define FREE_MACROS_AND_RETURN(x) do { \
@@ -2834,7 +3245,8 @@ MILTER *milter8_receive(VSTREAM *stream, MILTERS *parent)
 		  RECV_ATTR_INT(MAIL_ATTR_MILT_MSG, &msg_timeout),
 		  RECV_ATTR_STR(MAIL_ATTR_MILT_ACT, act_buf),
 		  RECV_ATTR_INT(MAIL_ATTR_MILT_MAC, &has_macros),
-		  ATTR_TYPE_END) < 10
+		  RECV_ATTR_INT(MAIL_ATTR_MILT_FLAGS, &flags),
+		  ATTR_TYPE_END) < 12
 	|| (has_macros != 0
 	    && attr_scan(stream, ATTR_FLAG_STRICT,
 			 RECV_ATTR_FUNC(milter_macros_scan,
@@ -2877,6 +3289,7 @@ MILTER *milter8_receive(VSTREAM *stream, MILTERS *parent)
 	milter->ev_mask = ev_mask;
 	milter->np_mask = np_mask;
 	milter->state = state;
+	milter->m.flags = flags;
 	return (&milter->m);
     }
 }
@@ -2945,6 +3358,8 @@ static MILTER8 *milter8_alloc(const char *name, int conn_timeout,
     milter->m.active = milter8_active;
     milter->m.send = milter8_send;
     milter->m.free = milter8_free;
+    milter->m.pending_reply = milter8_pending_reply;
+    milter->m.latency = 0;
     milter->fp = 0;
     milter->buf = vstring_alloc(100);
     milter->body = vstring_alloc(100);
@@ -2959,6 +3374,7 @@ static MILTER8 *milter8_alloc(const char *name, int conn_timeout,
     milter->def_action = mystrdup(def_action);
     milter->def_reply = 0;
     milter->skip_event_type = 0;
+    milter->pending_event = 0;
 
     return (milter);
 }
@@ -0,0 +1,246 @@
+/*++
+/* NAME
+/*	milter_bench 1
+/* SUMMARY
+/*	measure Milter message content throughput
+/* SYNOPSIS
+/* .fi
+/*	\fBmilter_bench\fR [\fB-v\fR] [\fB-l \fIline_length\fR]
+/*		[\fB-n \fImessage_count\fR] [\fB-r \fIrecord_length\fR]
+/*		[\fB-s \fImessage_size\fR] \fImilter\fR
+/* DESCRIPTION
+/*	The \fBmilter_bench\fR command measures how fast message
+/*	content is sent to a Milter application, the way that the
+/*	\fBcleanup\fR(8) server sends message content from a queue
+/*	file at the end of a message.
+/*
+/*	The program builds a queue file fragment with message headers
+/*	and a body of \fImessage_size\fR bytes, connects to the
+/*	specified \fImilter\fR (inet:\fIhost\fR:\fIport\fR or
+/*	unix:\fIpathname\fR), and then sends \fImessage_count\fR
+/*	messages over the same Milter connection. Only the time to
+/*	send message content and to receive the end-of-message reply
+/*	is measured. Configuration parameters such as header_size_limit
+/*	are read from main.cf.
+/*
+/*	The \fBtest-milter\fR program that is built from
+/*	\fBtest-milter.c\fR can be used as a local Milter application:
+/*
+/* .nf
+/*	    ./test-milter -p inet:9999@127.0.0.1 &
+/*	    ./milter_bench -n 100 -s 30000000 inet:127.0.0.1:9999
+/* .fi
+/*
+/*	Options:
+/* .IP "\fB-l \fIline_length\fR (default: 76)"
+/*	The length of a body line, excluding the line terminator.
+/* .IP "\fB-n \fImessage_count\fR (default: 10)"
+/*	The number of messages to send.
+/* .IP "\fB-r \fIrecord_length\fR (default: 2048)"
+/*	The maximal length of a queue file record. Longer lines are
+/*	stored as multiple records, as with the \fBline_length_limit\fR
+/*	configuration parameter.
+/* .IP "\fB-s \fImessage_size\fR (default: 10000000)"
+/*	The approximate size of the message body in bytes.
+/* .IP \fB-v\fR
+/*	Increase verbosity.
+/* DIAGNOSTICS
+/*	Problems are reported to the standard error stream.
+/* ENVIRONMENT
+/* .ad
+/* .fi
+/* .IP MAIL_CONFIG
+/*	Directory with the \fBmain.cf\fR file.
+/* LICENSE
+/* .ad
+/* .fi
+/*	The Secure Mailer license must be distributed with this software.
+/*--*/
+
+/* System library. */
+
+#include <sys_defs.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/* Utility library. */
+
+#include <msg.h>
+#include <msg_vstream.h>
+#include <mymalloc.h>
+#include <vstream.h>
+#include <vstring.h>
+#include <argv.h>
+
+/* Global library. */
+
+#include <mail_conf.h>
+#include <rec_type.h>
+#include <record.h>
+
+/* Application-specific. */
+
+#include <milter.h>
+
+#define RECEIVED_HEADER	"Received: from localhost (localhost [127.0.0.1])"
+
+/* elapsed - return elapsed time in seconds */
+
+static double elapsed(struct timeval *start)
+{
+    struct timeval now;
+
+    if (gettimeofday(&now, (struct timezone *) 0) < 0)
+	msg_fatal("gettimeofday: %m");
+    return ((now.tv_sec - start->tv_sec)
+	    + (now.tv_usec - start->tv_usec) / 1000000.0);
+}
+
+/* macro_lookup - no macro values */
+
+static const char *macro_lookup(const char *unused_name, void *unused_context)
+{
+    return (0);
+}
+
+/* make_queue_file - build message content records */
+
+static VSTREAM *make_queue_file(ssize_t size, ssize_t line_len,
+				        ssize_t rec_len)
+{
+    char    path[] = "/tmp/milter_bench.XXXXXX";
+    VSTREAM *fp;
+    VSTRING *line = vstring_alloc(100);
+    ssize_t done;
+    ssize_t off;
+    ssize_t n;
+    int     fd;
+
+    if ((fd = mkstemp(path)) < 0)
+	msg_fatal("mkstemp %s: %m", path);
+    if (unlink(path) < 0)
+	msg_fatal("unlink %s: %m", path);
+    fp = vstream_fdopen(fd, O_RDWR);
+    vstream_control(fp, CA_VSTREAM_CTL_PATH(path), CA_VSTREAM_CTL_END);
+
+    rec_fputs(fp, REC_TYPE_NORM, RECEIVED_HEADER);
+    rec_fputs(fp, REC_TYPE_NORM, "From: sender@example.com");
+    rec_fputs(fp, REC_TYPE_NORM, "To: recipient@example.com");
+    rec_fputs(fp, REC_TYPE_NORM, "Subject: milter_bench");
+    rec_fputs(fp, REC_TYPE_NORM, "");
+
+    /*
+     * Split long lines into REC_TYPE_CONT records, like the cleanup server.
+     */
+    for (n = 0; n < line_len; n++)
+	VSTRING_ADDCH(line, 'a' + n % 26);
+    VSTRING_TERMINATE(line);
+    for (done = 0; done < size; done += line_len + 2) {
+	for (off = 0; line_len - off > rec_len; off += rec_len)
+	    rec_put(fp, REC_TYPE_CONT, vstring_str(line) + off, rec_len);
+	rec_put(fp, REC_TYPE_NORM, vstring_str(line) + off, line_len - off);
+    }
+    rec_fputs(fp, REC_TYPE_XTRA, "");
+    if (vstream_fflush(fp) != 0)
+	msg_fatal("write %s: %m", path);
+    vstring_free(line);
+    return (fp);
+}
+
+/* check_reply - report unexpected Milter reply */
+
+static void check_reply(const char *event, const char *resp)
+{
+    if (resp != 0)
+	msg_fatal("%s: unexpected milter reply: %s", event, resp);
+}
+
+/* usage - explain and terminate */
+
+static NORETURN usage(char *myname)
+{
+    msg_fatal("usage: %s [-v] [-l line_length] [-n message_count] "
+	      "[-r record_length] [-s message_size] milter", myname);
+}
+
+int     main(int argc, char **argv)
+{
+    ssize_t size = 10000000;
+    ssize_t line_len = 76;
+    ssize_t rec_len = 2048;
+    int     count = 10;
+    const char *sender[] = {"<sender@example.com>", 0};
+    const char *rcpt[] = {"<recipient@example.com>", 0};
+    ARGV   *auto_hdrs;
+    MILTERS *milters;
+    VSTREAM *qfile;
+    struct timeval start;
+    double  secs;
+    int     ch;
+    int     n;
+
+    msg_vstream_init(argv[0], VSTREAM_ERR);
+    while ((ch = GETOPT(argc, argv, "l:n:r:s:v")) > 0) {
+	switch (ch) {
+	case 'l':
+	    if ((line_len = atol(optarg)) <= 0)
+		usage(argv[0]);
+	    break;
+	case 'n':
+	    if ((count = atoi(optarg)) <= 0)
+		usage(argv[0]);
+	    break;
+	case 'r':
+	    if ((rec_len = atol(optarg)) <= 0)
+		usage(argv[0]);
+	    break;
+	case 's':
+	    if ((size = atol(optarg)) <= 0)
+		usage(argv[0]);
+	    break;
+	case 'v':
+	    msg_verbose++;
+	    break;
+	default:
+	    usage(argv[0]);
+	}
+    }
+    if (argc != optind + 1)
+	usage(argv[0]);
+    mail_conf_read();
+
+    qfile = make_queue_file(size, line_len, rec_len);
+    auto_hdrs = argv_alloc(1);
+    argv_add(auto_hdrs, RECEIVED_HEADER, ARGV_END);
+    milters = milter_create(argv[optind], 10, 10, 100, "6", "tempfail",
+			    "", "", "", "", "", "", "", "", "");
+    milter_macro_callback(milters, macro_lookup, (void *) 0);
+    check_reply("connect", milter_conn_event(milters, "localhost",
+					     "127.0.0.1", "25", AF_INET));
+    check_reply("helo", milter_helo_event(milters, "localhost", 0));
+
+    /*
+     * Time the message content only.
+     */
+    for (secs = 0, n = 0; n < count; n++) {
+	check_reply("mail", milter_mail_event(milters, sender));
+	check_reply("rcpt", milter_rcpt_event(milters, 0, rcpt));
+	check_reply("data", milter_data_event(milters));
+	gettimeofday(&start, (struct timezone *) 0);
+	check_reply("message", milter_message(milters, qfile, (off_t) 0,
+					      auto_hdrs));
+	secs += elapsed(&start);
+    }
+    milter_disc_event(milters);
+    milter_free(milters);
+
+    vstream_printf("%d messages %ld bytes %8.3f s %8.1f MB/s\n",
+		   count, (long) size, secs,
+		   secs > 0 ? count * (size / 1000000.0) / secs : 0);
+    vstream_fflush(VSTREAM_OUT);
+    argv_free(auto_hdrs);
+    (void) vstream_fclose(qfile);
+    exit(0);
+}
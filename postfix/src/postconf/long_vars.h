@@ -0,0 +1,3 @@
+long var_queue_minfree;
+long var_mailbox_limit;
+long var_virt_mailbox_limit;
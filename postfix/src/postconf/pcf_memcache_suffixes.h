@@ -0,0 +1,12 @@
+"backup",
+"data_size_limit",
+"domain",
+"flags",
+"key_digest",
+"key_format",
+"line_size_limit",
+"max_try",
+"memcache",
+"retry_pause",
+"timeout",
+"ttl",
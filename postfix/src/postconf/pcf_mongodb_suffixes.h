@@ -0,0 +1,9 @@
+"collection",
+"dbname",
+"domain",
+"expansion_limit",
+"projection",
+"query_filter",
+"result_attribute",
+"result_format",
+"uri",
@@ -0,0 +1,24 @@
+"additional_conditions",
+"charset",
+"dbname",
+"domain",
+"expansion_limit",
+"hosts",
+"idle_interval",
+"option_file",
+"option_group",
+"password",
+"query",
+"require_result_set",
+"result_format",
+"retry_interval",
+"select_field",
+"table",
+"tls_CAfile",
+"tls_CApath",
+"tls_cert_file",
+"tls_ciphers",
+"tls_key_file",
+"tls_verify_cert",
+"user",
+"where_field",
@@ -0,0 +1,16 @@
+"additional_conditions",
+"dbname",
+"domain",
+"encoding",
+"expansion_limit",
+"hosts",
+"idle_interval",
+"password",
+"query",
+"result_format",
+"retry_interval",
+"select_field",
+"select_function",
+"table",
+"user",
+"where_field",
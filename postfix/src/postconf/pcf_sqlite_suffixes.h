@@ -0,0 +1,9 @@
+"additional_conditions",
+"dbpath",
+"domain",
+"expansion_limit",
+"query",
+"result_format",
+"select_field",
+"table",
+"where_field",
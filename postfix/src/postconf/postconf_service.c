@@ -138,8 +138,16 @@ void    pcf_register_service_parameters(void)
 	_CONC_POS_FDBACK, VAR_CONC_POS_FDBACK,
 	_CONC_NEG_FDBACK, VAR_CONC_NEG_FDBACK,
 	_CONC_COHORT_LIM, VAR_CONC_COHORT_LIM,
+	_CONC_FDBACK_MODE, VAR_CONC_FDBACK_MODE,
 	_DEST_RATE_DELAY, VAR_DEST_RATE_DELAY,
 	_XPORT_RATE_DELAY, VAR_XPORT_RATE_DELAY,
+	_DEST_RATE_LIMIT, VAR_DEST_RATE_LIMIT,
+	_DEST_RATE_BURST, VAR_DEST_RATE_BURST,
+	_XPORT_RATE_LIMIT, VAR_XPORT_RATE_LIMIT,
+	_XPORT_RATE_BURST, VAR_XPORT_RATE_BURST,
+	_DEST_BATCH_LIMIT, VAR_DEST_BATCH_LIMIT,
+	_PRIO_LANE_MODE, VAR_PRIO_LANE_MODE,
+	_PRIO_LANE_WEIGHTS, VAR_PRIO_LANE_WEIGHTS,
 	0,
     };
     static const PCF_STRING_NV spawn_params[] = {
@@ -0,0 +1,9 @@
+char *var_psc_rej_footer;
+char *var_psc_exp_filter;
+char *var_exec_directory;
+char *var_smtpd_rej_footer;
+char *var_def_rbl_reply;
+char *var_forward_path;
+char *var_smtpd_exp_filter;
+char *var_mailbox_command;
+char *var_luser_relay;
@@ -0,0 +1,3 @@
+VAR_MYHOSTNAME, pcf_check_myhostname, &var_myhostname, 1, 0,
+VAR_MYNETWORKS, pcf_mynetworks, &var_mynetworks, 0, 0,
+VAR_MYDOMAIN, pcf_check_mydomainname, &var_mydomain, 1, 0,
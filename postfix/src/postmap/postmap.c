@@ -240,6 +240,11 @@
 /*	\fBlmdb\fR supports concurrent writes and reads from different
 /*	processes, unlike other supported file-based tables.
 /*	This is available on systems with support for \fBlmdb\fR databases.
+/* .IP \fBmmap\fR
+/*	The output consists of one file, named \fIfile_name\fB.mmap\fR.
+/*	Processes map the file read-only and shared, so that all
+/*	processes that use the table share its memory, and opening
+/*	a large table is fast. This is always available.
 /* .IP \fBsdbm\fR
 /*	The output consists of two files, named \fIfile_name\fB.pag\fR and
 /*	\fIfile_name\fB.dir\fR.
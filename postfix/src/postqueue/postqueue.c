@@ -19,6 +19,11 @@
 /*	\fBpostqueue\fR [\fB-v\fR] [\fB-c \fIconfig_dir\fR] \fB-j\fR
 /*
 /*	\fBpostqueue\fR [\fB-v\fR] [\fB-c \fIconfig_dir\fR] \fB-p\fR
+/*
+/* .ti -4
+/*	\fBTo report the queue manager scheduler state\fR:
+/*
+/*	\fBpostqueue\fR [\fB-v\fR] [\fB-c \fIconfig_dir\fR] \fB-S\fR
 /* DESCRIPTION
 /*	The \fBpostqueue\fR(1) command implements the Postfix user interface
 /*	for queue management. It implements operations that are
@@ -91,6 +96,38 @@
 /*
 /*	This option implements the traditional "\fBsendmail -qR\fIsite\fR"
 /*	command, by contacting the Postfix \fBflush\fR(8) daemon.
+/* .IP \fB-S\fR
+/*	Report the in-core state of the \fBqmgr\fR(8) scheduler in
+/*	JSON LINES format: active queue message and recipient counts,
+/*	and per-transport, per-destination and per-message delivery
+/*	state, including concurrency windows, feedback, throttling,
+/*	and recipient slots. Each object has a \fBtype\fR member
+/*	with value \fBsummary\fR, \fBtransport\fR, \fBlane\fR,
+/*	\fBqueue\fR, or \fBjob\fR. The report is a snapshot that
+/*	costs the queue manager no file system access; it is intended
+/*	for monitoring tools that poll frequently. See \fBqmgr\fR(8) for the
+/*	meaning of the reported values. The list of object members
+/*	is expected to change over time.
+/*
+/*	A \fBlane\fR object reports the jobs and delivery statistics
+/*	for one message priority on one transport: the number of
+/*	delivery requests selected, the number of delivery requests
+/*	completed, and the average and maximal time in seconds from
+/*	message arrival to completion. The \fBdelay_histogram\fR
+/*	member is an array with the number of completions in less
+/*	than 1, 5, 30, 60, 300, and 3600 seconds, and in 3600 seconds
+/*	or more. These are request completions, not recipient
+/*	deliveries: a request is counted when it completed without
+/*	deferred recipients, and recipients that were bounced are
+/*	counted as if they were delivered. The statistics are reset
+/*	when the queue manager restarts.
+/*
+/*	With multiple queue manager shards, each shard produces its
+/*	own report, starting with a \fBsummary\fR object.
+/*
+/*	This option requires the same privileges as \fB-p\fR.
+/*
+/*	This feature is available in Postfix 3.12 and later.
 /* .IP \fB-v\fR
 /*	Enable verbose logging for debugging purposes. Multiple \fB-v\fR
 /*	options make the software increasingly verbose. As of Postfix 2.3,
@@ -210,6 +247,11 @@
 /*	List of users who are authorized to flush the queue.
 /* .IP "\fBauthorized_mailq_users (static:anyone)\fR"
 /*	List of users who are authorized to view the queue.
+/* .PP
+/*	Available in Postfix version 3.12 and later:
+/* .IP "\fBqmgr_status_service_name (qstatus)\fR"
+/*	The name of the public socket where the queue manager reports
+/*	its in-core scheduler state to "postqueue -S".
 /* FILES
 /*	/var/spool/postfix, mail queue
 /* SEE ALSO
@@ -265,6 +307,8 @@
 #include <mymalloc.h>
 #include <clean_env.h>
 #include <vstream.h>
+#include <vstring.h>
+#include <vstring_vstream.h>
 #include <msg_vstream.h>
 #include <argv.h>
 #include <safe.h>
@@ -290,6 +334,7 @@
 #include <valid_mailhost_addr.h>
 #include <mail_dict.h>
 #include <mail_parm_split.h>
+#include <mail_shard.h>
 #include <maillog_client.h>
 
 /* Application-specific. */
@@ -330,6 +375,7 @@
 #define PQ_MODE_FLUSH_SITE	3	/* flush site */
 #define PQ_MODE_FLUSH_FILE	4	/* flush message */
 #define PQ_MODE_JSON_LIST	5	/* JSON-format queue listing */
+#define PQ_MODE_QMGR_STATUS	6	/* JSON-format scheduler state */
 
  /*
   * Silly little macros (SLMs).
@@ -341,10 +387,12 @@
   */
 char   *var_flush_acl;
 char   *var_showq_acl;
+char   *var_qmgr_status_service;
 
 static const CONFIG_STR_TABLE str_table[] = {
     VAR_FLUSH_ACL, DEF_FLUSH_ACL, &var_flush_acl, 0, 0,
     VAR_SHOWQ_ACL, DEF_SHOWQ_ACL, &var_showq_acl, 0, 0,
+    VAR_QMGR_STATUS_SERVICE, DEF_QMGR_STATUS_SERVICE, &var_qmgr_status_service, 0, 0,
     0,
 };
 
@@ -452,6 +500,62 @@ static void show_queue(int mode)
     }
 }
 
+/* show_qmgr_status - show scheduler state */
+
+static void show_qmgr_status(void)
+{
+    const char *errstr;
+    VSTREAM *status;
+    VSTRING *buf;
+    VSTRING *service;
+    int     shard;
+    uid_t   uid = getuid();
+
+    if (uid != 0 && uid != var_owner_uid
+	&& (errstr = check_user_acl_byuid(VAR_SHOWQ_ACL, var_showq_acl,
+					  uid)) != 0)
+	msg_fatal_status(EX_NOPERM,
+		       "User %s(%ld) is not allowed to view the mail queue",
+			 errstr, (long) uid);
+    if (*var_qmgr_status_service == 0)
+	msg_fatal_status(EX_UNAVAILABLE,
+			 "Scheduler report unavailable - %s is empty",
+			 VAR_QMGR_STATUS_SERVICE);
+
+    /*
+     * Each queue manager (shard) sends one report and disconnects. Unlike
+     * the showq service, there is no stand-alone fall-back: without a queue
+     * manager, there is no scheduler state to report.
+     */
+    buf = vstring_alloc(200);
+    service = vstring_alloc(100);
+    for (shard = 0; shard < var_qmgr_shard_count; shard++) {
+	mail_shard_service(service, var_qmgr_status_service, shard);
+	if ((status = mail_connect(MAIL_CLASS_PUBLIC, STR(service),
+				   BLOCKING)) == 0)
+	    msg_fatal_status(EX_UNAVAILABLE,
+			     "Scheduler report unavailable"
+			     " (Connect to the %s %s service: %m)",
+			     var_mail_name, STR(service));
+	while (vstring_get_nonl(buf, status) != VSTREAM_EOF) {
+	    if (*STR(buf) != '{')
+		msg_fatal_status(EX_SOFTWARE, "malformed %s server response",
+				 STR(service));
+	    vstream_fputs(STR(buf), VSTREAM_OUT);
+	    VSTREAM_PUTC('\n', VSTREAM_OUT);
+	}
+	if (vstream_ferror(status))
+	    msg_fatal_status(EX_SOFTWARE, "read %s server response: %m",
+			     STR(service));
+	if (vstream_fclose(status))
+	    msg_warn("close: %m");
+    }
+    if (vstream_fflush(VSTREAM_OUT))
+	msg_fatal_status(EX_IOERR, "write error: %m");
+    vstring_free(service);
+    vstring_free(buf);
+}
+
 /* flush_queue - force delivery */
 
 static void flush_queue(void)
@@ -553,7 +657,7 @@ static void unavailable(void)
 
 static NORETURN usage(void)
 {
-    msg_fatal_status(EX_USAGE, "usage: postqueue -f | postqueue -i queueid | postqueue -j | postqueue -p | postqueue -s site");
+    msg_fatal_status(EX_USAGE, "usage: postqueue -f | postqueue -i queueid | postqueue -j | postqueue -p | postqueue -s site | postqueue -S");
 }
 
 MAIL_VERSION_STAMP_DECLARE;
@@ -613,7 +717,7 @@ int     main(int argc, char **argv)
      * mail configuration read routine. Don't do complex things until we have
      * completed initializations.
      */
-    while ((c = GETOPT(argc, argv, "c:fi:jps:v")) > 0) {
+    while ((c = GETOPT(argc, argv, "c:fi:jps:Sv")) > 0) {
 	switch (c) {
 	case 'c':				/* non-default configuration */
 	    if (setenv(CONF_ENV_PATH, optarg, 1) < 0)
@@ -646,6 +750,11 @@ int     main(int argc, char **argv)
 	    mode = PQ_MODE_FLUSH_SITE;
 	    site_to_flush = optarg;
 	    break;
+	case 'S':				/* scheduler state */
+	    if (mode != PQ_MODE_DEFAULT)
+		usage();
+	    mode = PQ_MODE_QMGR_STATUS;
+	    break;
 	case 'v':
 	    if (geteuid() == 0)
 		msg_verbose++;
@@ -716,6 +825,10 @@ int     main(int argc, char **argv)
 	show_queue(mode);
 	exit(0);
 	break;
+    case PQ_MODE_QMGR_STATUS:
+	show_qmgr_status();
+	exit(0);
+	break;
     case PQ_MODE_FLUSH_SITE:
 	flush_site(site_to_flush);
 	exit(0);
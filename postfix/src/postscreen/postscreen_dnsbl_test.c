@@ -425,16 +425,16 @@ static const struct multi_dnsbl_data multi_dnsbl_tests[] = {
 	 /* dnsbl_sites */ "list.dnswl.org=127.0.[0..255].[1..3]*-2, foo.example.org",
 	 /* req_addr */ "10.2.3.4",
 	 /* dnsbl_data */ {
-	    {
-		 /* req_dnsbl */ "foo.example.org",
-		 /* res_addr */ "127.0.0.10",
-		 /* res_ttl */ 62,
-	    },
 	    {
 		 /* req_dnsbl */ "list.dnswl.org",
 		 /* res_addr */ "127.0.5.2",
 		 /* res_ttl */ 61,
 	    },
+	    {
+		 /* req_dnsbl */ "foo.example.org",
+		 /* res_addr */ "127.0.0.10",
+		 /* res_ttl */ 62,
+	    },
 	},
 	 /* want_ttl */ 61,
 	 /* want_score */ -1,
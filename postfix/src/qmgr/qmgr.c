@@ -119,6 +119,31 @@
 /*	\fBD\fR and \fBI\fR. Thus, in order to force a deferred queue run,
 /*	one would request \fBA F D\fR; in order to notify the queue manager
 /*	of the arrival of new mail one would request \fBI\fR.
+/* SHARDS
+/* .ad
+/* .fi
+/*	With "\fBqmgr_shard_count\fR = \fIN\fR", \fIN\fR queue manager
+/*	processes share the incoming, active and deferred queues. Each
+/*	process ("shard") handles the queue files whose queue ID hashes
+/*	to its shard index, with its own share of the active queue
+/*	message and recipient limits. Per-destination concurrency
+/*	limits are enforced across all shards, except that each
+/*	shard may always make one delivery per destination.
+/*
+/*	Shard 0 is the \fBmaster.cf\fR service named \fBqmgr\fR
+/*	(more precisely, $\fBqueue_service_name\fR); shard \fIn\fR
+/*	is the service named \fBqmgr-\fIn\fR. For example, with
+/*	"\fBqmgr_shard_count = 2\fR":
+/*
+/* .nf
+/* .na
+/*	qmgr      unix  n       -       n       300     1       qmgr
+/*	qmgr-1    unix  n       -       n       300     1       qmgr
+/* .fi
+/* .ad
+/*
+/*	Use "\fBpostfix stop\fR" and "\fBpostfix start\fR" after
+/*	changing the number of shards.
 /* STANDARDS
 /*	RFC 3463 (Enhanced status codes)
 /*	RFC 3464 (Delivery status notifications)
@@ -138,6 +163,11 @@
 /*
 /*	Depending on the setting of the \fBnotify_classes\fR parameter,
 /*	the postmaster is notified of bounces and of other trouble.
+/*
+/*	When it terminates, the queue manager logs the number of
+/*	in-core recipients, the average amount of memory used to
+/*	store each one, and the maximal amount of recipient string
+/*	storage that was in use at the same time.
 /* BUGS
 /*	A single queue manager process has to compete for disk access with
 /*	multiple front-end processes such as \fBcleanup\fR(8). A sudden burst of
@@ -261,6 +291,18 @@
 /* .IP "\fBdestination_concurrency_feedback_debug (no)\fR"
 /*	Make the queue manager's feedback algorithm verbose for performance
 /*	analysis purposes.
+/* .PP
+/*	Available in Postfix version 3.12 and later:
+/* .IP "\fBdefault_destination_concurrency_feedback_mode (classic)\fR"
+/*	How the queue manager adjusts the per-destination delivery
+/*	concurrency: \fBclassic\fR (positive and negative feedback
+/*	after each delivery) or \fBlatency\fR (follow delivery latency
+/*	and receiver throttling, with an adaptive rate delay).
+/* .IP "\fBtransport_destination_concurrency_feedback_mode ($default_destination_concurrency_feedback_mode)\fR"
+/*	A transport-specific override for the
+/*	default_destination_concurrency_feedback_mode parameter value,
+/*	where \fItransport\fR is the master.cf name of the message delivery
+/*	transport.
 /* RECIPIENT SCHEDULING CONTROLS
 /* .ad
 /* .fi
@@ -346,6 +388,80 @@
 /*	A transport-specific override for the default_transport_rate_delay
 /*	parameter value, where the initial \fItransport\fR in the parameter
 /*	name is the master.cf name of the message delivery transport.
+/* .PP
+/*	Available in Postfix version 3.12 and later:
+/* .IP "\fBdefault_destination_rate_limit (0)\fR"
+/*	The default maximal number of message deliveries per second to
+/*	the same destination and over the same message delivery transport,
+/*	enforced with a token bucket.
+/* .IP "\fBtransport_destination_rate_limit ($default_destination_rate_limit)\fR"
+/*	A transport-specific override for the default_destination_rate_limit
+/*	parameter value, where \fItransport\fR is the master.cf name of
+/*	the message delivery transport.
+/* .IP "\fBdefault_destination_rate_burst (1)\fR"
+/*	The default number of message deliveries to the same destination
+/*	that may be made in a burst, in excess of the
+/*	default_destination_rate_limit.
+/* .IP "\fBtransport_destination_rate_burst ($default_destination_rate_burst)\fR"
+/*	A transport-specific override for the default_destination_rate_burst
+/*	parameter value, where \fItransport\fR is the master.cf name of
+/*	the message delivery transport.
+/* .IP "\fBdefault_transport_rate_limit (0)\fR"
+/*	The default maximal number of message deliveries per second over
+/*	the same message delivery transport, regardless of destination,
+/*	enforced with a token bucket.
+/* .IP "\fBtransport_transport_rate_limit ($default_transport_rate_limit)\fR"
+/*	A transport-specific override for the default_transport_rate_limit
+/*	parameter value, where the initial \fItransport\fR in the parameter
+/*	name is the master.cf name of the message delivery transport.
+/* .IP "\fBdefault_transport_rate_burst (1)\fR"
+/*	The default number of message deliveries over the same message
+/*	delivery transport that may be made in a burst, in excess of the
+/*	default_transport_rate_limit.
+/* .IP "\fBtransport_transport_rate_burst ($default_transport_rate_burst)\fR"
+/*	A transport-specific override for the default_transport_rate_burst
+/*	parameter value, where the initial \fItransport\fR in the parameter
+/*	name is the master.cf name of the message delivery transport.
+/* .IP "\fBdefault_destination_batch_limit (1)\fR"
+/*	The default maximal number of delivery requests for the same
+/*	destination that the queue manager sends back-to-back over one
+/*	connection to a delivery agent that supports batching.
+/* .IP "\fBtransport_destination_batch_limit ($default_destination_batch_limit)\fR"
+/*	A transport-specific override for the default_destination_batch_limit
+/*	parameter value, where \fItransport\fR is the master.cf name of
+/*	the message delivery transport.
+/* .IP "\fBdefault_priority_lane_mode (strict)\fR"
+/*	How the queue manager schedules messages with different priority:
+/*	\fBstrict\fR (deliver lower-priority mail only when no
+/*	higher-priority mail can be delivered) or \fBweighted\fR
+/*	(share delivery slots according to default_priority_lane_weights).
+/* .IP "\fBtransport_priority_lane_mode ($default_priority_lane_mode)\fR"
+/*	A transport-specific override for the default_priority_lane_mode
+/*	parameter value, where \fItransport\fR is the master.cf name of
+/*	the message delivery transport.
+/* .IP "\fBdefault_priority_lane_weights (high=8, normal=4, low=1)\fR"
+/*	The relative share of delivery slots for each message priority,
+/*	with "default_priority_lane_mode = weighted".
+/* .IP "\fBtransport_priority_lane_weights ($default_priority_lane_weights)\fR"
+/*	A transport-specific override for the default_priority_lane_weights
+/*	parameter value, where \fItransport\fR is the master.cf name of
+/*	the message delivery transport.
+/* .IP "\fBqmgr_deferred_index (no)\fR"
+/*	Maintain an index of deferred queue files, ordered by the time
+/*	of the next delivery attempt, so that a periodic deferred queue
+/*	scan looks only at queue files that are due.
+/* .IP "\fBqmgr_deferred_rescan_time (1h)\fR"
+/*	The time between full deferred queue scans that rebuild the
+/*	qmgr_deferred_index.
+/* .IP "\fBqmgr_active_snapshot (no)\fR"
+/*	Save the list of active queue messages when the queue manager
+/*	terminates normally, and reload those messages directly from
+/*	the active queue after restart.
+/* .IP "\fBqmgr_status_service_name (qstatus)\fR"
+/*	The name of the public socket where the queue manager reports
+/*	its in-core scheduler state to "postqueue -S".
+/* .IP "\fBqmgr_shard_count (1)\fR"
+/*	The number of queue manager processes that share the queue.
 /* SAFETY CONTROLS
 /* .ad
 /* .fi
@@ -407,7 +523,11 @@
 /*	/var/spool/postfix/bounce, non-delivery status
 /*	/var/spool/postfix/defer, non-delivery status
 /*	/var/spool/postfix/trace, delivery status
+/*	$data_directory/qmgr_retry_index, deferred queue retry index
+/*	$data_directory/qmgr_shard_table, per-destination delivery counters
+/*	/var/spool/postfix/public/qstatus, scheduler status socket
 /* SEE ALSO
+/*	postqueue(1), scheduler status report
 /*	trivial-rewrite(8), address routing
 /*	bounce(8), delivery status reports
 /*	postconf(5), configuration parameters
@@ -451,13 +571,18 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include <ctype.h>
+#include <errno.h>
+#include <signal.h>
 
 /* Utility library. */
 
 #include <msg.h>
 #include <events.h>
 #include <vstream.h>
+#include <vstring.h>
 #include <dict.h>
+#include <set_eugid.h>
+#include <iostuff.h>
 
 /* Global library. */
 
@@ -468,6 +593,7 @@
 #include <mail_version.h>
 #include <mail_proto.h>			/* QMGR_SCAN constants */
 #include <mail_flow.h>
+#include <mail_shard.h>
 #include <flush_clnt.h>
 
 /* Master process interface */
@@ -511,13 +637,25 @@ char   *var_conc_pos_feedback;
 char   *var_conc_neg_feedback;
 int     var_conc_cohort_limit;
 bool    var_conc_feedback_debug;
+char   *var_conc_feedback_mode;
 int     var_xport_rate_delay;
 int     var_dest_rate_delay;
+char   *var_dest_rate_limit;
+int     var_dest_rate_burst;
+char   *var_xport_rate_limit;
+int     var_xport_rate_burst;
+int     var_dest_batch_limit;
+char   *var_prio_lane_mode;
+char   *var_prio_lane_weights;
 char   *var_def_filter_nexthop;
 int     var_qmgr_daemon_timeout;
 int     var_qmgr_ipc_timeout;
 bool    var_dsn_delay_cleared;
 int     var_vrfy_pend_limit;
+bool    var_qmgr_defer_index;
+bool    var_qmgr_act_snapshot;
+char   *var_qmgr_status_service;
+int     var_qmgr_defer_rescan;
 
 static QMGR_SCAN *qmgr_scans[2];
 
@@ -525,16 +663,32 @@ static QMGR_SCAN *qmgr_scans[2];
 #define QMGR_SCAN_IDX_DEFERRED 1
 #define QMGR_SCAN_IDX_COUNT (sizeof(qmgr_scans) / sizeof(qmgr_scans[0]))
 
+ /*
+  * With an active queue snapshot, the master's SIGTERM at "postfix stop" or
+  * "postfix reload" is turned into an event, so that the snapshot is saved
+  * outside signal handler context.
+  */
+static int qmgr_sig_pipe[2];
+
 /* qmgr_deferred_run_event - queue manager heartbeat */
 
 static void qmgr_deferred_run_event(int unused_event, void *dummy)
 {
+    int     flags = QMGR_SCAN_START;
 
     /*
      * This routine runs when it is time for another deferred queue scan.
      * Make sure this routine gets called again in the future.
+     * 
+     * With a retry index, look only at deferred queue files that are due,
+     * but rebuild the index with a full scan once in a while, to pick up
+     * files that were added to the deferred queue by other programs.
      */
-    qmgr_scan_request(qmgr_scans[QMGR_SCAN_IDX_DEFERRED], QMGR_SCAN_START);
+    if (qmgr_retry_index != 0
+	&& !qmgr_retry_stale(qmgr_retry_index, event_time(),
+			     var_qmgr_defer_rescan))
+	flags |= QMGR_SCAN_INDEX;
+    qmgr_scan_request(qmgr_scans[QMGR_SCAN_IDX_DEFERRED], flags);
     event_request_timer(qmgr_deferred_run_event, dummy, var_queue_run_delay);
 }
 
@@ -604,6 +758,7 @@ static void qmgr_trigger_event(char *buf, ssize_t len,
 static int qmgr_loop(char *unused_name, char **unused_argv)
 {
     char   *path;
+    const char *queue_id;
     ssize_t token_count;
     int     feed = 0;
     int     scan_idx;			/* Priority order scan index */
@@ -637,6 +792,17 @@ static int qmgr_loop(char *unused_name, char **unused_argv)
      * qmgr_transport.c.
      */
     delay = WAIT_FOR_EVENT;
+
+    /*
+     * After restart, messages from the active queue snapshot go first: they
+     * were in the active queue before the incoming and deferred queue files
+     * that are waiting now.
+     */
+    if (qmgr_message_count < var_qmgr_active_limit
+	&& (queue_id = qmgr_snapshot_next()) != 0) {
+	(void) qmgr_active_reload(queue_id);
+	return (DONT_WAIT);
+    }
     for (scan_idx = 0; qmgr_message_count < var_qmgr_active_limit
 	 && scan_idx < QMGR_SCAN_IDX_COUNT; ++scan_idx) {
 	last_scan_idx = (scan_idx + first_scan_idx) % QMGR_SCAN_IDX_COUNT;
@@ -675,6 +841,43 @@ static int qmgr_loop(char *unused_name, char **unused_argv)
     return (delay);
 }
 
+/* qmgr_before_exit - log statistics, clear shard state, save snapshot */
+
+static void qmgr_before_exit(char *unused_name, char **unused_argv)
+{
+    qmgr_rcpt_pool_stats();
+    qmgr_shard_done();
+    qmgr_snapshot_save();
+}
+
+/* qmgr_sigterm - force wakeup from event loop */
+
+static void qmgr_sigterm(int unused_sig)
+{
+    int     saved_errno = errno;
+
+    /*
+     * WARNING WARNING WARNING.
+     * 
+     * This code runs at unpredictable moments, as a signal handler. Don't put
+     * any code here other than code that is intended to be run within a
+     * signal handler. Restore errno in case we are interrupting the epilog
+     * of a failed system call.
+     */
+    (void) write(qmgr_sig_pipe[1], "", 1);
+    errno = saved_errno;
+}
+
+/* qmgr_sigterm_event - terminate after SIGTERM */
+
+static void qmgr_sigterm_event(int unused_event, void *unused_context)
+{
+    if (msg_verbose)
+	msg_info("SIGTERM -- exiting");
+    qmgr_before_exit((char *) 0, (char **) 0);
+    exit(0);
+}
+
 /* pre_accept - see if tables have changed */
 
 static void pre_accept(char *unused_name, char **unused_argv)
@@ -683,15 +886,48 @@ static void pre_accept(char *unused_name, char **unused_argv)
 
     if ((table = dict_changed_name()) != 0) {
 	msg_info("table %s has changed -- restarting", table);
+	qmgr_before_exit((char *) 0, (char **) 0);
 	exit(0);
     }
 }
 
 /* qmgr_pre_init - pre-jail initialization */
 
-static void qmgr_pre_init(char *unused_name, char **unused_argv)
+static void qmgr_pre_init(char *name, char **unused_argv)
 {
+    VSTRING *path;
+    VSTRING *file;
+
     flush_init();
+
+    /*
+     * The shard state, the retry index and the active queue snapshot live
+     * outside the chroot jail. Each shard has its own retry index and
+     * snapshot. Remove a left-over file when the feature is turned off, so
+     * that it can't be mistaken for a current one when the feature is
+     * turned on again.
+     */
+    path = vstring_alloc(100);
+    file = vstring_alloc(100);
+    SAVE_AND_SET_EUGID(var_owner_uid, var_owner_gid);
+    qmgr_shard_init(name);
+    vstring_sprintf(path, "%s/%s", var_data_dir,
+		    mail_shard_service(file, QMGR_RETRY_FILE,
+				       qmgr_shard_index));
+    if (var_qmgr_defer_index)
+	qmgr_retry_index = qmgr_retry_open(vstring_str(path));
+    else if (unlink(vstring_str(path)) < 0 && errno != ENOENT)
+	msg_warn("remove %s: %m", vstring_str(path));
+    vstring_sprintf(path, "%s/%s", var_data_dir,
+		    mail_shard_service(file, QMGR_SNAPSHOT_FILE,
+				       qmgr_shard_index));
+    if (var_qmgr_act_snapshot)
+	qmgr_snapshot_open(vstring_str(path));
+    else if (unlink(vstring_str(path)) < 0 && errno != ENOENT)
+	msg_warn("remove %s: %m", vstring_str(path));
+    RESTORE_SAVED_EUGID();
+    vstring_free(file);
+    vstring_free(path);
 }
 
 /* qmgr_post_init - post-jail initialization */
@@ -741,10 +977,37 @@ static void qmgr_post_init(char *name, char **unused_argv)
     var_use_limit = 0;
     var_idle_limit = 0;
     qmgr_move(MAIL_QUEUE_ACTIVE, MAIL_QUEUE_INCOMING, event_time());
+
+    /*
+     * Save the active queue snapshot when the master terminates us. Files
+     * that are listed in the snapshot were left in the active queue above.
+     */
+    if (var_qmgr_act_snapshot) {
+	if (pipe(qmgr_sig_pipe) < 0)
+	    msg_fatal("pipe: %m");
+	non_blocking(qmgr_sig_pipe[1], NON_BLOCKING);
+	close_on_exec(qmgr_sig_pipe[0], CLOSE_ON_EXEC);
+	close_on_exec(qmgr_sig_pipe[1], CLOSE_ON_EXEC);
+	event_enable_read(qmgr_sig_pipe[0], qmgr_sigterm_event, (void *) 0);
+	signal(SIGTERM, qmgr_sigterm);
+    }
     qmgr_scans[QMGR_SCAN_IDX_INCOMING] = qmgr_scan_create(MAIL_QUEUE_INCOMING);
     qmgr_scans[QMGR_SCAN_IDX_DEFERRED] = qmgr_scan_create(MAIL_QUEUE_DEFERRED);
+    qmgr_scans[QMGR_SCAN_IDX_DEFERRED]->retry = qmgr_retry_index;
     qmgr_scan_request(qmgr_scans[QMGR_SCAN_IDX_INCOMING], QMGR_SCAN_START);
     qmgr_deferred_run_event(0, (void *) 0);
+
+    /*
+     * Report the scheduler state to "postqueue -S". Each shard has its own
+     * status socket.
+     */
+    if (*var_qmgr_status_service) {
+	VSTRING *service = vstring_alloc(100);
+
+	qmgr_status_init(mail_shard_service(service, var_qmgr_status_service,
+					    qmgr_shard_index));
+	vstring_free(service);
+    }
 }
 
 MAIL_VERSION_STAMP_DECLARE;
@@ -757,7 +1020,13 @@ int     main(int argc, char **argv)
 	VAR_DEFER_XPORTS, DEF_DEFER_XPORTS, &var_defer_xports, 0, 0,
 	VAR_CONC_POS_FDBACK, DEF_CONC_POS_FDBACK, &var_conc_pos_feedback, 1, 0,
 	VAR_CONC_NEG_FDBACK, DEF_CONC_NEG_FDBACK, &var_conc_neg_feedback, 1, 0,
+	VAR_CONC_FDBACK_MODE, DEF_CONC_FDBACK_MODE, &var_conc_feedback_mode, 1, 0,
 	VAR_DEF_FILTER_NEXTHOP, DEF_DEF_FILTER_NEXTHOP, &var_def_filter_nexthop, 0, 0,
+	VAR_QMGR_STATUS_SERVICE, DEF_QMGR_STATUS_SERVICE, &var_qmgr_status_service, 0, 0,
+	VAR_DEST_RATE_LIMIT, DEF_DEST_RATE_LIMIT, &var_dest_rate_limit, 1, 0,
+	VAR_XPORT_RATE_LIMIT, DEF_XPORT_RATE_LIMIT, &var_xport_rate_limit, 1, 0,
+	VAR_PRIO_LANE_MODE, DEF_PRIO_LANE_MODE, &var_prio_lane_mode, 1, 0,
+	VAR_PRIO_LANE_WEIGHTS, DEF_PRIO_LANE_WEIGHTS, &var_prio_lane_weights, 0, 0,
 	0,
     };
     static const CONFIG_TIME_TABLE time_table[] = {
@@ -773,6 +1042,7 @@ int     main(int argc, char **argv)
 	VAR_DEST_RATE_DELAY, DEF_DEST_RATE_DELAY, &var_dest_rate_delay, 0, 0,
 	VAR_QMGR_DAEMON_TIMEOUT, DEF_QMGR_DAEMON_TIMEOUT, &var_qmgr_daemon_timeout, 1, 0,
 	VAR_QMGR_IPC_TIMEOUT, DEF_QMGR_IPC_TIMEOUT, &var_qmgr_ipc_timeout, 1, 0,
+	VAR_QMGR_DEFER_RESCAN, DEF_QMGR_DEFER_RESCAN, &var_qmgr_defer_rescan, 1, 0,
 	0,
     };
     static const CONFIG_INT_TABLE int_table[] = {
@@ -793,12 +1063,17 @@ int     main(int argc, char **argv)
 	VAR_LOCAL_CON_LIMIT, DEF_LOCAL_CON_LIMIT, &var_local_con_lim, 0, 0,
 	VAR_CONC_COHORT_LIM, DEF_CONC_COHORT_LIM, &var_conc_cohort_limit, 0, 0,
 	VAR_VRFY_PEND_LIMIT, DEF_VRFY_PEND_LIMIT, &var_vrfy_pend_limit, 1, 0,
+	VAR_DEST_RATE_BURST, DEF_DEST_RATE_BURST, &var_dest_rate_burst, 1, 0,
+	VAR_XPORT_RATE_BURST, DEF_XPORT_RATE_BURST, &var_xport_rate_burst, 1, 0,
+	VAR_DEST_BATCH_LIMIT, DEF_DEST_BATCH_LIMIT, &var_dest_batch_limit, 1, 0,
 	0,
     };
     static const CONFIG_BOOL_TABLE bool_table[] = {
 	VAR_VERP_BOUNCE_OFF, DEF_VERP_BOUNCE_OFF, &var_verp_bounce_off,
 	VAR_CONC_FDBACK_DEBUG, DEF_CONC_FDBACK_DEBUG, &var_conc_feedback_debug,
 	VAR_DSN_DELAY_CLEARED, DEF_DSN_DELAY_CLEARED, &var_dsn_delay_cleared,
+	VAR_QMGR_DEFER_INDEX, DEF_QMGR_DEFER_INDEX, &var_qmgr_defer_index,
+	VAR_QMGR_ACT_SNAPSHOT, DEF_QMGR_ACT_SNAPSHOT, &var_qmgr_act_snapshot,
 	0,
     };
 
@@ -821,6 +1096,7 @@ int     main(int argc, char **argv)
 			CA_MAIL_SERVER_POST_INIT(qmgr_post_init),
 			CA_MAIL_SERVER_LOOP(qmgr_loop),
 			CA_MAIL_SERVER_PRE_ACCEPT(pre_accept),
+			CA_MAIL_SERVER_EXIT(qmgr_before_exit),
 			CA_MAIL_SERVER_SOLITARY,
 			CA_MAIL_SERVER_WATCHDOG(&var_qmgr_daemon_timeout),
 			0);
@@ -18,13 +18,16 @@
   * Utility library.
   */
 #include <vstream.h>
+#include <vstring.h>
 #include <scan_dir.h>
+#include <marena.h>
 
  /*
   * Global library.
   */
 #include <recipient_list.h>
 #include <dsn.h>
+#include <mail_priority.h>
 
  /*
   * The queue manager is built around lots of mutually-referring structures.
@@ -42,7 +45,11 @@ typedef struct QMGR_ENTRY_LIST QMGR_ENTRY_LIST;
 typedef struct QMGR_JOB_LIST QMGR_JOB_LIST;
 typedef struct QMGR_PEER_LIST QMGR_PEER_LIST;
 typedef struct QMGR_SCAN QMGR_SCAN;
+typedef struct QMGR_RETRY QMGR_RETRY;
+typedef struct QMGR_RETRY_ENTRY QMGR_RETRY_ENTRY;
 typedef struct QMGR_FEEDBACK QMGR_FEEDBACK;
+typedef struct QMGR_RCPT_POOL QMGR_RCPT_POOL;
+typedef struct QMGR_MESSAGE_LIST QMGR_MESSAGE_LIST;
 
  /*
   * Hairy macros to update doubly-linked lists.
@@ -150,6 +157,97 @@ extern void qmgr_feedback_init(QMGR_FEEDBACK *, const char *, const char *, cons
     (fb).base / sqrt(win))
 #endif
 
+ /*
+  * With latency feedback, the concurrency window follows the delivery
+  * latency and the deferrals that a receiver reports as throttling, instead
+  * of counting successes and failures. The window is updated once per
+  * cohort of deliveries. A throttled destination with a window of one is
+  * also given a rate delay that adapts in the same manner.
+  */
+#define QMGR_FEEDBACK_MODE_CLASSIC	0
+#define QMGR_FEEDBACK_MODE_LATENCY	1
+
+typedef struct QMGR_LATENCY {
+    double  avg;			/* smoothed delivery latency */
+    double  base;			/* latency without queueing */
+    int     samples;			/* deliveries in this cohort */
+    int     throttled;			/* throttled in this cohort */
+    int     delay;			/* adaptive rate delay */
+} QMGR_LATENCY;
+
+#define QMGR_LATENCY_INIT(lp) do { \
+	(lp)->avg = (lp)->base = 0; \
+	(lp)->samples = (lp)->throttled = (lp)->delay = 0; \
+    } while (0)
+
+#define QMGR_LATENCY_MAX_DELAY	60	/* adaptive rate delay limit */
+
+extern int qmgr_feedback_mode(const char *, const char *, const char *, const char *);
+extern int qmgr_feedback_latency(QMGR_LATENCY *, int, int, double, int);
+
+ /*
+  * Token-bucket rate limits. A bucket holds up to "burst" delivery tokens
+  * and is refilled at "limit" tokens per second; each delivery spends one
+  * token. The state of a destination's bucket is saved when its in-core
+  * queue is disposed of, so that a destination cannot evade its rate limit
+  * by draining the active queue.
+  */
+typedef struct QMGR_RATE {
+    double  limit;			/* tokens per second, 0 = off */
+    int     burst;			/* bucket size */
+    double  tokens;			/* available tokens */
+    double  stamp;			/* time of last refill */
+    long    waits;			/* times the bucket ran dry */
+} QMGR_RATE;
+
+#define QMGR_RATE_UNLIMITED	(1<<30)	/* result when limit is off */
+
+extern double qmgr_rate_conf(const char *, const char *, const char *, const char *);
+extern void qmgr_rate_init(QMGR_RATE *, double, int);
+extern double qmgr_rate_tokens(QMGR_RATE *);
+extern int qmgr_rate_avail(QMGR_RATE *);
+extern int qmgr_rate_take(QMGR_RATE *);
+extern int qmgr_rate_wait(QMGR_RATE *);
+extern void qmgr_rate_save(struct HTABLE *, const char *, QMGR_RATE *);
+extern void qmgr_rate_restore(struct HTABLE *, const char *, QMGR_RATE *);
+
+ /*
+  * Priority lanes. Each message priority has its own lane on a transport's
+  * job list. With strict lanes, a job is selected only when no job in a
+  * higher lane can make progress; with weighted lanes, the lanes share the
+  * delivery slots in proportion to their weight. Job preemption happens only
+  * within a lane. Per-lane statistics measure the time from message arrival
+  * to the completion of a delivery request. These are request completions,
+  * not recipient deliveries: a request with deferred recipients is not
+  * counted, but a request whose recipients were bounced is counted, because
+  * the delivery agent reply does not distinguish delivered from bounced
+  * recipients.
+  */
+#define QMGR_LANE_MODE_STRICT	0
+#define QMGR_LANE_MODE_WEIGHTED	1
+
+#define QMGR_LANE_COUNT		MAIL_PRIORITY_COUNT
+#define QMGR_LANE_HIST_SIZE	7	/* delay histogram buckets */
+
+typedef struct QMGR_LANE {
+    int     weight;			/* weighted lane share */
+    int     credit;			/* weighted round-robin state */
+    QMGR_JOB *job_head;			/* first job of lane on job list */
+    int     job_count;			/* jobs of lane on job list */
+    long    selected;			/* deliveries started */
+    long    completed;			/* requests without deferrals */
+    double  delay_total;		/* arrival to completion, total */
+    int     delay_max;			/* arrival to completion, maximum */
+    long    delay_hist[QMGR_LANE_HIST_SIZE];	/* delay histogram */
+} QMGR_LANE;
+
+extern const int qmgr_lane_hist_limits[QMGR_LANE_HIST_SIZE];
+
+extern void qmgr_lane_init(QMGR_TRANSPORT *);
+extern int qmgr_lane_select(QMGR_TRANSPORT *);
+extern void qmgr_lane_charge(QMGR_TRANSPORT *, int);
+extern void qmgr_lane_done(QMGR_TRANSPORT *, QMGR_MESSAGE *);
+
  /*
   * Each transport (local, smtp-out, bounce) can have one queue per next hop
   * name. Queues are looked up by next hop name (when we have resolved a
@@ -206,6 +304,14 @@ struct QMGR_TRANSPORT {
     int     fail_cohort_limit;		/* flow shutdown control */
     int     xport_rate_delay;		/* suspend per delivery */
     int     rate_delay;			/* suspend per delivery */
+    int     feedback_mode;		/* classic or latency */
+    QMGR_RATE xport_rate;		/* transport rate limit */
+    double  dest_rate_limit;		/* destination rate limit */
+    int     dest_rate_burst;		/* destination rate burst */
+    struct HTABLE *rate_byname;		/* saved destination rate state */
+    int     batch_limit;		/* requests per agent connection */
+    int     lane_mode;			/* strict or weighted lanes */
+    QMGR_LANE lanes[QMGR_LANE_COUNT];	/* per-priority job lanes */
 };
 
 #define QMGR_TRANSPORT_STAT_DEAD	(1<<1)
@@ -216,6 +322,7 @@ extern QMGR_TRANSPORT *qmgr_transport_select(void);
 extern void qmgr_transport_alloc(QMGR_TRANSPORT *, QMGR_TRANSPORT_ALLOC_NOTIFY);
 extern void qmgr_transport_throttle(QMGR_TRANSPORT *, DSN *);
 extern void qmgr_transport_unthrottle(QMGR_TRANSPORT *);
+extern void qmgr_transport_rate_take(QMGR_TRANSPORT *);
 extern QMGR_TRANSPORT *qmgr_transport_create(const char *);
 extern QMGR_TRANSPORT *qmgr_transport_find(const char *);
 
@@ -251,6 +358,9 @@ struct QMGR_QUEUE {
     DSN    *dsn;			/* why unavailable */
     time_t  clog_time_to_warn;		/* time of last warning */
     int     blocker_tag;		/* tagged if blocks job list */
+    int     shard_slot;			/* see qmgr_shard.c */
+    QMGR_LATENCY latency;		/* latency feedback */
+    QMGR_RATE rate;			/* destination rate limit */
 };
 
 #define	QMGR_QUEUE_TODO	1		/* waiting for service */
@@ -262,8 +372,11 @@ extern QMGR_QUEUE *qmgr_queue_create(QMGR_TRANSPORT *, const char *, const char
 extern void qmgr_queue_done(QMGR_QUEUE *);
 extern void qmgr_queue_throttle(QMGR_QUEUE *, DSN *);
 extern void qmgr_queue_unthrottle(QMGR_QUEUE *);
+extern void qmgr_queue_latency(QMGR_QUEUE *, double, int);
 extern QMGR_QUEUE *qmgr_queue_find(QMGR_TRANSPORT *, const char *);
 extern void qmgr_queue_suspend(QMGR_QUEUE *, int);
+extern int qmgr_queue_avail(QMGR_QUEUE *);
+extern void qmgr_queue_rate_take(QMGR_QUEUE *);
 
  /*
   * Exclusive queue states. Originally there were only two: "throttled" and
@@ -302,10 +415,13 @@ struct QMGR_ENTRY {
     VSTREAM *stream;			/* delivery process */
     QMGR_MESSAGE *message;		/* message info */
     RECIPIENT_LIST rcpt_list;		/* as many as it takes */
+    QMGR_RCPT_POOL *rcpt_pool;		/* recipient storage */
     QMGR_QUEUE *queue;			/* parent linkage */
     QMGR_PEER *peer;			/* parent linkage */
     QMGR_ENTRY_LIST queue_peers;	/* per queue neighbor entries */
     QMGR_ENTRY_LIST peer_peers;		/* per peer neighbor entries */
+    struct timeval start;		/* delivery request sent */
+    int     batch_count;		/* earlier requests on this stream */
 };
 
 extern QMGR_ENTRY *qmgr_entry_select(QMGR_PEER *);
@@ -314,12 +430,30 @@ extern void qmgr_entry_move_todo(QMGR_QUEUE *, QMGR_ENTRY *);
 extern void qmgr_entry_done(QMGR_ENTRY *, int);
 extern QMGR_ENTRY *qmgr_entry_create(QMGR_PEER *, QMGR_MESSAGE *);
 
+ /*
+  * Recipient batch index, see REC_TYPE_RIDX_FORMAT. A batch is a contiguous
+  * sequence of recipient record groups. When all recipients in a batch are
+  * done, the queue manager can skip the batch without reading it.
+  */
+typedef struct QMGR_RCPT_BATCH {
+    long    start;			/* first recipient record group */
+    long    end;			/* after last recipient record group */
+    long    offset;			/* index entry offset */
+    int     count;			/* recipients in batch */
+    int     done;			/* all recipients are done */
+} QMGR_RCPT_BATCH;
+
  /*
   * All common in-core information about a message is kept here. When all
   * recipients have been tried the message file is linked to the "deferred"
   * queue (some hosts not reachable), to the "bounce" queue (some recipients
   * were rejected), and is then removed from the "active" queue.
   */
+struct QMGR_MESSAGE_LIST {
+    QMGR_MESSAGE *next;
+    QMGR_MESSAGE *prev;
+};
+
 struct QMGR_MESSAGE {
     int     flags;			/* delivery problems */
     int     qflags;			/* queuing flags */
@@ -339,14 +473,16 @@ struct QMGR_MESSAGE {
     long    warn_offset;		/* warning bounce flag offset */
     time_t  warn_time;			/* time next warning to be sent */
     long    data_offset;		/* data seek offset */
-    char   *queue_name;			/* queue name */
-    char   *queue_id;			/* queue file */
+    MARENA *arena;			/* strings that are saved once */
+    char   *queue_name;			/* queue name (arena) */
+    char   *queue_id;			/* queue file (arena) */
     char   *encoding;			/* content encoding */
-    char   *sender;			/* complete address */
+    int     priority;			/* scheduling lane */
+    char   *sender;			/* complete address (arena) */
     char   *dsn_envid;			/* DSN envelope ID */
     int     dsn_ret;			/* DSN headers/full */
     int     sendopts;			/* smtputf8, requiretls, etc. */
-    char   *verp_delims;		/* VERP delimiters */
+    char   *verp_delims;		/* VERP delimiters (arena) */
     char   *filter_xport;		/* filtering transport */
     char   *inspect_xport;		/* inspecting transport */
     char   *redirect_addr;		/* info@spammer.tld */
@@ -358,17 +494,24 @@ struct QMGR_MESSAGE {
     char   *client_port;		/* client port */
     char   *client_proto;		/* client protocol */
     char   *client_helo;		/* helo parameter */
-    char   *sasl_method;		/* SASL method */
-    char   *sasl_username;		/* SASL user name */
-    char   *sasl_sender;		/* SASL sender */
-    char   *log_ident;			/* up-stream queue ID */
-    char   *rewrite_context;		/* address qualification */
+    char   *sasl_method;		/* SASL method (arena) */
+    char   *sasl_username;		/* SASL user name (arena) */
+    char   *sasl_sender;		/* SASL sender (arena) */
+    char   *log_ident;			/* up-stream queue ID (arena) */
+    char   *rewrite_context;		/* address qualification (arena) */
     RECIPIENT_LIST rcpt_list;		/* complete addresses */
+    QMGR_RCPT_POOL *rcpt_pool;		/* recipient storage */
     int     rcpt_count;			/* used recipient slots */
     int     rcpt_limit;			/* maximum read in-core */
     int     rcpt_unread;		/* # of recipients left in queue file */
+    long    rcpt_index_offset;		/* recipient batch index or zero */
+    QMGR_RCPT_BATCH *rcpt_batch;	/* batches sorted by start offset */
+    int     rcpt_batch_len;		/* number of batches */
+    QMGR_RCPT_BATCH *rcpt_batch_curr;	/* batch being read */
+    int     rcpt_batch_todo;		/* batch has undelivered recipient */
     QMGR_JOB_LIST job_list;		/* jobs delivering this message (1
 					 * per transport) */
+    QMGR_MESSAGE_LIST active_peers;	/* active queue order */
 };
 
  /*
@@ -378,6 +521,7 @@ struct QMGR_MESSAGE {
 
 #define QMGR_MESSAGE_LOCKED	((QMGR_MESSAGE *) 1)
 
+extern QMGR_MESSAGE_LIST qmgr_message_list;
 extern int qmgr_message_count;
 extern int qmgr_recipient_count;
 extern int qmgr_vrfy_pend_count;
@@ -440,6 +584,7 @@ struct QMGR_PEER {
 };
 
 extern QMGR_ENTRY *qmgr_job_entry_select(QMGR_TRANSPORT *);
+extern QMGR_ENTRY *qmgr_job_entry_select_queue(QMGR_QUEUE *);
 extern QMGR_PEER *qmgr_peer_select(QMGR_JOB *);
 extern void qmgr_job_blocker_update(QMGR_QUEUE *);
 
@@ -474,6 +619,7 @@ extern void qmgr_deliver(QMGR_TRANSPORT *, VSTREAM *);
   * qmgr_active.c
   */
 extern int qmgr_active_feed(QMGR_SCAN *, const char *);
+extern int qmgr_active_reload(const char *);
 extern void qmgr_active_drain(void);
 extern void qmgr_active_done(QMGR_MESSAGE *);
 
@@ -497,8 +643,13 @@ struct QMGR_SCAN {
     int     flags;			/* private, this run */
     int     nflags;			/* private, next run */
     struct SCAN_DIR *handle;		/* scan */
+    QMGR_RETRY *retry;			/* retry index or null */
+    time_t  due;			/* retry index scan */
 };
 
+#define QMGR_SCAN_BUSY(scan_info) \
+	((scan_info)->handle != 0 || (scan_info)->due != 0)
+
  /*
   * Flags that control queue scans or destination selection. These are
   * similar to the QMGR_REQ_XXX request codes.
@@ -509,6 +660,7 @@ struct QMGR_SCAN {
 #define QMGR_FLUSH_DFXP	(1<<3)		/* override defer_transports */
 #define QMGR_FLUSH_EACH	(1<<4)		/* unthrottle per message */
 #define QMGR_FORCE_EXPIRE (1<<5)	/* force-defer and force-expire */
+#define QMGR_SCAN_INDEX	(1<<6)		/* due files in retry index only */
 
  /*
   * qmgr_scan.c
@@ -517,6 +669,96 @@ extern QMGR_SCAN *qmgr_scan_create(const char *);
 extern void qmgr_scan_request(QMGR_SCAN *, int);
 extern char *qmgr_scan_next(QMGR_SCAN *);
 
+ /*
+  * qmgr_retry.c
+  */
+struct QMGR_RETRY {
+    char   *path;			/* index file name */
+    VSTREAM *fp;			/* index file */
+    QMGR_RETRY_ENTRY *heap;		/* entries, earliest first */
+    ssize_t len;			/* number of entries */
+    ssize_t size;			/* heap allocation */
+    time_t  built;			/* last rebuild, or 0 */
+    int     flags;			/* see below */
+    VSTRING *queue_id;			/* result buffer */
+};
+
+extern QMGR_RETRY *qmgr_retry_open(const char *);
+extern void qmgr_retry_enter(QMGR_RETRY *, const char *, time_t);
+extern const char *qmgr_retry_next(QMGR_RETRY *, time_t);
+extern void qmgr_retry_rebuild(QMGR_RETRY *, time_t);
+extern void qmgr_retry_save(QMGR_RETRY *);
+extern int qmgr_retry_stale(QMGR_RETRY *, time_t, int);
+extern void qmgr_retry_close(QMGR_RETRY *);
+
+extern QMGR_RETRY *qmgr_retry_index;
+
+#define QMGR_RETRY_FILE	"qmgr_retry_index"	/* under $data_directory */
+
+ /*
+  * qmgr_snapshot.c
+  */
+extern void qmgr_snapshot_open(const char *);
+extern int qmgr_snapshot_find(const char *);
+extern const char *qmgr_snapshot_next(void);
+extern void qmgr_snapshot_save(void);
+
+#define QMGR_SNAPSHOT_FILE "qmgr_active_snapshot"	/* under $data_directory */
+
+ /*
+  * qmgr_rcpt_pool.c. Recipient address information is allocated from a
+  * memory pool that is shared by a message and by the queue entries that
+  * receive recipients from one qmgr_message_read() call. The pool goes away
+  * when the last of those lets go.
+  */
+struct QMGR_RCPT_POOL {
+    MARENA *arena;			/* recipient strings */
+    int     refcount;			/* message, queue entries */
+    const char *last_orig;		/* previous original recipient */
+    const char *last_orcpt;		/* previous DSN original recipient */
+};
+
+extern QMGR_RCPT_POOL *qmgr_rcpt_pool_create(int);
+extern QMGR_RCPT_POOL *qmgr_rcpt_pool_link(QMGR_RCPT_POOL *);
+extern void qmgr_rcpt_pool_unlink(QMGR_RCPT_POOL *);
+extern QMGR_RCPT_POOL *qmgr_rcpt_pool_refresh(QMGR_RCPT_POOL *);
+extern void qmgr_rcpt_pool_add(QMGR_RCPT_POOL *, RECIPIENT_LIST *, long,
+			               const char *, int, const char *,
+			               const char *);
+extern const char *qmgr_rcpt_pool_strdup(QMGR_RCPT_POOL *, const char *);
+extern void qmgr_rcpt_pool_stats(void);
+
+#define QMGR_RCPT_LIST_INIT	(RCPT_LIST_INIT_QUEUE | RCPT_LIST_FLAG_NOCOPY)
+
+typedef struct QMGR_RCPT_STATS {
+    long    rcpt_count;			/* recipients stored */
+    long    byte_count;			/* storage for those recipients */
+    long    curr_bytes;			/* string storage in use */
+    long    peak_bytes;			/* max string storage in use */
+} QMGR_RCPT_STATS;
+
+extern QMGR_RCPT_STATS qmgr_rcpt_stats;
+
+ /*
+  * qmgr_status.c
+  */
+extern void qmgr_status_init(const char *);
+
+ /*
+  * qmgr_shard.c
+  */
+extern int qmgr_shard_index;
+extern void qmgr_shard_init(const char *);
+extern int qmgr_shard_owns(const char *);
+extern int qmgr_shard_slot(const char *, const char *);
+extern void qmgr_shard_release(QMGR_QUEUE *);
+extern void qmgr_shard_busy(QMGR_QUEUE *, int);
+extern int qmgr_shard_active(QMGR_QUEUE *);
+extern int qmgr_shard_avail(QMGR_QUEUE *);
+extern void qmgr_shard_done(void);
+
+#define QMGR_SHARD_FILE	"qmgr_shard_table"	/* under $data_directory */
+
  /*
   * qmgr_error.c
   */
@@ -10,6 +10,9 @@
 /*	QMGR_SCAN *scan_info;
 /*	const char *queue_id;
 /*
+/*	int	qmgr_active_reload(queue_id)
+/*	const char *queue_id;
+/*
 /*	void	qmgr_active_drain()
 /*
 /*	int	qmgr_active_done(message)
@@ -26,6 +29,8 @@
 /*	qmgr_active_feed() inserts the named message file into
 /*	the active queue. Message files with the wrong name or
 /*	with other wrong properties are skipped but not removed.
+/*	Message files that belong to a different queue manager shard
+/*	are skipped.
 /*	The following queue flags are recognized, other flags being
 /*	ignored:
 /* .IP QMGR_SCAN_ALL
@@ -33,6 +38,14 @@
 /*	future time stamps are ignored, and incoming queue files with
 /*	future time stamps are frowned upon.
 /* .PP
+/*	When the scan has a retry index, a queue file that is skipped
+/*	because of its future time stamp is added to that index.
+/*
+/*	qmgr_active_reload() inserts the named message file into the
+/*	active queue, without moving it. This is used for files that
+/*	were listed in an active queue snapshot by the previous queue
+/*	manager. A file that no longer exists is skipped.
+/*
 /*	qmgr_active_drain() allocates one delivery process.
 /*	Process allocation is asynchronous. Once the delivery
 /*	process is available, an attempt is made to deliver
@@ -55,7 +68,8 @@
 /*	into the future by a minimal backoff time, whichever is more.
 /*	The minimal_backoff_time parameter specifies the minimal
 /*	amount of time between delivery attempts; maximal_backoff_time
-/*	specifies an upper limit.
+/*	specifies an upper limit. When the deferred queue has a retry
+/*	index, the message is also added to that index.
 /* DIAGNOSTICS
 /*	Fatal: queue file access failures, out of memory.
 /*	Panic: interface violations, internal consistency errors.
@@ -121,6 +135,8 @@
 
 #include "qmgr.h"
 
+static int qmgr_active_load(const char *, int, mode_t);
+
  /*
   * A bunch of call-back routines.
   */
@@ -161,6 +177,13 @@ static void qmgr_active_defer(const char *queue_name, const char *queue_id,
 	msg_info("wakeup %s after %ld secs", queue_id, (long) delay);
 
     tbuf.actime = tbuf.modtime = event_time() + delay;
+
+    /*
+     * Update the retry index before the rename, so that the index is never
+     * behind the deferred queue.
+     */
+    if (qmgr_retry_index != 0 && strcmp(dest_queue, MAIL_QUEUE_DEFERRED) == 0)
+	qmgr_retry_enter(qmgr_retry_index, queue_id, tbuf.modtime);
     path = mail_queue_path((VSTRING *) 0, queue_name, queue_id);
     if (utime(path, &tbuf) < 0 && errno != ENOENT)
 	msg_fatal("%s: update %s time stamps: %m", myname, path);
@@ -180,7 +203,6 @@ static void qmgr_active_defer(const char *queue_name, const char *queue_id,
 int     qmgr_active_feed(QMGR_SCAN *scan_info, const char *queue_id)
 {
     const char *myname = "qmgr_active_feed";
-    QMGR_MESSAGE *message;
     struct stat st;
     const char *path;
 
@@ -189,6 +211,12 @@ int     qmgr_active_feed(QMGR_SCAN *scan_info, const char *queue_id)
     if (msg_verbose)
 	msg_info("%s: queue %s", myname, scan_info->queue);
 
+    /*
+     * With multiple queue manager shards, leave other shards' mail alone.
+     */
+    if (!qmgr_shard_owns(queue_id))
+	return (0);
+
     /*
      * Make sure this is something we are willing to open.
      */
@@ -207,6 +235,8 @@ int     qmgr_active_feed(QMGR_SCAN *scan_info, const char *queue_id)
 	if (msg_verbose)
 	    msg_info("%s: skip %s (%ld seconds)", myname, queue_id,
 		     (long) (st.st_mtime - event_time()));
+	if (scan_info->retry)
+	    qmgr_retry_enter(scan_info->retry, queue_id, st.st_mtime);
 	return (0);
     }
 
@@ -221,6 +251,33 @@ int     qmgr_active_feed(QMGR_SCAN *scan_info, const char *queue_id)
 		 queue_id, scan_info->queue, MAIL_QUEUE_ACTIVE);
 	return (0);
     }
+    return (qmgr_active_load(queue_id, scan_info->flags, st.st_mode));
+}
+
+/* qmgr_active_reload - reload message file that is already active */
+
+int     qmgr_active_reload(const char *queue_id)
+{
+    struct stat st;
+    const char *path;
+
+    if (msg_verbose)
+	msg_info("qmgr_active_reload: %s", queue_id);
+
+    /*
+     * The file may have been delivered, removed or moved after the previous
+     * queue manager terminated.
+     */
+    if (mail_open_ok(MAIL_QUEUE_ACTIVE, queue_id, &st, &path) == MAIL_OPEN_NO)
+	return (0);
+    return (qmgr_active_load(queue_id, 0, st.st_mode));
+}
+
+/* qmgr_active_load - read active message file */
+
+static int qmgr_active_load(const char *queue_id, int flags, mode_t mode)
+{
+    QMGR_MESSAGE *message;
 
     /*
      * Extract envelope information: sender and recipients. At this point,
@@ -246,10 +303,10 @@ int     qmgr_active_feed(QMGR_SCAN *scan_info, const char *queue_id)
 	(mode) & ~MAIL_QUEUE_STAT_UNTHROTTLE : 0)
 
     if ((message = qmgr_message_alloc(MAIL_QUEUE_ACTIVE, queue_id,
-				      scan_info->flags
-				      | MAYBE_FLUSH_AFTER(st.st_mode)
-				      | MAYBE_FORCE_EXPIRE(st.st_mode),
-				      MAYBE_UPDATE_MODE(st.st_mode))) == 0) {
+				      flags
+				      | MAYBE_FLUSH_AFTER(mode)
+				      | MAYBE_FORCE_EXPIRE(mode),
+				      MAYBE_UPDATE_MODE(mode))) == 0) {
 	qmgr_active_corrupt(queue_id);
 	return (0);
     } else if (message == QMGR_MESSAGE_LOCKED) {
@@ -30,6 +30,14 @@
 /*	pointer if the transport accepts no connection. Upon completion
 /*	of delivery (successful or not), the stream is closed, so that the
 /*	delivery process is released.
+/*
+/*	With a transport_destination_batch_limit larger than one, the
+/*	queue manager asks the delivery agent to stay connected after
+/*	a request. When the delivery agent reports success and is
+/*	willing to receive another request, the queue manager sends
+/*	it the next entry for the same destination, if that
+/*	destination can accept another delivery. Each request still
+/*	gets its own status report.
 /* DIAGNOSTICS
 /* LICENSE
 /* .ad
@@ -107,6 +115,16 @@ int     qmgr_deliver_concurrency;
 #define DELIVER_STAT_DEFER	1	/* try some recipients later */
 #define DELIVER_STAT_CRASH	2	/* mailer internal problem */
 
+ /*
+  * Ask the delivery agent to stay connected after this request? A transport
+  * rate delay must be enforced between deliveries, so it rules out batching.
+  */
+#define QMGR_DELIVER_BATCH(entry) \
+	((entry)->batch_count + 1 < (entry)->queue->transport->batch_limit \
+	 && (entry)->queue->transport->xport_rate_delay == 0)
+
+static void qmgr_deliver_start(QMGR_ENTRY *, VSTREAM *);
+
 /* qmgr_deliver_initial_reply - retrieve initial delivery process response */
 
 static int qmgr_deliver_initial_reply(VSTREAM *stream)
@@ -126,17 +144,34 @@ static int qmgr_deliver_initial_reply(VSTREAM *stream)
 
 /* qmgr_deliver_final_reply - retrieve final delivery process response */
 
-static int qmgr_deliver_final_reply(VSTREAM *stream, DSN_BUF *dsb)
+static int qmgr_deliver_final_reply(VSTREAM *stream, DSN_BUF *dsb,
+				            int *throttled, int *batch)
 {
     int     stat;
+    int     other;
 
+    /*
+     * With latency feedback, the delivery agent also reports how many
+     * recipients were deferred, by deferral class. With batching, the
+     * delivery agent also reports if it will accept another request.
+     */
     if (peekfd(vstream_fileno(stream)) < 0) {
 	msg_warn("%s: premature disconnect", VSTREAM_PATH(stream));
 	return (DELIVER_STAT_CRASH);
-    } else if (attr_scan(stream, ATTR_FLAG_STRICT,
+    } else if (attr_scan(stream, ATTR_FLAG_STRICT | ATTR_FLAG_MORE,
 			 RECV_ATTR_FUNC(dsb_scan, (void *) dsb),
 			 RECV_ATTR_INT(MAIL_ATTR_STATUS, &stat),
-			 ATTR_TYPE_END) != 2) {
+			 ATTR_TYPE_END) != 2
+	       || (throttled != 0
+		   && attr_scan(stream, ATTR_FLAG_STRICT | ATTR_FLAG_MORE,
+			     RECV_ATTR_INT(MAIL_ATTR_DEFER_THROTTLE, throttled),
+			      RECV_ATTR_INT(MAIL_ATTR_DEFER_OTHER, &other),
+				ATTR_TYPE_END) != 2)
+	       || (batch != 0
+		   && attr_scan(stream, ATTR_FLAG_STRICT | ATTR_FLAG_MORE,
+				RECV_ATTR_INT(MAIL_ATTR_BATCH, batch),
+				ATTR_TYPE_END) != 1)
+	       || attr_scan(stream, ATTR_FLAG_STRICT, ATTR_TYPE_END) != 0) {
 	msg_warn("%s: malformed response", VSTREAM_PATH(stream));
 	return (DELIVER_STAT_CRASH);
     } else {
@@ -186,6 +221,10 @@ static int qmgr_deliver_send_request(QMGR_ENTRY *entry, VSTREAM *stream)
     flags = message->tflags
 	| entry->queue->dflags
 	| (message->inspect_xport ? DEL_REQ_FLAG_BOUNCE : DEL_REQ_FLAG_DEFLT);
+    if (entry->queue->transport->feedback_mode == QMGR_FEEDBACK_MODE_LATENCY)
+	flags |= DEL_REQ_FLAG_DEFER_STATS;
+    if (QMGR_DELIVER_BATCH(entry))
+	flags |= DEL_REQ_FLAG_BATCH;
     (void) QMGR_MSG_STATS(&stats, message);
     attr_print(stream, ATTR_FLAG_NONE,
 	       SEND_ATTR_INT(MAIL_ATTR_FLAGS, flags),
@@ -253,7 +292,15 @@ static void qmgr_deliver_update(int unused_event, void *context)
     QMGR_TRANSPORT *transport = queue->transport;
     QMGR_MESSAGE *message = entry->message;
     static DSN_BUF *dsb;
+    static VSTRING *queue_name;
     int     status;
+    int     throttled = 0;
+    int     batch = 0;
+    int     batch_count;
+    VSTREAM *stream;
+    QMGR_ENTRY *next;
+    struct timeval now;
+    double  latency;
 
     /*
      * Release the delivery agent from a "hot" queue entry.
@@ -265,8 +312,10 @@ static void qmgr_deliver_update(int unused_event, void *context)
 	qmgr_deliver_concurrency--; \
     } while (0)
 
-    if (dsb == 0)
+    if (dsb == 0) {
 	dsb = dsb_create();
+	queue_name = vstring_alloc(100);
+    }
 
     /*
      * The message transport has responded. Stop the watchdog timer.
@@ -280,7 +329,12 @@ static void qmgr_deliver_update(int unused_event, void *context)
      * manager can log why it does not even try to schedule delivery to the
      * affected recipients.
      */
-    status = qmgr_deliver_final_reply(entry->stream, dsb);
+    status = qmgr_deliver_final_reply(entry->stream, dsb,
+				      transport->feedback_mode ==
+				      QMGR_FEEDBACK_MODE_LATENCY ?
+				      &throttled : (int *) 0,
+				      QMGR_DELIVER_BATCH(entry) ?
+				      &batch : (int *) 0);
 
     /*
      * The mail delivery process failed for some reason (although delivery
@@ -370,11 +424,58 @@ static void qmgr_deliver_update(int unused_event, void *context)
 	    qmgr_queue_unthrottle(queue);
     }
 
+    /*
+     * With latency feedback, the time to complete this delivery request and
+     * the receiver's throttling decide the concurrency window. A connection
+     * or handshake failure carries no latency information; that is handled
+     * with negative feedback above.
+     */
+    if (status != DELIVER_STAT_CRASH && VSTRING_LEN(dsb->reason) == 0
+	&& transport->feedback_mode == QMGR_FEEDBACK_MODE_LATENCY
+	&& QMGR_QUEUE_READY(queue)) {
+	GETTIMEOFDAY(&now);
+	latency = (now.tv_sec - entry->start.tv_sec)
+	    + (now.tv_usec - entry->start.tv_usec) / 1000000.0;
+	qmgr_queue_latency(queue, latency, throttled > 0);
+    }
+
+    /*
+     * Per-lane statistics: the time from message arrival until a delivery
+     * request for the message is completed. A request with deferred
+     * recipients has DELIVER_STAT_DEFER status and is not counted. The
+     * reply does not tell us if recipients were delivered or bounced.
+     */
+    if (status == DELIVER_STAT_OK)
+	qmgr_lane_done(transport, message);
+
     /*
      * Release the delivery process, and give some other queue entry a chance
      * to be delivered. When all recipients for a message have been tried,
      * decide what to do next with this message: defer, bounce, delete.
+     * 
+     * When the delivery agent will accept another request, keep it and hand
+     * it the next entry for the same destination. The queue may go away
+     * when this entry is done; look it up again by name.
      */
+    if (batch > 0 && status == 0 && VSTRING_LEN(dsb->reason) == 0
+	&& !QMGR_TRANSPORT_THROTTLED(transport)) {
+	event_disable_readwrite(vstream_fileno(entry->stream));
+	stream = entry->stream;
+	entry->stream = 0;
+	qmgr_deliver_concurrency--;
+	batch_count = entry->batch_count;
+	vstring_strcpy(queue_name, queue->name);
+	qmgr_entry_done(entry, QMGR_QUEUE_BUSY);
+	if ((queue = qmgr_queue_find(transport, vstring_str(queue_name))) != 0
+	    && qmgr_rate_avail(&transport->xport_rate) > 0
+	    && (next = qmgr_job_entry_select_queue(queue)) != 0) {
+	    next->batch_count = batch_count + 1;
+	    qmgr_deliver_start(next, stream);
+	} else {
+	    (void) vstream_fclose(stream);
+	}
+	return;
+    }
     QMGR_DELIVER_RELEASE_AGENT(entry);
     qmgr_entry_done(entry, QMGR_QUEUE_BUSY);
 }
@@ -422,6 +523,15 @@ void    qmgr_deliver(QMGR_TRANSPORT *transport, VSTREAM *stream)
 	(void) vstream_fclose(stream);
 	return;
     }
+    qmgr_deliver_start(entry, stream);
+}
+
+/* qmgr_deliver_start - send request and wait for status report */
+
+static void qmgr_deliver_start(QMGR_ENTRY *entry, VSTREAM *stream)
+{
+    QMGR_TRANSPORT *transport = entry->queue->transport;
+    DSN     dsn;
 
     /*
      * Send the queue file info and recipient info to the delivery process.
@@ -453,6 +563,7 @@ void    qmgr_deliver(QMGR_TRANSPORT *transport, VSTREAM *stream)
      */
     qmgr_deliver_concurrency++;
     entry->stream = stream;
+    GETTIMEOFDAY(&entry->start);
     event_enable_read(vstream_fileno(stream),
 		      qmgr_deliver_update, (void *) entry);
 
@@ -31,7 +31,9 @@
 /*	qmgr_entry_create() creates an entry for the named peer and message,
 /*	and appends the entry to the peer's list and its queue's todo list.
 /*	Filling in and cleaning up the recipients is the responsibility
-/*	of the caller.
+/*	of the caller. The caller also attaches the qmgr_rcpt_pool(3)
+/*	that holds the recipient address information; qmgr_entry_done()
+/*	lets go of that pool.
 /*
 /*	qmgr_entry_done() discards a per-site queue entry.  The
 /*	\fIwhich\fR argument is either QMGR_QUEUE_BUSY for an entry
@@ -58,6 +60,8 @@
 /*	per-site queue's `todo' list for actual delivery. The entry is
 /*	moved to the queue's `busy' list: the list of messages being
 /*	delivered. The entry is also removed from its peer list.
+/*	The delivery spends one token from the destination and
+/*	transport rate limits.
 /*
 /*	qmgr_entry_unselect() takes the named entry off the named
 /*	per-site queue's `busy' list and moves it to the queue's
@@ -119,8 +123,11 @@ QMGR_ENTRY *qmgr_entry_select(QMGR_PEER *peer)
 	queue->todo_refcount--;
 	QMGR_LIST_APPEND(queue->busy, entry, queue_peers);
 	queue->busy_refcount++;
+	qmgr_shard_busy(queue, 1);
 	QMGR_LIST_UNLINK(peer->entry_list, QMGR_ENTRY *, entry, peer_peers);
 	peer->job->selected_entries++;
+	qmgr_queue_rate_take(queue);
+	qmgr_transport_rate_take(queue->transport);
 
 	/*
 	 * With opportunistic session caching, the delivery agent must not
@@ -192,6 +199,7 @@ void    qmgr_entry_unselect(QMGR_ENTRY *entry)
      */
     QMGR_LIST_UNLINK(queue->busy, QMGR_ENTRY *, entry, queue_peers);
     queue->busy_refcount--;
+    qmgr_shard_busy(queue, -1);
     QMGR_LIST_APPEND(queue->todo, entry, queue_peers);
     queue->todo_refcount++;
     QMGR_LIST_PREPEND(peer->entry_list, entry, peer_peers);
@@ -237,6 +245,8 @@ void    qmgr_entry_move_todo(QMGR_QUEUE *dst_queue, QMGR_ENTRY *entry)
     new_entry = qmgr_entry_create(dst_peer, message);
 
     recipient_list_swap(&entry->rcpt_list, &new_entry->rcpt_list);
+    new_entry->rcpt_pool = entry->rcpt_pool;
+    entry->rcpt_pool = 0;
 
     src_job->rcpt_count -= rcpt_count;
     dst_job->rcpt_count += rcpt_count;
@@ -263,6 +273,7 @@ void    qmgr_entry_done(QMGR_ENTRY *entry, int which)
     if (which == QMGR_QUEUE_BUSY) {
 	QMGR_LIST_UNLINK(queue->busy, QMGR_ENTRY *, entry, queue_peers);
 	queue->busy_refcount--;
+	qmgr_shard_busy(queue, -1);
     } else if (which == QMGR_QUEUE_TODO) {
 	QMGR_LIST_UNLINK(peer->entry_list, QMGR_ENTRY *, entry, peer_peers);
 	job->selected_entries++;
@@ -280,6 +291,7 @@ void    qmgr_entry_done(QMGR_ENTRY *entry, int which)
     message->rcpt_count -= entry->rcpt_list.len;
     qmgr_recipient_count -= entry->rcpt_list.len;
     recipient_list_free(&entry->rcpt_list);
+    qmgr_rcpt_pool_unlink(entry->rcpt_pool);
     myfree((void *) entry);
 
     /*
@@ -315,6 +327,16 @@ void    qmgr_entry_done(QMGR_ENTRY *entry, int which)
 	if (QMGR_QUEUE_READY(queue))
 	    qmgr_queue_suspend(queue, transport->rate_delay);
     }
+
+    /*
+     * With latency feedback, a destination that throttles us at a window of
+     * one gets an adaptive rate delay. The delay is applied only after the
+     * last delivery in progress, like the rate delay above.
+     */
+    if (which == QMGR_QUEUE_BUSY && transport->rate_delay == 0
+	&& queue->latency.delay > 0 && QMGR_QUEUE_READY(queue)
+	&& queue->busy_refcount == 0)
+	qmgr_queue_suspend(queue, queue->latency.delay);
     if (!QMGR_QUEUE_SUSPENDED(queue)
 	&& queue->blocker_tag == transport->blocker_tag)
 	qmgr_job_blocker_update(queue);
@@ -374,7 +396,9 @@ QMGR_ENTRY *qmgr_entry_create(QMGR_PEER *peer, QMGR_MESSAGE *message)
     entry = (QMGR_ENTRY *) mymalloc(sizeof(QMGR_ENTRY));
     entry->stream = 0;
     entry->message = message;
-    recipient_list_init(&entry->rcpt_list, RCPT_LIST_INIT_QUEUE);
+    recipient_list_init(&entry->rcpt_list, QMGR_RCPT_LIST_INIT);
+    entry->rcpt_pool = 0;
+    entry->batch_count = 0;
     message->refcount++;
     entry->peer = peer;
     QMGR_LIST_APPEND(peer->entry_list, entry, peer_peers);
@@ -17,6 +17,19 @@
 /*	double	QMGR_FEEDBACK_VAL(fbck_ctl, concurrency)
 /*	QMGR_FEEDBACK *fbck_ctl;
 /*	const int concurrency;
+/*
+/*	int	qmgr_feedback_mode(name_prefix, name_tail, def_name, def_value)
+/*	const char *name_prefix;
+/*	const char *name_tail;
+/*	const char *def_name;
+/*	const char *def_value;
+/*
+/*	int	qmgr_feedback_latency(lat_ctl, window, limit, latency, throttled)
+/*	QMGR_LATENCY *lat_ctl;
+/*	int	window;
+/*	int	limit;
+/*	double	latency;
+/*	int	throttled;
 /* DESCRIPTION
 /*	Upon completion of a delivery request, a delivery agent
 /*	provides a hint that the scheduler should dedicate fewer or
@@ -31,6 +44,27 @@
 /*	current concurrency window. This is an "unsafe" macro that
 /*	evaluates some arguments multiple times.
 /*
+/*	qmgr_feedback_mode() looks up the transport-dependent feedback
+/*	mode from main.cf, and returns QMGR_FEEDBACK_MODE_CLASSIC
+/*	or QMGR_FEEDBACK_MODE_LATENCY.
+/*
+/*	qmgr_feedback_latency() implements latency feedback. It
+/*	updates the latency statistics of a destination with the
+/*	outcome of one delivery, and returns the new concurrency
+/*	window. Once per cohort (as many deliveries as the window
+/*	size), the window is decreased by one quarter when the
+/*	receiver throttled any delivery in that cohort. Otherwise,
+/*	the number of deliveries that wait at the receiver is
+/*	estimated from the difference between the smoothed latency
+/*	and the lowest recent latency, and the window is increased
+/*	by one when that number is less than one, or decreased by
+/*	one when it is more than three. At a window of one,
+/*	throttling doubles the adaptive rate delay instead, and a
+/*	cohort without throttling halves it. The window is not
+/*	increased while the rate delay is non-zero.
+/*	This function has no side effects other than updating the
+/*	QMGR_LATENCY structure, so that it can be used for simulation.
+/*
 /*	Arguments:
 /* .IP fbck_ctl
 /*	Pointer to QMGR_FEEDBACK structure where the result will
@@ -48,9 +82,21 @@
 /*	The value of the default feedback parameter.
 /* .IP concurrency
 /*	Delivery concurrency for concurrency-dependent feedback calculation.
+/* .IP lat_ctl
+/*	Pointer to the latency feedback state of a destination, initialized
+/*	with QMGR_LATENCY_INIT().
+/* .IP window
+/*	The current concurrency window of the destination.
+/* .IP limit
+/*	The transport-dependent destination concurrency limit, or zero.
+/* .IP latency
+/*	The time from sending a delivery request to receiving the
+/*	delivery status, in seconds.
+/* .IP throttled
+/*	Non-zero when the receiver asked the sender to slow down.
 /* DIAGNOSTICS
 /*	Warning: configuration error or unreasonable input. The program
-/*	uses name_tail feedback instead.
+/*	uses name_tail feedback, or classic feedback mode, instead.
 /*	Panic: consistency check failure.
 /* LICENSE
 /* .ad
@@ -180,3 +226,96 @@ void    qmgr_feedback_init(QMGR_FEEDBACK *fb,
     myfree(fbck_name);
     myfree(fbck_val);
 }
+
+/* qmgr_feedback_mode - look up feedback mode */
+
+int     qmgr_feedback_mode(const char *name_prefix, const char *name_tail,
+			           const char *def_name, const char *def_val)
+{
+    static const NAME_CODE qmgr_feedback_mode_map[] = {
+	CONC_FDBACK_MODE_CLASSIC, QMGR_FEEDBACK_MODE_CLASSIC,
+	CONC_FDBACK_MODE_LATENCY, QMGR_FEEDBACK_MODE_LATENCY,
+	0, -1,
+    };
+    char   *mode_name;
+    char   *mode_val;
+    int     mode;
+
+    mode_name = concatenate(name_prefix, name_tail, (char *) 0);
+    mode_val = get_mail_conf_str(mode_name, def_val, 1, 0);
+    if ((mode = name_code(qmgr_feedback_mode_map, NAME_CODE_FLAG_NONE,
+			  mode_val)) < 0) {
+	msg_warn("%s: ignoring unknown feedback mode: %s",
+		 strcmp(mode_val, def_val) ? mode_name : def_name, mode_val);
+	mode = QMGR_FEEDBACK_MODE_CLASSIC;
+    }
+    myfree(mode_name);
+    myfree(mode_val);
+    return (mode);
+}
+
+ /*
+  * Latency feedback parameters. The smoothed latency follows the measured
+  * latency with a gain of 1/8, like a TCP round-trip time estimate. The
+  * base latency tracks the minimum, and slowly drifts up toward the smoothed
+  * latency, so that it recovers after a change in network path or receiver
+  * capacity. The thresholds are the number of deliveries that may wait at
+  * the receiver, as in TCP Vegas.
+  */
+#define QMGR_LATENCY_GAIN	8
+#define QMGR_LATENCY_DRIFT	64
+#define QMGR_LATENCY_ALPHA	1
+#define QMGR_LATENCY_BETA	3
+
+/* qmgr_feedback_latency - update window from latency and throttling */
+
+int     qmgr_feedback_latency(QMGR_LATENCY *lp, int window, int limit,
+			              double latency, int throttled)
+{
+    double  waiting;
+
+    /*
+     * Update the latency statistics with every delivery.
+     */
+    if (lp->avg <= 0) {
+	lp->avg = lp->base = latency;
+    } else {
+	lp->avg += (latency - lp->avg) / QMGR_LATENCY_GAIN;
+	if (latency < lp->base)
+	    lp->base = latency;
+	else
+	    lp->base += (lp->avg - lp->base) / QMGR_LATENCY_DRIFT;
+    }
+    lp->samples += 1;
+    if (throttled)
+	lp->throttled += 1;
+
+    /*
+     * Update the window once per cohort, so that the effect of one update
+     * can be observed before the next.
+     */
+    if (lp->samples < window)
+	return (window);
+    if (lp->throttled > 0) {
+	if (window > 1) {
+	    window -= (window + 3) / 4;
+	} else {
+	    lp->delay = (lp->delay > 0 ? 2 * lp->delay : 1);
+	    if (lp->delay > QMGR_LATENCY_MAX_DELAY)
+		lp->delay = QMGR_LATENCY_MAX_DELAY;
+	}
+    } else if (lp->delay > 0) {
+	lp->delay /= 2;
+    } else {
+	waiting = (lp->avg > 0 ? window * (lp->avg - lp->base) / lp->avg : 0);
+	if (waiting < QMGR_LATENCY_ALPHA) {
+	    if (limit == 0 || window < limit)
+		window += 1;
+	} else if (waiting > QMGR_LATENCY_BETA) {
+	    if (window > 1)
+		window -= 1;
+	}
+    }
+    lp->samples = lp->throttled = 0;
+    return (window);
+}
@@ -0,0 +1,464 @@
+/*++
+/* NAME
+/*	qmgr_feedback_sim 1
+/* SUMMARY
+/*	replay delivery traces against destination concurrency feedback
+/* SYNOPSIS
+/* .fi
+/*	\fBqmgr_feedback_sim\fR [\fB-v\fR] [\fB-i \fIinitial\fR]
+/*	[\fB-l \fIlimit\fR] [\fB-m \fImode\fR] [\fB-t \fIseconds\fR]
+/*	[\fItrace\fR]
+/*
+/*	\fBqmgr_feedback_sim -g \fIcapacity\fR [\fB-b \fIlatency\fR]
+/* DESCRIPTION
+/*	The \fBqmgr_feedback_sim\fR command replays a recorded
+/*	delivery trace for one destination against the queue
+/*	manager's concurrency feedback, and reports the throughput
+/*	with \fBclassic\fR and with \fBlatency\fR feedback (see
+/*	qmgr_feedback(3)).
+/*
+/*	The trace is read from the named file or from standard input.
+/*	Each line describes one delivery:
+/*
+/* .nf
+/*	\fIactive latency outcome\fR
+/* .fi
+/*
+/*	where \fIactive\fR is the number of deliveries in progress
+/*	for the destination, \fIlatency\fR is the time for the
+/*	delivery in seconds, and \fIoutcome\fR is one of \fBsent\fR,
+/*	\fBthrottled\fR (the receiver asked the sender to slow down),
+/*	\fBdeferred\fR (another temporary error), or \fBfailed\fR
+/*	(connection or handshake failure). Empty lines and lines
+/*	that start with "#" are ignored. Such a trace can be made
+/*	from the queue manager's logging with
+/*	\fBdestination_concurrency_feedback_debug = yes\fR and latency
+/*	feedback turned on.
+/*
+/*	The simulation runs on a virtual clock. It keeps as many
+/*	deliveries in progress as the concurrency window allows.
+/*	Each delivery takes its latency and outcome from the next
+/*	trace record with the nearest \fIactive\fR value, so that the
+/*	receiver responds to the simulated concurrency as it did to
+/*	the recorded concurrency. Deliveries that are not \fBsent\fR
+/*	do not count toward the throughput. The simulation applies
+/*	negative feedback after a failure in both modes; it does not
+/*	implement the failed cohort limit.
+/*
+/*	Options:
+/* .IP "\fB-b \fIlatency\fR (default: 0.5)"
+/*	With \fB-g\fR, the delivery latency in seconds without
+/*	queueing at the receiver.
+/* .IP "\fB-g \fIcapacity\fR"
+/*	Instead of a simulation, write a synthetic trace to standard
+/*	output, for a receiver that serves \fIcapacity\fR deliveries
+/*	in parallel. Above that, its latency grows with the number
+/*	of deliveries that wait, and above 1.5 times that, it
+/*	throttles an increasing fraction of deliveries.
+/* .IP "\fB-i \fIinitial\fR (default: 5)"
+/*	The initial destination concurrency.
+/* .IP "\fB-l \fIlimit\fR (default: 20)"
+/*	The destination concurrency limit.
+/* .IP "\fB-m \fImode\fR"
+/*	Simulate only the specified feedback mode, \fBclassic\fR
+/*	or \fBlatency\fR.
+/* .IP "\fB-t \fIseconds\fR (default: 3600)"
+/*	The duration of the simulation.
+/* .IP \fB-v\fR
+/*	Increase verbosity. With two \fB-v\fR options, log each
+/*	simulated delivery.
+/* DIAGNOSTICS
+/*	Problems are reported to the standard error stream.
+/* LICENSE
+/* .ad
+/* .fi
+/*	The Secure Mailer license must be distributed with this software.
+/*--*/
+
+/* System library. */
+
+#include <sys_defs.h>
+#include <stdlib.h>
+#include <stdio.h>			/* sscanf() */
+#include <string.h>
+
+/* Utility library. */
+
+#include <msg.h>
+#include <msg_vstream.h>
+#include <mymalloc.h>
+#include <myrand.h>
+#include <name_code.h>
+#include <vstream.h>
+#include <vstring.h>
+#include <vstring_vstream.h>
+
+/* Global library. */
+
+#include <mail_params.h>
+
+/* Application-specific. */
+
+#include "qmgr.h"
+
+ /*
+  * Referenced by qmgr_feedback.c.
+  */
+bool    var_conc_feedback_debug;
+int     var_init_dest_concurrency;
+
+#define STR(x)	vstring_str(x)
+
+ /*
+  * Delivery outcomes.
+  */
+#define SIM_SENT	0
+#define SIM_THROTTLED	1
+#define SIM_DEFERRED	2
+#define SIM_FAILED	3
+
+static const NAME_CODE sim_outcome_map[] = {
+    "sent", SIM_SENT,
+    "throttled", SIM_THROTTLED,
+    "deferred", SIM_DEFERRED,
+    "failed", SIM_FAILED,
+    0, -1,
+};
+
+ /*
+  * Trace records, grouped by the number of deliveries in progress.
+  */
+#define SIM_MAX_CONC	1000
+
+typedef struct SIM_SAMPLE {
+    double  latency;
+    int     outcome;
+} SIM_SAMPLE;
+
+typedef struct SIM_BUCKET {
+    SIM_SAMPLE *samples;
+    int     len;
+    int     size;
+    int     next;			/* round-robin replay */
+} SIM_BUCKET;
+
+static SIM_BUCKET sim_buckets[SIM_MAX_CONC + 1];
+
+ /*
+  * Simulation results.
+  */
+typedef struct SIM_STATS {
+    long    outcomes[SIM_FAILED + 1];
+    double  window_area;		/* window integrated over time */
+    double  suspended;			/* time with rate delay */
+    int     max_window;
+} SIM_STATS;
+
+/* read_trace - read trace records */
+
+static long read_trace(VSTREAM *fp, const char *path)
+{
+    VSTRING *buf = vstring_alloc(100);
+    char    outcome_name[32];
+    SIM_BUCKET *bp;
+    double  latency;
+    int     active;
+    int     outcome;
+    long    count = 0;
+    int     lineno = 0;
+
+    while (vstring_get_nonl(buf, fp) != VSTREAM_EOF) {
+	lineno++;
+	if (*STR(buf) == 0 || *STR(buf) == '#')
+	    continue;
+	if (sscanf(STR(buf), "%d %lf %31s", &active, &latency,
+		   outcome_name) != 3 || active < 1 || latency < 0
+	    || (outcome = name_code(sim_outcome_map, NAME_CODE_FLAG_NONE,
+				    outcome_name)) < 0) {
+	    msg_warn("%s, line %d: ignoring malformed record: %s",
+		     path, lineno, STR(buf));
+	    continue;
+	}
+	if (active > SIM_MAX_CONC)
+	    active = SIM_MAX_CONC;
+	bp = sim_buckets + active;
+	if (bp->size == 0) {
+	    bp->size = 16;
+	    bp->samples = (SIM_SAMPLE *)
+		mymalloc(bp->size * sizeof(SIM_SAMPLE));
+	} else if (bp->len >= bp->size) {
+	    bp->size *= 2;
+	    bp->samples = (SIM_SAMPLE *)
+		myrealloc((void *) bp->samples, bp->size * sizeof(SIM_SAMPLE));
+	}
+	bp->samples[bp->len].latency = latency;
+	bp->samples[bp->len].outcome = outcome;
+	bp->len += 1;
+	count += 1;
+    }
+    vstring_free(buf);
+    return (count);
+}
+
+/* pick_sample - next trace record with nearest concurrency */
+
+static SIM_SAMPLE *pick_sample(int active)
+{
+    SIM_BUCKET *bp;
+    int     dist;
+
+    if (active > SIM_MAX_CONC)
+	active = SIM_MAX_CONC;
+    for (dist = 0; dist <= SIM_MAX_CONC; dist++) {
+	if (active + dist <= SIM_MAX_CONC
+	    && sim_buckets[active + dist].len > 0) {
+	    bp = sim_buckets + active + dist;
+	    break;
+	}
+	if (active - dist >= 1 && sim_buckets[active - dist].len > 0) {
+	    bp = sim_buckets + active - dist;
+	    break;
+	}
+    }
+    if (dist > SIM_MAX_CONC)
+	msg_panic("pick_sample: empty trace");
+    if (bp->next >= bp->len)
+	bp->next = 0;
+    return (bp->samples + bp->next++);
+}
+
+/* simulate - replay the trace with one feedback mode */
+
+static void simulate(int mode, int init, int limit, double duration,
+		             SIM_STATS *sp)
+{
+    SIM_SAMPLE *busy_sample[SIM_MAX_CONC];
+    double  busy_done[SIM_MAX_CONC];
+    QMGR_LATENCY latency;
+    double  now = 0;
+    double  last = 0;
+    double  resume = 0;
+    SIM_SAMPLE *sample;
+    int     window = init;
+    int     busy = 0;
+    int     lat_limit;
+    int     n;
+    int     k;
+
+    memset((void *) sp, 0, sizeof(*sp));
+    QMGR_LATENCY_INIT(&latency);
+    sp->max_window = window;
+
+    while (now < duration) {
+
+	/*
+	 * Start deliveries until the window is full, unless the destination
+	 * is suspended.
+	 */
+	while (busy < window && busy < SIM_MAX_CONC && now >= resume) {
+	    busy_sample[busy] = pick_sample(busy + 1);
+	    busy_done[busy] = now + busy_sample[busy]->latency;
+	    busy += 1;
+	}
+	if (busy == 0) {
+	    now = resume;
+	    continue;
+	}
+
+	/*
+	 * Complete the delivery that finishes first.
+	 */
+	for (k = 0, n = 1; n < busy; n++)
+	    if (busy_done[n] < busy_done[k])
+		k = n;
+	now = busy_done[k];
+	sample = busy_sample[k];
+	busy -= 1;
+	busy_done[k] = busy_done[busy];
+	busy_sample[k] = busy_sample[busy];
+	sp->window_area += window * (now - last);
+	last = now;
+	sp->outcomes[sample->outcome] += 1;
+
+	/*
+	 * Feedback, as qmgr_deliver_update() and friends would apply it. The
+	 * completed delivery still counts as in progress.
+	 */
+	if (sample->outcome == SIM_FAILED) {
+	    if (window > 1)
+		window -= 1;
+	} else if (mode == QMGR_FEEDBACK_MODE_CLASSIC) {
+	    if ((limit == 0 || window < limit) && window < busy + 1 + init)
+		window += 1;
+	} else {
+	    lat_limit = busy + 1 + init;
+	    if (limit > 0 && limit < lat_limit)
+		lat_limit = limit;
+	    if (lat_limit < window)
+		lat_limit = window;
+	    window = qmgr_feedback_latency(&latency, window, lat_limit,
+					   sample->latency,
+					   sample->outcome == SIM_THROTTLED);
+	    if (latency.delay > 0 && busy == 0) {
+		resume = now + latency.delay;
+		sp->suspended += latency.delay;
+	    }
+	}
+	if (window > sp->max_window)
+	    sp->max_window = window;
+	if (msg_verbose > 1)
+	    msg_info("time %.3f active %d latency %.3f outcome %s window %d",
+		     now, busy + 1, sample->latency,
+		     str_name_code(sim_outcome_map, sample->outcome), window);
+    }
+}
+
+/* report - print simulation results */
+
+static void report(const char *mode_name, SIM_STATS *sp, double duration)
+{
+    vstream_printf("%-8s %9ld %9.2f %9ld %9ld %9ld %7.2f %7d %9.0f\n",
+		   mode_name, sp->outcomes[SIM_SENT],
+		   sp->outcomes[SIM_SENT] / duration,
+		   sp->outcomes[SIM_THROTTLED], sp->outcomes[SIM_DEFERRED],
+		   sp->outcomes[SIM_FAILED], sp->window_area / duration,
+		   sp->max_window, sp->suspended);
+    vstream_fflush(VSTREAM_OUT);
+}
+
+/* make_trace - write synthetic trace */
+
+static void make_trace(int capacity, double base)
+{
+    double  latency;
+    double  throttle;
+    int     active;
+    int     n;
+
+#define SIM_GEN_SAMPLES	20
+
+    for (active = 1; active <= 4 * capacity; active++) {
+	if (active > SIM_MAX_CONC)
+	    break;
+	for (n = 0; n < SIM_GEN_SAMPLES; n++) {
+	    latency = base * (0.9 + 0.2 * (myrand() % 1000) / 1000.0);
+	    if (active > capacity)
+		latency *= (double) active / capacity;
+	    throttle = (active - 1.5 * capacity) / active;
+	    vstream_printf("%d %.3f %s\n", active, latency,
+			   (myrand() % 1000) / 1000.0 < throttle ?
+			   "throttled" : "sent");
+	}
+    }
+    vstream_fflush(VSTREAM_OUT);
+}
+
+/* usage - explain and terminate */
+
+static NORETURN usage(char *myname)
+{
+    msg_fatal("usage: %s [-v] [-i initial] [-l limit] [-m mode] "
+	      "[-t seconds] [trace] | -g capacity [-b latency]", myname);
+}
+
+int     main(int argc, char **argv)
+{
+    static const NAME_CODE mode_map[] = {
+	CONC_FDBACK_MODE_CLASSIC, QMGR_FEEDBACK_MODE_CLASSIC,
+	CONC_FDBACK_MODE_LATENCY, QMGR_FEEDBACK_MODE_LATENCY,
+	0, -1,
+    };
+    double  duration = 3600;
+    double  base = 0.5;
+    int     capacity = 0;
+    int     init = 5;
+    int     limit = 20;
+    int     mode = -1;
+    const char *path;
+    SIM_STATS stats;
+    VSTREAM *fp;
+    long    count;
+    int     ch;
+
+    msg_vstream_init(argv[0], VSTREAM_ERR);
+    while ((ch = GETOPT(argc, argv, "b:g:i:l:m:t:v")) > 0) {
+	switch (ch) {
+	case 'b':
+	    if ((base = atof(optarg)) <= 0)
+		usage(argv[0]);
+	    break;
+	case 'g':
+	    if ((capacity = atoi(optarg)) <= 0)
+		usage(argv[0]);
+	    break;
+	case 'i':
+	    if ((init = atoi(optarg)) <= 0)
+		usage(argv[0]);
+	    break;
+	case 'l':
+	    if ((limit = atoi(optarg)) < 0 || limit > SIM_MAX_CONC)
+		usage(argv[0]);
+	    break;
+	case 'm':
+	    if ((mode = name_code(mode_map, NAME_CODE_FLAG_NONE, optarg)) < 0)
+		usage(argv[0]);
+	    break;
+	case 't':
+	    if ((duration = atof(optarg)) <= 0)
+		usage(argv[0]);
+	    break;
+	case 'v':
+	    msg_verbose++;
+	    break;
+	default:
+	    usage(argv[0]);
+	}
+    }
+    if (capacity > 0) {
+	if (argc != optind)
+	    usage(argv[0]);
+	make_trace(capacity, base);
+	exit(0);
+    }
+    if (argc > optind + 1)
+	usage(argv[0]);
+    if (limit == 0)
+	limit = SIM_MAX_CONC;
+    if (init > limit)
+	init = limit;
+    var_init_dest_concurrency = init;
+
+    /*
+     * Load the trace.
+     */
+    if (argc == optind + 1) {
+	path = argv[optind];
+	if ((fp = vstream_fopen(path, O_RDONLY, 0)) == 0)
+	    msg_fatal("open %s: %m", path);
+    } else {
+	path = "stdin";
+	fp = VSTREAM_IN;
+    }
+    if ((count = read_trace(fp, path)) == 0)
+	msg_fatal("%s: no trace records", path);
+    if (fp != VSTREAM_IN)
+	(void) vstream_fclose(fp);
+    if (msg_verbose)
+	msg_info("%s: %ld trace records", path, count);
+
+    /*
+     * Compare the feedback modes.
+     */
+    vstream_printf("%-8s %9s %9s %9s %9s %9s %7s %7s %9s\n",
+		   "mode", "sent", "sent/s", "throttled", "deferred",
+		   "failed", "window", "max", "suspended");
+    if (mode < 0 || mode == QMGR_FEEDBACK_MODE_CLASSIC) {
+	simulate(QMGR_FEEDBACK_MODE_CLASSIC, init, limit, duration, &stats);
+	report(CONC_FDBACK_MODE_CLASSIC, &stats, duration);
+    }
+    if (mode < 0 || mode == QMGR_FEEDBACK_MODE_LATENCY) {
+	simulate(QMGR_FEEDBACK_MODE_LATENCY, init, limit, duration, &stats);
+	report(CONC_FDBACK_MODE_LATENCY, &stats, duration);
+    }
+    exit(0);
+}
@@ -19,6 +19,9 @@
 /*	QMGR_ENTRY *qmgr_job_entry_select(transport)
 /*	QMGR_TRANSPORT *transport;
 /*
+/*	QMGR_ENTRY *qmgr_job_entry_select_queue(queue)
+/*	QMGR_QUEUE *queue;
+/*
 /*	void	qmgr_job_blocker_update(queue)
 /*	QMGR_QUEUE *queue;
 /* DESCRIPTION
@@ -40,6 +43,17 @@
 /*	for delivery. The job preempting algorithm is also exercised.
 /*	If necessary, an attempt to read more recipients into core is made.
 /*	This can result in creation of more job, queue and entry structures.
+/*	The job list is ordered by message priority lane first; with
+/*	weighted lanes, the search starts in the lane that is owed the
+/*	most delivery slots (see qmgr_lane(3)).
+/*
+/*	qmgr_job_entry_select_queue() selects the next entry of the
+/*	specified queue, regardless of the job order, provided that
+/*	the queue can accept another delivery, and that no job in a
+/*	higher priority lane is waiting. This is used to send
+/*	a batch of delivery requests for the same destination to one
+/*	delivery agent. The result is a null pointer when no entry
+/*	is available.
 /*
 /*	qmgr_job_blocker_update() updates the status of blocked
 /*	jobs after a decrease in the queue's concurrency level,
@@ -95,6 +109,34 @@ static void qmgr_job_pop(QMGR_JOB *);
 
 #define IS_BLOCKER(job,transport) ((job)->blocker_tag == (transport)->blocker_tag)
 
+#define JOB_LANE(job) ((job)->message->priority)
+
+/* qmgr_job_lane_link - update lane after linking job on the job list */
+
+static void qmgr_job_lane_link(QMGR_JOB *job)
+{
+    QMGR_LANE *lane = job->transport->lanes + JOB_LANE(job);
+
+    /*
+     * The job list is ordered by lane, so the job is the first of its lane
+     * when it is the only one, or when it precedes the old first job.
+     */
+    if (lane->job_head == 0 || lane->job_head == job->transport_peers.next)
+	lane->job_head = job;
+}
+
+/* qmgr_job_lane_unlink - update lane before unlinking job from the job list */
+
+static void qmgr_job_lane_unlink(QMGR_JOB *job)
+{
+    QMGR_LANE *lane = job->transport->lanes + JOB_LANE(job);
+    QMGR_JOB *next = job->transport_peers.next;
+
+    if (lane->job_head == job)
+	lane->job_head = (next != 0 && JOB_LANE(next) == JOB_LANE(job)) ?
+	    next : 0;
+}
+
 /* qmgr_job_create - create and initialize message job structure */
 
 static QMGR_JOB *qmgr_job_create(QMGR_MESSAGE *message, QMGR_TRANSPORT *transport)
@@ -124,7 +166,7 @@ static QMGR_JOB *qmgr_job_create(QMGR_MESSAGE *message, QMGR_TRANSPORT *transpor
     return (job);
 }
 
-/* qmgr_job_link - append the job to the job lists based on the time it was queued */
+/* qmgr_job_link - append the job to the job lists based on its lane and the time it was queued */
 
 static void qmgr_job_link(QMGR_JOB *job)
 {
@@ -165,13 +207,19 @@ static void qmgr_job_link(QMGR_JOB *job)
      * level zero is gone. Consequently, the early loop stop in candidate
      * selection works reliably, too. These are the reasons why we care to
      * bother with children adoption at all.
+     * 
+     * The scheduler list is ordered by priority lane first, so that a job
+     * is never linked after a job with lower priority. Job stacks never
+     * cross a lane boundary (see qmgr_job_candidate()).
      */
     current = transport->job_current;
     for (next = 0, prev = transport->job_list.prev; prev;
 	 next = prev, prev = prev->transport_peers.prev) {
 	if (prev->stack_parent == 0) {
+	    if (JOB_LANE(prev) < JOB_LANE(job))
+		break;
 	    delay = message->queued_time - prev->message->queued_time;
-	    if (delay >= 0)
+	    if (delay >= 0 && JOB_LANE(prev) == JOB_LANE(job))
 		break;
 	}
 	if (current == prev)
@@ -197,6 +245,8 @@ static void qmgr_job_link(QMGR_JOB *job)
     job->stack_level = 0;
     QMGR_LIST_LINK(transport->job_list, list_prev, job, list_next, transport_peers);
     QMGR_LIST_LINK(transport->job_bytime, prev, job, next, time_peers);
+    qmgr_job_lane_link(job);
+    transport->lanes[JOB_LANE(job)].job_count++;
 
     /*
      * Update the current job pointer if necessary.
@@ -373,6 +423,8 @@ static void qmgr_job_unlink(QMGR_JOB *job)
     /*
      * Remove the job from the job lists and mark it as unlinked.
      */
+    qmgr_job_lane_unlink(job);
+    transport->lanes[JOB_LANE(job)].job_count--;
     QMGR_LIST_UNLINK(transport->job_list, QMGR_JOB *, job, transport_peers);
     QMGR_LIST_UNLINK(transport->job_bytime, QMGR_JOB *, job, time_peers);
     job->stack_level = -1;
@@ -533,9 +585,14 @@ static QMGR_JOB *qmgr_job_candidate(QMGR_JOB *current)
      * 
      * However, don't bother searching if we can't find anything suitable
      * anyway.
+     * 
+     * A job may preempt only a job in the same priority lane. The job list is
+     * ordered by lane, so the search ends at the first job of the next lane.
      */
     if (max_slots > 0) {
 	for (job = current->transport_peers.next; job; job = job->transport_peers.next) {
+	    if (JOB_LANE(job) != JOB_LANE(current))
+		break;
 	    if (job->stack_children.next != 0 || IS_BLOCKER(job, transport))
 		continue;
 	    max_total_entries = MAX_ENTRIES(job);
@@ -633,9 +690,11 @@ static QMGR_JOB *qmgr_job_preempt(QMGR_JOB *current)
      */
     if (job->stack_level > 0)
 	qmgr_job_pop(job);
+    qmgr_job_lane_unlink(job);
     QMGR_LIST_UNLINK(transport->job_list, QMGR_JOB *, job, transport_peers);
     prev = current->transport_peers.prev;
     QMGR_LIST_LINK(transport->job_list, prev, job, current, transport_peers);
+    qmgr_job_lane_link(job);
     job->stack_parent = current;
     QMGR_LIST_APPEND(current->stack_children, job, stack_siblings);
     job->stack_level = current->stack_level + 1;
@@ -831,6 +890,8 @@ QMGR_ENTRY *qmgr_job_entry_select(QMGR_TRANSPORT *transport)
     QMGR_JOB *job, *next;
     QMGR_PEER *peer;
     QMGR_ENTRY *entry;
+    int     lane = -1;
+    int     wrapped = 0;
 
     /*
      * Get the current job if there is one.
@@ -838,6 +899,15 @@ QMGR_ENTRY *qmgr_job_entry_select(QMGR_TRANSPORT *transport)
     if ((job = transport->job_current) == 0)
 	return (0);
 
+    /*
+     * With weighted lanes, start with the lane that is owed the most
+     * delivery slots. The current job is remembered only for its own lane.
+     */
+    if (transport->lane_mode == QMGR_LANE_MODE_WEIGHTED
+	&& (lane = qmgr_lane_select(transport)) >= 0
+	&& lane != JOB_LANE(job))
+	job = transport->lanes[lane].job_head;
+
     /*
      * Exercise the preempting algorithm if enabled.
      * 
@@ -861,9 +931,20 @@ QMGR_ENTRY *qmgr_job_entry_select(QMGR_TRANSPORT *transport)
      * available to this transport. Or it can happen that the job has some
      * more entries but suddenly they all get deferred. Whatever the reason,
      * we retire such jobs below if we happen to come across some.
+     * 
+     * When the search started in a weighted lane, and that lane and the lanes
+     * below it can't provide an entry, wrap around to the higher lanes.
      */
     for ( /* empty */ ; job; job = next) {
 	next = job->transport_peers.next;
+	if (lane > 0) {
+	    if (next == 0 && !wrapped) {
+		next = transport->job_list.next;
+		wrapped = 1;
+	    }
+	    if (wrapped && next != 0 && JOB_LANE(next) >= lane)
+		next = 0;
+	}
 
 	/*
 	 * Don't bother if the job is known to have no available entries
@@ -880,6 +961,7 @@ QMGR_ENTRY *qmgr_job_entry_select(QMGR_TRANSPORT *transport)
 	     */
 	    entry = qmgr_entry_select(peer);
 	    qmgr_job_count_slots(job);
+	    qmgr_lane_charge(transport, JOB_LANE(job));
 
 	    /*
 	     * Remember the current job for the next time so we don't have to
@@ -945,6 +1027,47 @@ QMGR_ENTRY *qmgr_job_entry_select(QMGR_TRANSPORT *transport)
     return (0);
 }
 
+/* qmgr_job_entry_select_queue - select next entry for this queue */
+
+QMGR_ENTRY *qmgr_job_entry_select_queue(QMGR_QUEUE *queue)
+{
+    QMGR_PEER *peer;
+    QMGR_JOB *job;
+    QMGR_ENTRY *entry;
+    int     lane;
+
+    /*
+     * Don't exceed the limits that apply to a new delivery agent.
+     */
+    if (!QMGR_QUEUE_READY(queue) || queue->todo.next == 0
+	|| qmgr_queue_avail(queue) <= 0)
+	return (0);
+
+    /*
+     * Don't let a batch hold up mail in a higher priority lane. The regular
+     * selection will decide what to deliver next.
+     */
+    peer = queue->todo.next->peer;
+    for (lane = 0; lane < JOB_LANE(peer->job); lane++)
+	if (queue->transport->lanes[lane].job_head != 0)
+	    return (0);
+
+    /*
+     * Select the entry that is at the front of the queue, and adjust the
+     * delivery slot counters as qmgr_job_entry_select() does. The entry
+     * jumps the job list; the job preemption algorithm catches up with the
+     * next regular selection.
+     */
+    job = peer->job;
+    entry = qmgr_entry_select(peer);
+    qmgr_job_count_slots(job);
+    qmgr_lane_charge(queue->transport, JOB_LANE(job));
+    if (!HAS_ENTRIES(job) && job->message->rcpt_offset == 0
+	&& job->stack_level >= 0)
+	qmgr_job_retire(job);
+    return (entry);
+}
+
 /* qmgr_job_blocker_update - update "blocked job" status */
 
 void    qmgr_job_blocker_update(QMGR_QUEUE *queue)
@@ -967,12 +1090,14 @@ void    qmgr_job_blocker_update(QMGR_QUEUE *queue)
      * never matches jobs that are not explicitly marked as blockers.
      */
     if (queue->blocker_tag == transport->blocker_tag) {
-	if (queue->window > queue->busy_refcount && queue->todo.next != 0) {
+	if (qmgr_queue_avail(queue) > 0 && queue->todo.next != 0) {
 	    transport->blocker_tag += 2;
 	    transport->job_current = transport->job_list.next;
 	    transport->candidate_cache_current = 0;
 	}
-	if (queue->window > queue->busy_refcount || QMGR_QUEUE_THROTTLED(queue))
+	if ((queue->window > queue->busy_refcount
+	     && qmgr_rate_avail(&queue->rate) > 0)
+	    || QMGR_QUEUE_THROTTLED(queue))
 	    queue->blocker_tag = 0;
     }
 }
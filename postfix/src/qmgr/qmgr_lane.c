@@ -0,0 +1,242 @@
+/*++
+/* NAME
+/*	qmgr_lane 3
+/* SUMMARY
+/*	message priority lanes
+/* SYNOPSIS
+/*	#include "qmgr.h"
+/*
+/*	const int qmgr_lane_hist_limits[QMGR_LANE_HIST_SIZE];
+/*
+/*	void	qmgr_lane_init(transport)
+/*	QMGR_TRANSPORT *transport;
+/*
+/*	int	qmgr_lane_select(transport)
+/*	QMGR_TRANSPORT *transport;
+/*
+/*	void	qmgr_lane_charge(transport, lane)
+/*	QMGR_TRANSPORT *transport;
+/*	int	lane;
+/*
+/*	void	qmgr_lane_done(transport, message)
+/*	QMGR_TRANSPORT *transport;
+/*	QMGR_MESSAGE *message;
+/* DESCRIPTION
+/*	Each message has a priority (high, normal, or low) that is
+/*	set with a header_checks, body_checks, or SMTP access table
+/*	PRIORITY action, and that is stored in the queue file. On
+/*	each transport, the jobs of messages with the same priority
+/*	form a lane on the job list. The job list is ordered by lane
+/*	first, and by message queue time within a lane; the job
+/*	preemption algorithm operates within a lane (see qmgr_job(3)).
+/*
+/*	With strict lanes, a job is selected for delivery only when
+/*	no job in a higher lane can make progress. With weighted
+/*	lanes, each lane that has jobs receives a share of the
+/*	delivery slots that is proportional to its weight, using
+/*	smooth weighted round-robin. A lane that can't make progress
+/*	does not accumulate more than one round of credit.
+/*
+/*	qmgr_lane_hist_limits[] specifies the upper bounds of the
+/*	delay histogram buckets, in seconds. The last bucket has no
+/*	upper bound, and its limit is zero.
+/*
+/*	qmgr_lane_init() initializes the lanes of the specified
+/*	transport, using global or transport-specific main.cf
+/*	settings.
+/*
+/*	qmgr_lane_select() returns the weighted lane that is owed
+/*	the most delivery slots, or -1 when the transport has no
+/*	jobs. The result is advisory; the caller may select an
+/*	entry from a different lane.
+/*
+/*	qmgr_lane_charge() accounts for an entry that was selected
+/*	for delivery from the specified lane.
+/*
+/*	qmgr_lane_done() updates the delay statistics of the
+/*	message's lane after a delivery request was completed
+/*	without deferred recipients. Recipients that were bounced
+/*	are not distinguished from recipients that were delivered.
+/* DIAGNOSTICS
+/*	Fatal: invalid lane weight.
+/* SEE ALSO
+/*	qmgr_job(3), per-transport jobs
+/*	qmgr_status(3), scheduler status report
+/* LICENSE
+/* .ad
+/* .fi
+/*	The Secure Mailer license must be distributed with this software.
+/* AUTHOR(S)
+/*	agent
+/*	agent@local
+/*--*/
+
+/* System library. */
+
+#include <sys_defs.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Utility library. */
+
+#include <msg.h>
+#include <mymalloc.h>
+#include <stringops.h>
+#include <name_code.h>
+#include <events.h>
+
+/* Global library. */
+
+#include <mail_conf.h>
+#include <mail_params.h>
+
+/* Application-specific. */
+
+#include "qmgr.h"
+
+const int qmgr_lane_hist_limits[QMGR_LANE_HIST_SIZE] = {
+    1, 5, 30, 60, 300, 3600, 0,
+};
+
+/* qmgr_lane_mode - look up lane mode */
+
+static int qmgr_lane_mode(const char *name_prefix)
+{
+    static const NAME_CODE qmgr_lane_mode_map[] = {
+	PRIO_LANE_MODE_STRICT, QMGR_LANE_MODE_STRICT,
+	PRIO_LANE_MODE_WEIGHTED, QMGR_LANE_MODE_WEIGHTED,
+	0, -1,
+    };
+    char   *mode_name;
+    char   *mode_val;
+    int     mode;
+
+    mode_name = concatenate(name_prefix, _PRIO_LANE_MODE, (char *) 0);
+    mode_val = get_mail_conf_str(mode_name, var_prio_lane_mode, 1, 0);
+    if ((mode = name_code(qmgr_lane_mode_map, NAME_CODE_FLAG_NONE,
+			  mode_val)) < 0) {
+	msg_warn("%s: ignoring unknown priority lane mode: %s",
+		 strcmp(mode_val, var_prio_lane_mode) ?
+		 mode_name : VAR_PRIO_LANE_MODE, mode_val);
+	mode = QMGR_LANE_MODE_STRICT;
+    }
+    myfree(mode_name);
+    myfree(mode_val);
+    return (mode);
+}
+
+/* qmgr_lane_weights - look up lane weights */
+
+static void qmgr_lane_weights(QMGR_TRANSPORT *transport)
+{
+    char   *weight_name;
+    char   *weight_val;
+    char   *cp;
+    char   *item;
+    char   *name;
+    char   *value;
+    int     lane;
+
+    weight_name = concatenate(transport->name, _PRIO_LANE_WEIGHTS, (char *) 0);
+    weight_val = get_mail_conf_str(weight_name, var_prio_lane_weights, 0, 0);
+    for (cp = weight_val; (item = mystrtok(&cp, CHARS_COMMA_SP)) != 0; /* */ ) {
+	if (split_nameval(item, &name, &value) != 0
+	    || (lane = mail_priority_from_string(name)) < 0
+	    || !alldig(value) || atoi(value) < 1)
+	    msg_fatal("%s: bad priority lane weight \"%s\" -- "
+		      "need high, normal or low=number",
+		      strcmp(weight_val, var_prio_lane_weights) ?
+		      weight_name : VAR_PRIO_LANE_WEIGHTS, item);
+	transport->lanes[lane].weight = atoi(value);
+    }
+    myfree(weight_name);
+    myfree(weight_val);
+}
+
+/* qmgr_lane_init - initialize transport lanes */
+
+void    qmgr_lane_init(QMGR_TRANSPORT *transport)
+{
+    QMGR_LANE *lane;
+
+    memset((void *) transport->lanes, 0, sizeof(transport->lanes));
+    for (lane = transport->lanes; lane < transport->lanes + QMGR_LANE_COUNT; lane++)
+	lane->weight = 1;
+    transport->lane_mode = qmgr_lane_mode(transport->name);
+    if (transport->lane_mode == QMGR_LANE_MODE_WEIGHTED)
+	qmgr_lane_weights(transport);
+}
+
+/* qmgr_lane_select - weighted lane that is owed the most */
+
+int     qmgr_lane_select(QMGR_TRANSPORT *transport)
+{
+    QMGR_LANE *lane;
+    int     best = -1;
+    int     best_credit = 0;
+
+    for (lane = transport->lanes; lane < transport->lanes + QMGR_LANE_COUNT; lane++) {
+	if (lane->job_head == 0)
+	    continue;
+	if (best < 0 || lane->credit + lane->weight > best_credit) {
+	    best = lane - transport->lanes;
+	    best_credit = lane->credit + lane->weight;
+	}
+    }
+    return (best);
+}
+
+/* qmgr_lane_charge - account for selected entry */
+
+void    qmgr_lane_charge(QMGR_TRANSPORT *transport, int which)
+{
+    QMGR_LANE *lane;
+    int     total = 0;
+
+    transport->lanes[which].selected++;
+    if (transport->lane_mode != QMGR_LANE_MODE_WEIGHTED)
+	return;
+
+    /*
+     * Smooth weighted round-robin: every lane with work earns its weight,
+     * and the lane that was served pays for everyone. The lane that was
+     * served may have run out of jobs in the meantime.
+     */
+    for (lane = transport->lanes; lane < transport->lanes + QMGR_LANE_COUNT; lane++) {
+	if (lane->job_head != 0 || lane == transport->lanes + which) {
+	    lane->credit += lane->weight;
+	    total += lane->weight;
+	}
+    }
+    transport->lanes[which].credit -= total;
+
+    /*
+     * Don't let a lane that can't make progress save up for a burst.
+     */
+    for (lane = transport->lanes; lane < transport->lanes + QMGR_LANE_COUNT; lane++) {
+	if (lane->job_head == 0)
+	    lane->credit = 0;
+	else if (lane->credit > total)
+	    lane->credit = total;
+    }
+}
+
+/* qmgr_lane_done - update lane delay statistics */
+
+void    qmgr_lane_done(QMGR_TRANSPORT *transport, QMGR_MESSAGE *message)
+{
+    QMGR_LANE *lane = transport->lanes + message->priority;
+    int     delay;
+    int     n;
+
+    if ((delay = event_time() - message->arrival_time.tv_sec) < 0)
+	delay = 0;
+    lane->completed++;
+    lane->delay_total += delay;
+    if (delay > lane->delay_max)
+	lane->delay_max = delay;
+    for (n = 0; n < QMGR_LANE_HIST_SIZE - 1; n++)
+	if (delay < qmgr_lane_hist_limits[n])
+	    break;
+    lane->delay_hist[n]++;
+}
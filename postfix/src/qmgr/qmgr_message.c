@@ -6,6 +6,8 @@
 /* SYNOPSIS
 /*	#include "qmgr.h"
 /*
+/*	QMGR_MESSAGE_LIST qmgr_message_list;
+/*
 /*	int	qmgr_message_count;
 /*	int	qmgr_recipient_count;
 /*	int	qmgr_vrfy_pend_count;
@@ -31,6 +33,9 @@
 /* DESCRIPTION
 /*	This module performs en-gross operations on queue messages.
 /*
+/*	qmgr_message_list is a list of all in-core message structures,
+/*	in the order that they entered the active queue.
+/*
 /*	qmgr_message_count is a global counter for the total number
 /*	of in-core message structures (i.e. the total size of the
 /*	`active' message queue).
@@ -71,6 +76,12 @@
 /*	qmgr_message_free() destroys an in-core message structure and makes
 /*	the resources available for reuse. It is an error to destroy
 /*	a message structure that is still referenced by queue entry structures.
+/*	Message attributes that are saved only once (queue name and
+/*	ID, sender, VERP delimiters, SASL and logging attributes)
+/*	live in a per-message memory arena that is released all at
+/*	once. With verbose logging, qmgr_message_free() reports how
+/*	many mymalloc() calls those strings would have needed, and
+/*	how many the arena made instead.
 /*
 /*	qmgr_message_update_warn() takes a closed message, opens it, updates
 /*	the warning field, and closes it again.
@@ -131,6 +142,7 @@
 #include <stringops.h>
 #include <myflock.h>
 #include <sane_time.h>
+#include <marena.h>
 
 /* Global library. */
 
@@ -160,10 +172,18 @@
 
 #include "qmgr.h"
 
+QMGR_MESSAGE_LIST qmgr_message_list;
 int     qmgr_message_count;
 int     qmgr_recipient_count;
 int     qmgr_vrfy_pend_count;
 
+ /*
+  * The active queue may hold thousands of messages, so the per-message arena
+  * starts small. A typical message has less than 200 bytes of strings that
+  * are saved once; longer strings get their own chunk.
+  */
+#define QMGR_MESSAGE_ARENA_SIZE	256
+
 /* qmgr_message_create - create in-core message structure */
 
 static QMGR_MESSAGE *qmgr_message_create(const char *queue_name,
@@ -173,6 +193,7 @@ static QMGR_MESSAGE *qmgr_message_create(const char *queue_name,
 
     message = (QMGR_MESSAGE *) mymalloc(sizeof(QMGR_MESSAGE));
     qmgr_message_count++;
+    QMGR_LIST_APPEND(qmgr_message_list, message, active_peers);
     message->flags = 0;
     message->qflags = qflags;
     message->tflags = 0;
@@ -187,9 +208,11 @@ static QMGR_MESSAGE *qmgr_message_create(const char *queue_name,
     message->queued_time = sane_time();
     message->refill_time = 0;
     message->data_offset = 0;
-    message->queue_id = mystrdup(queue_id);
-    message->queue_name = mystrdup(queue_name);
+    message->arena = marena_create(QMGR_MESSAGE_ARENA_SIZE);
+    message->queue_id = marena_strdup(message->arena, queue_id);
+    message->queue_name = marena_strdup(message->arena, queue_name);
     message->encoding = 0;
+    message->priority = MAIL_PRIORITY_NORMAL;
     message->sender = 0;
     message->dsn_envid = 0;
     message->dsn_ret = 0;
@@ -213,10 +236,16 @@ static QMGR_MESSAGE *qmgr_message_create(const char *queue_name,
     message->sasl_sender = 0;
     message->log_ident = 0;
     message->rewrite_context = 0;
-    recipient_list_init(&message->rcpt_list, RCPT_LIST_INIT_QUEUE);
+    recipient_list_init(&message->rcpt_list, QMGR_RCPT_LIST_INIT);
+    message->rcpt_pool = 0;
     message->rcpt_count = 0;
     message->rcpt_limit = var_qmgr_msg_rcpt_limit;
     message->rcpt_unread = 0;
+    message->rcpt_index_offset = 0;
+    message->rcpt_batch = 0;
+    message->rcpt_batch_len = 0;
+    message->rcpt_batch_curr = 0;
+    message->rcpt_batch_todo = 0;
     QMGR_LIST_INIT(message->job_list);
     return (message);
 }
@@ -331,6 +360,153 @@ static void qmgr_message_oldstyle_scan(QMGR_MESSAGE *message)
 	msg_fatal("%s: envelope records out of order", message->queue_id);
 }
 
+/* qmgr_rcpt_batch_compare - compare batches by start offset */
+
+static int qmgr_rcpt_batch_compare(const void *a, const void *b)
+{
+    long    sa = ((const QMGR_RCPT_BATCH *) a)->start;
+    long    sb = ((const QMGR_RCPT_BATCH *) b)->start;
+
+    return (sa < sb ? -1 : sa > sb ? 1 : 0);
+}
+
+/* qmgr_message_rcpt_index_load - load recipient batch index */
+
+static void qmgr_message_rcpt_index_load(QMGR_MESSAGE *message)
+{
+    VSTRING *buf;
+    QMGR_RCPT_BATCH *bp;
+    long    orig_offset;
+    long    offset;
+    long    start, end, count;
+    int     size;
+    int     rec_type;
+    int     n;
+
+    /*
+     * The index is an optimization. When it is damaged, we ignore it and
+     * read the queue file as if there were no index.
+     */
+    if ((orig_offset = vstream_ftell(message->fp)) < 0)
+	msg_fatal("vstream_ftell %s: %m", VSTREAM_PATH(message->fp));
+    if (vstream_fseek(message->fp, message->rcpt_index_offset, SEEK_SET) < 0)
+	msg_fatal("seek file %s: %m", VSTREAM_PATH(message->fp));
+    buf = vstring_alloc(100);
+    message->rcpt_batch = (QMGR_RCPT_BATCH *)
+	mymalloc((size = 10) * sizeof(*bp));
+    for (;;) {
+	if ((offset = vstream_ftell(message->fp)) < 0)
+	    msg_fatal("vstream_ftell %s: %m", VSTREAM_PATH(message->fp));
+	rec_type = rec_get(message->fp, buf, 0);
+	if (rec_type != REC_TYPE_RIDX && rec_type != REC_TYPE_DIDX)
+	    break;
+	if (sscanf(vstring_str(buf), "%ld %ld %ld", &start, &end, &count) != 3
+	    || start <= 0 || end <= start
+	    || end > message->rcpt_index_offset
+	    || count <= 0 || count > end - start) {
+	    rec_type = REC_TYPE_ERROR;
+	    break;
+	}
+	if (message->rcpt_batch_len >= size)
+	    message->rcpt_batch = (QMGR_RCPT_BATCH *)
+		myrealloc((void *) message->rcpt_batch,
+			  (size *= 2) * sizeof(*bp));
+	bp = message->rcpt_batch + message->rcpt_batch_len++;
+	bp->start = start;
+	bp->end = end;
+	bp->offset = offset;
+	bp->count = count;
+	bp->done = (rec_type == REC_TYPE_DIDX);
+    }
+    vstring_free(buf);
+
+    /*
+     * Sort the batches by file offset, and verify that they don't overlap.
+     * The queue manager reads recipients in pointer-chasing order, which is
+     * not necessarily the same as the file offset order.
+     */
+    if (rec_type == REC_TYPE_EOF && message->rcpt_batch_len > 0) {
+	qsort((void *) message->rcpt_batch, message->rcpt_batch_len,
+	      sizeof(*bp), qmgr_rcpt_batch_compare);
+	for (n = 1; n < message->rcpt_batch_len; n++)
+	    if (message->rcpt_batch[n - 1].end > message->rcpt_batch[n].start)
+		break;
+	if (n < message->rcpt_batch_len)
+	    rec_type = REC_TYPE_ERROR;
+    } else {
+	rec_type = REC_TYPE_ERROR;
+    }
+    if (rec_type != REC_TYPE_EOF) {
+	msg_warn("%s: ignoring malformed recipient index at offset %ld",
+		 message->queue_id, message->rcpt_index_offset);
+	myfree((void *) message->rcpt_batch);
+	message->rcpt_batch = 0;
+	message->rcpt_batch_len = 0;
+    } else if (msg_verbose) {
+	msg_info("%s: %d recipient batches", message->queue_id,
+		 message->rcpt_batch_len);
+    }
+    if (vstream_fseek(message->fp, orig_offset, SEEK_SET) < 0)
+	msg_fatal("seek file %s: %m", VSTREAM_PATH(message->fp));
+}
+
+/* qmgr_message_rcpt_index_skip - skip recipient batches that are done */
+
+static int qmgr_message_rcpt_index_skip(QMGR_MESSAGE *message,
+					        long *curr_offset)
+{
+    QMGR_RCPT_BATCH *bp;
+    QMGR_RCPT_BATCH key;
+    int     skipped = 0;
+
+    for (;;) {
+
+	/*
+	 * When we have read an entire batch without finding an undelivered
+	 * recipient, mark the batch as done in the queue file, so that we can
+	 * skip it next time. Delivery agents never change a done recipient
+	 * back into an undelivered one.
+	 */
+	if ((bp = message->rcpt_batch_curr) != 0) {
+	    if (*curr_offset > bp->start && *curr_offset < bp->end)
+		return (skipped);
+	    message->rcpt_batch_curr = 0;
+	    if (*curr_offset == bp->end && message->rcpt_batch_todo == 0) {
+		if (msg_verbose)
+		    msg_info("%s: recipient batch at offset %ld is done",
+			     message->queue_id, bp->start);
+		bp->done = 1;
+		(void) rec_put_type(message->fp, REC_TYPE_DIDX,
+				    (off_t) bp->offset);
+		if (vstream_fseek(message->fp, *curr_offset, SEEK_SET) < 0)
+		    msg_fatal("seek file %s: %m", VSTREAM_PATH(message->fp));
+	    }
+	}
+
+	/*
+	 * Start tracking a batch that begins here, or skip it when it is done.
+	 */
+	key.start = *curr_offset;
+	if ((bp = (QMGR_RCPT_BATCH *)
+	     bsearch((void *) &key, (void *) message->rcpt_batch,
+		     message->rcpt_batch_len, sizeof(*bp),
+		     qmgr_rcpt_batch_compare)) == 0)
+	    return (skipped);
+	if (bp->done == 0) {
+	    message->rcpt_batch_curr = bp;
+	    message->rcpt_batch_todo = 0;
+	    return (skipped);
+	}
+	if (msg_verbose > 1)
+	    msg_info("%s: skip %d recipients at offset %ld",
+		     message->queue_id, bp->count, bp->start);
+	if (vstream_fseek(message->fp, bp->end, SEEK_SET) < 0)
+	    msg_fatal("seek file %s: %m", VSTREAM_PATH(message->fp));
+	*curr_offset = bp->end;
+	skipped += bp->count;
+    }
+}
+
 /* qmgr_message_read - read envelope records */
 
 static int qmgr_message_read(QMGR_MESSAGE *message)
@@ -386,6 +562,8 @@ static int qmgr_message_read(QMGR_MESSAGE *message)
 	if (recipient_limit < message->rcpt_limit)
 	    recipient_limit = message->rcpt_limit;
     }
+    message->rcpt_pool = qmgr_rcpt_pool_refresh(message->rcpt_pool);
+    message->rcpt_batch_curr = 0;
     /* Keep interrupt latency in check. */
     if (recipient_limit > 5000)
 	recipient_limit = 5000;
@@ -427,6 +605,10 @@ static int qmgr_message_read(QMGR_MESSAGE *message)
 	    curr_offset += message->data_size;
 	    expected_rec_types = extra_rec_type;
 	}
+	if (message->rcpt_batch_len > 0
+	    && (n = qmgr_message_rcpt_index_skip(message, &curr_offset)) > 0
+	    && message->rcpt_offset == 0)
+	    message->rcpt_unread -= n;
 	rec_type = rec_get_raw(message->fp, buf, 0, REC_FLAG_NONE);
 	start = vstring_str(buf);
 	if (msg_verbose > 1)
@@ -477,10 +659,15 @@ static int qmgr_message_read(QMGR_MESSAGE *message)
 	 */
 	if (rec_type == REC_TYPE_RCPT) {
 	    /* See also below for code setting orig_rcpt etc. */
+	    message->rcpt_batch_todo = 1;
 	    if (message->rcpt_offset == 0) {
 		message->rcpt_unread--;
-		recipient_list_add(&message->rcpt_list, curr_offset,
-				   dsn_orcpt ? dsn_orcpt : "",
+		if (message->rcpt_pool == 0)
+		    message->rcpt_pool =
+			qmgr_rcpt_pool_create(message->rcpt_unread < recipient_limit ?
+				     message->rcpt_unread + 1 : recipient_limit);
+		qmgr_rcpt_pool_add(message->rcpt_pool, &message->rcpt_list,
+				   curr_offset, dsn_orcpt ? dsn_orcpt : "",
 				   dsn_notify ? dsn_notify : 0,
 				   orig_rcpt ? orig_rcpt : "", start);
 		if (dsn_orcpt) {
@@ -589,11 +776,12 @@ static int qmgr_message_read(QMGR_MESSAGE *message)
 	    continue;
 	if (rec_type == REC_TYPE_SIZE) {
 	    if (message->data_offset == 0) {
-		if ((count = sscanf(start, "%ld %ld %d %d %ld %d",
+		if ((count = sscanf(start, "%ld %ld %d %d %ld %d %ld",
 				 &message->data_size, &message->data_offset,
 				    &message->rcpt_unread, &message->rflags,
 				    &message->cont_length,
-				    &message->sendopts)) >= 3) {
+				    &message->sendopts,
+				    &message->rcpt_index_offset)) >= 3) {
 		    /* Postfix >= 1.0 (a.k.a. 20010228). */
 		    if (message->data_offset <= 0 || message->data_size <= 0) {
 			msg_warn("%s: invalid size record: %.100s",
@@ -609,6 +797,9 @@ static int qmgr_message_read(QMGR_MESSAGE *message)
 		    }
 		    /* Forward compatibility. */
 		    message->sendopts &= SOPT_FLAG_ALL;
+		    /* Postfix >= 3.12 recipient batch index. */
+		    if (message->rcpt_index_offset > message->data_offset)
+			qmgr_message_rcpt_index_load(message);
 		} else if (count == 1) {
 		    /* Postfix < 1.0 (a.k.a. 20010228). */
 		    qmgr_message_oldstyle_scan(message);
@@ -661,7 +852,7 @@ static int qmgr_message_read(QMGR_MESSAGE *message)
 	}
 	if (rec_type == REC_TYPE_FROM) {
 	    if (message->sender == 0) {
-		message->sender = mystrdup(start);
+		message->sender = marena_strdup(message->arena, start);
 		opened(message->queue_id, message->sender,
 		       message->cont_length, message->rcpt_unread,
 		       "queue %s", message->queue_name);
@@ -690,6 +881,18 @@ static int qmgr_message_read(QMGR_MESSAGE *message)
 		message->encoding = mystrdup(value);
 	    }
 
+	    /*
+	     * Scheduling lane. Allow extra segment to override envelope
+	     * segment info.
+	     */
+	    else if (strcmp(name, MAIL_ATTR_PRIORITY) == 0) {
+		if ((n = mail_priority_from_string(value)) < 0)
+		    msg_warn("%s: ignoring bad priority attribute: %.100s",
+			     message->queue_id, value);
+		else
+		    message->priority = n;
+	    }
+
 	    /*
 	     * Backwards compatibility. Before Postfix 2.3, the logging
 	     * attributes were called client_name, etc. Now they are called
@@ -748,31 +951,33 @@ static int qmgr_message_read(QMGR_MESSAGE *message)
 		have_log_client_attr = 1;
 	    } else if (strcmp(name, MAIL_ATTR_SASL_METHOD) == 0) {
 		if (message->sasl_method == 0)
-		    message->sasl_method = mystrdup(value);
+		    message->sasl_method = marena_strdup(message->arena, value);
 		else
 		    msg_warn("%s: ignoring multiple %s attribute: %s",
 			   message->queue_id, MAIL_ATTR_SASL_METHOD, value);
 	    } else if (strcmp(name, MAIL_ATTR_SASL_USERNAME) == 0) {
 		if (message->sasl_username == 0)
-		    message->sasl_username = mystrdup(value);
+		    message->sasl_username =
+			marena_strdup(message->arena, value);
 		else
 		    msg_warn("%s: ignoring multiple %s attribute: %s",
 			 message->queue_id, MAIL_ATTR_SASL_USERNAME, value);
 	    } else if (strcmp(name, MAIL_ATTR_SASL_SENDER) == 0) {
 		if (message->sasl_sender == 0)
-		    message->sasl_sender = mystrdup(value);
+		    message->sasl_sender = marena_strdup(message->arena, value);
 		else
 		    msg_warn("%s: ignoring multiple %s attribute: %s",
 			   message->queue_id, MAIL_ATTR_SASL_SENDER, value);
 	    } else if (strcmp(name, MAIL_ATTR_LOG_IDENT) == 0) {
 		if (message->log_ident == 0)
-		    message->log_ident = mystrdup(value);
+		    message->log_ident = marena_strdup(message->arena, value);
 		else
 		    msg_warn("%s: ignoring multiple %s attribute: %s",
 			     message->queue_id, MAIL_ATTR_LOG_IDENT, value);
 	    } else if (strcmp(name, MAIL_ATTR_RWR_CONTEXT) == 0) {
 		if (message->rewrite_context == 0)
-		    message->rewrite_context = mystrdup(value);
+		    message->rewrite_context =
+			marena_strdup(message->arena, value);
 		else
 		    msg_warn("%s: ignoring multiple %s attribute: %s",
 			   message->queue_id, MAIL_ATTR_RWR_CONTEXT, value);
@@ -816,7 +1021,7 @@ static int qmgr_message_read(QMGR_MESSAGE *message)
 			msg_info("%s: enabling VERP for sender \"%.100s\"",
 				 message->queue_id, message->sender);
 		    message->single_rcpt = 1;
-		    message->verp_delims = mystrdup(start);
+		    message->verp_delims = marena_strdup(message->arena, start);
 		}
 	    }
 	    continue;
@@ -876,15 +1081,16 @@ static int qmgr_message_read(QMGR_MESSAGE *message)
     if (message->client_helo == 0)
 	message->client_helo = mystrdup("");
     if (message->sasl_method == 0)
-	message->sasl_method = mystrdup("");
+	message->sasl_method = marena_strdup(message->arena, "");
     if (message->sasl_username == 0)
-	message->sasl_username = mystrdup("");
+	message->sasl_username = marena_strdup(message->arena, "");
     if (message->sasl_sender == 0)
-	message->sasl_sender = mystrdup("");
+	message->sasl_sender = marena_strdup(message->arena, "");
     if (message->log_ident == 0)
-	message->log_ident = mystrdup("");
+	message->log_ident = marena_strdup(message->arena, "");
     if (message->rewrite_context == 0)
-	message->rewrite_context = mystrdup(MAIL_ATTR_RWR_LOCAL);
+	message->rewrite_context =
+	    marena_strdup(message->arena, MAIL_ATTR_RWR_LOCAL);
     /* Postfix < 2.3 compatibility. */
     if (message->create_time == 0)
 	message->create_time = message->arrival_time.tv_sec;
@@ -921,7 +1127,7 @@ static int qmgr_message_read(QMGR_MESSAGE *message)
     message->rcpt_offset = save_offset;		/* restore flag */
     message->rcpt_unread = save_unread;		/* restore count */
     recipient_list_free(&message->rcpt_list);
-    recipient_list_init(&message->rcpt_list, RCPT_LIST_INIT_QUEUE);
+    recipient_list_init(&message->rcpt_list, QMGR_RCPT_LIST_INIT);
     return (-1);
 }
 
@@ -1084,6 +1290,9 @@ static void qmgr_message_resolve(QMGR_MESSAGE *message)
 #define STR		vstring_str
 #define LEN		VSTRING_LEN
 
+#define QMGR_RCPT_UPDATE(ptr, new) \
+    ((ptr) = qmgr_rcpt_pool_strdup(message->rcpt_pool, (new)))
+
     resolve_clnt_init(&reply);
     queue_name = vstring_alloc(1);
     for (recipient = list.info; recipient < list.info + list.len; recipient++) {
@@ -1103,12 +1312,12 @@ static void qmgr_message_resolve(QMGR_MESSAGE *message)
 
 	    rewrite_clnt_internal(REWRITE_CANON, message->redirect_addr,
 				  reply.recipient);
-	    RECIPIENT_UPDATE(recipient->address, STR(reply.recipient));
+	    QMGR_RCPT_UPDATE(recipient->address, STR(reply.recipient));
 	    if (qmgr_resolve_one(message, recipient,
 				 recipient->address, &reply) < 0)
 		continue;
 	    if (!STREQ(recipient->address, STR(reply.recipient)))
-		RECIPIENT_UPDATE(recipient->address, STR(reply.recipient));
+		QMGR_RCPT_UPDATE(recipient->address, STR(reply.recipient));
 	}
 
 	/*
@@ -1146,7 +1355,7 @@ static void qmgr_message_resolve(QMGR_MESSAGE *message)
 				 recipient->address, &reply) < 0)
 		continue;
 	    if (!STREQ(recipient->address, STR(reply.recipient)))
-		RECIPIENT_UPDATE(recipient->address, STR(reply.recipient));
+		QMGR_RCPT_UPDATE(recipient->address, STR(reply.recipient));
 	}
 
 	/*
@@ -1400,16 +1609,25 @@ static void qmgr_message_assign(QMGR_MESSAGE *message)
 	 */
 	entry = peer->entry_list.prev;
 	if (message->single_rcpt || entry == 0
-	    || !LIMIT_OK(queue->transport->recipient_limit, entry->rcpt_list.len))
+	    || !LIMIT_OK(queue->transport->recipient_limit, entry->rcpt_list.len)) {
 	    entry = qmgr_entry_create(peer, message);
+	    entry->rcpt_pool = qmgr_rcpt_pool_link(message->rcpt_pool);
+	}
 
 	/*
 	 * Add the recipient to the current entry and increase all those
 	 * recipient counters accordingly.
 	 */
-	recipient_list_add(&entry->rcpt_list, recipient->offset,
-			   recipient->dsn_orcpt, recipient->dsn_notify,
-			   recipient->orig_addr, recipient->address);
+	if (entry->rcpt_pool == message->rcpt_pool)
+	    recipient_list_add(&entry->rcpt_list, recipient->offset,
+			       recipient->dsn_orcpt, recipient->dsn_notify,
+			       recipient->orig_addr, recipient->address);
+	else
+	    /* Entry from an earlier read; its strings live elsewhere. */
+	    qmgr_rcpt_pool_add(entry->rcpt_pool, &entry->rcpt_list,
+			       recipient->offset, recipient->dsn_orcpt,
+			       recipient->dsn_notify, recipient->orig_addr,
+			       recipient->address);
 	job->rcpt_count++;
 	message->rcpt_count++;
 	qmgr_recipient_count++;
@@ -1420,7 +1638,7 @@ static void qmgr_message_assign(QMGR_MESSAGE *message)
      * time.
      */
     recipient_list_free(&message->rcpt_list);
-    recipient_list_init(&message->rcpt_list, RCPT_LIST_INIT_QUEUE);
+    recipient_list_init(&message->rcpt_list, QMGR_RCPT_LIST_INIT);
 
     /*
      * Note that even if qmgr_job_obtain() reset the job candidate cache of
@@ -1458,22 +1676,25 @@ void    qmgr_message_free(QMGR_MESSAGE *message)
 	msg_panic("qmgr_message_free: queue file is open");
     while ((job = message->job_list.next) != 0)
 	qmgr_job_free(job);
-    myfree(message->queue_id);
-    myfree(message->queue_name);
+    if (msg_verbose)
+	msg_info("%s: arena: %ld strings, %ld bytes, mymalloc() calls: "
+		 "%ld without arena, %ld with arena", message->queue_id,
+		 (long) message->arena->alloc_count,
+		 (long) message->arena->bytes,
+		 (long) message->arena->alloc_count,
+		 (long) message->arena->chunk_count + 1);
     if (message->dsn_envid)
 	myfree(message->dsn_envid);
     if (message->encoding)
 	myfree(message->encoding);
-    if (message->sender)
-	myfree(message->sender);
-    if (message->verp_delims)
-	myfree(message->verp_delims);
     if (message->filter_xport)
 	myfree(message->filter_xport);
     if (message->inspect_xport)
 	myfree(message->inspect_xport);
     if (message->redirect_addr)
 	myfree(message->redirect_addr);
+    if (message->rcpt_batch)
+	myfree((void *) message->rcpt_batch);
     if (message->client_name)
 	myfree(message->client_name);
     if (message->client_addr)
@@ -1484,20 +1705,13 @@ void    qmgr_message_free(QMGR_MESSAGE *message)
 	myfree(message->client_proto);
     if (message->client_helo)
 	myfree(message->client_helo);
-    if (message->sasl_method)
-	myfree(message->sasl_method);
-    if (message->sasl_username)
-	myfree(message->sasl_username);
-    if (message->sasl_sender)
-	myfree(message->sasl_sender);
-    if (message->log_ident)
-	myfree(message->log_ident);
-    if (message->rewrite_context)
-	myfree(message->rewrite_context);
     recipient_list_free(&message->rcpt_list);
+    qmgr_rcpt_pool_unlink(message->rcpt_pool);
     qmgr_message_count--;
+    QMGR_LIST_UNLINK(qmgr_message_list, QMGR_MESSAGE *, message, active_peers);
     if ((message->tflags & DEL_REQ_FLAG_MTA_VRFY) != 0)
 	qmgr_vrfy_pend_count--;
+    marena_free(message->arena);
     myfree((void *) message);
 }
 
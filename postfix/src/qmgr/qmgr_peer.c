@@ -141,7 +141,7 @@ QMGR_PEER *qmgr_peer_select(QMGR_JOB *job)
      */
     for (peer = job->peer_list.next; peer; peer = peer->peers.next) {
 	queue = peer->queue;
-	if (queue->window > queue->busy_refcount && peer->entry_list.next != 0) {
+	if (qmgr_queue_avail(queue) > 0 && peer->entry_list.next != 0) {
 	    QMGR_LIST_ROTATE(job->peer_list, peer, peers);
 	    if (msg_verbose)
 		msg_info("qmgr_peer_select: %s %s %s (%d of %d)",
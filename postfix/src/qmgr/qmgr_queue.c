@@ -27,9 +27,20 @@
 /*	void	qmgr_queue_unthrottle(queue)
 /*	QMGR_QUEUE *queue;
 /*
+/*	void	qmgr_queue_latency(queue, latency, throttled)
+/*	QMGR_QUEUE *queue;
+/*	double	latency;
+/*	int	throttled;
+/*
 /*	void	qmgr_queue_suspend(queue, delay)
 /*	QMGR_QUEUE *queue;
 /*	int	delay;
+/*
+/*	int	qmgr_queue_avail(queue)
+/*	QMGR_QUEUE *queue;
+/*
+/*	void	qmgr_queue_rate_take(queue)
+/*	QMGR_QUEUE *queue;
 /* DESCRIPTION
 /*	These routines add/delete/manipulate per-destination queues.
 /*	Each queue corresponds to a specific transport and destination.
@@ -64,6 +75,14 @@
 /*	provided that it does not exceed the destination concurrency
 /*	limit specified for the transport. This routine implements
 /*	"slow open" mode, and eliminates the "thundering herd" problem.
+/*	With latency feedback, qmgr_queue_unthrottle() only revives
+/*	a destination that was throttled.
+/*
+/*	qmgr_queue_latency() implements latency feedback (see
+/*	qmgr_feedback(3)) for a destination that is not throttled.
+/*	The latency argument specifies the time for one delivery in
+/*	seconds, and the throttled argument is non-zero when the
+/*	receiver asked the sender to slow down.
 /*
 /*	qmgr_queue_suspend() suspends delivery for this destination
 /*	briefly. This function invalidates any scheduling decisions
@@ -71,6 +90,19 @@
 /*	To compensate for work skipped by qmgr_entry_done(), the
 /*	status of blocker jobs is re-evaluated after the queue is
 /*	resumed.
+/*
+/*	qmgr_queue_avail() returns the number of deliveries that can
+/*	be added to the specified queue, taking into account the
+/*	concurrency window (see qmgr_shard_avail()) and the
+/*	destination rate limit. The result is zero or negative when
+/*	no delivery can be added.
+/*
+/*	qmgr_queue_rate_take() spends one token from the destination
+/*	rate limit (see qmgr_rate(3)). When the destination runs out
+/*	of tokens, a timer re-evaluates the status of blocker jobs
+/*	after the next token becomes available. The rate limit state
+/*	is saved when the queue is disposed of, and restored when
+/*	the queue is created again.
 /* DIAGNOSTICS
 /*	Panic: consistency check failure.
 /* LICENSE
@@ -97,6 +129,7 @@
 
 #include <sys_defs.h>
 #include <time.h>
+#include <string.h>
 
 /* Utility library. */
 
@@ -194,6 +227,55 @@ void    qmgr_queue_suspend(QMGR_QUEUE *queue, int delay)
     event_request_timer(qmgr_queue_resume, (void *) queue, delay);
 }
 
+/* qmgr_queue_rate_event - destination rate limit has a token */
+
+static void qmgr_queue_rate_event(int unused_event, void *context)
+{
+    QMGR_QUEUE *queue = (QMGR_QUEUE *) context;
+    int     wait;
+
+    /*
+     * The timer resolution is one second; don't expect the bucket to have
+     * a token at the exact time that the timer goes off.
+     */
+    if ((wait = qmgr_rate_wait(&queue->rate)) > 0) {
+	event_request_timer(qmgr_queue_rate_event, context, wait);
+	return;
+    }
+
+    /*
+     * Every event handler that leaves a queue in the "ready" state should
+     * remove the queue when it is empty. A suspended queue will update its
+     * blocker status when it is resumed.
+     */
+    if (QMGR_QUEUE_READY(queue) && queue->todo.next == 0 && queue->busy.next == 0)
+	qmgr_queue_done(queue);
+    else if (!QMGR_QUEUE_SUSPENDED(queue))
+	qmgr_job_blocker_update(queue);
+}
+
+/* qmgr_queue_rate_take - spend destination rate limit token */
+
+void    qmgr_queue_rate_take(QMGR_QUEUE *queue)
+{
+    int     wait;
+
+    if ((wait = qmgr_rate_take(&queue->rate)) > 0)
+	event_request_timer(qmgr_queue_rate_event, (void *) queue, wait);
+}
+
+/* qmgr_queue_avail - room for more deliveries */
+
+int     qmgr_queue_avail(QMGR_QUEUE *queue)
+{
+    int     avail = qmgr_shard_avail(queue);
+    int     tokens;
+
+    if (avail > 0 && (tokens = qmgr_rate_avail(&queue->rate)) < avail)
+	avail = tokens;
+    return (avail);
+}
+
 /* qmgr_queue_unthrottle_wrapper - in case (char *) != (struct *) */
 
 static void qmgr_queue_unthrottle_wrapper(int unused_event, void *context)
@@ -251,6 +333,15 @@ void    qmgr_queue_unthrottle(QMGR_QUEUE *queue)
 	else
 	    queue->window = transport->init_dest_concurrency;
 	queue->success = queue->failure = 0;
+	queue->latency.samples = queue->latency.throttled = 0;
+	QMGR_LOG_WINDOW(queue);
+	return;
+    }
+
+    /*
+     * With latency feedback, qmgr_queue_latency() adjusts the window.
+     */
+    if (transport->feedback_mode == QMGR_FEEDBACK_MODE_LATENCY) {
 	QMGR_LOG_WINDOW(queue);
 	return;
     }
@@ -290,6 +381,40 @@ void    qmgr_queue_unthrottle(QMGR_QUEUE *queue)
     QMGR_LOG_WINDOW(queue);
 }
 
+/* qmgr_queue_latency - latency feedback */
+
+void    qmgr_queue_latency(QMGR_QUEUE *queue, double latency, int throttled)
+{
+    const char *myname = "qmgr_queue_latency";
+    QMGR_TRANSPORT *transport = queue->transport;
+    int     limit;
+
+    /*
+     * Sanity checks.
+     */
+    if (!QMGR_QUEUE_READY(queue))
+	msg_panic("%s: bad queue status: %s", myname, QMGR_QUEUE_STATUS(queue));
+
+    /*
+     * As with classic feedback, keep the window within reasonable distance
+     * from actual concurrency; a destination that receives little mail has
+     * no latency to show for a large window.
+     */
+    limit = queue->busy_refcount + transport->init_dest_concurrency;
+    if (transport->dest_concurrency_limit > 0
+	&& transport->dest_concurrency_limit < limit)
+	limit = transport->dest_concurrency_limit;
+    if (limit < queue->window)
+	limit = queue->window;
+    queue->window = qmgr_feedback_latency(&queue->latency, queue->window,
+					  limit, latency, throttled);
+    if (var_conc_feedback_debug && !QMGR_ERROR_OR_RETRY_QUEUE(queue))
+	msg_info("%s: queue %s: active %d latency %.3f throttled %d "
+		 "avg %.3f base %.3f window %d delay %d", myname, queue->name,
+		 queue->busy_refcount, latency, throttled, queue->latency.avg,
+		 queue->latency.base, queue->window, queue->latency.delay);
+}
+
 /* qmgr_queue_throttle - handle destination delivery failure */
 
 void    qmgr_queue_throttle(QMGR_QUEUE *queue, DSN *dsn)
@@ -387,13 +512,24 @@ void    qmgr_queue_done(QMGR_QUEUE *queue)
 	msg_panic("%s: queue %s: spurious reason %s",
 		  myname, queue->name, queue->dsn->reason);
 
+    /*
+     * Remember the destination rate limit state, so that the next in-core
+     * queue for this destination does not start with a full bucket.
+     */
+    if (queue->rate.limit > 0) {
+	event_cancel_timer(qmgr_queue_rate_event, (void *) queue);
+	qmgr_rate_save(transport->rate_byname, queue->name, &queue->rate);
+    }
+
     /*
      * Clean up this in-core queue.
      */
+    qmgr_shard_release(queue);
     QMGR_LIST_UNLINK(transport->queue_list, QMGR_QUEUE *, queue, peers);
+    if (queue->nexthop != queue->name)
+	myfree(queue->nexthop);
+    /* This also destroys queue->name. */
     htable_delete(transport->queue_byname, queue->name, (void (*) (void *)) 0);
-    myfree(queue->name);
-    myfree(queue->nexthop);
     qmgr_queue_count--;
     myfree((void *) queue);
 }
@@ -404,6 +540,7 @@ QMGR_QUEUE *qmgr_queue_create(QMGR_TRANSPORT *transport, const char *name,
 			              const char *nexthop)
 {
     QMGR_QUEUE *queue;
+    int     wait;
 
     /*
      * If possible, choose an initial concurrency of > 1 so that one bad
@@ -414,20 +551,32 @@ QMGR_QUEUE *qmgr_queue_create(QMGR_TRANSPORT *transport, const char *name,
     qmgr_queue_count++;
     queue->dflags = 0;
     queue->last_done = 0;
-    queue->name = mystrdup(name);
-    queue->nexthop = mystrdup(nexthop);
+    /* Share the lookup table's copy of the name; see below. */
+    queue->nexthop = strcmp(name, nexthop) ? mystrdup(nexthop) : 0;
     queue->todo_refcount = 0;
     queue->busy_refcount = 0;
     queue->transport = transport;
     queue->window = transport->init_dest_concurrency;
     queue->success = queue->failure = queue->fail_cohorts = 0;
+    QMGR_LATENCY_INIT(&queue->latency);
     QMGR_LIST_INIT(queue->todo);
     QMGR_LIST_INIT(queue->busy);
     queue->dsn = 0;
     queue->clog_time_to_warn = 0;
     queue->blocker_tag = 0;
+    queue->shard_slot = qmgr_shard_slot(transport->name, name);
     QMGR_LIST_APPEND(transport->queue_list, queue, peers);
-    htable_enter(transport->queue_byname, name, (void *) queue);
+    queue->name = htable_enter(transport->queue_byname, name,
+			       (void *) queue)->key;
+    if (queue->nexthop == 0)
+	queue->nexthop = queue->name;
+    qmgr_rate_init(&queue->rate, transport->dest_rate_limit,
+		   transport->dest_rate_burst);
+    if (queue->rate.limit > 0) {
+	qmgr_rate_restore(transport->rate_byname, queue->name, &queue->rate);
+	if ((wait = qmgr_rate_wait(&queue->rate)) > 0)
+	    event_request_timer(qmgr_queue_rate_event, (void *) queue, wait);
+    }
     return (queue);
 }
 
@@ -0,0 +1,283 @@
+/*++
+/* NAME
+/*	qmgr_rate 3
+/* SUMMARY
+/*	token-bucket delivery rate limits
+/* SYNOPSIS
+/*	#include "qmgr.h"
+/*
+/*	double	qmgr_rate_conf(name_prefix, name_tail, def_name, def_val)
+/*	const char *name_prefix;
+/*	const char *name_tail;
+/*	const char *def_name;
+/*	const char *def_val;
+/*
+/*	void	qmgr_rate_init(rate, limit, burst)
+/*	QMGR_RATE *rate;
+/*	double	limit;
+/*	int	burst;
+/*
+/*	double	qmgr_rate_tokens(rate)
+/*	QMGR_RATE *rate;
+/*
+/*	int	qmgr_rate_avail(rate)
+/*	QMGR_RATE *rate;
+/*
+/*	int	qmgr_rate_take(rate)
+/*	QMGR_RATE *rate;
+/*
+/*	int	qmgr_rate_wait(rate)
+/*	QMGR_RATE *rate;
+/*
+/*	void	qmgr_rate_save(table, name, rate)
+/*	HTABLE	*table;
+/*	const char *name;
+/*	QMGR_RATE *rate;
+/*
+/*	void	qmgr_rate_restore(table, name, rate)
+/*	HTABLE	*table;
+/*	const char *name;
+/*	QMGR_RATE *rate;
+/* DESCRIPTION
+/*	This module implements token-bucket rate limits for delivery
+/*	transports and destinations. A bucket holds at most "burst"
+/*	tokens, and is refilled continuously at "limit" tokens per
+/*	second. Each delivery spends one token. Unlike a rate delay,
+/*	a token bucket does not limit the number of deliveries that
+/*	are in progress at the same time; it only limits how fast
+/*	deliveries are started.
+/*
+/*	The queue manager's timers have a resolution of one second.
+/*	Buckets are refilled with the time of day, and the scheduler
+/*	re-examines them whenever a delivery completes, so that a
+/*	limit of many deliveries per second is enforced with
+/*	sub-second precision while deliveries are in progress. A
+/*	timer is needed only when a bucket runs dry.
+/*
+/*	qmgr_rate_conf() looks up the configuration parameter whose
+/*	name is the concatenation of name_prefix and name_tail, with
+/*	def_val as the default value, and converts the value to a
+/*	number of deliveries per second. Zero means no limit. The
+/*	def_name argument is used in error messages.
+/*
+/*	qmgr_rate_init() initializes a bucket with the specified rate
+/*	limit and burst size. The bucket starts out full.
+/*
+/*	qmgr_rate_tokens() refills the bucket and returns the number
+/*	of tokens, including fractions.
+/*
+/*	qmgr_rate_avail() refills the bucket and returns the number
+/*	of deliveries that may be started now. The result is
+/*	QMGR_RATE_UNLIMITED when the bucket has no rate limit.
+/*
+/*	qmgr_rate_take() spends one token. The result is the number
+/*	of seconds until the next token becomes available, or zero
+/*	when a token is available now. Tokens may be spent ahead of
+/*	time; the debt is repaid before the next delivery can start.
+/*
+/*	qmgr_rate_wait() refills the bucket and returns the number
+/*	of seconds until the next token becomes available, or zero
+/*	when a token is available now.
+/*
+/*	qmgr_rate_save() saves the state of a bucket that is not
+/*	full under the specified name. Buckets that have filled up
+/*	are removed from the table from time to time.
+/*
+/*	qmgr_rate_restore() looks up the state that was saved under
+/*	the specified name, and if found, copies it to the specified
+/*	bucket and removes it from the table.
+/* DIAGNOSTICS
+/*	Fatal: invalid parameter value.
+/* SEE ALSO
+/*	qmgr_queue(3), per-destination queues
+/*	qmgr_transport(3), transport management
+/* LICENSE
+/* .ad
+/* .fi
+/*	The Secure Mailer license must be distributed with this software.
+/* AUTHOR(S)
+/*	agent
+/*	agent@local
+/*--*/
+
+/* System library. */
+
+#include <sys_defs.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Utility library. */
+
+#include <msg.h>
+#include <mymalloc.h>
+#include <htable.h>
+#include <stringops.h>
+
+/* Global library. */
+
+#include <mail_conf.h>
+
+/* Application-specific. */
+
+#include "qmgr.h"
+
+ /*
+  * Remove full buckets from a table after this many saves.
+  */
+#define QMGR_RATE_SWEEP	256
+
+/* qmgr_rate_now - current time with sub-second resolution */
+
+static double qmgr_rate_now(void)
+{
+    struct timeval tv;
+
+    GETTIMEOFDAY(&tv);
+    return (tv.tv_sec + tv.tv_usec / 1000000.0);
+}
+
+/* qmgr_rate_refill - add tokens for elapsed time */
+
+static void qmgr_rate_refill(QMGR_RATE *rate)
+{
+    double  now = qmgr_rate_now();
+
+    /*
+     * Don't add tokens when the clock steps backwards.
+     */
+    if (now > rate->stamp) {
+	rate->tokens += (now - rate->stamp) * rate->limit;
+	if (rate->tokens > rate->burst)
+	    rate->tokens = rate->burst;
+    }
+    rate->stamp = now;
+}
+
+/* qmgr_rate_conf - look up rate limit parameter value */
+
+double  qmgr_rate_conf(const char *name_prefix, const char *name_tail,
+		               const char *def_name, const char *def_val)
+{
+    char   *limit_name;
+    char   *limit_val;
+    double  limit;
+    char   *end;
+
+    limit_name = concatenate(name_prefix, name_tail, (char *) 0);
+    limit_val = get_mail_conf_str(limit_name, def_val, 1, 0);
+    limit = strtod(limit_val, &end);
+    if (end == limit_val || *end != 0 || !(limit >= 0) || limit > 1e6)
+	msg_fatal("bad numerical configuration: %s = %s",
+		  strcmp(limit_val, def_val) ? limit_name : def_name,
+		  limit_val);
+    myfree(limit_name);
+    myfree(limit_val);
+    return (limit);
+}
+
+/* qmgr_rate_init - initialize full bucket */
+
+void    qmgr_rate_init(QMGR_RATE *rate, double limit, int burst)
+{
+    rate->limit = limit;
+    rate->burst = burst;
+    rate->tokens = burst;
+    rate->stamp = limit > 0 ? qmgr_rate_now() : 0;
+    rate->waits = 0;
+}
+
+/* qmgr_rate_tokens - refill and report bucket content */
+
+double  qmgr_rate_tokens(QMGR_RATE *rate)
+{
+    if (rate->limit > 0)
+	qmgr_rate_refill(rate);
+    return (rate->tokens);
+}
+
+/* qmgr_rate_avail - deliveries that may start now */
+
+int     qmgr_rate_avail(QMGR_RATE *rate)
+{
+    if (rate->limit <= 0)
+	return (QMGR_RATE_UNLIMITED);
+    qmgr_rate_refill(rate);
+    return (rate->tokens < 1 ? 0 : (int) rate->tokens);
+}
+
+/* qmgr_rate_wait - time until the next token */
+
+int     qmgr_rate_wait(QMGR_RATE *rate)
+{
+    double  wait;
+
+    if (rate->limit <= 0)
+	return (0);
+    qmgr_rate_refill(rate);
+    if (rate->tokens >= 1)
+	return (0);
+    wait = (1 - rate->tokens) / rate->limit;
+    return (wait > (int) wait ? (int) wait + 1 : (int) wait);
+}
+
+/* qmgr_rate_take - spend one token */
+
+int     qmgr_rate_take(QMGR_RATE *rate)
+{
+    if (rate->limit <= 0)
+	return (0);
+    qmgr_rate_refill(rate);
+    rate->tokens -= 1;
+    if (rate->tokens < 1)
+	rate->waits += 1;
+    return (qmgr_rate_wait(rate));
+}
+
+/* qmgr_rate_sweep - remove buckets that have filled up */
+
+static void qmgr_rate_sweep(HTABLE *table)
+{
+    HTABLE_INFO **list;
+    HTABLE_INFO **ht;
+    QMGR_RATE *rate;
+
+    list = htable_list(table);
+    for (ht = list; *ht; ht++) {
+	rate = (QMGR_RATE *) ht[0]->value;
+	if (qmgr_rate_tokens(rate) >= rate->burst)
+	    htable_delete(table, ht[0]->key, myfree);
+    }
+    myfree((void *) list);
+}
+
+/* qmgr_rate_save - save bucket state */
+
+void    qmgr_rate_save(HTABLE *table, const char *name, QMGR_RATE *rate)
+{
+    static int saves;
+    QMGR_RATE *saved;
+
+    if (rate->limit <= 0 || qmgr_rate_tokens(rate) >= rate->burst)
+	return;
+    if (htable_locate(table, name) != 0)
+	msg_panic("qmgr_rate_save: duplicate entry: %s", name);
+    saved = (QMGR_RATE *) mymalloc(sizeof(*saved));
+    *saved = *rate;
+    htable_enter(table, name, (void *) saved);
+    if (++saves % QMGR_RATE_SWEEP == 0)
+	qmgr_rate_sweep(table);
+}
+
+/* qmgr_rate_restore - restore bucket state */
+
+void    qmgr_rate_restore(HTABLE *table, const char *name, QMGR_RATE *rate)
+{
+    QMGR_RATE *saved;
+
+    if ((saved = (QMGR_RATE *) htable_find(table, name)) != 0) {
+	rate->tokens = saved->tokens;
+	rate->stamp = saved->stamp;
+	rate->waits = saved->waits;
+	htable_delete(table, name, myfree);
+    }
+}
@@ -0,0 +1,251 @@
+/*++
+/* NAME
+/*	qmgr_rcpt_pool 3
+/* SUMMARY
+/*	in-core recipient storage
+/* SYNOPSIS
+/*	#include "qmgr.h"
+/*
+/*	QMGR_RCPT_STATS qmgr_rcpt_stats;
+/*
+/*	QMGR_RCPT_POOL *qmgr_rcpt_pool_create(expect)
+/*	int	expect;
+/*
+/*	QMGR_RCPT_POOL *qmgr_rcpt_pool_link(pool)
+/*	QMGR_RCPT_POOL *pool;
+/*
+/*	void	qmgr_rcpt_pool_unlink(pool)
+/*	QMGR_RCPT_POOL *pool;
+/*
+/*	QMGR_RCPT_POOL *qmgr_rcpt_pool_refresh(pool)
+/*	QMGR_RCPT_POOL *pool;
+/*
+/*	void	qmgr_rcpt_pool_add(pool, list, offset, dsn_orcpt, dsn_notify,
+/*					orig_rcpt, recipient)
+/*	QMGR_RCPT_POOL *pool;
+/*	RECIPIENT_LIST *list;
+/*	long	offset;
+/*	const char *dsn_orcpt;
+/*	int	dsn_notify;
+/*	const char *orig_rcpt;
+/*	const char *recipient;
+/*
+/*	const char *qmgr_rcpt_pool_strdup(pool, string)
+/*	QMGR_RCPT_POOL *pool;
+/*	const char *string;
+/*
+/*	void	qmgr_rcpt_pool_stats(void)
+/* DESCRIPTION
+/*	This module stores the address information of in-core
+/*	recipients. The recipients that are read with one
+/*	qmgr_message_read() call share one memory arena, instead of
+/*	making three mystrdup() copies per recipient. The queue
+/*	entries that receive those recipients refer to the same
+/*	strings, instead of making copies of their own. Strings that
+/*	repeat are stored once: the empty string, an original
+/*	recipient that is the same as the recipient, and an original
+/*	recipient that is the same as that of the preceding recipient
+/*	(for example, after alias or list expansion).
+/*
+/*	A pool is reference counted: it is destroyed after the message
+/*	and all queue entries that use it have let go. Thus, a message
+/*	with more recipients than fit in core at once still releases
+/*	the storage for each batch of recipients when the last of those
+/*	is delivered.
+/*
+/*	qmgr_rcpt_stats maintains the number of recipients that were
+/*	stored, the total storage for those recipients including the
+/*	RECIPIENT structure, and the current and maximal amount of
+/*	string storage in use.
+/*
+/*	qmgr_rcpt_pool_create() creates a pool with a reference count
+/*	of one. The expect argument is an estimate of the number of
+/*	recipients that will be stored; it determines the arena chunk
+/*	size.
+/*
+/*	qmgr_rcpt_pool_link() increments the reference count, and
+/*	returns its argument.
+/*
+/*	qmgr_rcpt_pool_unlink() decrements the reference count, and
+/*	destroys the pool when the count reaches zero. A null pool
+/*	argument is ignored.
+/*
+/*	qmgr_rcpt_pool_refresh() prepares the pool of a message for
+/*	another qmgr_message_read() call. When no queue entry uses
+/*	the pool, its storage is recycled. Otherwise, the message lets
+/*	go of the pool. The result is the pool argument, or a null
+/*	pointer.
+/*
+/*	qmgr_rcpt_pool_add() stores a copy of the recipient information
+/*	in the pool, and appends the result to the specified list,
+/*	which must be initialized with QMGR_RCPT_LIST_INIT.
+/*
+/*	qmgr_rcpt_pool_strdup() stores a copy of the string in the
+/*	pool. This is used to replace a recipient address.
+/*
+/*	qmgr_rcpt_pool_stats() logs the content of qmgr_rcpt_stats.
+/* DIAGNOSTICS
+/*	Panic: consistency check failure. Fatal: out of memory.
+/* SEE ALSO
+/*	marena(3), memory arena
+/*	recipient_list(3), in-core recipient structures
+/* LICENSE
+/* .ad
+/* .fi
+/*	The Secure Mailer license must be distributed with this software.
+/* AUTHOR(S)
+/*	agent
+/*	agent@local
+/*--*/
+
+/* System library. */
+
+#include <sys_defs.h>
+#include <string.h>
+
+/* Utility library. */
+
+#include <msg.h>
+#include <mymalloc.h>
+#include <marena.h>
+
+/* Application-specific. */
+
+#include "qmgr.h"
+
+QMGR_RCPT_STATS qmgr_rcpt_stats;
+
+ /*
+  * Arena chunk sizing. A message with one recipient should not pay for a
+  * large chunk, and a message with many recipients should not make many
+  * small mymalloc() calls.
+  */
+#define QMGR_RCPT_POOL_PER_RCPT	48	/* typical string storage */
+#define QMGR_RCPT_POOL_MAX_CHUNK	65536
+
+#define STREQ(x,y)	(strcmp((x), (y)) == 0)
+
+/* qmgr_rcpt_pool_create - create recipient pool */
+
+QMGR_RCPT_POOL *qmgr_rcpt_pool_create(int expect)
+{
+    QMGR_RCPT_POOL *pool;
+    ssize_t chunk_size;
+
+    if (expect < 1)
+	expect = 1;
+    if (expect > QMGR_RCPT_POOL_MAX_CHUNK / QMGR_RCPT_POOL_PER_RCPT)
+	chunk_size = QMGR_RCPT_POOL_MAX_CHUNK;
+    else
+	chunk_size = expect * QMGR_RCPT_POOL_PER_RCPT;
+    pool = (QMGR_RCPT_POOL *) mymalloc(sizeof(*pool));
+    pool->arena = marena_create(chunk_size);
+    pool->refcount = 1;
+    pool->last_orig = "";
+    pool->last_orcpt = "";
+    return (pool);
+}
+
+/* qmgr_rcpt_pool_link - add reference */
+
+QMGR_RCPT_POOL *qmgr_rcpt_pool_link(QMGR_RCPT_POOL *pool)
+{
+    if (pool->refcount <= 0)
+	msg_panic("qmgr_rcpt_pool_link: bad refcount: %d", pool->refcount);
+    pool->refcount += 1;
+    return (pool);
+}
+
+/* qmgr_rcpt_pool_unlink - drop reference */
+
+void    qmgr_rcpt_pool_unlink(QMGR_RCPT_POOL *pool)
+{
+    if (pool == 0)
+	return;
+    if (pool->refcount <= 0)
+	msg_panic("qmgr_rcpt_pool_unlink: bad refcount: %d", pool->refcount);
+    if (--pool->refcount == 0) {
+	qmgr_rcpt_stats.curr_bytes -= pool->arena->bytes;
+	marena_free(pool->arena);
+	myfree((void *) pool);
+    }
+}
+
+/* qmgr_rcpt_pool_refresh - recycle or let go */
+
+QMGR_RCPT_POOL *qmgr_rcpt_pool_refresh(QMGR_RCPT_POOL *pool)
+{
+    if (pool == 0)
+	return (0);
+    if (pool->refcount > 1) {
+	qmgr_rcpt_pool_unlink(pool);
+	return (0);
+    }
+    qmgr_rcpt_stats.curr_bytes -= pool->arena->bytes;
+    marena_reset(pool->arena);
+    pool->last_orig = "";
+    pool->last_orcpt = "";
+    return (pool);
+}
+
+/* qmgr_rcpt_pool_strdup - save string in pool */
+
+const char *qmgr_rcpt_pool_strdup(QMGR_RCPT_POOL *pool, const char *string)
+{
+    ssize_t before = pool->arena->bytes;
+    const char *result;
+
+    /*
+     * Strings need no alignment. Account for what the arena hands out, so
+     * that the numbers add up when the arena is reset or destroyed.
+     */
+    if (*string == 0)
+	return ("");
+    result = marena_strdup(pool->arena, string);
+    qmgr_rcpt_stats.byte_count += pool->arena->bytes - before;
+    qmgr_rcpt_stats.curr_bytes += pool->arena->bytes - before;
+    if (qmgr_rcpt_stats.curr_bytes > qmgr_rcpt_stats.peak_bytes)
+	qmgr_rcpt_stats.peak_bytes = qmgr_rcpt_stats.curr_bytes;
+    return (result);
+}
+
+/* qmgr_rcpt_pool_add - save recipient in pool, append to list */
+
+void    qmgr_rcpt_pool_add(QMGR_RCPT_POOL *pool, RECIPIENT_LIST *list,
+			           long offset, const char *dsn_orcpt,
+			           int dsn_notify, const char *orig_rcpt,
+			           const char *recipient)
+{
+    const char *addr;
+
+    if ((list->flags & RCPT_LIST_FLAG_NOCOPY) == 0)
+	msg_panic("qmgr_rcpt_pool_add: list owns its strings");
+
+    addr = qmgr_rcpt_pool_strdup(pool, recipient);
+    if (STREQ(orig_rcpt, recipient))
+	orig_rcpt = addr;
+    else if (STREQ(orig_rcpt, pool->last_orig))
+	orig_rcpt = pool->last_orig;
+    else
+	orig_rcpt = pool->last_orig = qmgr_rcpt_pool_strdup(pool, orig_rcpt);
+    if (STREQ(dsn_orcpt, pool->last_orcpt))
+	dsn_orcpt = pool->last_orcpt;
+    else
+	dsn_orcpt = pool->last_orcpt = qmgr_rcpt_pool_strdup(pool, dsn_orcpt);
+    recipient_list_add(list, offset, dsn_orcpt, dsn_notify, orig_rcpt, addr);
+    qmgr_rcpt_stats.rcpt_count += 1;
+    qmgr_rcpt_stats.byte_count += sizeof(RECIPIENT);
+}
+
+/* qmgr_rcpt_pool_stats - log recipient storage statistics */
+
+void    qmgr_rcpt_pool_stats(void)
+{
+    QMGR_RCPT_STATS *sp = &qmgr_rcpt_stats;
+
+    if (sp->rcpt_count > 0)
+	msg_info("statistics: recipient storage: %ld recipients, "
+		 "%ld bytes per recipient, max string storage %ld bytes",
+		 sp->rcpt_count, sp->byte_count / sp->rcpt_count,
+		 sp->peak_bytes);
+}
@@ -0,0 +1,440 @@
+/*++
+/* NAME
+/*	qmgr_retry 3
+/* SUMMARY
+/*	deferred queue retry index
+/* SYNOPSIS
+/*	#include "qmgr.h"
+/*
+/*	QMGR_RETRY *qmgr_retry_open(path)
+/*	const char *path;
+/*
+/*	void	qmgr_retry_enter(retry, queue_id, due)
+/*	QMGR_RETRY *retry;
+/*	const char *queue_id;
+/*	time_t	due;
+/*
+/*	const char *qmgr_retry_next(retry, now)
+/*	QMGR_RETRY *retry;
+/*	time_t	now;
+/*
+/*	void	qmgr_retry_rebuild(retry, now)
+/*	QMGR_RETRY *retry;
+/*	time_t	now;
+/*
+/*	void	qmgr_retry_save(retry)
+/*	QMGR_RETRY *retry;
+/*
+/*	int	qmgr_retry_stale(retry, now, max_age)
+/*	QMGR_RETRY *retry;
+/*	time_t	now;
+/*	int	max_age;
+/*
+/*	void	qmgr_retry_close(retry)
+/*	QMGR_RETRY *retry;
+/* DESCRIPTION
+/*	This module maintains an index of deferred queue files,
+/*	ordered by the time of the next delivery attempt, so that a
+/*	periodic deferred queue scan needs to look only at queue files
+/*	that are due, instead of looking at every queue file. The
+/*	index is kept in memory as a binary heap, and a copy is kept
+/*	in a file, so that it survives a queue manager restart.
+/*
+/*	The index is a hint: an entry may refer to a queue file that
+/*	no longer exists or that has a more recent time stamp, and
+/*	a queue file may have more than one entry. The caller must
+/*	verify the queue file before using it. Queue files that enter
+/*	the deferred queue by other means than the queue manager
+/*	(for example, "postsuper -H") are not indexed until the next
+/*	rebuild.
+/*
+/*	qmgr_retry_open() opens or creates the named index file,
+/*	and reads its content into memory. An index file that is
+/*	empty, damaged or incomplete is treated as stale (see
+/*	qmgr_retry_stale() below). This function should be called
+/*	before the process enters the chroot jail.
+/*
+/*	qmgr_retry_enter() adds an entry for the named queue file
+/*	that becomes due at the specified time. Except during a
+/*	rebuild, the entry is also appended to the index file.
+/*
+/*	qmgr_retry_next() removes the entry that is due first, and
+/*	returns its queue ID. The result is null when no entry is
+/*	due at the specified time. The result is overwritten upon
+/*	the next call.
+/*
+/*	qmgr_retry_rebuild() discards all entries, and truncates the
+/*	index file. The caller is expected to scan the entire deferred
+/*	queue, to call qmgr_retry_enter() for each queue file that is
+/*	not yet due, and to call qmgr_retry_save() when the scan is
+/*	complete. The now argument specifies the time of the scan
+/*	start.
+/*
+/*	qmgr_retry_save() writes the in-memory index to the index
+/*	file, and ends a rebuild. After a write error, the index
+/*	file is left empty, and the index is stale.
+/*
+/*	qmgr_retry_stale() returns non-zero when the index was not
+/*	rebuilt during the past max_age seconds, or when it was not
+/*	loaded successfully. An index rebuild counts from the time
+/*	that it starts.
+/*
+/*	qmgr_retry_close() destroys the in-memory index, and closes
+/*	the index file.
+/*
+/*	The QMGR_RETRY structure provides the read-only member "len",
+/*	the number of in-memory entries.
+/* DIAGNOSTICS
+/*	Warnings: index file corruption, index file read or write
+/*	errors. These force a rebuild from the deferred queue.
+/*	Fatal: the index file cannot be opened.
+/* LICENSE
+/* .ad
+/* .fi
+/*	The Secure Mailer license must be distributed with this software.
+/* AUTHOR(S)
+/*	agent
+/*	agent@local
+/*--*/
+
+/* System library. */
+
+#include <sys_defs.h>
+#include <sys/stat.h>
+#include <stdio.h>			/* sscanf() */
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+
+/* Utility library. */
+
+#include <msg.h>
+#include <mymalloc.h>
+#include <vstream.h>
+#include <vstring.h>
+#include <vstring_vstream.h>
+
+/* Global library. */
+
+#include <mail_queue.h>
+
+/* Application-specific. */
+
+#include "qmgr.h"
+
+ /*
+  * One index entry.
+  */
+struct QMGR_RETRY_ENTRY {
+    time_t  due;			/* next delivery attempt */
+    char   *queue_id;			/* queue file name */
+};
+
+#define QMGR_RETRY_FLAG_REBUILD	(1<<0)	/* rebuild in progress */
+
+ /*
+  * The index file starts with a header line with the file format version,
+  * the time of the last rebuild, and the number of entries that were
+  * written with that rebuild. The header is followed by one "time queueid"
+  * line per entry. Entries that were appended after the rebuild follow
+  * those that were written with the rebuild.
+  */
+#define QMGR_RETRY_MAGIC	"qmgr_retry_1"
+
+#define STR(x)	vstring_str(x)
+
+QMGR_RETRY *qmgr_retry_index;
+
+/* qmgr_retry_sift_up - restore heap order after insertion */
+
+static void qmgr_retry_sift_up(QMGR_RETRY *retry, ssize_t pos)
+{
+    QMGR_RETRY_ENTRY *heap = retry->heap;
+    QMGR_RETRY_ENTRY entry = heap[pos];
+    ssize_t parent;
+
+    while (pos > 0) {
+	parent = (pos - 1) / 2;
+	if (heap[parent].due <= entry.due)
+	    break;
+	heap[pos] = heap[parent];
+	pos = parent;
+    }
+    heap[pos] = entry;
+}
+
+/* qmgr_retry_sift_down - restore heap order after removal */
+
+static void qmgr_retry_sift_down(QMGR_RETRY *retry, ssize_t pos)
+{
+    QMGR_RETRY_ENTRY *heap = retry->heap;
+    QMGR_RETRY_ENTRY entry = heap[pos];
+    ssize_t child;
+
+    while ((child = 2 * pos + 1) < retry->len) {
+	if (child + 1 < retry->len && heap[child + 1].due < heap[child].due)
+	    child += 1;
+	if (entry.due <= heap[child].due)
+	    break;
+	heap[pos] = heap[child];
+	pos = child;
+    }
+    heap[pos] = entry;
+}
+
+/* qmgr_retry_store - add entry to in-memory index, without heap ordering */
+
+static void qmgr_retry_store(QMGR_RETRY *retry, const char *queue_id,
+			             time_t due)
+{
+    if (retry->len >= retry->size) {
+	retry->size *= 2;
+	retry->heap = (QMGR_RETRY_ENTRY *)
+	    myrealloc((void *) retry->heap, retry->size * sizeof(*retry->heap));
+    }
+    retry->heap[retry->len].due = due;
+    retry->heap[retry->len].queue_id = mystrdup(queue_id);
+    retry->len += 1;
+}
+
+/* qmgr_retry_purge - discard in-memory index */
+
+static void qmgr_retry_purge(QMGR_RETRY *retry)
+{
+    while (retry->len > 0)
+	myfree(retry->heap[--retry->len].queue_id);
+}
+
+/* qmgr_retry_write - append one line to index file */
+
+static void qmgr_retry_write(QMGR_RETRY *retry, const char *queue_id,
+			             time_t due)
+{
+    if (retry->built != 0)
+	vstream_fprintf(retry->fp, "%ld %s\n", (long) due, queue_id);
+}
+
+/* qmgr_retry_flush - flush index file, and handle errors */
+
+static void qmgr_retry_flush(QMGR_RETRY *retry)
+{
+    if (retry->built != 0 && vstream_fflush(retry->fp) != 0) {
+	msg_warn("write retry index file %s: %m -- forcing rebuild",
+		 retry->path);
+	retry->built = 0;
+    }
+}
+
+/* qmgr_retry_load - read index file into memory */
+
+static void qmgr_retry_load(QMGR_RETRY *retry)
+{
+    VSTRING *buf = vstring_alloc(100);
+    char    magic[sizeof(QMGR_RETRY_MAGIC) + 1];
+    long    built;
+    long    count;
+    long    lineno;
+    long    due;
+    char   *queue_id;
+    char   *end;
+    int     ch;
+
+    /*
+     * An empty file means that there is no index, or that a rebuild did not
+     * complete. That is not an error.
+     */
+    if (vstring_get_nonl(buf, retry->fp) == VSTREAM_EOF) {
+	if (msg_verbose)
+	    msg_info("retry index file %s is empty -- forcing rebuild",
+		     retry->path);
+	vstring_free(buf);
+	return;
+    }
+    if (sscanf(STR(buf), "%13s %ld %ld", magic, &built, &count) != 3
+	|| strcmp(magic, QMGR_RETRY_MAGIC) != 0 || built <= 0 || count < 0) {
+	msg_warn("retry index file %s: bad header -- forcing rebuild",
+		 retry->path);
+	vstring_free(buf);
+	return;
+    }
+
+    /*
+     * A partial last line means that the queue manager was terminated while
+     * it was deferring a message. The queue file was still in the active
+     * queue at that time, so the line can safely be ignored.
+     */
+    for (lineno = 0; (ch = vstring_get(buf, retry->fp)) != VSTREAM_EOF; lineno++) {
+	if (ch != '\n')
+	    break;
+	vstring_truncate(buf, VSTRING_LEN(buf) - 1);
+	VSTRING_TERMINATE(buf);
+	errno = 0;
+	due = strtol(STR(buf), &end, 10);
+	if (errno != 0 || end == STR(buf) || *end != ' '
+	    || !mail_queue_id_ok(queue_id = end + 1)) {
+	    msg_warn("retry index file %s: bad entry at line %ld "
+		     "-- forcing rebuild", retry->path, lineno + 2);
+	    qmgr_retry_purge(retry);
+	    vstring_free(buf);
+	    return;
+	}
+	qmgr_retry_store(retry, queue_id, (time_t) due);
+    }
+    if (vstream_ferror(retry->fp)) {
+	msg_warn("read retry index file %s: %m -- forcing rebuild",
+		 retry->path);
+	qmgr_retry_purge(retry);
+	vstring_free(buf);
+	return;
+    }
+
+    /*
+     * A rebuild that did not complete has fewer entries than announced.
+     */
+    if (lineno < count) {
+	msg_warn("retry index file %s: expected %ld entries, found %ld "
+		 "-- forcing rebuild", retry->path, count, lineno);
+	qmgr_retry_purge(retry);
+	vstring_free(buf);
+	return;
+    }
+    vstring_free(buf);
+
+    /*
+     * Establish the heap order in linear time.
+     */
+    for (count = retry->len / 2 - 1; count >= 0; count--)
+	qmgr_retry_sift_down(retry, count);
+    retry->built = built;
+    if (msg_verbose)
+	msg_info("retry index file %s: %ld entries", retry->path,
+		 (long) retry->len);
+
+    /*
+     * Don't append to a partial line; instead, rewrite the file.
+     */
+    if (ch != VSTREAM_EOF)
+	qmgr_retry_save(retry);
+}
+
+/* qmgr_retry_open - open index file, and load index */
+
+QMGR_RETRY *qmgr_retry_open(const char *path)
+{
+    QMGR_RETRY *retry;
+
+    retry = (QMGR_RETRY *) mymalloc(sizeof(*retry));
+    retry->path = mystrdup(path);
+    if ((retry->fp = vstream_fopen(path, O_RDWR | O_CREAT, 0600)) == 0)
+	msg_fatal("open retry index file %s: %m", path);
+    retry->size = 1024;
+    retry->heap = (QMGR_RETRY_ENTRY *)
+	mymalloc(retry->size * sizeof(*retry->heap));
+    retry->len = 0;
+    retry->built = 0;
+    retry->flags = 0;
+    retry->queue_id = vstring_alloc(30);
+    qmgr_retry_load(retry);
+    return (retry);
+}
+
+/* qmgr_retry_enter - add entry to index */
+
+void    qmgr_retry_enter(QMGR_RETRY *retry, const char *queue_id, time_t due)
+{
+    if (msg_verbose > 1)
+	msg_info("qmgr_retry_enter: %s %ld", queue_id, (long) due);
+
+    qmgr_retry_store(retry, queue_id, due);
+    qmgr_retry_sift_up(retry, retry->len - 1);
+    if ((retry->flags & QMGR_RETRY_FLAG_REBUILD) == 0) {
+	qmgr_retry_write(retry, queue_id, due);
+	qmgr_retry_flush(retry);
+    }
+}
+
+/* qmgr_retry_next - remove first entry that is due */
+
+const char *qmgr_retry_next(QMGR_RETRY *retry, time_t now)
+{
+    QMGR_RETRY_ENTRY *heap = retry->heap;
+
+    if (retry->len == 0 || heap[0].due > now)
+	return (0);
+    vstring_strcpy(retry->queue_id, heap[0].queue_id);
+    myfree(heap[0].queue_id);
+    if ((retry->len -= 1) > 0) {
+	heap[0] = heap[retry->len];
+	qmgr_retry_sift_down(retry, 0);
+    }
+    return (STR(retry->queue_id));
+}
+
+/* qmgr_retry_truncate - truncate index file */
+
+static void qmgr_retry_truncate(QMGR_RETRY *retry)
+{
+    if (vstream_fseek(retry->fp, (off_t) 0, SEEK_SET) < 0
+	|| ftruncate(vstream_fileno(retry->fp), (off_t) 0) < 0)
+	msg_warn("truncate retry index file %s: %m", retry->path);
+}
+
+/* qmgr_retry_rebuild - start index rebuild */
+
+void    qmgr_retry_rebuild(QMGR_RETRY *retry, time_t now)
+{
+    if (msg_verbose)
+	msg_info("qmgr_retry_rebuild: discard %ld entries", (long) retry->len);
+
+    /*
+     * If the rebuild does not complete, the empty file forces another
+     * rebuild after restart.
+     */
+    qmgr_retry_purge(retry);
+    qmgr_retry_truncate(retry);
+    retry->flags |= QMGR_RETRY_FLAG_REBUILD;
+    retry->built = now;
+}
+
+/* qmgr_retry_save - write index file, end rebuild */
+
+void    qmgr_retry_save(QMGR_RETRY *retry)
+{
+    ssize_t n;
+
+    /*
+     * After a write error, leave the file empty and force a rebuild.
+     */
+    retry->flags &= ~QMGR_RETRY_FLAG_REBUILD;
+    qmgr_retry_truncate(retry);
+    if (retry->built == 0)
+	return;
+    vstream_fprintf(retry->fp, "%s %ld %ld\n", QMGR_RETRY_MAGIC,
+		    (long) retry->built, (long) retry->len);
+    for (n = 0; n < retry->len; n++)
+	qmgr_retry_write(retry, retry->heap[n].queue_id, retry->heap[n].due);
+    qmgr_retry_flush(retry);
+    if (msg_verbose)
+	msg_info("qmgr_retry_save: %ld entries", (long) retry->len);
+}
+
+/* qmgr_retry_stale - index needs rebuild */
+
+int     qmgr_retry_stale(QMGR_RETRY *retry, time_t now, int max_age)
+{
+    return (retry->built == 0 || now - retry->built >= max_age);
+}
+
+/* qmgr_retry_close - destroy index */
+
+void    qmgr_retry_close(QMGR_RETRY *retry)
+{
+    qmgr_retry_purge(retry);
+    myfree((void *) retry->heap);
+    vstring_free(retry->queue_id);
+    if (vstream_fclose(retry->fp))
+	msg_warn("close retry index file %s: %m", retry->path);
+    myfree(retry->path);
+    myfree((void *) retry);
+}
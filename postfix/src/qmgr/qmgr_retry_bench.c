@@ -0,0 +1,269 @@
+/*++
+/* NAME
+/*	qmgr_retry_bench 1
+/* SUMMARY
+/*	compare deferred queue scans with and without retry index
+/* SYNOPSIS
+/* .fi
+/*	\fBqmgr_retry_bench\fR [\fB-v\fR] [\fB-n \fIcount\fR]
+/*	[\fB-p \fIpercent\fR] \fIdirectory\fR
+/* DESCRIPTION
+/*	The \fBqmgr_retry_bench\fR command measures the cost of
+/*	finding the due files in a synthetic deferred queue, first
+/*	with a full directory scan that examines the time stamp of
+/*	every file, as the queue manager does without retry index,
+/*	and then with a \fBqmgr_retry\fR(3) index.
+/*
+/*	When \fIdirectory\fR does not exist, \fBqmgr_retry_bench\fR
+/*	creates it, and populates \fIdirectory\fB/deferred\fR with
+/*	\fIcount\fR empty files in 16 hashed subdirectories. Of
+/*	these, \fIpercent\fR percent have a time stamp in the past;
+/*	the others have a time stamp up to 4000 seconds into the
+/*	future. An existing \fIdirectory\fR is reused, so that the
+/*	measurement can be repeated after flushing the file system
+/*	cache.
+/*
+/*	The retry index is saved as \fIdirectory\fB/qmgr_retry_index\fR.
+/*	The time to load that file is reported separately; the queue
+/*	manager loads it only once when it starts up.
+/*
+/*	Options:
+/* .IP "\fB-n \fIcount\fR (default: 100000)"
+/*	The number of files to create.
+/* .IP "\fB-p \fIpercent\fR (default: 1)"
+/*	The percentage of files that are due.
+/* .IP \fB-v\fR
+/*	Increase verbosity.
+/* DIAGNOSTICS
+/*	Problems are reported to the standard error stream.
+/* LICENSE
+/* .ad
+/* .fi
+/*	The Secure Mailer license must be distributed with this software.
+/*--*/
+
+/* System library. */
+
+#include <sys_defs.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <utime.h>
+#include <errno.h>
+
+/* Utility library. */
+
+#include <msg.h>
+#include <msg_vstream.h>
+#include <mymalloc.h>
+#include <myrand.h>
+#include <vstream.h>
+#include <vstring.h>
+#include <scan_dir.h>
+
+/* Global library. */
+
+#include <mail_scan_dir.h>
+
+/* Application-specific. */
+
+#include "qmgr.h"
+
+#define STR(x)	vstring_str(x)
+
+/* elapsed - return elapsed time in seconds */
+
+static double elapsed(struct timeval *start)
+{
+    struct timeval now;
+
+    if (gettimeofday(&now, (struct timezone *) 0) < 0)
+	msg_fatal("gettimeofday: %m");
+    return ((now.tv_sec - start->tv_sec)
+	    + (now.tv_usec - start->tv_usec) / 1000000.0);
+}
+
+/* make_queue - populate synthetic deferred queue */
+
+static void make_queue(const char *dir, long count, int percent, time_t now)
+{
+    static const char hex[] = "0123456789ABCDEF";
+    VSTRING *path = vstring_alloc(100);
+    struct utimbuf tbuf;
+    VSTREAM *fp;
+    long    n;
+    int     i;
+
+    if (mkdir(dir, 0700) < 0)
+	msg_fatal("mkdir %s: %m", dir);
+    vstring_sprintf(path, "%s/deferred", dir);
+    if (mkdir(STR(path), 0700) < 0)
+	msg_fatal("mkdir %s: %m", STR(path));
+    for (i = 0; i < 16; i++) {
+	vstring_sprintf(path, "%s/deferred/%c", dir, hex[i]);
+	if (mkdir(STR(path), 0700) < 0)
+	    msg_fatal("mkdir %s: %m", STR(path));
+    }
+    for (n = 0; n < count; n++) {
+	vstring_sprintf(path, "%s/deferred/%c/%c%07lX%06X", dir,
+			hex[n & 0xf], hex[n & 0xf], n,
+			(unsigned) myrand() & 0xffffff);
+	fp = vstream_fopen(STR(path), O_WRONLY | O_CREAT | O_EXCL, 0600);
+	if (fp == 0)
+	    msg_fatal("create %s: %m", STR(path));
+	(void) vstream_fclose(fp);
+	if (myrand() % 100 < percent)
+	    tbuf.actime = tbuf.modtime = now - 60;
+	else
+	    tbuf.actime = tbuf.modtime = now + 1 + myrand() % 4000;
+	if (utime(STR(path), &tbuf) < 0)
+	    msg_fatal("utime %s: %m", STR(path));
+    }
+    vstring_free(path);
+}
+
+/* scan_queue - find due files with full directory scan */
+
+static long scan_queue(const char *dir, time_t now, QMGR_RETRY *retry)
+{
+    VSTRING *path = vstring_alloc(100);
+    SCAN_DIR *scan;
+    struct stat st;
+    char   *name;
+    long    due = 0;
+
+    vstring_sprintf(path, "%s/deferred", dir);
+    scan = scan_dir_open(STR(path));
+    while ((name = mail_scan_dir_next(scan)) != 0) {
+	vstring_sprintf(path, "%s/%s", scan_dir_path(scan), name);
+	if (stat(STR(path), &st) < 0)
+	    msg_fatal("stat %s: %m", STR(path));
+	if (st.st_mtime <= now + 1)
+	    due += 1;
+	if (retry)
+	    qmgr_retry_enter(retry, name, st.st_mtime);
+    }
+    scan_dir_close(scan);
+    vstring_free(path);
+    return (due);
+}
+
+/* scan_index - find due files with retry index */
+
+static long scan_index(const char *dir, QMGR_RETRY *retry, time_t now)
+{
+    VSTRING *path = vstring_alloc(100);
+    struct stat st;
+    const char *name;
+    long    due = 0;
+
+    while ((name = qmgr_retry_next(retry, now + 1)) != 0) {
+	vstring_sprintf(path, "%s/deferred/%c/%s", dir, name[0], name);
+	if (stat(STR(path), &st) < 0)
+	    msg_fatal("stat %s: %m", STR(path));
+	if (st.st_mtime <= now + 1)
+	    due += 1;
+    }
+    vstring_free(path);
+    return (due);
+}
+
+/* usage - explain and terminate */
+
+static NORETURN usage(char *myname)
+{
+    msg_fatal("usage: %s [-v] [-n count] [-p percent] directory", myname);
+}
+
+int     main(int argc, char **argv)
+{
+    long    count = 100000;
+    int     percent = 1;
+    struct timeval start;
+    struct stat st;
+    QMGR_RETRY *retry;
+    VSTRING *index;
+    const char *dir;
+    time_t  now;
+    double  secs;
+    long    due;
+    int     ch;
+
+    msg_vstream_init(argv[0], VSTREAM_ERR);
+    while ((ch = GETOPT(argc, argv, "n:p:v")) > 0) {
+	switch (ch) {
+	case 'n':
+	    if ((count = atol(optarg)) <= 0)
+		usage(argv[0]);
+	    break;
+	case 'p':
+	    if ((percent = atoi(optarg)) < 0 || percent > 100)
+		usage(argv[0]);
+	    break;
+	case 'v':
+	    msg_verbose++;
+	    break;
+	default:
+	    usage(argv[0]);
+	}
+    }
+    if (argc != optind + 1)
+	usage(argv[0]);
+    dir = argv[optind];
+    now = time((time_t *) 0);
+    index = vstring_alloc(100);
+    vstring_sprintf(index, "%s/%s", dir, QMGR_RETRY_FILE);
+
+    /*
+     * Populate the queue, or reuse an existing one.
+     */
+    if (stat(dir, &st) < 0) {
+	if (errno != ENOENT)
+	    msg_fatal("stat %s: %m", dir);
+	gettimeofday(&start, (struct timezone *) 0);
+	make_queue(dir, count, percent, now);
+	vstream_printf("create %ld files: %.3f s\n", count, elapsed(&start));
+	vstream_fflush(VSTREAM_OUT);
+    }
+
+    /*
+     * Build the index with a full scan, as the queue manager does when the
+     * index is missing.
+     */
+    retry = qmgr_retry_open(STR(index));
+    qmgr_retry_rebuild(retry, now);
+    gettimeofday(&start, (struct timezone *) 0);
+    (void) scan_queue(dir, now, retry);
+    qmgr_retry_save(retry);
+    vstream_printf("index rebuild: %ld entries %.3f s\n",
+		   (long) retry->len, elapsed(&start));
+    qmgr_retry_close(retry);
+
+    /*
+     * Compare the periodic scans.
+     */
+    gettimeofday(&start, (struct timezone *) 0);
+    due = scan_queue(dir, now, (QMGR_RETRY *) 0);
+    secs = elapsed(&start);
+    vstream_printf("directory scan: %ld due %.3f s\n", due, secs);
+    vstream_fflush(VSTREAM_OUT);
+
+    gettimeofday(&start, (struct timezone *) 0);
+    retry = qmgr_retry_open(STR(index));
+    if (qmgr_retry_stale(retry, now, 3600))
+	msg_fatal("retry index %s is not valid", STR(index));
+    secs = elapsed(&start);
+    vstream_printf("index load:     %ld entries %.3f s\n",
+		   (long) retry->len, secs);
+    gettimeofday(&start, (struct timezone *) 0);
+    due = scan_index(dir, retry, now);
+    secs = elapsed(&start);
+    vstream_printf("index scan:     %ld due %.3f s\n", due, secs);
+    vstream_fflush(VSTREAM_OUT);
+    qmgr_retry_close(retry);
+
+    vstring_free(index);
+    exit(0);
+}
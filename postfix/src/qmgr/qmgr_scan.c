@@ -45,6 +45,15 @@
 /* .IP QMGR_SCAN_START
 /*	Start a queue scan when none is in progress, or restart the
 /*	current scan upon completion.
+/* .IP QMGR_SCAN_INDEX
+/*	Look only at queue files that are due according to the retry
+/*	index (see qmgr_retry(3)), instead of looking at every queue
+/*	file. This flag is ignored when the queue has no retry index,
+/*	with QMGR_SCAN_ALL, and when a scan without QMGR_SCAN_INDEX
+/*	is pending.
+/* .PP
+/*	When a queue has a retry index, a scan without QMGR_SCAN_INDEX
+/*	rebuilds the index from the queue directory.
 /* DIAGNOSTICS
 /*	Fatal: out of memory.
 /*	Panic: interface violations, internal consistency errors.
@@ -68,6 +77,7 @@
 #include <msg.h>
 #include <mymalloc.h>
 #include <scan_dir.h>
+#include <events.h>
 
 /* Global library. */
 
@@ -86,25 +96,62 @@ static void qmgr_scan_start(QMGR_SCAN *scan_info)
     /*
      * Sanity check.
      */
-    if (scan_info->handle)
+    if (QMGR_SCAN_BUSY(scan_info))
 	msg_panic("%s: %s queue scan in progress",
 		  myname, scan_info->queue);
 
+    /*
+     * Look only at files that are due, when there is an index and we don't
+     * need to look at all files anyway.
+     */
+    if (scan_info->retry == 0 || (scan_info->nflags & QMGR_SCAN_ALL))
+	scan_info->nflags &= ~QMGR_SCAN_INDEX;
+
     /*
      * Give the poor tester a clue.
      */
     if (msg_verbose)
-	msg_info("%s: %sstart %s queue scan",
+	msg_info("%s: %sstart %s queue %sscan",
 		 myname,
 		 scan_info->nflags & QMGR_SCAN_START ? "re" : "",
-		 scan_info->queue);
+		 scan_info->queue,
+		 scan_info->nflags & QMGR_SCAN_INDEX ? "index " : "");
 
     /*
-     * Start or restart the scan.
+     * Start or restart the scan. A directory scan rebuilds the index.
      */
     scan_info->flags = scan_info->nflags;
     scan_info->nflags = 0;
-    scan_info->handle = scan_dir_open(scan_info->queue);
+    if (scan_info->flags & QMGR_SCAN_INDEX) {
+	scan_info->due = event_time() + 1;
+    } else {
+	if (scan_info->retry)
+	    qmgr_retry_rebuild(scan_info->retry, event_time());
+	scan_info->handle = scan_dir_open(scan_info->queue);
+    }
+}
+
+/* qmgr_scan_step - look for next queue file in current scan */
+
+static char *qmgr_scan_step(QMGR_SCAN *scan_info)
+{
+    if (scan_info->handle)
+	return (mail_scan_dir_next(scan_info->handle));
+    else
+	return ((char *) qmgr_retry_next(scan_info->retry, scan_info->due));
+}
+
+/* qmgr_scan_done - clean up after scan */
+
+static void qmgr_scan_done(QMGR_SCAN *scan_info)
+{
+    if (scan_info->handle) {
+	scan_info->handle = scan_dir_close(scan_info->handle);
+	if (scan_info->retry)
+	    qmgr_retry_save(scan_info->retry);
+    } else {
+	scan_info->due = 0;
+    }
 }
 
 /* qmgr_scan_request - request for future scan */
@@ -129,21 +176,32 @@ void    qmgr_scan_request(QMGR_SCAN *scan_info, int flags)
      * Apply "ignore time stamp" requests also towards the scan that is
      * already in progress.
      */
-    if (scan_info->handle != 0 && (flags & QMGR_SCAN_ALL))
+    if (QMGR_SCAN_BUSY(scan_info) && (flags & QMGR_SCAN_ALL))
 	scan_info->flags |= QMGR_SCAN_ALL;
 
     /*
      * Apply "override defer_transports" requests also towards the scan that
      * is already in progress.
      */
-    if (scan_info->handle != 0 && (flags & QMGR_FLUSH_DFXP))
+    if (QMGR_SCAN_BUSY(scan_info) && (flags & QMGR_FLUSH_DFXP))
 	scan_info->flags |= QMGR_FLUSH_DFXP;
 
+    /*
+     * A pending request for a full scan wins over a request for an index
+     * scan.
+     */
+    if (flags & QMGR_SCAN_INDEX) {
+	if (scan_info->nflags & QMGR_SCAN_START)
+	    flags &= ~QMGR_SCAN_INDEX;
+    } else if (flags & QMGR_SCAN_START) {
+	scan_info->nflags &= ~QMGR_SCAN_INDEX;
+    }
+
     /*
      * If a scan is in progress, just record the request.
      */
     scan_info->nflags |= flags;
-    if (scan_info->handle == 0 && (flags & QMGR_SCAN_START) != 0) {
+    if (!QMGR_SCAN_BUSY(scan_info) && (flags & QMGR_SCAN_START) != 0) {
 	scan_info->nflags &= ~QMGR_SCAN_START;
 	qmgr_scan_start(scan_info);
     }
@@ -159,14 +217,14 @@ char   *qmgr_scan_next(QMGR_SCAN *scan_info)
      * Restart the scan if we reach the end and a queue scan request has
      * arrived in the mean time.
      */
-    if (scan_info->handle && (path = mail_scan_dir_next(scan_info->handle)) == 0) {
-	scan_info->handle = scan_dir_close(scan_info->handle);
+    if (QMGR_SCAN_BUSY(scan_info) && (path = qmgr_scan_step(scan_info)) == 0) {
+	qmgr_scan_done(scan_info);
 	if (msg_verbose && (scan_info->nflags & QMGR_SCAN_START) == 0)
 	    msg_info("done %s queue scan", scan_info->queue);
     }
-    if (!scan_info->handle && (scan_info->nflags & QMGR_SCAN_START)) {
+    if (!QMGR_SCAN_BUSY(scan_info) && (scan_info->nflags & QMGR_SCAN_START)) {
 	qmgr_scan_start(scan_info);
-	path = mail_scan_dir_next(scan_info->handle);
+	path = qmgr_scan_step(scan_info);
     }
     return (path);
 }
@@ -181,5 +239,7 @@ QMGR_SCAN *qmgr_scan_create(const char *queue)
     scan_info->queue = mystrdup(queue);
     scan_info->flags = scan_info->nflags = 0;
     scan_info->handle = 0;
+    scan_info->retry = 0;
+    scan_info->due = 0;
     return (scan_info);
 }
@@ -0,0 +1,427 @@
+/*++
+/* NAME
+/*	qmgr_shard 3
+/* SUMMARY
+/*	queue manager shards
+/* SYNOPSIS
+/*	#include "qmgr.h"
+/*
+/*	int	qmgr_shard_index;
+/*
+/*	void	qmgr_shard_init(service)
+/*	const char *service;
+/*
+/*	int	qmgr_shard_owns(queue_id)
+/*	const char *queue_id;
+/*
+/*	int	qmgr_shard_slot(transport, queue)
+/*	const char *transport;
+/*	const char *queue;
+/*
+/*	void	qmgr_shard_release(queue)
+/*	QMGR_QUEUE *queue;
+/*
+/*	void	qmgr_shard_busy(queue, delta)
+/*	QMGR_QUEUE *queue;
+/*	int	delta;
+/*
+/*	int	qmgr_shard_active(queue)
+/*	QMGR_QUEUE *queue;
+/*
+/*	int	qmgr_shard_avail(queue)
+/*	QMGR_QUEUE *queue;
+/*
+/*	void	qmgr_shard_done(void)
+/* DESCRIPTION
+/*	With "qmgr_shard_count = N", N queue manager processes share
+/*	the queue. Each queue manager ("shard") handles the queue
+/*	files whose queue ID maps to its shard index (see
+/*	mail_shard(3)), with its own share of the active queue
+/*	message and recipient limits.
+/*
+/*	Per-destination concurrency limits are enforced across shards
+/*	with a table of destinations in shared memory. Each table
+/*	entry has the destination (transport and queue name), and
+/*	one delivery counter per shard; a shard updates only its
+/*	own counter. Entries are found by hashing, and the full
+/*	destination is compared, so that different destinations
+/*	never share a counter. Entries are added and removed under
+/*	an exclusive lock on the table file; updating and reading
+/*	delivery counters requires no lock.
+/*
+/*	To guarantee progress, a shard may always make one delivery
+/*	per destination; with more shards than the concurrency limit
+/*	of a destination, that limit can be exceeded. When the table
+/*	is full, a new destination is limited by this shard only,
+/*	and a warning is logged.
+/*
+/*	qmgr_shard_index is the shard index of this queue manager.
+/*	It is zero when sharding is turned off.
+/*
+/*	qmgr_shard_init() determines the shard index from the master.cf
+/*	service name, opens the shared table, clears this shard's
+/*	counters, and divides the active queue limits by the number
+/*	of shards. This function must be called before entering the
+/*	chroot jail. It does nothing when sharding is turned off.
+/*
+/*	qmgr_shard_owns() returns non-zero when the specified queue
+/*	file belongs to this shard.
+/*
+/*	qmgr_shard_slot() returns the table entry for the specified
+/*	destination, and registers this shard as a user of that
+/*	entry. The result is -1 when sharding is turned off, or when
+/*	the table is full.
+/*
+/*	qmgr_shard_release() unregisters this shard as a user of
+/*	the table entry of the specified queue. The entry can be
+/*	reused for a different destination when it has no users.
+/*
+/*	qmgr_shard_busy() updates this shard's delivery counter for
+/*	the destination of the specified queue.
+/*
+/*	qmgr_shard_active() returns the number of deliveries in
+/*	progress for the destination of the specified queue, by
+/*	this shard and by all other shards.
+/*
+/*	qmgr_shard_avail() returns the number of deliveries that can
+/*	be added to the specified queue, taking into account the
+/*	concurrency window of the queue, and the deliveries by other
+/*	shards. The result is zero or negative when no delivery can
+/*	be added.
+/*
+/*	qmgr_shard_done() clears this shard's counters and table
+/*	entry registrations. This is called before the queue manager
+/*	terminates.
+/* DIAGNOSTICS
+/*	Fatal: the service name does not specify a valid shard; the
+/*	shared table cannot be created or locked.
+/* SEE ALSO
+/*	mail_shard(3), queue manager shard support
+/* LICENSE
+/* .ad
+/* .fi
+/*	The Secure Mailer license must be distributed with this software.
+/* AUTHOR(S)
+/*	agent
+/*	agent@local
+/*--*/
+
+/* System library. */
+
+#include <sys_defs.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <string.h>
+
+/* Utility library. */
+
+#include <msg.h>
+#include <vstring.h>
+#include <iostuff.h>
+#include <myflock.h>
+
+/* Global library. */
+
+#include <mail_params.h>
+#include <mail_shard.h>
+
+/* Application-specific. */
+
+#include "qmgr.h"
+
+int     qmgr_shard_index;
+
+ /*
+  * The shared table. Each entry has a fixed-size key with the transport
+  * name, a null byte, and the queue name. A longer key is stored truncated,
+  * and is compared by its length, hash value and stored prefix. An entry
+  * with a zero hash value was never used; an entry without users can be
+  * reused for a different destination. The layout does not depend on the
+  * number of shards, so that it does not change when shards are added.
+  */
+#define QMGR_SHARD_SLOTS	4096
+#define QMGR_SHARD_KEY_SIZE	256
+
+typedef struct {
+    unsigned hash;			/* key hash, never zero */
+    int     key_len;			/* full key length */
+    int     users;			/* number of shards that use this */
+    volatile int busy[MAX_QMGR_SHARD_COUNT];	/* deliveries per shard */
+    unsigned char used[MAX_QMGR_SHARD_COUNT];	/* shard uses this */
+    char    key[QMGR_SHARD_KEY_SIZE];	/* truncated key */
+} QMGR_SHARD_SLOT;
+
+#define QMGR_SHARD_TABLE_SIZE	(QMGR_SHARD_SLOTS * sizeof(QMGR_SHARD_SLOT))
+
+static QMGR_SHARD_SLOT *qmgr_shard_table;
+static int qmgr_shard_fd = -1;
+static VSTRING *qmgr_shard_key;
+
+#define QMGR_SHARD_LOCK() do { \
+	if (myflock(qmgr_shard_fd, INTERNAL_LOCK, MYFLOCK_OP_EXCLUSIVE) < 0) \
+	    msg_fatal("lock %s: %m", QMGR_SHARD_FILE); \
+    } while (0)
+
+#define QMGR_SHARD_UNLOCK() do { \
+	if (myflock(qmgr_shard_fd, INTERNAL_LOCK, MYFLOCK_OP_NONE) < 0) \
+	    msg_fatal("unlock %s: %m", QMGR_SHARD_FILE); \
+    } while (0)
+
+/* qmgr_shard_clear - clear delivery counters and registrations */
+
+static void qmgr_shard_clear(int first, int last)
+{
+    QMGR_SHARD_SLOT *sp;
+    int     row;
+
+    QMGR_SHARD_LOCK();
+    for (sp = qmgr_shard_table; sp < qmgr_shard_table + QMGR_SHARD_SLOTS; sp++) {
+	if (sp->hash == 0)
+	    continue;
+	for (row = first; row < last; row++) {
+	    sp->busy[row] = 0;
+	    if (sp->used[row]) {
+		sp->used[row] = 0;
+		sp->users -= 1;
+	    }
+	}
+    }
+    QMGR_SHARD_UNLOCK();
+}
+
+/* qmgr_shard_init - initialize this shard */
+
+void    qmgr_shard_init(const char *service)
+{
+    VSTRING *path;
+    struct stat st;
+    void   *table;
+
+    if (var_qmgr_shard_count <= 1)
+	return;
+
+    /*
+     * The service name determines the shard index. A shard that is outside
+     * the configured range would leave its mail alone.
+     */
+    if ((qmgr_shard_index = mail_shard_parse(var_queue_service, service)) < 0)
+	msg_fatal("service name \"%s\" is not \"%s\" or \"%s-number\"",
+		  service, var_queue_service, var_queue_service);
+    if (qmgr_shard_index >= var_qmgr_shard_count)
+	msg_fatal("service name \"%s\": shard %d is out of range for %s = %d",
+		  service, qmgr_shard_index, VAR_QMGR_SHARD_COUNT,
+		  var_qmgr_shard_count);
+
+    /*
+     * Concurrent shards may grow the file at the same time. That is
+     * harmless, because ftruncate() does not change the content of a file
+     * that is already large enough. The file stays open, because it is
+     * also used for locking.
+     */
+    path = vstring_alloc(100);
+    vstring_sprintf(path, "%s/%s", var_data_dir, QMGR_SHARD_FILE);
+    if ((qmgr_shard_fd = open(vstring_str(path), O_RDWR | O_CREAT, 0600)) < 0)
+	msg_fatal("open %s: %m", vstring_str(path));
+    if (fstat(qmgr_shard_fd, &st) < 0)
+	msg_fatal("fstat %s: %m", vstring_str(path));
+    if (st.st_size < (off_t) QMGR_SHARD_TABLE_SIZE
+	&& ftruncate(qmgr_shard_fd, QMGR_SHARD_TABLE_SIZE) < 0)
+	msg_fatal("truncate %s: %m", vstring_str(path));
+    if ((table = mmap((void *) 0, QMGR_SHARD_TABLE_SIZE,
+		      PROT_READ | PROT_WRITE, MAP_SHARED,
+		      qmgr_shard_fd, (off_t) 0)) == MAP_FAILED)
+	msg_fatal("mmap %s: %m", vstring_str(path));
+    close_on_exec(qmgr_shard_fd, CLOSE_ON_EXEC);
+    vstring_free(path);
+    qmgr_shard_table = (QMGR_SHARD_SLOT *) table;
+    qmgr_shard_key = vstring_alloc(100);
+
+    /*
+     * Forget counters and registrations from an earlier instance of this
+     * shard that did not terminate cleanly, and from shards that no longer
+     * exist.
+     */
+    qmgr_shard_clear(qmgr_shard_index, qmgr_shard_index + 1);
+    qmgr_shard_clear(var_qmgr_shard_count, MAX_QMGR_SHARD_COUNT);
+
+    /*
+     * Each shard gets its share of the active queue.
+     */
+#define QMGR_SHARD_SHARE(x) \
+	((x) = ((x) + var_qmgr_shard_count - 1) / var_qmgr_shard_count)
+
+    QMGR_SHARD_SHARE(var_qmgr_active_limit);
+    QMGR_SHARD_SHARE(var_qmgr_rcpt_limit);
+    msg_info("shard %d of %d", qmgr_shard_index, var_qmgr_shard_count);
+}
+
+/* qmgr_shard_owns - does this queue file belong to us */
+
+int     qmgr_shard_owns(const char *queue_id)
+{
+    return (var_qmgr_shard_count <= 1
+	    || mail_shard_index(queue_id) == qmgr_shard_index);
+}
+
+/* qmgr_shard_match - compare table entry with key */
+
+static int qmgr_shard_match(QMGR_SHARD_SLOT *sp, unsigned hash,
+			            const char *key, ssize_t key_len)
+{
+    ssize_t cmp_len;
+
+    if (sp->hash != hash || sp->key_len != key_len)
+	return (0);
+    cmp_len = (key_len < QMGR_SHARD_KEY_SIZE ? key_len : QMGR_SHARD_KEY_SIZE);
+    return (memcmp(sp->key, key, cmp_len) == 0);
+}
+
+/* qmgr_shard_slot - find or add table entry for destination */
+
+int     qmgr_shard_slot(const char *transport, const char *queue)
+{
+    const char *myname = "qmgr_shard_slot";
+    static int warned;
+    QMGR_SHARD_SLOT *sp;
+    unsigned long hash = 2166136261UL;
+    const unsigned char *cp;
+    const char *key;
+    ssize_t key_len;
+    int     free_slot = -1;
+    int     slot;
+    int     n;
+
+    if (qmgr_shard_table == 0)
+	return (-1);
+
+    /*
+     * The key is the transport name, a null byte, and the queue name. The
+     * hash value is never zero, because zero means an unused entry.
+     */
+    vstring_strcpy(qmgr_shard_key, transport);
+    VSTRING_ADDCH(qmgr_shard_key, 0);
+    vstring_strcat(qmgr_shard_key, queue);
+    key = vstring_str(qmgr_shard_key);
+    key_len = VSTRING_LEN(qmgr_shard_key);
+    for (cp = (const unsigned char *) key; cp < (const unsigned char *) key
+	 + key_len; cp++)
+	hash = ((hash ^ *cp) * 16777619UL) & 0xffffffffUL;
+    if (hash == 0)
+	hash = 1;
+
+    /*
+     * Linear probing. Look for an existing entry until we find an entry that
+     * was never used. Remember the first entry without users, so that we
+     * can reuse it when the destination is not in the table.
+     */
+    QMGR_SHARD_LOCK();
+    for (slot = hash % QMGR_SHARD_SLOTS, n = 0; n < QMGR_SHARD_SLOTS;
+	 slot = (slot + 1) % QMGR_SHARD_SLOTS, n++) {
+	sp = qmgr_shard_table + slot;
+	if (sp->hash == 0) {
+	    if (free_slot < 0)
+		free_slot = slot;
+	    break;
+	}
+	if (qmgr_shard_match(sp, hash, key, key_len))
+	    break;
+	if (sp->users == 0 && free_slot < 0)
+	    free_slot = slot;
+    }
+    if (n < QMGR_SHARD_SLOTS && sp->hash != 0) {
+	/* Existing entry. */
+    } else if (free_slot >= 0) {
+	slot = free_slot;
+	sp = qmgr_shard_table + slot;
+	if (sp->users != 0)
+	    msg_panic("%s: reusing entry %d with %d users",
+		      myname, slot, sp->users);
+	memset((void *) sp, 0, sizeof(*sp));
+	memcpy(sp->key, key, key_len < QMGR_SHARD_KEY_SIZE ?
+	       key_len : QMGR_SHARD_KEY_SIZE);
+	sp->key_len = key_len;
+	sp->hash = hash;
+    } else {
+	QMGR_SHARD_UNLOCK();
+	if (warned++ == 0)
+	    msg_warn("%s is full: the concurrency limit for %s:%s is not "
+		     "enforced across shards", QMGR_SHARD_FILE, transport, queue);
+	return (-1);
+    }
+    if (sp->used[qmgr_shard_index] == 0) {
+	sp->used[qmgr_shard_index] = 1;
+	sp->users += 1;
+    }
+    sp->busy[qmgr_shard_index] = 0;
+    QMGR_SHARD_UNLOCK();
+    return (slot);
+}
+
+/* qmgr_shard_release - stop using table entry */
+
+void    qmgr_shard_release(QMGR_QUEUE *queue)
+{
+    QMGR_SHARD_SLOT *sp;
+
+    if (qmgr_shard_table == 0 || queue->shard_slot < 0)
+	return;
+    sp = qmgr_shard_table + queue->shard_slot;
+    QMGR_SHARD_LOCK();
+    sp->busy[qmgr_shard_index] = 0;
+    if (sp->used[qmgr_shard_index]) {
+	sp->used[qmgr_shard_index] = 0;
+	sp->users -= 1;
+    }
+    QMGR_SHARD_UNLOCK();
+    queue->shard_slot = -1;
+}
+
+/* qmgr_shard_busy - update our delivery counter */
+
+void    qmgr_shard_busy(QMGR_QUEUE *queue, int delta)
+{
+    if (qmgr_shard_table && queue->shard_slot >= 0)
+	qmgr_shard_table[queue->shard_slot].busy[qmgr_shard_index] += delta;
+}
+
+/* qmgr_shard_active - deliveries by all shards */
+
+int     qmgr_shard_active(QMGR_QUEUE *queue)
+{
+    QMGR_SHARD_SLOT *sp;
+    int     active = queue->busy_refcount;
+    int     row;
+
+    if (qmgr_shard_table && queue->shard_slot >= 0) {
+	sp = qmgr_shard_table + queue->shard_slot;
+	for (row = 0; row < var_qmgr_shard_count; row++)
+	    if (row != qmgr_shard_index)
+		active += sp->busy[row];
+    }
+    return (active);
+}
+
+/* qmgr_shard_avail - room for more deliveries */
+
+int     qmgr_shard_avail(QMGR_QUEUE *queue)
+{
+    int     limit = queue->transport->dest_concurrency_limit;
+    int     avail = queue->window - queue->busy_refcount;
+    int     room;
+
+    if (qmgr_shard_table == 0 || queue->shard_slot < 0 || avail <= 0
+	|| limit == 0 || queue->busy_refcount == 0)
+	return (avail);
+    room = limit - qmgr_shard_active(queue);
+    return (room < avail ? room : avail);
+}
+
+/* qmgr_shard_done - clear our delivery counters and registrations */
+
+void    qmgr_shard_done(void)
+{
+    if (qmgr_shard_table)
+	qmgr_shard_clear(qmgr_shard_index, qmgr_shard_index + 1);
+}
@@ -0,0 +1,298 @@
+/*++
+/* NAME
+/*	qmgr_snapshot 3
+/* SUMMARY
+/*	active queue snapshot
+/* SYNOPSIS
+/*	#include "qmgr.h"
+/*
+/*	void	qmgr_snapshot_open(path)
+/*	const char *path;
+/*
+/*	int	qmgr_snapshot_find(queue_id)
+/*	const char *queue_id;
+/*
+/*	const char *qmgr_snapshot_next(void)
+/*
+/*	void	qmgr_snapshot_save(void)
+/* DESCRIPTION
+/*	This module saves the list of in-core messages when the queue
+/*	manager terminates normally, so that the next queue manager
+/*	can reload those messages directly from the active queue, in
+/*	the same order. Without a snapshot, the queue manager moves
+/*	every active queue file to the incoming queue, and moves it
+/*	back one file at a time as the incoming queue is scanned.
+/*
+/*	The snapshot is a list of queue IDs. The queue files remain
+/*	the authority for message content and recipient delivery
+/*	status. A snapshot is used once: it is discarded after it is
+/*	loaded, so that a queue manager that terminates abnormally
+/*	leaves no snapshot behind. A snapshot that is damaged or
+/*	incomplete, or that was saved with a different shard layout,
+/*	is ignored, and all active queue files take the normal
+/*	recovery path.
+/*
+/*	qmgr_snapshot_open() opens or creates the named snapshot file,
+/*	reads its content into memory, and truncates the file. This
+/*	function should be called before the process enters the chroot
+/*	jail. The file is kept open for qmgr_snapshot_save().
+/*
+/*	qmgr_snapshot_find() returns non-zero when the specified queue
+/*	file is listed in the snapshot and has not yet been reloaded.
+/*
+/*	qmgr_snapshot_next() returns the queue ID of the next queue
+/*	file to reload, or a null pointer when the snapshot is exhausted.
+/*	The result is overwritten upon the next call.
+/*
+/*	qmgr_snapshot_save() writes the queue IDs of all in-core
+/*	messages, followed by the queue IDs from the loaded snapshot
+/*	that have not yet been reloaded, to the snapshot file. This
+/*	function does nothing when qmgr_snapshot_open() was not called.
+/* DIAGNOSTICS
+/*	Warnings: snapshot file corruption, snapshot file read or
+/*	write errors. Fatal: the snapshot file cannot be opened.
+/* SEE ALSO
+/*	qmgr_active(3), active queue management
+/*	qmgr_move(3), move queue files
+/* LICENSE
+/* .ad
+/* .fi
+/*	The Secure Mailer license must be distributed with this software.
+/* AUTHOR(S)
+/*	agent
+/*	agent@local
+/*--*/
+
+/* System library. */
+
+#include <sys_defs.h>
+#include <stdio.h>			/* sscanf() */
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+
+/* Utility library. */
+
+#include <msg.h>
+#include <mymalloc.h>
+#include <vstream.h>
+#include <vstring.h>
+#include <vstring_vstream.h>
+#include <argv.h>
+#include <htable.h>
+
+/* Global library. */
+
+#include <mail_params.h>
+#include <mail_queue.h>
+
+/* Application-specific. */
+
+#include "qmgr.h"
+
+ /*
+  * The snapshot file starts with a header line with the file format
+  * version, the time of the snapshot, the shard index and shard count, and
+  * the number of entries. The header is followed by one queue ID per line.
+  */
+#define QMGR_SNAPSHOT_MAGIC	"qmgr_snapshot_1"
+
+#define STR(x)	vstring_str(x)
+
+static char *qmgr_snapshot_path;
+static VSTREAM *qmgr_snapshot_fp;
+static ARGV *qmgr_snapshot_list;
+static HTABLE *qmgr_snapshot_table;
+static ssize_t qmgr_snapshot_pos;
+
+/* qmgr_snapshot_purge - discard in-memory snapshot */
+
+static void qmgr_snapshot_purge(void)
+{
+    if (qmgr_snapshot_list) {
+	argv_free(qmgr_snapshot_list);
+	qmgr_snapshot_list = 0;
+    }
+    if (qmgr_snapshot_table) {
+	htable_free(qmgr_snapshot_table, (void (*) (void *)) 0);
+	qmgr_snapshot_table = 0;
+    }
+    qmgr_snapshot_pos = 0;
+}
+
+/* qmgr_snapshot_truncate - truncate snapshot file */
+
+static void qmgr_snapshot_truncate(void)
+{
+    if (vstream_fseek(qmgr_snapshot_fp, (off_t) 0, SEEK_SET) < 0
+	|| ftruncate(vstream_fileno(qmgr_snapshot_fp), (off_t) 0) < 0)
+	msg_warn("truncate active queue snapshot %s: %m", qmgr_snapshot_path);
+}
+
+/* qmgr_snapshot_load - read snapshot file into memory */
+
+static void qmgr_snapshot_load(void)
+{
+    VSTRING *buf = vstring_alloc(100);
+    char    magic[sizeof(QMGR_SNAPSHOT_MAGIC) + 1];
+    long    when;
+    int     shard_index;
+    int     shard_count;
+    long    count;
+    int     ch;
+
+    /*
+     * An empty file means that the previous queue manager did not terminate
+     * normally, or that the feature was just turned on. That is not an
+     * error.
+     */
+    if (vstring_get_nonl(buf, qmgr_snapshot_fp) == VSTREAM_EOF) {
+	if (msg_verbose)
+	    msg_info("active queue snapshot %s is empty", qmgr_snapshot_path);
+	vstring_free(buf);
+	return;
+    }
+    if (sscanf(STR(buf), "%16s %ld %d %d %ld", magic, &when, &shard_index,
+	       &shard_count, &count) != 5
+	|| strcmp(magic, QMGR_SNAPSHOT_MAGIC) != 0 || count < 0) {
+	msg_warn("active queue snapshot %s: bad header -- ignoring snapshot",
+		 qmgr_snapshot_path);
+	vstring_free(buf);
+	return;
+    }
+    if (shard_index != qmgr_shard_index
+	|| shard_count != var_qmgr_shard_count) {
+	msg_info("active queue snapshot %s: shard layout has changed "
+		 "-- ignoring snapshot", qmgr_snapshot_path);
+	vstring_free(buf);
+	return;
+    }
+
+    /*
+     * A missing or partial last line means that the previous queue manager
+     * was terminated while it was saving the snapshot.
+     */
+    qmgr_snapshot_list = argv_alloc(count > 0 ? count : 1);
+    while ((ch = vstring_get(buf, qmgr_snapshot_fp)) == '\n') {
+	vstring_truncate(buf, VSTRING_LEN(buf) - 1);
+	VSTRING_TERMINATE(buf);
+	if (!mail_queue_id_ok(STR(buf))) {
+	    msg_warn("active queue snapshot %s: bad entry at line %ld "
+		     "-- ignoring snapshot", qmgr_snapshot_path,
+		     (long) qmgr_snapshot_list->argc + 2);
+	    qmgr_snapshot_purge();
+	    vstring_free(buf);
+	    return;
+	}
+	argv_add(qmgr_snapshot_list, STR(buf), ARGV_END);
+    }
+    if (vstream_ferror(qmgr_snapshot_fp) || ch != VSTREAM_EOF
+	|| qmgr_snapshot_list->argc != count) {
+	msg_warn("active queue snapshot %s: expected %ld entries, found %ld "
+		 "-- ignoring snapshot", qmgr_snapshot_path, count,
+		 (long) qmgr_snapshot_list->argc);
+	qmgr_snapshot_purge();
+	vstring_free(buf);
+	return;
+    }
+    vstring_free(buf);
+
+    /*
+     * Index the entries for qmgr_snapshot_find().
+     */
+    qmgr_snapshot_table = htable_create(qmgr_snapshot_list->argc);
+    for (count = 0; count < qmgr_snapshot_list->argc; count++)
+	if (htable_locate(qmgr_snapshot_table,
+			  qmgr_snapshot_list->argv[count]) == 0)
+	    (void) htable_enter(qmgr_snapshot_table,
+				qmgr_snapshot_list->argv[count], (void *) 0);
+    msg_info("active queue snapshot: %ld messages from %ld seconds ago",
+	     (long) qmgr_snapshot_list->argc, (long) (time((time_t *) 0) - when));
+}
+
+/* qmgr_snapshot_open - open snapshot file, and load snapshot */
+
+void    qmgr_snapshot_open(const char *path)
+{
+    qmgr_snapshot_path = mystrdup(path);
+    if ((qmgr_snapshot_fp = vstream_fopen(path, O_RDWR | O_CREAT, 0600)) == 0)
+	msg_fatal("open active queue snapshot %s: %m", path);
+    qmgr_snapshot_load();
+
+    /*
+     * Use a snapshot only once.
+     */
+    qmgr_snapshot_truncate();
+}
+
+/* qmgr_snapshot_find - look up snapshot entry */
+
+int     qmgr_snapshot_find(const char *queue_id)
+{
+    return (qmgr_snapshot_table != 0
+	    && htable_locate(qmgr_snapshot_table, queue_id) != 0);
+}
+
+/* qmgr_snapshot_next - next snapshot entry */
+
+const char *qmgr_snapshot_next(void)
+{
+    static VSTRING *queue_id;
+    const char *id;
+
+    if (qmgr_snapshot_list == 0)
+	return (0);
+    if (qmgr_snapshot_pos >= qmgr_snapshot_list->argc) {
+	qmgr_snapshot_purge();
+	return (0);
+    }
+    if (queue_id == 0)
+	queue_id = vstring_alloc(30);
+    id = qmgr_snapshot_list->argv[qmgr_snapshot_pos++];
+    vstring_strcpy(queue_id, id);
+    if (htable_locate(qmgr_snapshot_table, id) != 0)
+	htable_delete(qmgr_snapshot_table, id, (void (*) (void *)) 0);
+    return (STR(queue_id));
+}
+
+/* qmgr_snapshot_save - write snapshot file */
+
+void    qmgr_snapshot_save(void)
+{
+    QMGR_MESSAGE *message;
+    ssize_t pos;
+    long    count;
+
+    if (qmgr_snapshot_fp == 0)
+	return;
+
+    /*
+     * Messages that are in core come first, because they were first in the
+     * active queue.
+     */
+    count = qmgr_message_count;
+    if (qmgr_snapshot_list)
+	count += qmgr_snapshot_list->argc - qmgr_snapshot_pos;
+    qmgr_snapshot_truncate();
+    vstream_fprintf(qmgr_snapshot_fp, "%s %ld %d %d %ld\n",
+		    QMGR_SNAPSHOT_MAGIC, (long) time((time_t *) 0),
+		    qmgr_shard_index, var_qmgr_shard_count, count);
+    for (message = qmgr_message_list.next; message;
+	 message = message->active_peers.next)
+	vstream_fprintf(qmgr_snapshot_fp, "%s\n", message->queue_id);
+    if (qmgr_snapshot_list)
+	for (pos = qmgr_snapshot_pos; pos < qmgr_snapshot_list->argc; pos++)
+	    vstream_fprintf(qmgr_snapshot_fp, "%s\n",
+			    qmgr_snapshot_list->argv[pos]);
+
+    /*
+     * After a write error, leave the file empty.
+     */
+    if (vstream_fflush(qmgr_snapshot_fp) != 0
+	|| fsync(vstream_fileno(qmgr_snapshot_fp)) < 0) {
+	msg_warn("write active queue snapshot %s: %m", qmgr_snapshot_path);
+	qmgr_snapshot_truncate();
+	return;
+    }
+    msg_info("active queue snapshot: saved %ld messages", count);
+}
@@ -0,0 +1,382 @@
+/*++
+/* NAME
+/*	qmgr_status 3
+/* SUMMARY
+/*	report scheduler status
+/* SYNOPSIS
+/*	#include "qmgr.h"
+/*
+/*	void	qmgr_status_init(service)
+/*	const char *service;
+/* DESCRIPTION
+/*	This module reports the in-core state of the queue manager
+/*	to local clients such as "postqueue -S". The report is a
+/*	snapshot of active queue counters, transports, destination
+/*	queues, message priority lanes, and message jobs. It is
+/*	formatted as JSON LINES: one JSON object per line, with a
+/*	"type" member that specifies the kind of object (summary,
+/*	transport, lane, queue, or job).
+/*
+/*	qmgr_status_init() creates a listening socket with the
+/*	specified name in the public queue directory. Each client
+/*	receives one report and is then disconnected; the queue
+/*	manager does not read client input. The report is formatted
+/*	in memory and written without blocking, so that a slow client
+/*	cannot stall the queue manager. A client that does not take
+/*	the report within QMGR_STATUS_TIMEOUT seconds is disconnected.
+/*
+/*	At most QMGR_STATUS_MAX_JOBS jobs are reported per transport;
+/*	the transport object reports the total number of jobs.
+/* DIAGNOSTICS
+/*	Warnings: too many clients, write errors. Fatal: cannot
+/*	create the listening socket.
+/* SEE ALSO
+/*	postqueue(1), Postfix queue control
+/* LICENSE
+/* .ad
+/* .fi
+/*	The Secure Mailer license must be distributed with this software.
+/* AUTHOR(S)
+/*	agent
+/*	agent@local
+/*--*/
+
+/* System library. */
+
+#include <sys_defs.h>
+#include <unistd.h>
+#include <errno.h>
+
+/* Utility library. */
+
+#include <msg.h>
+#include <mymalloc.h>
+#include <vstring.h>
+#include <stringops.h>
+#include <listen.h>
+#include <iostuff.h>
+#include <events.h>
+
+/* Global library. */
+
+#include <mail_proto.h>
+#include <mail_params.h>
+
+/* Application-specific. */
+
+#include "qmgr.h"
+
+ /*
+  * Resource limits.
+  */
+#define QMGR_STATUS_MAX_CLIENTS	4	/* concurrent clients */
+#define QMGR_STATUS_MAX_JOBS	1000	/* jobs per transport */
+#define QMGR_STATUS_TIMEOUT	10	/* seconds */
+
+typedef struct {
+    int     fd;				/* client connection */
+    VSTRING *buf;			/* report */
+    ssize_t offset;			/* bytes written */
+} QMGR_STATUS_CLIENT;
+
+static int qmgr_status_clients;
+
+#define STR(x)	vstring_str(x)
+#define LEN(x)	VSTRING_LEN(x)
+
+ /*
+  * JSON formatting helpers. Each object starts with its type.
+  */
+#define QMGR_STATUS_OPEN(buf, type) \
+	vstring_sprintf_append((buf), "{\"type\":\"%s\"", (type))
+#define QMGR_STATUS_CLOSE(buf) \
+	vstring_strcat((buf), "}\n")
+#define QMGR_STATUS_LONG(buf, name, val) \
+	vstring_sprintf_append((buf), ",\"%s\":%ld", (name), (long) (val))
+#define QMGR_STATUS_DOUBLE(buf, name, val) \
+	vstring_sprintf_append((buf), ",\"%s\":%.2f", (name), (double) (val))
+#define QMGR_STATUS_BOOL(buf, name, val) \
+	vstring_sprintf_append((buf), ",\"%s\":%s", (name), \
+			       (val) ? "true" : "false")
+
+/* qmgr_status_str - append string member */
+
+static void qmgr_status_str(VSTRING *buf, const char *name, const char *val)
+{
+    vstring_sprintf_append(buf, ",\"%s\":\"", name);
+    quote_for_json_append(buf, val, -1);
+    VSTRING_ADDCH(buf, '"');
+    VSTRING_TERMINATE(buf);
+}
+
+/* qmgr_status_summary - report global counters */
+
+static void qmgr_status_summary(VSTRING *buf)
+{
+    QMGR_STATUS_OPEN(buf, "summary");
+    QMGR_STATUS_LONG(buf, "time", event_time());
+    QMGR_STATUS_LONG(buf, "shard", qmgr_shard_index);
+    QMGR_STATUS_LONG(buf, "shards", var_qmgr_shard_count);
+    QMGR_STATUS_LONG(buf, "messages", qmgr_message_count);
+    QMGR_STATUS_LONG(buf, "message_limit", var_qmgr_active_limit);
+    QMGR_STATUS_LONG(buf, "recipients", qmgr_recipient_count);
+    QMGR_STATUS_LONG(buf, "recipient_limit", var_qmgr_rcpt_limit);
+    QMGR_STATUS_LONG(buf, "queues", qmgr_queue_count);
+    QMGR_STATUS_LONG(buf, "verify_pending", qmgr_vrfy_pend_count);
+    QMGR_STATUS_LONG(buf, "recipient_string_bytes",
+		     qmgr_rcpt_stats.curr_bytes);
+    QMGR_STATUS_CLOSE(buf);
+}
+
+/* qmgr_status_transport - report one transport */
+
+static void qmgr_status_transport(VSTRING *buf, QMGR_TRANSPORT *transport)
+{
+    QMGR_QUEUE *queue;
+    QMGR_JOB *job;
+    int     queue_count = 0;
+    int     job_count = 0;
+
+    for (queue = transport->queue_list.next; queue; queue = queue->peers.next)
+	queue_count++;
+    for (job = transport->job_list.next; job; job = job->transport_peers.next)
+	job_count++;
+
+    QMGR_STATUS_OPEN(buf, "transport");
+    qmgr_status_str(buf, "transport", transport->name);
+    qmgr_status_str(buf, "status", QMGR_TRANSPORT_THROTTLED(transport) ?
+		    "throttled" : "ready");
+    if (transport->dsn)
+	qmgr_status_str(buf, "reason", transport->dsn->reason);
+    QMGR_STATUS_LONG(buf, "pending", transport->pending);
+    QMGR_STATUS_LONG(buf, "dest_concurrency_limit",
+		     transport->dest_concurrency_limit);
+    QMGR_STATUS_LONG(buf, "init_dest_concurrency",
+		     transport->init_dest_concurrency);
+    QMGR_STATUS_LONG(buf, "recipient_limit", transport->recipient_limit);
+    QMGR_STATUS_LONG(buf, "recipient_slots_unused", transport->rcpt_unused);
+    QMGR_STATUS_LONG(buf, "rate_delay", transport->rate_delay);
+    if (transport->batch_limit > 1)
+	QMGR_STATUS_LONG(buf, "batch_limit", transport->batch_limit);
+    if (transport->dest_rate_limit > 0) {
+	QMGR_STATUS_DOUBLE(buf, "dest_rate_limit", transport->dest_rate_limit);
+	QMGR_STATUS_LONG(buf, "dest_rate_burst", transport->dest_rate_burst);
+    }
+    if (transport->xport_rate.limit > 0) {
+	QMGR_STATUS_DOUBLE(buf, "rate_limit", transport->xport_rate.limit);
+	QMGR_STATUS_LONG(buf, "rate_burst", transport->xport_rate.burst);
+	QMGR_STATUS_DOUBLE(buf, "rate_tokens",
+			   qmgr_rate_tokens(&transport->xport_rate));
+	QMGR_STATUS_LONG(buf, "rate_waits", transport->xport_rate.waits);
+    }
+    QMGR_STATUS_DOUBLE(buf, "positive_feedback", transport->pos_feedback.base);
+    QMGR_STATUS_DOUBLE(buf, "negative_feedback", transport->neg_feedback.base);
+    QMGR_STATUS_LONG(buf, "fail_cohort_limit", transport->fail_cohort_limit);
+    QMGR_STATUS_LONG(buf, "queues", queue_count);
+    QMGR_STATUS_LONG(buf, "jobs", job_count);
+    if (transport->job_current)
+	qmgr_status_str(buf, "current_job",
+			transport->job_current->message->queue_id);
+    qmgr_status_str(buf, "lane_mode",
+		    transport->lane_mode == QMGR_LANE_MODE_WEIGHTED ?
+		    PRIO_LANE_MODE_WEIGHTED : PRIO_LANE_MODE_STRICT);
+    QMGR_STATUS_CLOSE(buf);
+}
+
+/* qmgr_status_lane - report one message priority lane */
+
+static void qmgr_status_lane(VSTRING *buf, QMGR_TRANSPORT *transport,
+			             int which)
+{
+    QMGR_LANE *lane = transport->lanes + which;
+    int     n;
+
+    QMGR_STATUS_OPEN(buf, "lane");
+    qmgr_status_str(buf, "transport", transport->name);
+    qmgr_status_str(buf, "priority", mail_priority_to_string(which));
+    if (transport->lane_mode == QMGR_LANE_MODE_WEIGHTED) {
+	QMGR_STATUS_LONG(buf, "weight", lane->weight);
+	QMGR_STATUS_LONG(buf, "credit", lane->credit);
+    }
+    QMGR_STATUS_LONG(buf, "jobs", lane->job_count);
+    QMGR_STATUS_LONG(buf, "selected", lane->selected);
+    QMGR_STATUS_LONG(buf, "completed", lane->completed);
+    QMGR_STATUS_DOUBLE(buf, "delay_avg", lane->completed ?
+		       lane->delay_total / lane->completed : 0);
+    QMGR_STATUS_LONG(buf, "delay_max", lane->delay_max);
+    vstring_strcat(buf, ",\"delay_histogram\":[");
+    for (n = 0; n < QMGR_LANE_HIST_SIZE; n++)
+	vstring_sprintf_append(buf, "%s%ld", n ? "," : "", lane->delay_hist[n]);
+    vstring_strcat(buf, "]");
+    QMGR_STATUS_CLOSE(buf);
+}
+
+/* qmgr_status_queue - report one destination queue */
+
+static void qmgr_status_queue(VSTRING *buf, QMGR_QUEUE *queue)
+{
+    QMGR_STATUS_OPEN(buf, "queue");
+    qmgr_status_str(buf, "transport", queue->transport->name);
+    qmgr_status_str(buf, "queue", queue->name);
+    qmgr_status_str(buf, "nexthop", queue->nexthop);
+    qmgr_status_str(buf, "status", QMGR_QUEUE_STATUS(queue));
+    if (queue->dsn)
+	qmgr_status_str(buf, "reason", queue->dsn->reason);
+    QMGR_STATUS_LONG(buf, "window", queue->window);
+    QMGR_STATUS_LONG(buf, "active", queue->busy_refcount);
+    QMGR_STATUS_LONG(buf, "pending", queue->todo_refcount);
+    if (var_qmgr_shard_count > 1)
+	QMGR_STATUS_LONG(buf, "active_all_shards", qmgr_shard_active(queue));
+    QMGR_STATUS_DOUBLE(buf, "success", queue->success);
+    QMGR_STATUS_DOUBLE(buf, "failure", queue->failure);
+    QMGR_STATUS_DOUBLE(buf, "fail_cohorts", queue->fail_cohorts);
+    if (queue->transport->feedback_mode == QMGR_FEEDBACK_MODE_LATENCY) {
+	QMGR_STATUS_DOUBLE(buf, "latency", queue->latency.avg);
+	QMGR_STATUS_DOUBLE(buf, "base_latency", queue->latency.base);
+	QMGR_STATUS_LONG(buf, "rate_delay", queue->latency.delay);
+    }
+    if (queue->rate.limit > 0) {
+	QMGR_STATUS_DOUBLE(buf, "rate_tokens", qmgr_rate_tokens(&queue->rate));
+	QMGR_STATUS_LONG(buf, "rate_waits", queue->rate.waits);
+    }
+    QMGR_STATUS_CLOSE(buf);
+}
+
+/* qmgr_status_job - report one message job */
+
+static void qmgr_status_job(VSTRING *buf, QMGR_JOB *job)
+{
+    QMGR_MESSAGE *message = job->message;
+
+    QMGR_STATUS_OPEN(buf, "job");
+    qmgr_status_str(buf, "transport", job->transport->name);
+    qmgr_status_str(buf, "queue_id", message->queue_id);
+    QMGR_STATUS_BOOL(buf, "current", job == job->transport->job_current);
+    qmgr_status_str(buf, "priority", mail_priority_to_string(message->priority));
+    QMGR_STATUS_LONG(buf, "stack_level", job->stack_level);
+    QMGR_STATUS_LONG(buf, "slots_used", job->slots_used);
+    QMGR_STATUS_LONG(buf, "slots_available", job->slots_available);
+    QMGR_STATUS_LONG(buf, "selected_entries", job->selected_entries);
+    QMGR_STATUS_LONG(buf, "read_entries", job->read_entries);
+    QMGR_STATUS_LONG(buf, "recipients", job->rcpt_count);
+    QMGR_STATUS_LONG(buf, "recipient_limit", job->rcpt_limit);
+    QMGR_STATUS_LONG(buf, "unread_recipients", message->rcpt_unread);
+    QMGR_STATUS_CLOSE(buf);
+}
+
+/* qmgr_status_report - format the complete report */
+
+static void qmgr_status_report(VSTRING *buf)
+{
+    QMGR_TRANSPORT *transport;
+    QMGR_QUEUE *queue;
+    QMGR_JOB *job;
+    QMGR_LANE *lane;
+    int     count;
+
+    qmgr_status_summary(buf);
+    for (transport = qmgr_transport_list.next; transport;
+	 transport = transport->peers.next) {
+	qmgr_status_transport(buf, transport);
+	for (count = 0; count < QMGR_LANE_COUNT; count++) {
+	    lane = transport->lanes + count;
+	    if (lane->job_count > 0 || lane->selected > 0)
+		qmgr_status_lane(buf, transport, count);
+	}
+	for (queue = transport->queue_list.next; queue;
+	     queue = queue->peers.next)
+	    qmgr_status_queue(buf, queue);
+	for (count = 0, job = transport->job_list.next;
+	     job && count < QMGR_STATUS_MAX_JOBS;
+	     count++, job = job->transport_peers.next)
+	    qmgr_status_job(buf, job);
+    }
+}
+
+/* qmgr_status_done - disconnect client */
+
+static void qmgr_status_done(QMGR_STATUS_CLIENT *client)
+{
+    event_disable_readwrite(client->fd);
+    (void) close(client->fd);
+    vstring_free(client->buf);
+    myfree((void *) client);
+    qmgr_status_clients--;
+}
+
+/* qmgr_status_event - write report, or time out */
+
+static void qmgr_status_event(int event, void *context)
+{
+    QMGR_STATUS_CLIENT *client = (QMGR_STATUS_CLIENT *) context;
+    ssize_t count;
+
+    if (event == EVENT_TIME) {
+	msg_warn("status client timeout");
+	qmgr_status_done(client);
+	return;
+    }
+    count = write(client->fd, STR(client->buf) + client->offset,
+		  LEN(client->buf) - client->offset);
+    if (count < 0 && (errno == EAGAIN || errno == EINTR))
+	return;
+    if (count <= 0) {
+	if (msg_verbose)
+	    msg_info("status client write: %m");
+	(void) event_cancel_timer(qmgr_status_event, context);
+	qmgr_status_done(client);
+	return;
+    }
+    client->offset += count;
+    if (client->offset >= LEN(client->buf)) {
+	(void) event_cancel_timer(qmgr_status_event, context);
+	qmgr_status_done(client);
+    }
+}
+
+/* qmgr_status_accept - accept client and format report */
+
+static void qmgr_status_accept(int unused_event, void *context)
+{
+    int     listen_fd = CAST_ANY_PTR_TO_INT(context);
+    QMGR_STATUS_CLIENT *client;
+    int     fd;
+
+    if ((fd = unix_accept(listen_fd)) < 0) {
+	if (errno != EAGAIN)
+	    msg_warn("accept status client: %m");
+	return;
+    }
+    if (qmgr_status_clients >= QMGR_STATUS_MAX_CLIENTS) {
+	msg_warn("too many status clients");
+	(void) close(fd);
+	return;
+    }
+    non_blocking(fd, NON_BLOCKING);
+    close_on_exec(fd, CLOSE_ON_EXEC);
+    client = (QMGR_STATUS_CLIENT *) mymalloc(sizeof(*client));
+    client->fd = fd;
+    client->buf = vstring_alloc(1000);
+    client->offset = 0;
+    qmgr_status_clients++;
+    qmgr_status_report(client->buf);
+    event_enable_write(fd, qmgr_status_event, (void *) client);
+    event_request_timer(qmgr_status_event, (void *) client,
+			QMGR_STATUS_TIMEOUT);
+}
+
+/* qmgr_status_init - create listening socket */
+
+void    qmgr_status_init(const char *service)
+{
+    char   *path;
+    int     listen_fd;
+
+    path = mail_pathname(MAIL_CLASS_PUBLIC, service);
+    if ((listen_fd = unix_listen(path, 10, NON_BLOCKING)) < 0)
+	msg_fatal("listen on %s: %m", path);
+    close_on_exec(listen_fd, CLOSE_ON_EXEC);
+    event_enable_read(listen_fd, qmgr_status_accept,
+		      CAST_INT_TO_VOID_PTR(listen_fd));
+    myfree(path);
+}
@@ -24,6 +24,9 @@
 /*
 /*	void	qmgr_transport_unthrottle(transport)
 /*	QMGR_TRANSPORT *transport;
+/*
+/*	void	qmgr_transport_rate_take(transport)
+/*	QMGR_TRANSPORT *transport;
 /* DESCRIPTION
 /*	This module organizes the world by message transport type.
 /*	Each transport can have zero or more destination queues
@@ -53,6 +56,13 @@
 /*
 /*	qmgr_transport_unthrottle() undoes qmgr_transport_throttle().
 /*	Attempts to unthrottle a non-throttled transport are ignored.
+/*
+/*	qmgr_transport_rate_take() spends one token from the transport
+/*	rate limit (see qmgr_rate(3)). qmgr_transport_select() skips
+/*	a transport that has no tokens for its pending delivery process
+/*	allocations. When the transport runs out of tokens, a timer
+/*	wakes up the queue manager after the next token becomes
+/*	available.
 /* DIAGNOSTICS
 /*	Panic: consistency check failure. Fatal: out of memory.
 /* LICENSE
@@ -236,6 +246,32 @@ void    qmgr_transport_throttle(QMGR_TRANSPORT *transport, DSN *dsn)
     }
 }
 
+/* qmgr_transport_token_event - transport rate limit has a token */
+
+static void qmgr_transport_token_event(int unused_event, void *context)
+{
+    QMGR_TRANSPORT *transport = (QMGR_TRANSPORT *) context;
+    int     wait;
+
+    /*
+     * The timer resolution is one second. When the transport has a token,
+     * there is nothing else to do: the queue manager main loop runs after
+     * each event, and will select the transport.
+     */
+    if ((wait = qmgr_rate_wait(&transport->xport_rate)) > 0)
+	event_request_timer(qmgr_transport_token_event, context, wait);
+}
+
+/* qmgr_transport_rate_take - spend transport rate limit token */
+
+void    qmgr_transport_rate_take(QMGR_TRANSPORT *transport)
+{
+    int     wait;
+
+    if ((wait = qmgr_rate_take(&transport->xport_rate)) > 0)
+	event_request_timer(qmgr_transport_token_event, (void *) transport, wait);
+}
+
 /* qmgr_transport_abort - transport connect watchdog */
 
 static void qmgr_transport_abort(int unused_event, void *context)
@@ -321,13 +357,14 @@ QMGR_TRANSPORT *qmgr_transport_select(void)
     for (xport = qmgr_transport_list.next; xport; xport = xport->peers.next) {
 	if ((xport->flags & QMGR_TRANSPORT_STAT_DEAD) != 0
 	    || (xport->flags & QMGR_TRANSPORT_STAT_RATE_LOCK) != 0
-	    || xport->pending >= QMGR_TRANSPORT_MAX_PEND)
+	    || xport->pending >= QMGR_TRANSPORT_MAX_PEND
+	    || qmgr_rate_avail(&xport->xport_rate) <= xport->pending)
 	    continue;
 	need = xport->pending + 1;
 	for (queue = xport->queue_list.next; queue; queue = queue->peers.next) {
 	    if (QMGR_QUEUE_READY(queue) == 0)
 		continue;
-	    if ((need -= MIN5af51743e4eef(queue->window - queue->busy_refcount,
+	    if ((need -= MIN5af51743e4eef(qmgr_queue_avail(queue),
 					  queue->todo_refcount)) <= 0) {
 		QMGR_LIST_ROTATE(qmgr_transport_list, xport, peers);
 		if (msg_verbose)
@@ -442,6 +479,19 @@ QMGR_TRANSPORT *qmgr_transport_create(const char *name)
 						var_dest_rate_delay,
 						's', 0, 0);
 
+    transport->dest_rate_limit = qmgr_rate_conf(name, _DEST_RATE_LIMIT,
+						VAR_DEST_RATE_LIMIT,
+						var_dest_rate_limit);
+    transport->dest_rate_burst = get_mail_conf_int2(name, _DEST_RATE_BURST,
+						    var_dest_rate_burst, 1, 0);
+    qmgr_rate_init(&transport->xport_rate,
+		   qmgr_rate_conf(name, _XPORT_RATE_LIMIT,
+				  VAR_XPORT_RATE_LIMIT, var_xport_rate_limit),
+		   get_mail_conf_int2(name, _XPORT_RATE_BURST,
+				      var_xport_rate_burst, 1, 0));
+    transport->batch_limit = get_mail_conf_int2(name, _DEST_BATCH_LIMIT,
+						var_dest_batch_limit, 1, 0);
+
     if (transport->rate_delay > 0)
 	transport->dest_concurrency_limit = 1;
     if (transport->dest_concurrency_limit != 0
@@ -467,6 +517,7 @@ QMGR_TRANSPORT *qmgr_transport_create(const char *name)
 					 var_xport_refill_delay, 's', 1, 0);
 
     transport->queue_byname = htable_create(0);
+    transport->rate_byname = htable_create(0);
     QMGR_LIST_INIT(transport->queue_list);
     transport->job_byname = htable_create(0);
     QMGR_LIST_INIT(transport->job_list);
@@ -485,6 +536,10 @@ QMGR_TRANSPORT *qmgr_transport_create(const char *name)
     transport->fail_cohort_limit =
 	get_mail_conf_int2(name, _CONC_COHORT_LIM,
 			   var_conc_cohort_limit, 0, 0);
+    transport->feedback_mode =
+	qmgr_feedback_mode(name, _CONC_FDBACK_MODE,
+			   VAR_CONC_FDBACK_MODE, var_conc_feedback_mode);
+    qmgr_lane_init(transport);
     if (qmgr_transport_byname == 0)
 	qmgr_transport_byname = htable_create(10);
     htable_enter(qmgr_transport_byname, name, (void *) transport);
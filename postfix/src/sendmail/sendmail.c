@@ -823,7 +823,8 @@ static void enqueue(const int flags, const char *encoding,
 		    (REC_TYPE_SIZE_CAST3) ~ 0,	/* recipient count */
 		    (REC_TYPE_SIZE_CAST4) ~ 0,	/* qmgr options */
 		    (REC_TYPE_SIZE_CAST5) ~ 0,	/* content length */
-		    (REC_TYPE_SIZE_CAST6) sm_sendopts);
+		    (REC_TYPE_SIZE_CAST6) sm_sendopts,	/* sendopts */
+		    (REC_TYPE_SIZE_CAST7) ~ 0);	/* recipient index */
     if (dsn_envid)
 	rec_fprintf(dst, REC_TYPE_ATTR, "%s=%s",
 		    MAIL_ATTR_DSN_ENVID, dsn_envid);
@@ -1417,10 +1417,17 @@ static void smtp_service(VSTREAM *client_stream, char *service,
      * read a request from the queue manager, and (3) report the completion
      * status of that request. All connection-management stuff is handled by
      * the common code in single_server.c.
+     * 
+     * When the queue manager sends a batch of requests for the same
+     * destination, steps (2) and (3) repeat on the same connection. The
+     * SMTP or LMTP session is handed from one request to the next through
+     * the connection cache.
      */
     if ((request = deliver_request_read(client_stream)) != 0) {
-	status = deliver_message(service, request);
-	deliver_request_done(client_stream, request, status);
+	do {
+	    status = deliver_message(service, request);
+	} while ((request = deliver_request_next(client_stream, request,
+						 status)) != 0);
     }
 }
 
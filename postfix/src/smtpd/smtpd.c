@@ -286,6 +286,18 @@
 /* .IP "\fBsmtpd_milter_maps (empty)\fR"
 /*	Lookup tables with Milter settings per remote SMTP client IP
 /*	address.
+/* .PP
+/*	Available in Postfix version 3.12 and later:
+/* .IP "\fBmilter_parallel_events (no)\fR"
+/*	Send each event to all Milter applications before receiving
+/*	their replies, instead of one application at a time.
+/* .IP "\fBmilter_latency_logging (no)\fR"
+/*	Log a per-Milter latency histogram when a Milter session ends.
+/* .IP "\fBmilter_connection_reuse (no)\fR"
+/*	Keep a Milter connection open for the next session in the same
+/*	process, when the Milter supports protocol version 6.
+/* .IP "\fBmilter_connection_cache_time_limit (10s)\fR"
+/*	The maximal time that an unused Milter connection is kept open.
 /* GENERAL CONTENT INSPECTION CONTROLS
 /* .ad
 /* .fi
@@ -2996,6 +3008,7 @@ static void mail_reset(SMTPD_STATE *state)
 	argv_free(state->saved_bcc);
 	state->saved_bcc = 0;
     }
+    state->saved_priority = 0;
     state->saved_flags = 0;
 #ifdef DELAY_ACTION
     state->saved_delay = 0;
@@ -3866,6 +3879,9 @@ static int common_post_message_handling(SMTPD_STATE *state)
 	    if (state->saved_redirect)
 		rec_fprintf(state->cleanup, REC_TYPE_RDR, "%s",
 			    state->saved_redirect);
+	    if (state->saved_priority)
+		rec_fprintf(state->cleanup, REC_TYPE_ATTR, "%s=%s",
+			    MAIL_ATTR_PRIORITY, state->saved_priority);
 	    if (state->saved_bcc) {
 		char  **cpp;
 
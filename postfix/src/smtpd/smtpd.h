@@ -143,6 +143,7 @@ typedef struct {
     char   *saved_filter;		/* postponed filter action */
     char   *saved_redirect;		/* postponed redirect action */
     ARGV   *saved_bcc;			/* postponed bcc action */
+    const char *saved_priority;		/* postponed priority action */
     int     saved_flags;		/* postponed hold/discard */
 #ifdef DELAY_ACTION
     int     saved_delay;		/* postponed deferred delay */
@@ -264,6 +264,7 @@
 #include <map_search.h>
 #include <info_log_addr_form.h>
 #include <mail_version.h>
+#include <mail_priority.h>
 
 /* Application-specific. */
 
@@ -2389,6 +2390,7 @@ static int check_table_result(SMTPD_STATE *state, const char *table,
     static char def_dsn[] = "5.7.1";
     DSN_SPLIT dp;
     static VSTRING *buf;
+    int     priority;
 
 #ifdef DELAY_ACTION
     int     defer_delay;
@@ -2508,6 +2510,29 @@ static int check_table_result(SMTPD_STATE *state, const char *table,
 	}
     }
 
+    /*
+     * PRIORITY selects the queue manager scheduling lane. But we may still
+     * change our mind, and reject/discard the message for other reasons.
+     */
+    if (STREQUAL(value, "PRIORITY", cmd_len)) {
+#ifndef TEST
+	if (can_delegate_action(state, table, "PRIORITY", reply_class) == 0)
+	    return (SMTPD_CHECK_DUNNO);
+#endif
+	if ((priority = mail_priority_from_string(cmd_text)) < 0) {
+	    msg_warn("access table %s entry \"%s\" requires PRIORITY "
+		     "high, normal or low", table, datum);
+	    return (SMTPD_CHECK_DUNNO);
+	}
+	vstring_sprintf(error_text, "<%s>: %s triggers PRIORITY %s",
+			reply_name, reply_class, cmd_text);
+	log_whatsup(state, "priority", STR(error_text));
+#ifndef TEST
+	state->saved_priority = mail_priority_to_string(priority);
+#endif
+	return (SMTPD_CHECK_DUNNO);
+    }
+
     /*
      * HOLD means deliver later. But we may still change our mind, and
      * reject/discard the message for other reasons.
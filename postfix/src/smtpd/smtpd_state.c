@@ -128,6 +128,7 @@ void    smtpd_state_init(SMTPD_STATE *state, VSTREAM *stream,
     state->saved_filter = 0;
     state->saved_redirect = 0;
     state->saved_bcc = 0;
+    state->saved_priority = 0;
     state->saved_flags = 0;
 #ifdef DELAY_ACTION
     state->saved_delay = 0;
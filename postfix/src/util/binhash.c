@@ -110,7 +110,7 @@
 /*	to delete a non-existent entry.
 /* SEE ALSO
 /*	mymalloc(3) memory management wrapper
-/*	hash_fnv(3) Fowler/Noll/Vo hash function
+/*	hash_fnv(3) Fowler/Noll/Vo and word-at-a-time hash functions
 /* LICENSE
 /* .ad
 /* .fi
@@ -143,7 +143,11 @@
 #ifndef NO_HASH_FNV
 #include "hash_fnv.h"
 
+#ifndef NO_HASH_MUM
+#define binhash_hash(key, len, size) (hash_mum((key), (len)) % (size))
+#else
 #define binhash_hash(key, len, size) (hash_fnv((key), (len)) % (size))
+#endif
 
 #else
 
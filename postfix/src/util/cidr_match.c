@@ -14,6 +14,12 @@
 /*	int	cidr_match_execute(info, address)
 /*	CIDR_MATCH *info;
 /*	const char *address;
+/*
+/*	void	cidr_match_index_build(list)
+/*	CIDR_MATCH *list;
+/*
+/*	void	cidr_match_index_free(list)
+/*	CIDR_MATCH *list;
 /* AUXILIARY FUNCTIONS
 /*	VSTRING *cidr_match_parse_if(info, pattern, match, why)
 /*	CIDR_MATCH *info;
@@ -50,6 +56,20 @@
 /*	cidr_match_execute() matches the specified address against
 /*	a list of parsed expressions, and returns the matching
 /*	expression's data structure.
+/*
+/*	cidr_match_index_build() speeds up cidr_match_execute() for
+/*	long lists. It compiles each run of consecutive positive
+/*	address patterns into a sorted table of address ranges, one
+/*	table per address family. Each range maps to the first pattern
+/*	in that run that matches all addresses in the range, so that
+/*	a binary search produces the same result as a linear scan.
+/*	IF/ENDIF and negated patterns are not indexed and terminate a
+/*	run. Short runs are not indexed. The list must be complete,
+/*	and must not be modified after this call.
+/*
+/*	cidr_match_index_free() destroys the index that was built by
+/*	cidr_match_index_build(). This must be done before the list
+/*	is destroyed.
 /* SEE ALSO
 /*	dict_cidr(3) CIDR-style lookup table
 /* AUTHOR(S)
@@ -78,6 +98,7 @@
 /* Utility library. */
 
 #include <msg.h>
+#include <mymalloc.h>
 #include <vstring.h>
 #include <stringops.h>
 #include <split_at.h>
@@ -111,6 +132,43 @@
      (msg_panic("%s: bad address family %d", myname, (f)), 0))
 #endif
 
+ /*
+  * A run index maps each address range of one address family to the first
+  * pattern in the run that matches all addresses in that range, or to null.
+  * Ranges are stored as a sorted array of start addresses; a range ends
+  * where the next one begins. The first range always starts at the
+  * all-zeroes address.
+  */
+typedef struct CIDR_MATCH_RANGES {
+    int     count;			/* number of ranges */
+    int     addr_byte_count;		/* typically, 4 or 16 */
+    unsigned char *starts;		/* range start addresses */
+    CIDR_MATCH **results;		/* per-range result, or null */
+} CIDR_MATCH_RANGES;
+
+typedef struct CIDR_MATCH_INDEX {
+    CIDR_MATCH *last;			/* last pattern in run */
+    CIDR_MATCH_RANGES v4;		/* IPv4 ranges */
+#ifdef HAS_IPV6
+    CIDR_MATCH_RANGES v6;		/* IPv6 ranges */
+#endif
+} CIDR_MATCH_INDEX;
+
+#ifdef HAS_IPV6
+#define CIDR_MATCH_INDEX_RANGES(ip, f) \
+    ((f) == AF_INET6 ? &(ip)->v6 : &(ip)->v4)
+#else
+#define CIDR_MATCH_INDEX_RANGES(ip, f) (&(ip)->v4)
+#endif
+
+ /*
+  * Runs that are shorter than this are not worth the memory.
+  */
+#define CIDR_MATCH_INDEX_MIN_RUN	4
+
+#define CIDR_MATCH_INDEXABLE(e) \
+    ((e)->op == CIDR_MATCH_OP_MATCH && (e)->match == CIDR_MATCH_TRUE)
+
 /* cidr_match_entry - match one entry */
 
 static inline int cidr_match_entry(CIDR_MATCH *entry,
@@ -143,6 +201,30 @@ static inline int cidr_match_entry(CIDR_MATCH *entry,
     return (!entry->match);
 }
 
+/* cidr_match_index_lookup - find first matching pattern in indexed run */
+
+static CIDR_MATCH *cidr_match_index_lookup(CIDR_MATCH_INDEX *ip,
+					           unsigned addr_family,
+					           unsigned char *addr_bytes)
+{
+    CIDR_MATCH_RANGES *rp = CIDR_MATCH_INDEX_RANGES(ip, addr_family);
+    int     lo;
+    int     hi;
+    int     mid;
+
+    if (rp->count == 0)
+	return (0);
+    for (lo = 0, hi = rp->count - 1; lo < hi; /* void */ ) {
+	mid = (lo + hi + 1) / 2;
+	if (memcmp(rp->starts + mid * rp->addr_byte_count, addr_bytes,
+		   rp->addr_byte_count) <= 0)
+	    lo = mid;
+	else
+	    hi = mid - 1;
+    }
+    return (rp->results[lo]);
+}
+
 /* cidr_match_execute - match address against compiled CIDR pattern list */
 
 CIDR_MATCH *cidr_match_execute(CIDR_MATCH *list, const char *addr)
@@ -150,6 +232,7 @@ CIDR_MATCH *cidr_match_execute(CIDR_MATCH *list, const char *addr)
     unsigned char addr_bytes[CIDR_MATCH_ABYTES];
     unsigned addr_family;
     CIDR_MATCH *entry;
+    CIDR_MATCH *match;
 
     addr_family = CIDR_MATCH_ADDR_FAMILY(addr);
     if (inet_pton(addr_family, addr, addr_bytes) != 1)
@@ -160,6 +243,14 @@ CIDR_MATCH *cidr_match_execute(CIDR_MATCH *list, const char *addr)
 	switch (entry->op) {
 
 	case CIDR_MATCH_OP_MATCH:
+	    if (entry->run_index != 0) {
+		if ((match = cidr_match_index_lookup(entry->run_index,
+						     addr_family,
+						     addr_bytes)) != 0)
+		    return (match);
+		entry = entry->run_index->last;
+		break;
+	    }
 	    if (entry->addr_family == addr_family)
 		if (cidr_match_entry(entry, addr_bytes))
 		    return (entry);
@@ -289,6 +380,7 @@ VSTRING *cidr_match_parse(CIDR_MATCH *ip, char *pattern, int match,
     ip->match = match;
     ip->next = 0;
     ip->block_end = 0;
+    ip->run_index = 0;
 
     return (0);
 }
@@ -313,4 +405,248 @@ void    cidr_match_endif(CIDR_MATCH *ip)
     ip->op = CIDR_MATCH_OP_ENDIF;
     ip->next = 0;				/* maybe not all bits 0 */
     ip->block_end = 0;
+    ip->run_index = 0;
+}
+
+ /*
+  * Index construction state. Patterns of one address family are sorted by
+  * network address, then by mask length, then by position in the run, so
+  * that a pattern always comes after the patterns whose network contains
+  * it. CIDR networks are either disjoint or nested, so that a stack of
+  * enclosing networks suffices to find the first matching pattern for each
+  * range.
+  */
+typedef struct {
+    CIDR_MATCH *entry;			/* pattern */
+    int     rank;			/* position in run */
+} CIDR_MATCH_SORT;
+
+typedef struct {
+    unsigned char last[CIDR_MATCH_ABYTES];	/* last address in network */
+    CIDR_MATCH_SORT best;		/* first matching pattern */
+} CIDR_MATCH_STACK;
+
+/* cidr_match_sort_cmp - order patterns for range table construction */
+
+static int cidr_match_sort_cmp(const void *a, const void *b)
+{
+    const CIDR_MATCH_SORT *sa = (const CIDR_MATCH_SORT *) a;
+    const CIDR_MATCH_SORT *sb = (const CIDR_MATCH_SORT *) b;
+    int     ret;
+
+    if ((ret = memcmp(sa->entry->net_bytes, sb->entry->net_bytes,
+		      sa->entry->addr_byte_count)) != 0)
+	return (ret);
+    if (sa->entry->mask_shift != sb->entry->mask_shift)
+	return (sa->entry->mask_shift - sb->entry->mask_shift);
+    return (sa->rank - sb->rank);
+}
+
+/* cidr_match_ranges_add - append range, merging with its predecessor */
+
+static void cidr_match_ranges_add(CIDR_MATCH_RANGES *rp,
+				          unsigned char *start,
+				          CIDR_MATCH *result)
+{
+    int     len = rp->addr_byte_count;
+
+    /*
+     * A later range with the same start address supersedes an earlier one.
+     * Adjacent ranges with the same result are merged.
+     */
+    if (rp->count > 0
+	&& memcmp(rp->starts + (rp->count - 1) * len, start, len) == 0) {
+	rp->results[rp->count - 1] = result;
+	if (rp->count > 1 && rp->results[rp->count - 2] == result)
+	    rp->count -= 1;
+    } else if (rp->count == 0 || rp->results[rp->count - 1] != result) {
+	memcpy(rp->starts + rp->count * len, start, len);
+	rp->results[rp->count] = result;
+	rp->count += 1;
+    }
+}
+
+/* cidr_match_addr_incr - increment address, report wrap-around */
+
+static int cidr_match_addr_incr(unsigned char *addr, int len)
+{
+    unsigned char *cp;
+
+    for (cp = addr + len - 1; cp >= addr; cp--)
+	if (++(*cp) != 0)
+	    return (1);
+    return (0);
+}
+
+/* cidr_match_ranges_pop - close innermost network */
+
+static void cidr_match_ranges_pop(CIDR_MATCH_RANGES *rp,
+				          CIDR_MATCH_STACK *stack, int *depth)
+{
+    unsigned char next[CIDR_MATCH_ABYTES];
+
+    *depth -= 1;
+    memcpy(next, stack[*depth].last, rp->addr_byte_count);
+    if (cidr_match_addr_incr(next, rp->addr_byte_count))
+	cidr_match_ranges_add(rp, next, *depth > 0 ?
+			      stack[*depth - 1].best.entry : 0);
+}
+
+/* cidr_match_ranges_build - build range table for one address family */
+
+static void cidr_match_ranges_build(CIDR_MATCH_RANGES *rp,
+				            CIDR_MATCH_SORT *sorted, int count,
+				            int addr_byte_count)
+{
+    CIDR_MATCH_STACK stack[CIDR_MATCH_ABYTES * CHAR_BIT + 1];
+    int     depth = 0;
+    unsigned char zero[CIDR_MATCH_ABYTES];
+    CIDR_MATCH_SORT *sp;
+    CIDR_MATCH *entry;
+    int     n;
+
+    /*
+     * Each pattern adds at most two ranges: one where its network begins,
+     * and one where it ends.
+     */
+    rp->addr_byte_count = addr_byte_count;
+    rp->count = 0;
+    rp->starts = (unsigned char *) mymalloc((2 * count + 1) * addr_byte_count);
+    rp->results = (CIDR_MATCH **) mymalloc((2 * count + 1)
+					   * sizeof(*rp->results));
+    memset(zero, 0, sizeof(zero));
+    cidr_match_ranges_add(rp, zero, (CIDR_MATCH *) 0);
+
+    qsort((void *) sorted, count, sizeof(*sorted), cidr_match_sort_cmp);
+    for (sp = sorted; sp < sorted + count; sp++) {
+	entry = sp->entry;
+
+	/*
+	 * Close the networks that end before this one begins. The remaining
+	 * networks on the stack contain this one.
+	 */
+	while (depth > 0 && memcmp(stack[depth - 1].last, entry->net_bytes,
+				   addr_byte_count) < 0)
+	    cidr_match_ranges_pop(rp, stack, &depth);
+
+	/*
+	 * Skip duplicate patterns. The first one always wins.
+	 */
+	if (sp > sorted && sp[-1].entry->mask_shift == entry->mask_shift
+	    && memcmp(sp[-1].entry->net_bytes, entry->net_bytes,
+		      addr_byte_count) == 0)
+	    continue;
+	if (depth >= (int) (sizeof(stack) / sizeof(stack[0])))
+	    msg_panic("cidr_match_ranges_build: network stack overflow");
+
+	/*
+	 * Open this network. Its addresses match the first pattern in the
+	 * run that contains them.
+	 */
+	for (n = 0; n < addr_byte_count; n++)
+	    stack[depth].last[n] = entry->net_bytes[n] | ~entry->mask_bytes[n];
+	if (depth > 0 && stack[depth - 1].best.rank < sp->rank)
+	    stack[depth].best = stack[depth - 1].best;
+	else
+	    stack[depth].best = *sp;
+	depth += 1;
+	cidr_match_ranges_add(rp, entry->net_bytes,
+			      stack[depth - 1].best.entry);
+    }
+    while (depth > 0)
+	cidr_match_ranges_pop(rp, stack, &depth);
+
+    rp->starts = (unsigned char *)
+	myrealloc((void *) rp->starts, rp->count * addr_byte_count);
+    rp->results = (CIDR_MATCH **)
+	myrealloc((void *) rp->results, rp->count * sizeof(*rp->results));
+}
+
+/* cidr_match_index_run - index one run of positive patterns */
+
+static CIDR_MATCH_INDEX *cidr_match_index_run(CIDR_MATCH *first, int count)
+{
+    CIDR_MATCH_INDEX *ip;
+    CIDR_MATCH_SORT *v4;
+    int     v4_count = 0;
+
+#ifdef HAS_IPV6
+    CIDR_MATCH_SORT *v6;
+    int     v6_count = 0;
+
+#endif
+    CIDR_MATCH *entry;
+    int     rank;
+
+    v4 = (CIDR_MATCH_SORT *) mymalloc(count * sizeof(*v4));
+#ifdef HAS_IPV6
+    v6 = (CIDR_MATCH_SORT *) mymalloc(count * sizeof(*v6));
+#endif
+    ip = (CIDR_MATCH_INDEX *) mymalloc(sizeof(*ip));
+    for (rank = 0, entry = first; rank < count; rank++, entry = entry->next) {
+	ip->last = entry;
+#ifdef HAS_IPV6
+	if (entry->addr_family == AF_INET6) {
+	    v6[v6_count].entry = entry;
+	    v6[v6_count++].rank = rank;
+	    continue;
+	}
+#endif
+	v4[v4_count].entry = entry;
+	v4[v4_count++].rank = rank;
+    }
+    cidr_match_ranges_build(&ip->v4, v4, v4_count, MAI_V4ADDR_BYTES);
+    myfree((void *) v4);
+#ifdef HAS_IPV6
+    cidr_match_ranges_build(&ip->v6, v6, v6_count, MAI_V6ADDR_BYTES);
+    myfree((void *) v6);
+#endif
+    return (ip);
+}
+
+/* cidr_match_index_build - index runs of positive patterns */
+
+void    cidr_match_index_build(CIDR_MATCH *list)
+{
+    CIDR_MATCH *first;
+    CIDR_MATCH *entry;
+    int     count;
+
+    for (first = list; first != 0; first = entry) {
+	if (!CIDR_MATCH_INDEXABLE(first)) {
+	    entry = first->next;
+	    continue;
+	}
+	for (count = 0, entry = first;
+	     entry != 0 && CIDR_MATCH_INDEXABLE(entry); entry = entry->next)
+	    count++;
+	if (count >= CIDR_MATCH_INDEX_MIN_RUN)
+	    first->run_index = cidr_match_index_run(first, count);
+    }
+}
+
+/* cidr_match_ranges_free - destroy range table */
+
+static void cidr_match_ranges_free(CIDR_MATCH_RANGES *rp)
+{
+    myfree((void *) rp->starts);
+    myfree((void *) rp->results);
+}
+
+/* cidr_match_index_free - destroy run indexes */
+
+void    cidr_match_index_free(CIDR_MATCH *list)
+{
+    CIDR_MATCH *entry;
+
+    for (entry = list; entry != 0; entry = entry->next) {
+	if (entry->run_index != 0) {
+	    cidr_match_ranges_free(&entry->run_index->v4);
+#ifdef HAS_IPV6
+	    cidr_match_ranges_free(&entry->run_index->v6);
+#endif
+	    myfree((void *) entry->run_index);
+	    entry->run_index = 0;
+	}
+    }
 }
@@ -0,0 +1,279 @@
+/*++
+/* NAME
+/*	cidr_match_bench 1
+/* SUMMARY
+/*	measure CIDR pattern list load and lookup cost
+/* SYNOPSIS
+/* .fi
+/*	\fBcidr_match_bench\fR [\fB-v\fR] [\fB-n \fIpattern_count\fR]
+/*		[\fB-l \fIlookup_count\fR] [\fB-r \fIrounds\fR]
+/* DESCRIPTION
+/*	The \fBcidr_match_bench\fR command measures the cost of
+/*	parsing and indexing a large list of CIDR patterns with the
+/*	\fBcidr_match\fR(3) module, as happens when a \fBcidr\fR:
+/*	table is opened, and compares the cost of lookups with and
+/*	without the run index that is built by cidr_match_index_build().
+/*
+/*	Each round generates \fIpattern_count\fR random IPv4 and
+/*	IPv6 patterns with a mix of network lengths, similar to an
+/*	imported block list. It then looks up \fIlookup_count\fR
+/*	random addresses, half of which fall inside a pattern, once
+/*	with a linear scan and once with the run index, and verifies
+/*	that both produce the same result.
+/*
+/*	Options:
+/* .IP "\fB-n \fIpattern_count\fR (default: 50000)"
+/*	The number of patterns in the list.
+/* .IP "\fB-l \fIlookup_count\fR (default: 10000)"
+/*	The number of lookups. The linear scan is slow; increase
+/*	this with care.
+/* .IP "\fB-r \fIrounds\fR (default: 1)"
+/*	The number of times to repeat the measurement.
+/* .IP \fB-v\fR
+/*	Increase verbosity.
+/* DIAGNOSTICS
+/*	Problems are reported to the standard error stream.
+/* LICENSE
+/* .ad
+/* .fi
+/*	The Secure Mailer license must be distributed with this software.
+/*--*/
+
+/* System library. */
+
+#include <sys_defs.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Utility library. */
+
+#include <msg.h>
+#include <msg_vstream.h>
+#include <mymalloc.h>
+#include <myrand.h>
+#include <vstream.h>
+#include <vstring.h>
+#include <myaddrinfo.h>
+#include <mask_addr.h>
+#include <cidr_match.h>
+
+ /*
+  * Network lengths, weighted like a typical block list.
+  */
+static const int v4_lengths[] = {8, 16, 20, 22, 24, 24, 24, 28, 32, 32, 32, 32};
+static const int v6_lengths[] = {32, 48, 56, 64, 64, 64, 96, 128, 128};
+
+#define LEN(a) (sizeof(a) / sizeof((a)[0]))
+
+ /*
+  * Every eighth pattern or lookup address is IPv6.
+  */
+#ifdef HAS_IPV6
+#define RANDOM_V6()	((myrand() & 7) == 0)
+#else
+#define RANDOM_V6()	0
+#endif
+
+/* elapsed - return elapsed time in seconds */
+
+static double elapsed(struct timeval *start)
+{
+    struct timeval now;
+
+    if (gettimeofday(&now, (struct timezone *) 0) < 0)
+	msg_fatal("gettimeofday: %m");
+    return ((now.tv_sec - start->tv_sec)
+	    + (now.tv_usec - start->tv_usec) / 1000000.0);
+}
+
+/* report - report the cost of one phase */
+
+static void report(const char *phase, long count, struct timeval *start)
+{
+    double  secs = elapsed(start);
+
+    vstream_printf("%-8s %8ld requests %8.3f s %10.0f requests/s\n",
+		   phase, count, secs, secs > 0 ? count / secs : 0);
+    vstream_fflush(VSTREAM_OUT);
+}
+
+/* random_bytes - generate random address bytes */
+
+static void random_bytes(unsigned char *bytes, int len)
+{
+    while (len-- > 0)
+	*bytes++ = myrand();
+}
+
+/* random_pattern - generate random network pattern */
+
+static void random_pattern(VSTRING *buf)
+{
+    unsigned char bytes[CIDR_MATCH_ABYTES];
+    MAI_HOSTADDR_STR hostaddr;
+    int     family;
+    int     len;
+    int     bits;
+
+    if (RANDOM_V6()) {
+	family = AF_INET6;
+	len = MAI_V6ADDR_BYTES;
+	bits = v6_lengths[myrand() % LEN(v6_lengths)];
+    } else {
+	family = AF_INET;
+	len = MAI_V4ADDR_BYTES;
+	bits = v4_lengths[myrand() % LEN(v4_lengths)];
+    }
+    random_bytes(bytes, len);
+    mask_addr(bytes, len, bits);
+    if (inet_ntop(family, bytes, hostaddr.buf, sizeof(hostaddr.buf)) == 0)
+	msg_fatal("inet_ntop: %m");
+    vstring_sprintf(buf, "%s/%d", hostaddr.buf, bits);
+}
+
+/* random_address - generate random address, maybe inside a pattern */
+
+static char *random_address(CIDR_MATCH *patterns, long count)
+{
+    unsigned char bytes[CIDR_MATCH_ABYTES];
+    MAI_HOSTADDR_STR hostaddr;
+    CIDR_MATCH *pp;
+    int     family;
+    int     n;
+
+    if (myrand() & 1) {
+	pp = patterns + myrand() % count;
+	family = pp->addr_family;
+	random_bytes(bytes, pp->addr_byte_count);
+	for (n = 0; n < pp->addr_byte_count; n++)
+	    bytes[n] = (bytes[n] & ~pp->mask_bytes[n]) | pp->net_bytes[n];
+    } else if (RANDOM_V6()) {
+	family = AF_INET6;
+	random_bytes(bytes, MAI_V6ADDR_BYTES);
+    } else {
+	family = AF_INET;
+	random_bytes(bytes, MAI_V4ADDR_BYTES);
+    }
+    if (inet_ntop(family, bytes, hostaddr.buf, sizeof(hostaddr.buf)) == 0)
+	msg_fatal("inet_ntop: %m");
+    return (mystrdup(hostaddr.buf));
+}
+
+/* run_round - one round of parsing and lookups */
+
+static void run_round(long count, long lookups)
+{
+    struct timeval start;
+    CIDR_MATCH *patterns;
+    CIDR_MATCH **expect;
+    CIDR_MATCH *got;
+    char  **addrs;
+    VSTRING *buf = vstring_alloc(100);
+    VSTRING *why;
+    long    hits;
+    long    n;
+
+    /*
+     * Parse the patterns into a list.
+     */
+    patterns = (CIDR_MATCH *) mymalloc(sizeof(*patterns) * count);
+    gettimeofday(&start, (struct timezone *) 0);
+    for (n = 0; n < count; n++) {
+	random_pattern(buf);
+	if ((why = cidr_match_parse(patterns + n, vstring_str(buf),
+				    CIDR_MATCH_TRUE, (VSTRING *) 0)) != 0)
+	    msg_fatal("%s", vstring_str(why));
+	if (n > 0)
+	    patterns[n - 1].next = patterns + n;
+    }
+    report("parse", count, &start);
+
+    addrs = (char **) mymalloc(sizeof(*addrs) * lookups);
+    for (n = 0; n < lookups; n++)
+	addrs[n] = random_address(patterns, count);
+
+    /*
+     * Linear lookups.
+     */
+    expect = (CIDR_MATCH **) mymalloc(sizeof(*expect) * lookups);
+    gettimeofday(&start, (struct timezone *) 0);
+    for (hits = n = 0; n < lookups; n++)
+	if ((expect[n] = cidr_match_execute(patterns, addrs[n])) != 0)
+	    hits++;
+    report("linear", lookups, &start);
+    if (msg_verbose)
+	msg_info("%ld of %ld lookups matched", hits, lookups);
+
+    /*
+     * Indexed lookups.
+     */
+    gettimeofday(&start, (struct timezone *) 0);
+    cidr_match_index_build(patterns);
+    report("index", count, &start);
+
+    gettimeofday(&start, (struct timezone *) 0);
+    for (n = 0; n < lookups; n++)
+	if ((got = cidr_match_execute(patterns, addrs[n])) != expect[n])
+	    msg_fatal("%s: indexed result %ld differs from linear result %ld",
+		      addrs[n], got ? (long) (got - patterns) : -1L,
+		      expect[n] ? (long) (expect[n] - patterns) : -1L);
+    report("indexed", lookups, &start);
+
+    cidr_match_index_free(patterns);
+    for (n = 0; n < lookups; n++)
+	myfree(addrs[n]);
+    myfree((void *) addrs);
+    myfree((void *) expect);
+    myfree((void *) patterns);
+    vstring_free(buf);
+}
+
+/* usage - explain and terminate */
+
+static NORETURN usage(char *myname)
+{
+    msg_fatal("usage: %s [-v] [-n pattern_count] [-l lookup_count] [-r rounds]",
+	      myname);
+}
+
+int     main(int argc, char **argv)
+{
+    long    count = 50000;
+    long    lookups = 10000;
+    int     rounds = 1;
+    int     ch;
+
+    msg_vstream_init(argv[0], VSTREAM_ERR);
+    while ((ch = GETOPT(argc, argv, "l:n:r:v")) > 0) {
+	switch (ch) {
+	case 'l':
+	    if ((lookups = atol(optarg)) <= 0)
+		usage(argv[0]);
+	    break;
+	case 'n':
+	    if ((count = atol(optarg)) <= 0)
+		usage(argv[0]);
+	    break;
+	case 'r':
+	    if ((rounds = atoi(optarg)) <= 0)
+		usage(argv[0]);
+	    break;
+	case 'v':
+	    msg_verbose++;
+	    break;
+	default:
+	    usage(argv[0]);
+	}
+    }
+    if (argc != optind)
+	usage(argv[0]);
+
+    while (rounds-- > 0)
+	run_round(count, lookups);
+    exit(0);
+}
@@ -0,0 +1,650 @@
+/*++
+/* NAME
+/*	dict_mmap 3
+/* SUMMARY
+/*	dictionary manager interface to shared memory-mapped files
+/* SYNOPSIS
+/*	#include <dict_mmap.h>
+/*
+/*	DICT	*dict_mmap_open(path, open_flags, dict_flags)
+/*	const char *path;
+/*	int	open_flags;
+/*	int	dict_flags;
+/* DESCRIPTION
+/*	dict_mmap_open() opens the specified compiled lookup table.
+/*	The result is a pointer to a structure that can be used to
+/*	access the dictionary using the generic methods documented
+/*	in dict_open(3).
+/*
+/*	In query mode, the table file is mapped read-only and shared
+/*	into the process address space. All processes that open the
+/*	same table share the same physical memory pages, opening a
+/*	table takes the same time regardless of its size, and lookup
+/*	and sequence results point directly into the mapped file.
+/*
+/*	In create mode, updates are collected in memory. When the
+/*	table is closed, the result is written to a temporary file
+/*	under an exclusive lock, and the temporary file is renamed
+/*	to the table file. Processes that have the old file mapped
+/*	continue to use it until they notice that the table has
+/*	changed.
+/*
+/*	The file format is position-independent and uses the native
+/*	byte order. A table that was built on a host with a different
+/*	byte order is rejected.
+/*
+/*	Arguments:
+/* .IP path
+/*	The database pathname, not including the ".mmap" suffix.
+/* .IP open_flags
+/*	Flags passed to open(). Specify O_RDONLY or O_WRONLY|O_CREAT|O_TRUNC.
+/* .IP dict_flags
+/*	Flags used by the dictionary interface.
+/* SEE ALSO
+/*	dict(3) generic dictionary manager
+/* DIAGNOSTICS
+/*	Fatal errors: cannot open file, write error, corrupted file,
+/*	out of memory.
+/* LICENSE
+/* .ad
+/* .fi
+/*	The Secure Mailer license must be distributed with this software.
+/* AUTHOR(S)
+/*	agent
+/*	agent@local
+/*--*/
+
+/* System library. */
+
+#include <sys_defs.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <stdio.h>
+
+/* Utility library. */
+
+#include <msg.h>
+#include <mymalloc.h>
+#include <vstring.h>
+#include <stringops.h>
+#include <iostuff.h>
+#include <myflock.h>
+#include <htable.h>
+#include <ldseed.h>
+#include <dict.h>
+#include <dict_mmap.h>
+
+/* Application-specific. */
+
+#define DICT_MMAP_SUFFIX	".mmap"
+#define DICT_MMAP_TMP_SUFFIX	DICT_MMAP_SUFFIX ".tmp"
+
+ /*
+  * File layout. All offsets are relative to the start of the file, so that
+  * the file can be mapped at any address, and all numbers are in native
+  * byte order.
+  *
+  * The header is followed by an open-addressing hash table with linear
+  * probing that is at most half full. Each bucket has the key hash value
+  * and the record offset; offset zero means an empty bucket. The records
+  * follow the hash table in the order that they were added. Each record
+  * has the key and value lengths, the key and a null byte, and the value
+  * and a null byte, padded to a 4-byte boundary.
+  */
+typedef struct {
+    uint32_t magic;			/* DICT_MMAP_MAGIC */
+    uint32_t version;			/* DICT_MMAP_VERSION */
+    uint32_t seed;			/* hash function seed */
+    uint32_t count;			/* number of records */
+    uint32_t bucket_count;		/* power of 2 */
+    uint32_t bucket_offset;		/* start of hash table */
+    uint32_t record_offset;		/* start of records */
+    uint32_t size;			/* file size */
+} DICT_MMAP_HEADER;
+
+typedef struct {
+    uint32_t hash;			/* key hash value */
+    uint32_t offset;			/* record offset, or zero */
+} DICT_MMAP_BUCKET;
+
+typedef struct {
+    uint32_t key_len;			/* key length */
+    uint32_t val_len;			/* value length */
+} DICT_MMAP_RECORD;
+
+#define DICT_MMAP_MAGIC		0x50464d4dUL	/* "PFMM" */
+#define DICT_MMAP_VERSION	1
+#define DICT_MMAP_MAX_SIZE	((size_t) UINT32_MAX)
+
+#define DICT_MMAP_ALIGN(n)	(((n) + 3) & ~(size_t) 3)
+#define DICT_MMAP_RECORD_SIZE(key_len, val_len) \
+	DICT_MMAP_ALIGN(sizeof(DICT_MMAP_RECORD) + (key_len) + (val_len) + 2)
+#define DICT_MMAP_KEY(rp)	((const char *) ((rp) + 1))
+#define DICT_MMAP_VALUE(rp)	(DICT_MMAP_KEY(rp) + (rp)->key_len + 1)
+
+typedef struct {
+    DICT    dict;			/* generic members */
+    char   *map;			/* mapped file */
+    size_t  map_size;			/* mapped file size */
+    const DICT_MMAP_HEADER *header;	/* file header */
+    const DICT_MMAP_BUCKET *buckets;	/* hash table */
+    uint32_t seq_offset;		/* current sequence offset */
+} DICT_MMAPQ;				/* query interface */
+
+typedef struct {
+    DICT    dict;			/* generic members */
+    int     fd;				/* temporary file */
+    char   *mmap_path;			/* table pathname (.mmap) */
+    char   *tmp_path;			/* temporary pathname (.tmp) */
+    HTABLE *table;			/* key to value mapping */
+    HTABLE_INFO **order;		/* keys in the order they were added */
+    ssize_t order_len;			/* number of keys */
+    ssize_t order_size;			/* allocated size */
+} DICT_MMAPM;				/* rebuild interface */
+
+/* dict_mmap_hash - seeded FNV-1a hash, stable across processes */
+
+static uint32_t dict_mmap_hash(uint32_t seed, const char *key, size_t len)
+{
+    uint32_t hash = 0x811c9dc5UL ^ seed;
+
+    /*
+     * Unlike hash_fnv(3), which is seeded per process, this hash must
+     * produce the same result in every process that maps the same file. The
+     * seed is chosen when the file is built, and is stored in its header.
+     */
+    while (len-- > 0) {
+	hash ^= 1 + *(const unsigned char *) key++;
+	hash *= 0x01000193UL;
+    }
+    return (hash);
+}
+
+/* dict_mmapq_record - find and validate record */
+
+static const DICT_MMAP_RECORD *dict_mmapq_record(DICT_MMAPQ *dict_mmapq,
+						         uint32_t offset)
+{
+    const DICT_MMAP_HEADER *hp = dict_mmapq->header;
+    const DICT_MMAP_RECORD *rp;
+
+    if (offset < hp->record_offset || offset > hp->size || offset % 4 != 0
+	|| hp->size - offset < sizeof(*rp))
+	msg_fatal("%s: corrupted record offset %lu",
+		  dict_mmapq->dict.name, (unsigned long) offset);
+    rp = (const DICT_MMAP_RECORD *) (dict_mmapq->map + offset);
+    if (rp->key_len > hp->size || rp->val_len > hp->size
+	|| hp->size - offset < DICT_MMAP_RECORD_SIZE((size_t) rp->key_len,
+						     (size_t) rp->val_len))
+	msg_fatal("%s: corrupted record at offset %lu",
+		  dict_mmapq->dict.name, (unsigned long) offset);
+    return (rp);
+}
+
+/* dict_mmapq_lookup - find database entry, query mode */
+
+static const char *dict_mmapq_lookup(DICT *dict, const char *name)
+{
+    DICT_MMAPQ *dict_mmapq = (DICT_MMAPQ *) dict;
+    const DICT_MMAP_HEADER *hp = dict_mmapq->header;
+    const DICT_MMAP_BUCKET *bp;
+    const DICT_MMAP_RECORD *rp;
+    size_t  len;
+    uint32_t hash;
+    uint32_t mask;
+    uint32_t probes;
+    uint32_t n;
+
+    dict->error = 0;
+
+    /* The file is constant, so do not try to acquire a lock. */
+
+    /*
+     * Optionally fold the key.
+     */
+    if (dict->flags & DICT_FLAG_FOLD_FIX) {
+	if (dict->fold_buf == 0)
+	    dict->fold_buf = vstring_alloc(10);
+	vstring_strcpy(dict->fold_buf, name);
+	name = lowercase(vstring_str(dict->fold_buf));
+    }
+
+    /*
+     * Probe until we find the key or an empty bucket. The probe limit
+     * protects against a damaged file that has no empty bucket.
+     */
+    len = strlen(name);
+    hash = dict_mmap_hash(hp->seed, name, len);
+    mask = hp->bucket_count - 1;
+    for (n = hash & mask, probes = 0; probes < hp->bucket_count;
+	 n = (n + 1) & mask, probes++) {
+	bp = dict_mmapq->buckets + n;
+	if (bp->offset == 0)
+	    break;
+	if (bp->hash != hash)
+	    continue;
+	rp = dict_mmapq_record(dict_mmapq, bp->offset);
+	if (rp->key_len == len && memcmp(DICT_MMAP_KEY(rp), name, len) == 0)
+	    return (DICT_MMAP_VALUE(rp));
+    }
+    return (0);
+}
+
+/* dict_mmapq_sequence - traverse the dictionary */
+
+static int dict_mmapq_sequence(DICT *dict, int function,
+			               const char **key, const char **value)
+{
+    const char *myname = "dict_mmapq_sequence";
+    DICT_MMAPQ *dict_mmapq = (DICT_MMAPQ *) dict;
+    const DICT_MMAP_RECORD *rp;
+
+    dict->error = 0;
+
+    switch (function) {
+    case DICT_SEQ_FUN_FIRST:
+	dict_mmapq->seq_offset = dict_mmapq->header->record_offset;
+	break;
+    case DICT_SEQ_FUN_NEXT:
+	if (dict_mmapq->seq_offset == 0)
+	    msg_panic("%s: %s: no cursor", myname, dict->name);
+	break;
+    default:
+	msg_panic("%s: invalid function %d", myname, function);
+    }
+
+    if (dict_mmapq->seq_offset >= dict_mmapq->header->size) {
+	dict_mmapq->seq_offset = 0;
+	return (-1);				/* not found */
+    }
+    rp = dict_mmapq_record(dict_mmapq, dict_mmapq->seq_offset);
+    *key = DICT_MMAP_KEY(rp);
+    *value = DICT_MMAP_VALUE(rp);
+    dict_mmapq->seq_offset += DICT_MMAP_RECORD_SIZE(rp->key_len, rp->val_len);
+    return (0);
+}
+
+/* dict_mmapq_close - close data base, query mode */
+
+static void dict_mmapq_close(DICT *dict)
+{
+    DICT_MMAPQ *dict_mmapq = (DICT_MMAPQ *) dict;
+
+    if (munmap(dict_mmapq->map, dict_mmapq->map_size) < 0)
+	msg_warn("munmap %s: %m", dict->name);
+    close(dict->stat_fd);
+    if (dict->fold_buf)
+	vstring_free(dict->fold_buf);
+    dict_free(dict);
+}
+
+/* dict_mmapq_check - validate file header */
+
+static const char *dict_mmapq_check(const DICT_MMAP_HEADER *hp, size_t size)
+{
+    if (hp->magic != DICT_MMAP_MAGIC)
+	return ("bad magic number; file has wrong type or byte order");
+    if (hp->version != DICT_MMAP_VERSION)
+	return ("unsupported file format version");
+    if (hp->size != size)
+	return ("file size does not match header");
+    if (hp->bucket_count == 0 || (hp->bucket_count & (hp->bucket_count - 1)))
+	return ("bad hash table size");
+    if (hp->bucket_offset < sizeof(*hp) || hp->bucket_offset % 4 != 0
+	|| hp->bucket_offset > size
+	|| (size - hp->bucket_offset) / sizeof(DICT_MMAP_BUCKET)
+	< hp->bucket_count)
+	return ("bad hash table offset");
+    if (hp->record_offset < hp->bucket_offset
+	+ hp->bucket_count * sizeof(DICT_MMAP_BUCKET)
+	|| hp->record_offset > size)
+	return ("bad record offset");
+    return (0);
+}
+
+/* dict_mmapq_open - open data base, query mode */
+
+static DICT *dict_mmapq_open(const char *path, int dict_flags)
+{
+    DICT_MMAPQ *dict_mmapq;
+    struct stat st;
+    char   *mmap_path;
+    const char *why;
+    void   *map;
+    int     fd;
+
+    /*
+     * Let the optimizer worry about eliminating redundant code.
+     */
+#define DICT_MMAPQ_OPEN_RETURN(d) do { \
+	DICT *__d = (d); \
+	myfree(mmap_path); \
+	return (__d); \
+    } while (0)
+
+    mmap_path = concatenate(path, DICT_MMAP_SUFFIX, (char *) 0);
+
+    if ((fd = open(mmap_path, O_RDONLY)) < 0)
+	DICT_MMAPQ_OPEN_RETURN(dict_surrogate(DICT_TYPE_MMAP, path,
+					      O_RDONLY, dict_flags,
+					 "open database %s: %m", mmap_path));
+    if (fstat(fd, &st) < 0)
+	msg_fatal("fstat %s: %m", mmap_path);
+    if (st.st_size < sizeof(DICT_MMAP_HEADER)
+	|| st.st_size > DICT_MMAP_MAX_SIZE) {
+	(void) close(fd);
+	DICT_MMAPQ_OPEN_RETURN(dict_surrogate(DICT_TYPE_MMAP, path,
+					      O_RDONLY, dict_flags,
+					      "open database %s: bad file size",
+					      mmap_path));
+    }
+    if ((map = mmap((void *) 0, st.st_size, PROT_READ, MAP_SHARED,
+		    fd, (off_t) 0)) == MAP_FAILED) {
+	(void) close(fd);
+	DICT_MMAPQ_OPEN_RETURN(dict_surrogate(DICT_TYPE_MMAP, path,
+					      O_RDONLY, dict_flags,
+					 "mmap database %s: %m", mmap_path));
+    }
+    if ((why = dict_mmapq_check((DICT_MMAP_HEADER *) map, st.st_size)) != 0) {
+	(void) munmap(map, st.st_size);
+	(void) close(fd);
+	DICT_MMAPQ_OPEN_RETURN(dict_surrogate(DICT_TYPE_MMAP, path,
+					      O_RDONLY, dict_flags,
+					      "open database %s: %s",
+					      mmap_path, why));
+    }
+    dict_mmapq = (DICT_MMAPQ *) dict_alloc(DICT_TYPE_MMAP,
+					   mmap_path, sizeof(*dict_mmapq));
+    dict_mmapq->map = map;
+    dict_mmapq->map_size = st.st_size;
+    dict_mmapq->header = (DICT_MMAP_HEADER *) map;
+    dict_mmapq->buckets = (DICT_MMAP_BUCKET *)
+	(dict_mmapq->map + dict_mmapq->header->bucket_offset);
+    dict_mmapq->seq_offset = 0;
+    dict_mmapq->dict.lookup = dict_mmapq_lookup;
+    dict_mmapq->dict.sequence = dict_mmapq_sequence;
+    dict_mmapq->dict.close = dict_mmapq_close;
+    dict_mmapq->dict.stat_fd = fd;
+    dict_mmapq->dict.mtime = st.st_mtime;
+    dict_mmapq->dict.owner.uid = st.st_uid;
+    dict_mmapq->dict.owner.status = (st.st_uid != 0);
+    close_on_exec(fd, CLOSE_ON_EXEC);
+
+    /*
+     * Warn if the source file is newer than the indexed file, except when
+     * the source file changed only seconds ago.
+     */
+    if (stat(path, &st) == 0
+	&& st.st_mtime > dict_mmapq->dict.mtime
+	&& st.st_mtime < time((time_t *) 0) - 100)
+	msg_warn("database %s is older than source file %s", mmap_path, path);
+
+    /*
+     * Keys and values are stored with an explicit length and a null byte,
+     * so there is no need to try both with and without null byte.
+     */
+    dict_mmapq->dict.flags = dict_flags | DICT_FLAG_FIXED;
+    if (dict_flags & DICT_FLAG_FOLD_FIX)
+	dict_mmapq->dict.fold_buf = vstring_alloc(10);
+
+    DICT_MMAPQ_OPEN_RETURN(&dict_mmapq->dict);
+}
+
+/* dict_mmapm_update - add database entry, create mode */
+
+static int dict_mmapm_update(DICT *dict, const char *name, const char *value)
+{
+    DICT_MMAPM *dict_mmapm = (DICT_MMAPM *) dict;
+    HTABLE_INFO *ht;
+
+    dict->error = 0;
+
+    /*
+     * Optionally fold the key.
+     */
+    if (dict->flags & DICT_FLAG_FOLD_FIX) {
+	if (dict->fold_buf == 0)
+	    dict->fold_buf = vstring_alloc(10);
+	vstring_strcpy(dict->fold_buf, name);
+	name = lowercase(vstring_str(dict->fold_buf));
+    }
+
+    /*
+     * Handle duplicates.
+     */
+    if ((ht = htable_locate(dict_mmapm->table, name)) != 0) {
+	if (dict->flags & DICT_FLAG_DUP_IGNORE)
+	     /* void */ ;
+	else if (dict->flags & DICT_FLAG_DUP_REPLACE) {
+	    myfree(ht->value);
+	    ht->value = mystrdup(value);
+	    DICT_ERR_VAL_RETURN(dict, DICT_ERR_NONE, DICT_STAT_SUCCESS);
+	} else if (dict->flags & DICT_FLAG_DUP_WARN)
+	    msg_warn("%s: duplicate entry: \"%s\"", dict->name, name);
+	else
+	    msg_fatal("%s: duplicate entry: \"%s\"", dict->name, name);
+	DICT_ERR_VAL_RETURN(dict, DICT_ERR_NONE, DICT_STAT_FAIL);
+    }
+
+    /*
+     * Remember the order in which keys were added, so that a sequence
+     * operation on the result produces the same order.
+     */
+    if (dict_mmapm->order_len >= dict_mmapm->order_size) {
+	dict_mmapm->order_size *= 2;
+	dict_mmapm->order = (HTABLE_INFO **)
+	    myrealloc((void *) dict_mmapm->order,
+		      dict_mmapm->order_size * sizeof(*dict_mmapm->order));
+    }
+    ht = htable_enter(dict_mmapm->table, name, mystrdup(value));
+    dict_mmapm->order[dict_mmapm->order_len++] = ht;
+    DICT_ERR_VAL_RETURN(dict, DICT_ERR_NONE, DICT_STAT_SUCCESS);
+}
+
+/* dict_mmapm_build - serialize the table */
+
+static char *dict_mmapm_build(DICT_MMAPM *dict_mmapm, size_t *size)
+{
+    DICT_MMAP_HEADER *hp;
+    DICT_MMAP_BUCKET *buckets;
+    DICT_MMAP_BUCKET *bp;
+    DICT_MMAP_RECORD *rp;
+    HTABLE_INFO *ht;
+    uint32_t bucket_count;
+    uint32_t mask;
+    uint32_t slot;
+    uint32_t hash;
+    size_t  offset;
+    size_t  key_len;
+    size_t  val_len;
+    char   *buf;
+    ssize_t n;
+
+    /*
+     * Compute the file size. The hash table is at most half full, so that a
+     * lookup for a missing key ends quickly.
+     */
+    for (bucket_count = 8; bucket_count < 2 * dict_mmapm->order_len; /* */ ) {
+	if (bucket_count > DICT_MMAP_MAX_SIZE / 2 / sizeof(*bp))
+	    msg_fatal("%s: too many entries", dict_mmapm->tmp_path);
+	bucket_count *= 2;
+    }
+    offset = sizeof(*hp) + bucket_count * sizeof(*bp);
+    for (n = 0; n < dict_mmapm->order_len; n++) {
+	ht = dict_mmapm->order[n];
+	key_len = strlen(ht->key);
+	val_len = strlen(ht->value);
+	if (key_len > DICT_MMAP_MAX_SIZE || val_len > DICT_MMAP_MAX_SIZE
+	    || DICT_MMAP_MAX_SIZE - offset
+	    < DICT_MMAP_RECORD_SIZE(key_len, val_len))
+	    msg_fatal("%s: database would exceed %lu bytes",
+		      dict_mmapm->tmp_path, (unsigned long) DICT_MMAP_MAX_SIZE);
+	offset += DICT_MMAP_RECORD_SIZE(key_len, val_len);
+    }
+    *size = offset;
+
+    /*
+     * Fill in the header, hash table and records.
+     */
+    buf = mymalloc(*size);
+    memset(buf, 0, *size);
+    hp = (DICT_MMAP_HEADER *) buf;
+    hp->magic = DICT_MMAP_MAGIC;
+    hp->version = DICT_MMAP_VERSION;
+    ldseed(&hp->seed, sizeof(hp->seed));
+    hp->count = dict_mmapm->order_len;
+    hp->bucket_count = bucket_count;
+    hp->bucket_offset = sizeof(*hp);
+    hp->record_offset = hp->bucket_offset + bucket_count * sizeof(*bp);
+    hp->size = *size;
+
+    buckets = (DICT_MMAP_BUCKET *) (buf + hp->bucket_offset);
+    mask = bucket_count - 1;
+    offset = hp->record_offset;
+    for (n = 0; n < dict_mmapm->order_len; n++) {
+	ht = dict_mmapm->order[n];
+	rp = (DICT_MMAP_RECORD *) (buf + offset);
+	rp->key_len = strlen(ht->key);
+	rp->val_len = strlen(ht->value);
+	memcpy((char *) DICT_MMAP_KEY(rp), ht->key, rp->key_len + 1);
+	memcpy((char *) DICT_MMAP_VALUE(rp), ht->value, rp->val_len + 1);
+	hash = dict_mmap_hash(hp->seed, ht->key, rp->key_len);
+	for (slot = hash & mask; buckets[slot].offset != 0; slot = (slot + 1) & mask)
+	     /* void */ ;
+	bp = buckets + slot;
+	bp->hash = hash;
+	bp->offset = offset;
+	offset += DICT_MMAP_RECORD_SIZE(rp->key_len, rp->val_len);
+    }
+    return (buf);
+}
+
+/* dict_mmapm_close - write table and rename file.tmp to file.mmap */
+
+static void dict_mmapm_close(DICT *dict)
+{
+    DICT_MMAPM *dict_mmapm = (DICT_MMAPM *) dict;
+    char   *buf;
+    size_t  size;
+
+    /*
+     * Note: if FCNTL locking is used, closing any file descriptor on a
+     * locked file cancels all locks that the process may have on that file.
+     * We use the same file descriptor for writing and locking.
+     */
+    buf = dict_mmapm_build(dict_mmapm, &size);
+    if (write_buf(dict_mmapm->fd, buf, size, 0) != size)
+	msg_fatal("write database %s: %m", dict_mmapm->tmp_path);
+    myfree(buf);
+    if (rename(dict_mmapm->tmp_path, dict_mmapm->mmap_path) < 0)
+	msg_fatal("rename database from %s to %s: %m",
+		  dict_mmapm->tmp_path, dict_mmapm->mmap_path);
+    if (close(dict_mmapm->fd) < 0)		/* releases a lock */
+	msg_fatal("close database %s: %m", dict_mmapm->mmap_path);
+    htable_free(dict_mmapm->table, myfree);
+    myfree((void *) dict_mmapm->order);
+    myfree(dict_mmapm->mmap_path);
+    myfree(dict_mmapm->tmp_path);
+    if (dict->fold_buf)
+	vstring_free(dict->fold_buf);
+    dict_free(dict);
+}
+
+/* dict_mmapm_open - create database as file.tmp */
+
+static DICT *dict_mmapm_open(const char *path, int dict_flags)
+{
+    DICT_MMAPM *dict_mmapm;
+    char   *mmap_path;
+    char   *tmp_path;
+    int     fd;
+    struct stat st0, st1;
+
+    /*
+     * Let the optimizer worry about eliminating redundant code.
+     */
+#define DICT_MMAPM_OPEN_RETURN(d) do { \
+	DICT *__d = (d); \
+	if (mmap_path) \
+	    myfree(mmap_path); \
+	if (tmp_path) \
+	    myfree(tmp_path); \
+	return (__d); \
+    } while (0)
+
+    mmap_path = concatenate(path, DICT_MMAP_SUFFIX, (char *) 0);
+    tmp_path = concatenate(path, DICT_MMAP_TMP_SUFFIX, (char *) 0);
+
+    /*
+     * Repeat until we have opened *and* locked *existing* file. See
+     * dict_cdb(3) for the race conditions that this avoids.
+     */
+    for (;;) {
+	if ((fd = open(tmp_path, O_RDWR | O_CREAT, 0644)) < 0)
+	    DICT_MMAPM_OPEN_RETURN(dict_surrogate(DICT_TYPE_MMAP, path,
+						  O_RDWR, dict_flags,
+						  "open database %s: %m",
+						  tmp_path));
+	if (fstat(fd, &st0) < 0)
+	    msg_fatal("fstat(%s): %m", tmp_path);
+	if (myflock(fd, INTERNAL_LOCK, MYFLOCK_OP_EXCLUSIVE) < 0)
+	    msg_fatal("lock %s: %m", tmp_path);
+	if (stat(tmp_path, &st1) < 0)
+	    msg_fatal("stat(%s): %m", tmp_path);
+	if (st0.st_ino == st1.st_ino && st0.st_dev == st1.st_dev
+	    && st0.st_rdev == st1.st_rdev && st0.st_nlink == st1.st_nlink
+	    && st0.st_nlink > 0)
+	    break;				/* successfully opened */
+	close(fd);
+    }
+    if (st1.st_size > 0 && ftruncate(fd, (off_t) 0) < 0)
+	msg_fatal("truncate %s: %m", tmp_path);
+
+    dict_mmapm = (DICT_MMAPM *) dict_alloc(DICT_TYPE_MMAP, path,
+					   sizeof(*dict_mmapm));
+    dict_mmapm->dict.close = dict_mmapm_close;
+    dict_mmapm->dict.update = dict_mmapm_update;
+    dict_mmapm->fd = fd;
+    dict_mmapm->mmap_path = mmap_path;
+    dict_mmapm->tmp_path = tmp_path;
+    mmap_path = tmp_path = 0;			/* DICT_MMAPM_OPEN_RETURN() */
+    dict_mmapm->table = htable_create(100);
+    dict_mmapm->order_size = 100;
+    dict_mmapm->order_len = 0;
+    dict_mmapm->order = (HTABLE_INFO **)
+	mymalloc(dict_mmapm->order_size * sizeof(*dict_mmapm->order));
+    dict_mmapm->dict.owner.uid = st1.st_uid;
+    dict_mmapm->dict.owner.status = (st1.st_uid != 0);
+    close_on_exec(fd, CLOSE_ON_EXEC);
+
+    dict_mmapm->dict.flags = dict_flags | DICT_FLAG_FIXED;
+    if (dict_flags & DICT_FLAG_FOLD_FIX)
+	dict_mmapm->dict.fold_buf = vstring_alloc(10);
+
+    DICT_MMAPM_OPEN_RETURN(&dict_mmapm->dict);
+}
+
+/* dict_mmap_open - open data base for query mode or create mode */
+
+DICT   *dict_mmap_open(const char *path, int open_flags, int dict_flags)
+{
+    switch (open_flags & (O_RDONLY | O_RDWR | O_WRONLY | O_CREAT | O_TRUNC)) {
+    case O_RDONLY:				/* query mode */
+	return (dict_mmapq_open(path, dict_flags));
+    case O_WRONLY | O_CREAT | O_TRUNC:		/* create mode */
+    case O_RDWR | O_CREAT | O_TRUNC:		/* sloppiness */
+	return (dict_mmapm_open(path, dict_flags));
+    case O_RDWR | O_CREAT:
+    case O_RDWR:
+	/* User error. */
+	return (dict_surrogate(DICT_TYPE_MMAP, path, open_flags, dict_flags,
+			       "unsupported non-bulk change request"));
+    default:
+	/* Programmer error. */
+	msg_fatal("dict_mmap_open: inappropriate open flags for mmap database"
+		  " - specify O_RDONLY or O_WRONLY|O_CREAT|O_TRUNC");
+    }
+}
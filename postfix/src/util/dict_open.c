@@ -380,6 +380,7 @@
 #include <dict_random.h>
 #include <dict_union.h>
 #include <dict_inline.h>
+#include <dict_mmap.h>
 #include <stringops.h>
 #include <split_at.h>
 #include <htable.h>
@@ -412,6 +413,7 @@ static const DICT_OPEN_INFO dict_open_info[] = {
     DICT_TYPE_STATIC, dict_static_open, 0,
     DICT_TYPE_CIDR, dict_cidr_open, 0,
     DICT_TYPE_THASH, dict_thash_open, 0,
+    DICT_TYPE_MMAP, dict_mmap_open, mkmap_mmap_open,
     DICT_TYPE_SOCKMAP, dict_sockmap_open, 0,
     DICT_TYPE_FAIL, dict_fail_open, mkmap_fail_open,
     DICT_TYPE_PIPE, dict_pipe_open, 0,
@@ -456,6 +458,7 @@ static DICT_MAPNAMES_EXTEND_FN dict_mapnames_extend_hook;
   */
 DEFINE_DICT_LMDB_MAP_SIZE;
 DEFINE_DICT_DB_CACHE_SIZE;
+DEFINE_DICT_PCRE_STAT_INTERVAL;
 
  /*
   * Replace obscure code with a more readable expression.
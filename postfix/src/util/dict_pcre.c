@@ -10,10 +10,36 @@
 /*	const char *name;
 /*	int	dummy;
 /*	int	dict_flags;
+/*
+/*	extern int dict_pcre_stat_interval;
+/*
+/*	DEFINE_DICT_PCRE_STAT_INTERVAL;
 /* DESCRIPTION
 /*	dict_pcre_open() opens the named file and compiles the contained
 /*	regular expressions. The result object can be used to match strings
 /*	against the table.
+/*
+/*	When the global re_prefilter_enable variable is non-zero,
+/*	dict_pcre_open() also builds a literal substring prefilter
+/*	(see re_prefilter(3)). A lookup then scans the lookup string
+/*	once, and skips patterns whose required literal substring
+/*	is absent. This does not change lookup results.
+/*
+/*	Patterns are JIT compiled when the library supports this,
+/*	and all JIT compiled patterns in a table share one JIT stack
+/*	that can grow to 512kB. With PCRE2, all patterns in a table
+/*	also share one match_data block that is sized for the pattern
+/*	with the most capturing subpatterns.
+/*
+/*	When the global dict_pcre_stat_interval variable is positive,
+/*	dict_pcre_open() also collects per-pattern statistics: the
+/*	number of evaluations, the number of matches, and the time
+/*	spent. The statistics for the most expensive patterns are
+/*	logged and reset after every dict_pcre_stat_interval lookups,
+/*	and when the table is closed. This variable cannot be exported
+/*	via the dict(3) API and must therefore be defined in the
+/*	calling program by invoking the DEFINE_DICT_PCRE_STAT_INTERVAL
+/*	macro at the global level.
 /* SEE ALSO
 /*	dict(3) generic dictionary manager
 /*	pcre_table(5) PCRE table configuration
@@ -42,6 +68,7 @@
 /* System library. */
 
 #include <sys/stat.h>
+#include <sys/time.h>
 #include <stdio.h>			/* sprintf() prototype */
 #include <stdlib.h>
 #include <unistd.h>
@@ -75,6 +102,13 @@
 #include "mac_parse.h"
 #include "warn_stat.h"
 #include "mvect.h"
+#include "re_prefilter.h"
+
+ /*
+  * JIT stack for patterns that need more than the default 32kB.
+  */
+#define DICT_PCRE_JIT_STACK_MIN	(32 * 1024)
+#define DICT_PCRE_JIT_STACK_MAX	(512 * 1024)
 
  /*
   * Backwards compatibility.
@@ -82,8 +116,11 @@
 #if HAS_PCRE == 1
  /* PCRE Legacy JIT supprt. */
 #ifdef PCRE_STUDY_JIT_COMPILE
+#define DICT_PCRE_STUDY_OPTIONS	PCRE_STUDY_JIT_COMPILE
 #define DICT_PCRE_FREE_STUDY(x)	pcre_free_study(x)
+#define DICT_PCRE_LEGACY_JIT
 #else
+#define DICT_PCRE_STUDY_OPTIONS	0
 #define DICT_PCRE_FREE_STUDY(x)	pcre_free((char *) (x))
 #endif
 
@@ -91,10 +128,12 @@
 #define DICT_PCRE_CODE		pcre
 #define DICT_PCRE_CODE_FREE(x)	myfree((void *) (x))
 
- /* Old-style hints versus new-style match_data. */
+ /* Old-style per-pattern hints. */
 #define DICT_PCRE_MATCH_HINT_TYPE pcre_extra *
 #define DICT_PCRE_MATCH_HINT_NAME hints
 #define DICT_PCRE_MATCH_HINT(x) ((x)->DICT_PCRE_MATCH_HINT_NAME)
+#define DICT_PCRE_MATCH_HINT_SAVE(x, y) \
+	(DICT_PCRE_MATCH_HINT(x) = DICT_PCRE_MATCH_HINT(y))
 #define DICT_PCRE_MATCH_HINT_FREE(x) do { \
 	if (DICT_PCRE_MATCH_HINT(x)) \
 	    DICT_PCRE_FREE_STUDY(DICT_PCRE_MATCH_HINT(x)); \
@@ -121,12 +160,12 @@
 #define DICT_PCRE_CODE		pcre2_code
 #define DICT_PCRE_CODE_FREE(x)	pcre2_code_free(x)
 
- /* PCRE2 Old-style hints versus new-style match_data. */
-#define DICT_PCRE_MATCH_HINT_TYPE pcre2_match_data *
-#define DICT_PCRE_MATCH_HINT_NAME match_data
-#define DICT_PCRE_MATCH_HINT(x)	((x)->DICT_PCRE_MATCH_HINT_NAME)
-#define DICT_PCRE_MATCH_HINT_FREE(x) \
-	pcre2_match_data_free(DICT_PCRE_MATCH_HINT(x))
+ /*
+  * PCRE2 has no per-pattern hints. Instead, all patterns in a table share
+  * one match_data block, which is allocated after the table is loaded.
+  */
+#define DICT_PCRE_MATCH_HINT_SAVE(x, y)	((void) 0)
+#define DICT_PCRE_MATCH_HINT_FREE(x)	((void) 0)
 
  /* PCRE2 Pattern options. */
 #define DICT_PCRE_CASELESS	PCRE2_CASELESS
@@ -168,7 +207,9 @@ typedef struct {
 
 typedef struct {
     DICT_PCRE_CODE *pattern;		/* the compiled pattern */
+#ifdef DICT_PCRE_MATCH_HINT_TYPE
     DICT_PCRE_MATCH_HINT_TYPE DICT_PCRE_MATCH_HINT_NAME;
+#endif
 } DICT_PCRE_ENGINE;
 
  /*
@@ -177,13 +218,19 @@ typedef struct {
 typedef struct DICT_PCRE_RULE {
     int     op;				/* DICT_PCRE_OP_MATCH/IF/ENDIF */
     int     lineno;			/* source file line number */
+    int     prefilter;			/* required literal, or none */
+    unsigned long evals;		/* statistics: pattern evaluations */
+    unsigned long hits;			/* statistics: pattern matches */
+    unsigned long usecs;		/* statistics: time spent */
     struct DICT_PCRE_RULE *next;	/* next rule in dict */
 } DICT_PCRE_RULE;
 
 typedef struct {
     DICT_PCRE_RULE rule;		/* generic part */
     DICT_PCRE_CODE *pattern;		/* compiled pattern */
+#ifdef DICT_PCRE_MATCH_HINT_TYPE
     DICT_PCRE_MATCH_HINT_TYPE DICT_PCRE_MATCH_HINT_NAME;
+#endif
     char   *replacement;		/* replacement string */
     int     match;			/* positive or negative match */
     size_t  max_sub;			/* largest $number in replacement */
@@ -192,7 +239,9 @@ typedef struct {
 typedef struct {
     DICT_PCRE_RULE rule;		/* generic members */
     DICT_PCRE_CODE *pattern;		/* compiled pattern */
+#ifdef DICT_PCRE_MATCH_HINT_TYPE
     DICT_PCRE_MATCH_HINT_TYPE DICT_PCRE_MATCH_HINT_NAME;
+#endif
     int     match;			/* positive or negative match */
     struct DICT_PCRE_RULE *endif_rule;	/* matching endif rule */
 } DICT_PCRE_IF_RULE;
@@ -204,8 +253,34 @@ typedef struct {
     DICT    dict;			/* generic members */
     DICT_PCRE_RULE *head;
     VSTRING *expansion_buf;		/* lookup result */
+    RE_PREFILTER *prefilter;		/* required literal finder */
+#ifdef DICT_PCRE_LEGACY_JIT
+    pcre_jit_stack *jit_stack;		/* JIT stack, or null */
+#endif
+#if HAS_PCRE == 2
+    pcre2_match_data *match_data;	/* shared by all patterns */
+    pcre2_match_context *match_context;	/* JIT stack, or null */
+    pcre2_jit_stack *jit_stack;		/* JIT stack, or null */
+#endif
+    int     stat_interval;		/* lookups between reports */
+    unsigned long stat_lookups;		/* lookups since last report */
 } DICT_PCRE;
 
+ /*
+  * Statistics. Log the most expensive patterns only.
+  */
+#define DICT_PCRE_STAT_TOP	10
+
+#define DICT_PCRE_STAT_START(dict_pcre, start) do { \
+	if ((dict_pcre)->stat_interval > 0) \
+	    GETTIMEOFDAY(&(start)); \
+    } while (0)
+
+#define DICT_PCRE_STAT_UPDATE(dict_pcre, rule, start, matched) do { \
+	if ((dict_pcre)->stat_interval > 0) \
+	    dict_pcre_stat_update((rule), &(start), (matched)); \
+    } while (0)
+
 #if HAS_PCRE == 1
 static int dict_pcre_init = 0;		/* flag need to init pcre library */
 
@@ -251,6 +326,13 @@ typedef struct {
 #define NULL_STARTOFFSET	(0)
 #define NULL_EXEC_OPTIONS 	(0)
 
+ /*
+  * A positive pattern cannot match when its required literal is absent.
+  */
+#define DICT_PCRE_PREFILTER_SKIP(dict_pcre, rule) \
+    ((rule)->prefilter != RE_PREFILTER_NONE \
+     && !re_prefilter_found((dict_pcre)->prefilter, (rule)->prefilter))
+
 /* dict_pcre_expand - replace $number with matched text */
 
 static int dict_pcre_expand(int type, VSTRING *buf, void *ptr)
@@ -395,23 +477,91 @@ static void dict_pcre_exec_error(const char *mapname, int lineno, int errval)
   * Inlined to reduce function call overhead in the time-critical loop.
   */
 #if HAS_PCRE == 1
-#define DICT_PCRE_EXEC(ctxt, map, line, pattern, hints, match, str, len) \
-    ((ctxt).matches = pcre_exec((pattern), (hints), (str), (len), \
+#define DICT_PCRE_EXEC(ctxt, dict_pcre, r, str, len) \
+    ((ctxt).matches = pcre_exec((r)->pattern, DICT_PCRE_MATCH_HINT(r), \
+				(str), (len), \
 				NULL_STARTOFFSET, NULL_EXEC_OPTIONS, \
 				(ctxt).offsets, PCRE_MAX_CAPTURE * 3), \
-     (ctxt).matches > 0 ? (match) : \
-     (ctxt).matches == PCRE_ERROR_NOMATCH ? !(match) : \
-     (dict_pcre_exec_error((map), (line), (ctxt).matches), 0))
+     (ctxt).matches > 0 ? (r)->match : \
+     (ctxt).matches == PCRE_ERROR_NOMATCH ? !(r)->match : \
+     (dict_pcre_exec_error((dict_pcre)->dict.name, (r)->rule.lineno, \
+			   (ctxt).matches), 0))
 #else
-#define DICT_PCRE_EXEC(ctxt, map, line, pattern, match_data, match, str, len) \
-    ((ctxt).matches = pcre2_match((pattern), (unsigned char *) (str), (len), \
-				NULL_STARTOFFSET, NULL_EXEC_OPTIONS, \
-				(match_data), (pcre2_match_context *) 0), \
-     (ctxt).matches > 0 ? (match) : \
-     (ctxt).matches == PCRE2_ERROR_NOMATCH ? !(match) : \
-     (dict_pcre_exec_error((map), (line), (ctxt).matches), 0))
+#define DICT_PCRE_EXEC(ctxt, dict_pcre, r, str, len) \
+    ((ctxt).matches = pcre2_match((r)->pattern, (unsigned char *) (str), \
+				(len), NULL_STARTOFFSET, NULL_EXEC_OPTIONS, \
+				(dict_pcre)->match_data, \
+				(dict_pcre)->match_context), \
+     (ctxt).matches > 0 ? (r)->match : \
+     (ctxt).matches == PCRE2_ERROR_NOMATCH ? !(r)->match : \
+     (dict_pcre_exec_error((dict_pcre)->dict.name, (r)->rule.lineno, \
+			   (ctxt).matches), 0))
 #endif
 
+/* dict_pcre_stat_update - update pattern statistics */
+
+static void dict_pcre_stat_update(DICT_PCRE_RULE *rule,
+				          struct timeval *start, int matched)
+{
+    struct timeval now;
+
+    GETTIMEOFDAY(&now);
+    rule->evals += 1;
+    rule->hits += (matched != 0);
+    rule->usecs += (now.tv_sec - start->tv_sec) * 1000000
+	+ (now.tv_usec - start->tv_usec);
+}
+
+/* dict_pcre_stat_compar - sort patterns by decreasing time spent */
+
+static int dict_pcre_stat_compar(const void *a, const void *b)
+{
+    DICT_PCRE_RULE *ra = *(DICT_PCRE_RULE **) a;
+    DICT_PCRE_RULE *rb = *(DICT_PCRE_RULE **) b;
+
+    return (ra->usecs < rb->usecs ? 1 : ra->usecs > rb->usecs ? -1 :
+	    ra->lineno - rb->lineno);
+}
+
+/* dict_pcre_stat_log_reset - log and reset pattern statistics */
+
+static void dict_pcre_stat_log_reset(DICT_PCRE *dict_pcre)
+{
+    DICT_PCRE_RULE *rule;
+    DICT_PCRE_RULE **sorted;
+    int     count = 0;
+    int     n;
+    unsigned long evals = 0;
+    unsigned long usecs = 0;
+
+    for (rule = dict_pcre->head; rule; rule = rule->next)
+	if (rule->evals > 0)
+	    count++;
+    sorted = (DICT_PCRE_RULE **) mymalloc(sizeof(*sorted) * (count + 1));
+    for (count = 0, rule = dict_pcre->head; rule; rule = rule->next) {
+	if (rule->evals > 0) {
+	    sorted[count++] = rule;
+	    evals += rule->evals;
+	    usecs += rule->usecs;
+	}
+    }
+    qsort((void *) sorted, count, sizeof(*sorted), dict_pcre_stat_compar);
+    msg_info("pcre map %s: lookups=%lu evaluations=%lu time=%lu.%03lums",
+	     dict_pcre->dict.name, dict_pcre->stat_lookups, evals,
+	     usecs / 1000, usecs % 1000);
+    for (n = 0; n < count && n < DICT_PCRE_STAT_TOP; n++) {
+	rule = sorted[n];
+	msg_info("pcre map %s, line %d: evaluations=%lu matches=%lu "
+		 "time=%lu.%03lums", dict_pcre->dict.name, rule->lineno,
+		 rule->evals, rule->hits, rule->usecs / 1000,
+		 rule->usecs % 1000);
+    }
+    myfree((void *) sorted);
+    for (rule = dict_pcre->head; rule; rule = rule->next)
+	rule->evals = rule->hits = rule->usecs = 0;
+    dict_pcre->stat_lookups = 0;
+}
+
 /* dict_pcre_lookup - match string and perform optional substitution */
 
 static const char *dict_pcre_lookup(DICT *dict, const char *lookup_string)
@@ -422,12 +572,23 @@ static const char *dict_pcre_lookup(DICT *dict, const char *lookup_string)
     DICT_PCRE_MATCH_RULE *match_rule;
     int     lookup_len = strlen(lookup_string);
     DICT_PCRE_EXPAND_CONTEXT ctxt;
+    struct timeval start;
+    int     matched;
 
     dict->error = 0;
 
     if (msg_verbose)
 	msg_info("dict_pcre_lookup: %s: %s", dict->name, lookup_string);
 
+    /*
+     * Optionally report statistics.
+     */
+    if (dict_pcre->stat_interval > 0) {
+	if (dict_pcre->stat_lookups >= dict_pcre->stat_interval)
+	    dict_pcre_stat_log_reset(dict_pcre);
+	dict_pcre->stat_lookups += 1;
+    }
+
     /*
      * Optionally fold the key.
      */
@@ -437,6 +598,8 @@ static const char *dict_pcre_lookup(DICT *dict, const char *lookup_string)
 	vstring_strcpy(dict->fold_buf, lookup_string);
 	lookup_string = lowercase(vstring_str(dict->fold_buf));
     }
+    if (dict_pcre->prefilter)
+	re_prefilter_scan(dict_pcre->prefilter, lookup_string);
     for (rule = dict_pcre->head; rule; rule = rule->next) {
 
 	switch (rule->op) {
@@ -446,10 +609,13 @@ static const char *dict_pcre_lookup(DICT *dict, const char *lookup_string)
 	     */
 	case DICT_PCRE_OP_MATCH:
 	    match_rule = (DICT_PCRE_MATCH_RULE *) rule;
-	    if (!DICT_PCRE_EXEC(ctxt, dict->name, rule->lineno,
-				match_rule->pattern,
-				DICT_PCRE_MATCH_HINT(match_rule),
-			      match_rule->match, lookup_string, lookup_len))
+	    if (DICT_PCRE_PREFILTER_SKIP(dict_pcre, rule))
+		continue;
+	    DICT_PCRE_STAT_START(dict_pcre, start);
+	    matched = DICT_PCRE_EXEC(ctxt, dict_pcre, match_rule,
+				     lookup_string, lookup_len);
+	    DICT_PCRE_STAT_UPDATE(dict_pcre, rule, start, matched);
+	    if (!matched)
 		continue;
 
 	    /*
@@ -470,7 +636,7 @@ static const char *dict_pcre_lookup(DICT *dict, const char *lookup_string)
 #if HAS_PCRE == 1
 	    ctxt.match_rule = match_rule;
 #else
-	    ctxt.ovector = pcre2_get_ovector_pointer(match_rule->match_data);
+	    ctxt.ovector = pcre2_get_ovector_pointer(dict_pcre->match_data);
 #endif
 	    ctxt.lookup_string = lookup_string;
 
@@ -490,11 +656,14 @@ static const char *dict_pcre_lookup(DICT *dict, const char *lookup_string)
 	     */
 	case DICT_PCRE_OP_IF:
 	    if_rule = (DICT_PCRE_IF_RULE *) rule;
-	    if (DICT_PCRE_EXEC(ctxt, dict->name, rule->lineno,
-			       if_rule->pattern,
-			       DICT_PCRE_MATCH_HINT(if_rule),
-			       if_rule->match, lookup_string, lookup_len))
-		continue;
+	    if (!DICT_PCRE_PREFILTER_SKIP(dict_pcre, rule)) {
+		DICT_PCRE_STAT_START(dict_pcre, start);
+		matched = DICT_PCRE_EXEC(ctxt, dict_pcre, if_rule,
+					 lookup_string, lookup_len);
+		DICT_PCRE_STAT_UPDATE(dict_pcre, rule, start, matched);
+		if (matched)
+		    continue;
+	    }
 	    /* An IF without matching ENDIF has no "endif" rule. */
 	    if ((rule = if_rule->endif_rule) == 0)
 		return (0);
@@ -523,6 +692,8 @@ static void dict_pcre_close(DICT *dict)
     DICT_PCRE_MATCH_RULE *match_rule;
     DICT_PCRE_IF_RULE *if_rule;
 
+    if (dict_pcre->stat_lookups > 0)
+	dict_pcre_stat_log_reset(dict_pcre);
     for (rule = dict_pcre->head; rule; rule = next) {
 	next = rule->next;
 	switch (rule->op) {
@@ -549,6 +720,20 @@ static void dict_pcre_close(DICT *dict)
     }
     if (dict_pcre->expansion_buf)
 	vstring_free(dict_pcre->expansion_buf);
+    if (dict_pcre->prefilter)
+	re_prefilter_free(dict_pcre->prefilter);
+#ifdef DICT_PCRE_LEGACY_JIT
+    if (dict_pcre->jit_stack)
+	pcre_jit_stack_free(dict_pcre->jit_stack);
+#endif
+#if HAS_PCRE == 2
+    if (dict_pcre->match_data)
+	pcre2_match_data_free(dict_pcre->match_data);
+    if (dict_pcre->match_context)
+	pcre2_match_context_free(dict_pcre->match_context);
+    if (dict_pcre->jit_stack)
+	pcre2_jit_stack_free(dict_pcre->jit_stack);
+#endif
     if (dict->fold_buf)
 	vstring_free(dict->fold_buf);
     dict_free(dict);
@@ -703,7 +888,8 @@ static int dict_pcre_compile(const char *mapname, int lineno,
 		 mapname, lineno, errptr, error);
 	return (0);
     }
-    engine->hints = pcre_study(engine->pattern, 0, &error);
+    engine->hints = pcre_study(engine->pattern, DICT_PCRE_STUDY_OPTIONS,
+				&error);
     if (error != 0) {
 	msg_warn("pcre map %s, line %d: error while studying regex: %s",
 		 mapname, lineno, error);
@@ -726,11 +912,19 @@ static int dict_pcre_compile(const char *mapname, int lineno,
 	vstring_free(buf);
 	return (0);
     }
-    engine->match_data = pcre2_match_data_create_from_pattern(
-					       engine->pattern, (void *) 0);
-    /* 202604 Claude: handle error result. */
-    if (engine->match_data == 0)
-	msg_fatal("out of memory in pcre2_match_data_create_from_pattern()");
+
+    /*
+     * Use JIT code when the library supports it. Otherwise, pcre2_match()
+     * falls back to the interpreter.
+     */
+    if ((error = pcre2_jit_compile(engine->pattern, PCRE2_JIT_COMPLETE)) != 0
+	&& msg_verbose) {
+	VSTRING *buf = vstring_alloc(DICT_PCRE_GET_ERROR_BUF_LEN);
+
+	msg_info("pcre map %s, line %d: no JIT code: %s",
+		 mapname, lineno, dict_pcre_get_error(buf, error));
+	vstring_free(buf);
+    }
 #endif
     return (1);
 }
@@ -744,11 +938,27 @@ static DICT_PCRE_RULE *dict_pcre_rule_alloc(int op, int lineno, size_t size)
     rule = (DICT_PCRE_RULE *) mymalloc(size);
     rule->op = op;
     rule->lineno = lineno;
+    rule->prefilter = RE_PREFILTER_NONE;
+    rule->evals = rule->hits = rule->usecs = 0;
     rule->next = 0;
 
     return (rule);
 }
 
+/* dict_pcre_prefilter_add - add positive pattern to prefilter */
+
+static void dict_pcre_prefilter_add(DICT *dict, DICT_PCRE_RULE *rule,
+				            DICT_PCRE_REGEXP *regexp)
+{
+    DICT_PCRE *dict_pcre = (DICT_PCRE *) dict;
+
+    if (dict_pcre->prefilter != 0 && regexp->match != 0
+	&& (regexp->options & DICT_PCRE_EXTENDED) == 0)
+	rule->prefilter = re_prefilter_add(dict_pcre->prefilter,
+					   regexp->regexp,
+					   RE_PREFILTER_FLAG_PCRE);
+}
+
 /* dict_pcre_parse_rule - parse and compile one rule */
 
 static DICT_PCRE_RULE *dict_pcre_parse_rule(DICT *dict, const char *mapname,
@@ -900,7 +1110,8 @@ static DICT_PCRE_RULE *dict_pcre_parse_rule(DICT *dict, const char *mapname,
 	else
 	    match_rule->replacement = mystrdup(p);
 	match_rule->pattern = engine.pattern;
-	DICT_PCRE_MATCH_HINT(match_rule) = DICT_PCRE_MATCH_HINT(&engine);
+	DICT_PCRE_MATCH_HINT_SAVE(match_rule, &engine);
+	dict_pcre_prefilter_add(dict, &match_rule->rule, &regexp);
 	return ((DICT_PCRE_RULE *) match_rule);
     }
 
@@ -948,8 +1159,9 @@ static DICT_PCRE_RULE *dict_pcre_parse_rule(DICT *dict, const char *mapname,
 				 sizeof(DICT_PCRE_IF_RULE));
 	if_rule->match = regexp.match;
 	if_rule->pattern = engine.pattern;
-	DICT_PCRE_MATCH_HINT(if_rule) = DICT_PCRE_MATCH_HINT(&engine);
+	DICT_PCRE_MATCH_HINT_SAVE(if_rule, &engine);
 	if_rule->endif_rule = 0;
+	dict_pcre_prefilter_add(dict, &if_rule->rule, &regexp);
 	return ((DICT_PCRE_RULE *) if_rule);
     }
 
@@ -997,6 +1209,111 @@ static DICT_PCRE_RULE *dict_pcre_parse_rule(DICT *dict, const char *mapname,
     }
 }
 
+#ifdef DICT_PCRE_LEGACY_JIT
+
+/* dict_pcre_jit_stack_assign - give JIT compiled patterns a larger stack */
+
+static void dict_pcre_jit_stack_assign(DICT_PCRE *dict_pcre)
+{
+    DICT_PCRE_RULE *rule;
+    DICT_PCRE_CODE *pattern;
+    pcre_extra *hints;
+    int     is_jit;
+    int     jit_count = 0;
+
+    /*
+     * JIT code uses a 32kB machine stack by default. Allow for larger
+     * patterns, instead of failing the match. As with PCRE2, all patterns
+     * in a table share one stack.
+     */
+    for (rule = dict_pcre->head; rule; rule = rule->next) {
+	if (rule->op == DICT_PCRE_OP_MATCH) {
+	    pattern = ((DICT_PCRE_MATCH_RULE *) rule)->pattern;
+	    hints = ((DICT_PCRE_MATCH_RULE *) rule)->hints;
+	} else if (rule->op == DICT_PCRE_OP_IF) {
+	    pattern = ((DICT_PCRE_IF_RULE *) rule)->pattern;
+	    hints = ((DICT_PCRE_IF_RULE *) rule)->hints;
+	} else
+	    continue;
+	if (hints == 0
+	    || pcre_fullinfo(pattern, hints, PCRE_INFO_JIT, &is_jit) != 0
+	    || is_jit == 0)
+	    continue;
+	if (dict_pcre->jit_stack == 0
+	    && (dict_pcre->jit_stack =
+		pcre_jit_stack_alloc(DICT_PCRE_JIT_STACK_MIN,
+				     DICT_PCRE_JIT_STACK_MAX)) == 0)
+	    break;
+	pcre_assign_jit_stack(hints, (pcre_jit_callback) 0,
+			      dict_pcre->jit_stack);
+	jit_count++;
+    }
+    if (msg_verbose)
+	msg_info("pcre map %s: %d JIT compiled patterns",
+		 dict_pcre->dict.name, jit_count);
+}
+
+#endif					/* DICT_PCRE_LEGACY_JIT */
+
+#if HAS_PCRE == 2
+
+/* dict_pcre_match_data_create - allocate match data shared by all patterns */
+
+static void dict_pcre_match_data_create(DICT_PCRE *dict_pcre)
+{
+    DICT_PCRE_RULE *rule;
+    DICT_PCRE_CODE *pattern;
+    uint32_t capture_count;
+    uint32_t max_capture = 0;
+    size_t  jit_size;
+    int     jit_count = 0;
+
+    /*
+     * Size the match data for the pattern with the most capturing
+     * subpatterns. A match data block that is too small would make
+     * pcre2_match() return zero.
+     */
+    for (rule = dict_pcre->head; rule; rule = rule->next) {
+	if (rule->op == DICT_PCRE_OP_MATCH)
+	    pattern = ((DICT_PCRE_MATCH_RULE *) rule)->pattern;
+	else if (rule->op == DICT_PCRE_OP_IF)
+	    pattern = ((DICT_PCRE_IF_RULE *) rule)->pattern;
+	else
+	    continue;
+	if (pcre2_pattern_info(pattern, PCRE2_INFO_CAPTURECOUNT,
+			       (void *) &capture_count) != 0)
+	    msg_panic("pcre map %s, line %d: pcre2_pattern_info failed",
+		      dict_pcre->dict.name, rule->lineno);
+	if (capture_count > max_capture)
+	    max_capture = capture_count;
+	if (pcre2_pattern_info(pattern, PCRE2_INFO_JITSIZE,
+			       (void *) &jit_size) == 0 && jit_size > 0)
+	    jit_count++;
+    }
+    dict_pcre->match_data = pcre2_match_data_create(max_capture + 1,
+						    (void *) 0);
+    if (dict_pcre->match_data == 0)
+	msg_fatal("out of memory in pcre2_match_data_create()");
+
+    /*
+     * JIT code uses a 32kB machine stack by default. Allow for larger
+     * patterns, instead of failing the match.
+     */
+    if (jit_count > 0
+	&& (dict_pcre->jit_stack =
+	    pcre2_jit_stack_create(DICT_PCRE_JIT_STACK_MIN,
+				   DICT_PCRE_JIT_STACK_MAX, (void *) 0)) != 0
+	&& (dict_pcre->match_context =
+	    pcre2_match_context_create((void *) 0)) != 0)
+	pcre2_jit_stack_assign(dict_pcre->match_context, (void *) 0,
+			       (void *) dict_pcre->jit_stack);
+    if (msg_verbose)
+	msg_info("pcre map %s: %d JIT compiled patterns, %lu captures",
+		 dict_pcre->dict.name, jit_count, (unsigned long) max_capture);
+}
+
+#endif					/* HAS_PCRE == 2 */
+
 /* dict_pcre_open - load and compile a file containing regular expressions */
 
 DICT   *dict_pcre_open(const char *mapname, int open_flags, int dict_flags)
@@ -1058,6 +1375,17 @@ DICT   *dict_pcre_open(const char *mapname, int open_flags, int dict_flags)
 	dict_pcre->dict.fold_buf = vstring_alloc(10);
     dict_pcre->head = 0;
     dict_pcre->expansion_buf = 0;
+    dict_pcre->prefilter = re_prefilter_enable ? re_prefilter_create() : 0;
+#ifdef DICT_PCRE_LEGACY_JIT
+    dict_pcre->jit_stack = 0;
+#endif
+#if HAS_PCRE == 2
+    dict_pcre->match_data = 0;
+    dict_pcre->match_context = 0;
+    dict_pcre->jit_stack = 0;
+#endif
+    dict_pcre->stat_interval = dict_pcre_stat_interval;
+    dict_pcre->stat_lookups = 0;
 
 #if HAS_PCRE == 1
     if (dict_pcre_init == 0) {
@@ -1117,6 +1445,25 @@ DICT   *dict_pcre_open(const char *mapname, int open_flags, int dict_flags)
     if (rule_stack)
 	(void) mvect_free(&mvect);
 
+    /*
+     * Finish the prefilter, or discard it when no pattern has a usable
+     * literal.
+     */
+    if (dict_pcre->prefilter) {
+	if (re_prefilter_count(dict_pcre->prefilter) > 0) {
+	    re_prefilter_compile(dict_pcre->prefilter);
+	} else {
+	    re_prefilter_free(dict_pcre->prefilter);
+	    dict_pcre->prefilter = 0;
+	}
+    }
+#ifdef DICT_PCRE_LEGACY_JIT
+    dict_pcre_jit_stack_assign(dict_pcre);
+#endif
+#if HAS_PCRE == 2
+    dict_pcre_match_data_create(dict_pcre);
+#endif
+
     dict_file_purge_buffers(&dict_pcre->dict);
     DICT_PCRE_OPEN_RETURN(&dict_pcre->dict);
 }
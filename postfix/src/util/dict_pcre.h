@@ -23,6 +23,13 @@
 
 extern DICT *dict_pcre_open(const char *, int, int);
 
+ /*
+  * XXX Should be part of the DICT interface.
+  */
+extern int dict_pcre_stat_interval;
+
+#define DEFINE_DICT_PCRE_STAT_INTERVAL int dict_pcre_stat_interval = 0
+
 /* LICENSE
 /* .ad
 /* .fi
@@ -14,6 +14,12 @@
 /*	dict_regexp_open() opens the named file and compiles the contained
 /*	regular expressions. The result object can be used to match strings
 /*	against the table.
+/*
+/*	When the global re_prefilter_enable variable is non-zero,
+/*	dict_regexp_open() also builds a literal substring prefilter
+/*	(see re_prefilter(3)). A lookup then scans the lookup string
+/*	once, and skips patterns whose required literal substring
+/*	is absent. This does not change lookup results.
 /* SEE ALSO
 /*	dict(3) generic dictionary manager
 /*	regexp_table(5) regular expression table configuration
@@ -68,6 +74,7 @@
 #include "mac_parse.h"
 #include "warn_stat.h"
 #include "mvect.h"
+#include "re_prefilter.h"
 
  /*
   * Support for IF/ENDIF based on an idea by Bert Driehuis.
@@ -91,6 +98,7 @@ typedef struct {
 typedef struct DICT_REGEXP_RULE {
     int     op;				/* DICT_REGEXP_OP_MATCH/IF/ENDIF */
     int     lineno;			/* source file line number */
+    int     prefilter;			/* required literal, or none */
     struct DICT_REGEXP_RULE *next;	/* next rule in dict */
 } DICT_REGEXP_RULE;
 
@@ -119,6 +127,7 @@ typedef struct {
     regmatch_t *pmatch;			/* matched substring info */
     DICT_REGEXP_RULE *head;		/* first rule */
     VSTRING *expansion_buf;		/* lookup result */
+    RE_PREFILTER *prefilter;		/* required literal finder */
 } DICT_REGEXP;
 
  /*
@@ -127,6 +136,13 @@ typedef struct {
 #define NULL_SUBSTITUTIONS	(0)
 #define NULL_MATCH_RESULT	((regmatch_t *) 0)
 
+ /*
+  * A positive pattern cannot match when its required literal is absent.
+  */
+#define DICT_REGEXP_PREFILTER_SKIP(dict_regexp, rule) \
+    ((rule)->prefilter != RE_PREFILTER_NONE \
+     && !re_prefilter_found((dict_regexp)->prefilter, (rule)->prefilter))
+
  /*
   * Context for $number expansion callback.
   */
@@ -237,6 +253,8 @@ static const char *dict_regexp_lookup(DICT *dict, const char *lookup_string)
 	vstring_strcpy(dict->fold_buf, lookup_string);
 	lookup_string = lowercase(vstring_str(dict->fold_buf));
     }
+    if (dict_regexp->prefilter)
+	re_prefilter_scan(dict_regexp->prefilter, lookup_string);
     for (rule = dict_regexp->head; rule; rule = rule->next) {
 
 	switch (rule->op) {
@@ -247,6 +265,8 @@ static const char *dict_regexp_lookup(DICT *dict, const char *lookup_string)
 	     */
 	case DICT_REGEXP_OP_MATCH:
 	    match_rule = (DICT_REGEXP_MATCH_RULE *) rule;
+	    if (DICT_REGEXP_PREFILTER_SKIP(dict_regexp, rule))
+		continue;
 	    if (!DICT_REGEXP_REGEXEC(error, dict->name, rule->lineno,
 				     match_rule->first_exp,
 				     match_rule->first_match,
@@ -297,9 +317,10 @@ static const char *dict_regexp_lookup(DICT *dict, const char *lookup_string)
 	     */
 	case DICT_REGEXP_OP_IF:
 	    if_rule = (DICT_REGEXP_IF_RULE *) rule;
-	    if (DICT_REGEXP_REGEXEC(error, dict->name, rule->lineno,
+	    if (!DICT_REGEXP_PREFILTER_SKIP(dict_regexp, rule)
+		&& DICT_REGEXP_REGEXEC(error, dict->name, rule->lineno,
 			       if_rule->expr, if_rule->match, lookup_string,
-				    NULL_SUBSTITUTIONS, NULL_MATCH_RESULT))
+				       NULL_SUBSTITUTIONS, NULL_MATCH_RESULT))
 		continue;
 	    /* An IF without matching ENDIF has no "endif" rule. */
 	    if ((rule = if_rule->endif_rule) == 0)
@@ -363,6 +384,8 @@ static void dict_regexp_close(DICT *dict)
 	myfree((void *) dict_regexp->pmatch);
     if (dict_regexp->expansion_buf)
 	vstring_free(dict_regexp->expansion_buf);
+    if (dict_regexp->prefilter)
+	re_prefilter_free(dict_regexp->prefilter);
     if (dict->fold_buf)
 	vstring_free(dict->fold_buf);
     dict_free(dict);
@@ -539,11 +562,25 @@ static DICT_REGEXP_RULE *dict_regexp_rule_alloc(int op, int lineno, size_t size)
     rule = (DICT_REGEXP_RULE *) mymalloc(size);
     rule->op = op;
     rule->lineno = lineno;
+    rule->prefilter = RE_PREFILTER_NONE;
     rule->next = 0;
 
     return (rule);
 }
 
+/* dict_regexp_prefilter_add - add positive POSIX ERE to prefilter */
+
+static void dict_regexp_prefilter_add(DICT *dict, DICT_REGEXP_RULE *rule,
+				              DICT_REGEXP_PATTERN *pat)
+{
+    DICT_REGEXP *dict_regexp = (DICT_REGEXP *) dict;
+
+    if (dict_regexp->prefilter != 0 && pat->match != 0
+	&& (pat->options & REG_EXTENDED) != 0)
+	rule->prefilter = re_prefilter_add(dict_regexp->prefilter,
+					   pat->regexp, RE_PREFILTER_FLAG_NONE);
+}
+
 /* dict_regexp_parseline - parse one rule */
 
 static DICT_REGEXP_RULE *dict_regexp_parseline(DICT *dict, const char *mapname,
@@ -675,6 +712,7 @@ static DICT_REGEXP_RULE *dict_regexp_parseline(DICT *dict, const char *mapname,
 	    match_rule->replacement = prescan_context.literal;
 	else
 	    match_rule->replacement = mystrdup(p);
+	dict_regexp_prefilter_add(dict, &match_rule->rule, &first_pat);
 	return ((DICT_REGEXP_RULE *) match_rule);
     }
 
@@ -707,6 +745,7 @@ static DICT_REGEXP_RULE *dict_regexp_parseline(DICT *dict, const char *mapname,
 	if_rule->expr = expr;
 	if_rule->match = pattern.match;
 	if_rule->endif_rule = 0;
+	dict_regexp_prefilter_add(dict, &if_rule->rule, &pattern);
 	return ((DICT_REGEXP_RULE *) if_rule);
     }
 
@@ -805,6 +844,7 @@ DICT   *dict_regexp_open(const char *mapname, int open_flags, int dict_flags)
     dict_regexp->head = 0;
     dict_regexp->pmatch = 0;
     dict_regexp->expansion_buf = 0;
+    dict_regexp->prefilter = re_prefilter_enable ? re_prefilter_create() : 0;
     dict_regexp->dict.owner.uid = st.st_uid;
     dict_regexp->dict.owner.status = (st.st_uid != 0);
 
@@ -859,6 +899,19 @@ DICT   *dict_regexp_open(const char *mapname, int open_flags, int dict_flags)
     if (rule_stack)
 	(void) mvect_free(&mvect);
 
+    /*
+     * Finish the prefilter, or discard it when no pattern has a usable
+     * literal.
+     */
+    if (dict_regexp->prefilter) {
+	if (re_prefilter_count(dict_regexp->prefilter) > 0) {
+	    re_prefilter_compile(dict_regexp->prefilter);
+	} else {
+	    re_prefilter_free(dict_regexp->prefilter);
+	    dict_regexp->prefilter = 0;
+	}
+    }
+
     /*
      * Allocate space for only as many matched substrings as used in the
      * replacement text.
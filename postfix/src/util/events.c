@@ -156,7 +156,7 @@
 #include "mymalloc.h"
 #include "msg.h"
 #include "iostuff.h"
-#include "ring.h"
+#include "binhash.h"
 #include "events.h"
 
 #if !defined(EVENTS_STYLE)
@@ -499,8 +499,475 @@ typedef struct epoll_event EVENT_BUFFER;
 #endif
 
  /*
-  * Timer events. Timer requests are kept sorted, in a circular list. We use
-  * the RING abstraction, so we get to use a couple ugly macros.
+  * Linux io_uring. We use io_uring as a kernel-based event filter with
+  * one-shot IORING_OP_POLL_ADD requests. The important difference with
+  * epoll is that filter updates do not cost a system call each: requests to
+  * add or remove a descriptor are queued in the submission ring, and are
+  * submitted in bulk with the same io_uring_enter() system call that waits
+  * for events. A descriptor is re-armed after its event is delivered, unless
+  * the application has disabled or changed the request in the meantime.
+  * Because a one-shot poll request checks the descriptor state when it is
+  * armed, this preserves the level-triggered semantics that the rest of
+  * this module depends on.
+  * 
+  * We label each poll request with the file descriptor and a per-descriptor
+  * generation number. The generation number is incremented whenever an
+  * application disables a descriptor, so that we can discard completions
+  * for requests that are no longer wanted, even when a descriptor number is
+  * reused before a queued removal request reaches the kernel.
+  * 
+  * io_uring may be unavailable at runtime (old kernel, or disabled by
+  * policy). In that case we use epoll instead. To keep event_loop() simple,
+  * io_uring completions are converted into epoll event records.
+  */
+#if (EVENTS_STYLE == EVENTS_STYLE_IO_URING)
+#include <sys/epoll.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <signal.h>
+#include <poll.h>
+#include <linux/io_uring.h>
+
+typedef struct epoll_event EVENT_BUFFER;
+
+typedef struct {
+    int     fd;				/* file descriptor */
+    unsigned gen;			/* generation number */
+} EVENT_URING_REARM;
+
+typedef struct {
+    int     ring_fd;			/* io_uring handle */
+    void   *ring_map;			/* SQ and CQ rings */
+    size_t  ring_map_len;
+    struct io_uring_sqe *sqes;		/* submission queue entries */
+    size_t  sqes_map_len;
+    unsigned *sq_head;			/* kernel-owned */
+    unsigned *sq_tail;			/* application-owned */
+    unsigned *sq_array;
+    unsigned sq_mask;
+    unsigned sq_entries;
+    unsigned sq_pending;		/* queued, not yet submitted */
+    unsigned *cq_head;			/* application-owned */
+    unsigned *cq_tail;			/* kernel-owned */
+    struct io_uring_cqe *cqes;
+    unsigned cq_mask;
+} EVENT_URING;
+
+static EVENT_URING *event_uring;	/* null: use epoll */
+static int event_epollfd = -1;		/* epoll fall-back handle */
+static unsigned *event_uring_gen;	/* per-descriptor generation */
+static char *event_uring_armed;		/* per-descriptor poll request */
+static int event_uring_slots;		/* per-descriptor table size */
+static EVENT_URING_REARM *event_uring_rearm;	/* last delivered events */
+static int event_uring_rearm_count;
+
+#define EVENT_URING_ENTRIES	256	/* submission ring size */
+#define EVENT_URING_REMOVE_UD	(~(__u64) 0)	/* removal completions */
+
+#define EVENT_URING_UD(fd, gen)	(((__u64) (gen) << 32) | (unsigned) (fd))
+#define EVENT_URING_UD_FD(ud)	((int) ((ud) & 0xffffffff))
+#define EVENT_URING_UD_GEN(ud)	((unsigned) ((ud) >> 32))
+
+#if __BYTE_ORDER == __BIG_ENDIAN
+#define EVENT_URING_POLL_MASK(ev) \
+	((((__u32) (ev)) << 16) | (((__u32) (ev)) >> 16))
+#else
+#define EVENT_URING_POLL_MASK(ev) ((__u32) (ev))
+#endif
+
+#define event_uring_load_acquire(p)	__atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define event_uring_store_release(p, v) \
+	__atomic_store_n((p), (v), __ATOMIC_RELEASE)
+
+/* event_uring_enter - submit queued requests, optionally wait */
+
+static int event_uring_enter(unsigned min_complete, int delay)
+{
+    struct io_uring_getevents_arg arg;
+    struct __kernel_timespec ts;
+    unsigned flags = 0;
+    int     ret;
+
+    if (min_complete > 0) {
+	flags = IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG;
+	memset((void *) &arg, 0, sizeof(arg));
+	arg.sigmask_sz = _NSIG / 8;
+	if (delay >= 0) {
+	    ts.tv_sec = delay;
+	    ts.tv_nsec = 0;
+	    arg.ts = (__u64) (unsigned long) &ts;
+	}
+    }
+    ret = syscall(__NR_io_uring_enter, event_uring->ring_fd,
+		  event_uring->sq_pending, min_complete, flags,
+		  min_complete > 0 ? (void *) &arg : (void *) 0,
+		  min_complete > 0 ? sizeof(arg) : 0);
+    if (ret >= 0) {
+	event_uring->sq_pending -= (ret < event_uring->sq_pending ?
+				    ret : event_uring->sq_pending);
+    } else if (errno == ETIME) {
+	ret = 0;
+    }
+    return (ret);
+}
+
+/* event_uring_get_sqe - allocate submission queue entry */
+
+static struct io_uring_sqe *event_uring_get_sqe(void)
+{
+    struct io_uring_sqe *sqe;
+    unsigned tail = *event_uring->sq_tail;
+    unsigned idx;
+
+    /*
+     * Flush the submission ring when it is full. This is the only case where
+     * a filter update costs a system call of its own.
+     */
+    while (tail - event_uring_load_acquire(event_uring->sq_head)
+	   >= event_uring->sq_entries) {
+	if (event_uring_enter(0, 0) < 0 && errno != EINTR && errno != EAGAIN
+	    && errno != EBUSY)
+	    msg_fatal("io_uring_enter: %m");
+    }
+    idx = tail & event_uring->sq_mask;
+    sqe = event_uring->sqes + idx;
+    memset((void *) sqe, 0, sizeof(*sqe));
+    event_uring->sq_array[idx] = idx;
+    return (sqe);
+}
+
+/* event_uring_put_sqe - make submission queue entry visible to the kernel */
+
+static void event_uring_put_sqe(void)
+{
+    event_uring_store_release(event_uring->sq_tail, *event_uring->sq_tail + 1);
+    event_uring->sq_pending += 1;
+}
+
+/* event_uring_close - destroy ring */
+
+static void event_uring_close(void)
+{
+    if (event_uring->sqes)
+	(void) munmap((void *) event_uring->sqes, event_uring->sqes_map_len);
+    if (event_uring->ring_map)
+	(void) munmap(event_uring->ring_map, event_uring->ring_map_len);
+    (void) close(event_uring->ring_fd);
+    myfree((void *) event_uring);
+    event_uring = 0;
+}
+
+/* event_uring_open - create ring, or return -1 */
+
+static int event_uring_open(void)
+{
+    struct io_uring_params params;
+    EVENT_URING *ur;
+    char   *ring;
+    size_t  sq_len;
+    size_t  cq_len;
+    int     fd;
+
+    memset((void *) &params, 0, sizeof(params));
+    if ((fd = syscall(__NR_io_uring_setup, EVENT_URING_ENTRIES, &params)) < 0)
+	return (-1);
+
+    /*
+     * We need the single-mmap layout (Linux 5.4), completions that are not
+     * dropped when the completion ring is full (Linux 5.5), and wait
+     * time limits without a timeout request (Linux 5.11).
+     */
+#define EVENT_URING_FEATURES \
+	(IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG)
+
+    if ((params.features & EVENT_URING_FEATURES) != EVENT_URING_FEATURES) {
+	(void) close(fd);
+	errno = ENOTSUP;
+	return (-1);
+    }
+    ur = (EVENT_URING *) mymalloc(sizeof(*ur));
+    memset((void *) ur, 0, sizeof(*ur));
+    ur->ring_fd = fd;
+    event_uring = ur;
+
+    sq_len = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_len = params.cq_off.cqes
+	+ params.cq_entries * sizeof(struct io_uring_cqe);
+    ur->ring_map_len = (sq_len > cq_len ? sq_len : cq_len);
+    if ((ring = mmap((void *) 0, ur->ring_map_len, PROT_READ | PROT_WRITE,
+		     MAP_SHARED | MAP_POPULATE, fd,
+		     IORING_OFF_SQ_RING)) == MAP_FAILED) {
+	ur->ring_map = 0;
+	event_uring_close();
+	return (-1);
+    }
+    ur->ring_map = (void *) ring;
+    ur->sqes_map_len = params.sq_entries * sizeof(struct io_uring_sqe);
+    if ((ur->sqes = (struct io_uring_sqe *)
+	 mmap((void *) 0, ur->sqes_map_len, PROT_READ | PROT_WRITE,
+	      MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES)) == MAP_FAILED) {
+	ur->sqes = 0;
+	event_uring_close();
+	return (-1);
+    }
+    ur->sq_head = (unsigned *) (ring + params.sq_off.head);
+    ur->sq_tail = (unsigned *) (ring + params.sq_off.tail);
+    ur->sq_array = (unsigned *) (ring + params.sq_off.array);
+    ur->sq_mask = *(unsigned *) (ring + params.sq_off.ring_mask);
+    ur->sq_entries = *(unsigned *) (ring + params.sq_off.ring_entries);
+    ur->cq_head = (unsigned *) (ring + params.cq_off.head);
+    ur->cq_tail = (unsigned *) (ring + params.cq_off.tail);
+    ur->cq_mask = *(unsigned *) (ring + params.cq_off.ring_mask);
+    ur->cqes = (struct io_uring_cqe *) (ring + params.cq_off.cqes);
+    close_on_exec(fd, CLOSE_ON_EXEC);
+    return (0);
+}
+
+/* event_uring_extend - make room for more descriptor slots */
+
+static int event_uring_extend(int slots)
+{
+    if (event_uring_slots == 0) {
+	event_uring_gen = (unsigned *) mymalloc(slots * sizeof(*event_uring_gen));
+	event_uring_armed = mymalloc(slots);
+    } else if (slots > event_uring_slots) {
+	event_uring_gen = (unsigned *) myrealloc((void *) event_uring_gen,
+					       slots * sizeof(*event_uring_gen));
+	event_uring_armed = myrealloc(event_uring_armed, slots);
+    }
+    if (slots > event_uring_slots) {
+	memset((void *) (event_uring_gen + event_uring_slots), 0,
+	       (slots - event_uring_slots) * sizeof(*event_uring_gen));
+	memset(event_uring_armed + event_uring_slots, 0,
+	       slots - event_uring_slots);
+	event_uring_slots = slots;
+    }
+    return (0);
+}
+
+/* event_uring_init - open io_uring or epoll handle */
+
+static int event_uring_init(int slots)
+{
+    if (event_uring_open() == 0) {
+	(void) event_uring_extend(slots);
+	memset(event_uring_armed, 0, event_uring_slots);
+	event_uring_rearm_count = 0;
+	return (0);
+    }
+    if (msg_verbose)
+	msg_info("io_uring is unavailable: %m; using epoll instead");
+    if ((event_epollfd = epoll_create(slots)) >= 0)
+	close_on_exec(event_epollfd, CLOSE_ON_EXEC);
+    return (event_epollfd);
+}
+
+/* event_uring_fork - replace handle after fork() */
+
+static int event_uring_fork(int slots)
+{
+    if (event_uring != 0)
+	event_uring_close();
+    if (event_epollfd >= 0) {
+	(void) close(event_epollfd);
+	event_epollfd = -1;
+    }
+    return (event_uring_init(slots));
+}
+
+/* event_uring_add - queue request for read or write events */
+
+static int event_uring_add(int fd, int events)
+{
+    struct io_uring_sqe *sqe;
+    struct epoll_event dummy;
+
+    if (event_uring == 0) {
+	dummy.events = events;
+	dummy.data.fd = fd;
+	return (epoll_ctl(event_epollfd, EPOLL_CTL_ADD, fd, &dummy));
+    }
+    sqe = event_uring_get_sqe();
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = fd;
+    sqe->poll32_events = EVENT_URING_POLL_MASK(events);
+    sqe->user_data = EVENT_URING_UD(fd, event_uring_gen[fd]);
+    event_uring_put_sqe();
+    event_uring_armed[fd] = 1;
+    return (0);
+}
+
+/* event_uring_del - queue removal of read or write request */
+
+static int event_uring_del(int fd, int events)
+{
+    struct io_uring_sqe *sqe;
+    struct epoll_event dummy;
+
+    if (event_uring == 0) {
+	dummy.events = events;
+	dummy.data.fd = fd;
+	return (epoll_ctl(event_epollfd, EPOLL_CTL_DEL, fd, &dummy));
+    }
+    if (event_uring_armed[fd]) {
+	sqe = event_uring_get_sqe();
+	sqe->opcode = IORING_OP_POLL_REMOVE;
+	sqe->fd = -1;
+	sqe->addr = EVENT_URING_UD(fd, event_uring_gen[fd]);
+	sqe->user_data = EVENT_URING_REMOVE_UD;
+	event_uring_put_sqe();
+	event_uring_armed[fd] = 0;
+    }
+    event_uring_gen[fd] += 1;
+    return (0);
+}
+
+/* event_uring_read - submit pending requests, and wait for events */
+
+static int event_uring_read(EVENT_BUFFER *event_buf, int buflen, int delay)
+{
+    EVENT_URING_REARM *rp;
+    struct io_uring_cqe *cqe;
+    unsigned head;
+    unsigned tail;
+    int     event_count;
+    int     fd;
+
+    if (event_uring == 0)
+	return (epoll_wait(event_epollfd, event_buf, buflen,
+			   delay < 0 ? -1 : delay * 1000));
+
+    /*
+     * Re-arm one-shot requests for events that were delivered in the
+     * previous round, if the application still wants them.
+     */
+    if (event_uring_rearm == 0)
+	event_uring_rearm = (EVENT_URING_REARM *)
+	    mymalloc(buflen * sizeof(*event_uring_rearm));
+    for (rp = event_uring_rearm; rp < event_uring_rearm
+	 + event_uring_rearm_count; rp++) {
+	fd = rp->fd;
+	if (event_uring_gen[fd] != rp->gen || event_uring_armed[fd])
+	    continue;
+	if (EVENT_MASK_ISSET(fd, &event_rmask))
+	    (void) event_uring_add(fd, POLLIN);
+	else if (EVENT_MASK_ISSET(fd, &event_wmask))
+	    (void) event_uring_add(fd, POLLOUT);
+    }
+    event_uring_rearm_count = 0;
+
+    /*
+     * Submit all queued filter updates, and wait for a completion only if
+     * none is available yet.
+     */
+    head = *event_uring->cq_head;
+    if (head != event_uring_load_acquire(event_uring->cq_tail) || delay == 0) {
+	if (event_uring->sq_pending > 0 && event_uring_enter(0, 0) < 0)
+	    return (-1);
+    } else if (event_uring_enter(1, delay) < 0) {
+	return (-1);
+    }
+
+    /*
+     * Convert completions into epoll event records, and skip completions
+     * for requests that the application no longer wants.
+     */
+    tail = event_uring_load_acquire(event_uring->cq_tail);
+    for (event_count = 0; head != tail && event_count < buflen
+	 && event_uring_rearm_count < buflen; head++) {
+	cqe = event_uring->cqes + (head & event_uring->cq_mask);
+	if (cqe->user_data == EVENT_URING_REMOVE_UD)
+	    continue;
+	fd = EVENT_URING_UD_FD(cqe->user_data);
+	if (fd < 0 || fd >= event_uring_slots
+	    || event_uring_gen[fd] != EVENT_URING_UD_GEN(cqe->user_data))
+	    continue;
+	event_uring_armed[fd] = 0;
+
+	/*
+	 * A cancelled request is re-armed without reporting an event. Any
+	 * other error is reported once as an exception, and the request is
+	 * not re-armed, so that a persistent error does not fire in every
+	 * round.
+	 */
+	if (cqe->res >= 0 || cqe->res == -ECANCELED) {
+	    event_uring_rearm[event_uring_rearm_count].fd = fd;
+	    event_uring_rearm[event_uring_rearm_count].gen = event_uring_gen[fd];
+	    event_uring_rearm_count += 1;
+	    if (cqe->res < 0)
+		continue;
+	} else {
+	    msg_warn("io_uring poll request for fd %d: %s",
+		     fd, strerror(-cqe->res));
+	}
+	event_buf[event_count].events = (cqe->res < 0 ? POLLERR : cqe->res);
+	event_buf[event_count].data.fd = fd;
+	event_count += 1;
+    }
+    event_uring_store_release(event_uring->cq_head, head);
+    return (event_count);
+}
+
+ /*
+  * Macros to initialize the kernel-based filter; see event_init().
+  */
+#define EVENT_REG_INIT_HANDLE(er, n) do { \
+	er = event_uring_init(n); \
+    } while (0)
+#define EVENT_REG_INIT_TEXT	"io_uring_setup or epoll_create"
+
+#define EVENT_REG_FORK_HANDLE(er, n) do { \
+	er = event_uring_fork(n); \
+    } while (0)
+
+#define EVENT_REG_UPD_HANDLE(er, n) do { \
+	er = event_uring_extend(n); \
+    } while (0)
+#define EVENT_REG_UPD_TEXT	"io_uring descriptor table"
+
+ /*
+  * Macros to update the kernel-based filter; see event_enable_read(),
+  * event_enable_write() and event_disable_readwrite().
+  */
+#define EVENT_REG_ADD_READ(e, f)   ((e) = event_uring_add((f), POLLIN))
+#define EVENT_REG_ADD_WRITE(e, f)  ((e) = event_uring_add((f), POLLOUT))
+#define EVENT_REG_ADD_TEXT         "io_uring poll add or epoll_ctl EPOLL_CTL_ADD"
+
+#define EVENT_REG_DEL_READ(e, f)   ((e) = event_uring_del((f), POLLIN))
+#define EVENT_REG_DEL_WRITE(e, f)  ((e) = event_uring_del((f), POLLOUT))
+#define EVENT_REG_DEL_TEXT         "io_uring poll remove or epoll_ctl EPOLL_CTL_DEL"
+
+ /*
+  * Macros to retrieve event buffers from the kernel; see event_loop().
+  */
+#define EVENT_BUFFER_READ(event_count, event_buf, buflen, delay) do { \
+	(event_count) = event_uring_read((event_buf), (buflen), (delay)); \
+    } while (0)
+#define EVENT_BUFFER_READ_TEXT	"io_uring_enter or epoll_wait"
+
+ /*
+  * Macros to process event buffers from the kernel; see event_loop().
+  */
+#define EVENT_GET_FD(bp)	((bp)->data.fd)
+#define EVENT_GET_TYPE(bp)	((bp)->events)
+#define EVENT_TEST_READ(bp)	(EVENT_GET_TYPE(bp) & EPOLLIN)
+#define EVENT_TEST_WRITE(bp)	(EVENT_GET_TYPE(bp) & EPOLLOUT)
+
+#endif
+
+ /*
+  * Timer events. Timer requests are kept in a binary heap that is ordered
+  * by (time, request sequence number), so that the next timer is always at
+  * the top, and so that insert, reset, cancel and expire cost O(log n)
+  * instead of a linear walk over a sorted list. The heap position is stored
+  * in the timer request itself. A (callback, context) hash table index
+  * finds an existing request in O(1) time, as required by the "one request
+  * per (callback, context) pair" semantics of event_request_timer() and
+  * event_cancel_timer().
+  * 
+  * The request sequence number preserves the behavior of the sorted list that
+  * this code replaces: requests for the same time slot are delivered in the
+  * order that they were (re)scheduled.
   * 
   * When a call-back function adds a timer request, we label the request with
   * the event_loop() call instance that invoked the call-back. We use this to
@@ -514,20 +981,36 @@ struct EVENT_TIMER {
     EVENT_NOTIFY_TIME_FN callback;	/* callback function */
     char   *context;			/* callback context */
     long    loop_instance;		/* event_loop() call instance */
-    RING    ring;			/* linkage */
+    unsigned long seqno;		/* request sequence number */
+    ssize_t heap_pos;			/* position in timer heap */
 };
 
-static RING event_timer_head;		/* timer queue head */
+typedef struct {
+    EVENT_NOTIFY_TIME_FN callback;	/* callback function */
+    char   *context;			/* callback context */
+} EVENT_TIMER_KEY;
+
+static EVENT_TIMER **event_timer_heap;	/* timer queue, heap ordered */
+static ssize_t event_timer_count;	/* number of pending timers */
+static ssize_t event_timer_slots;	/* allocated heap slots */
+static BINHASH *event_timer_index;	/* (callback, context) lookup */
+static unsigned long event_timer_seqno;	/* request sequence number */
 static long event_loop_instance;	/* event_loop() call instance */
 
-#define RING_TO_TIMER(r) \
-	((EVENT_TIMER *) ((void *) (r) - offsetof(EVENT_TIMER, ring)))
+#define EVENT_TIMER_ALLOC_INCR	64
 
-#define FOREACH_QUEUE_ENTRY(entry, head) \
-	for (entry = ring_succ(head); entry != (head); entry = ring_succ(entry))
+#define EVENT_TIMER_BEFORE(t1, t2) \
+	((t1)->when < (t2)->when \
+	    || ((t1)->when == (t2)->when && (t1)->seqno < (t2)->seqno))
 
-#define FIRST_TIMER(head) \
-	(ring_succ(head) != (head) ? RING_TO_TIMER(ring_succ(head)) : 0)
+#define FIRST_TIMER() \
+	(event_timer_count > 0 ? event_timer_heap[0] : 0)
+
+#define EVENT_TIMER_KEY_INIT(key, cb, ctx) do { \
+	memset((void *) &(key), 0, sizeof(key)); \
+	(key).callback = (cb); \
+	(key).context = (char *) (ctx); \
+    } while (0)
 
  /*
   * Other private data structures.
@@ -591,7 +1074,11 @@ static void event_init(void)
     /*
      * Initialize timer stuff.
      */
-    ring_init(&event_timer_head);
+    event_timer_slots = EVENT_TIMER_ALLOC_INCR;
+    event_timer_heap = (EVENT_TIMER **)
+	mymalloc(sizeof(*event_timer_heap) * event_timer_slots);
+    event_timer_count = 0;
+    event_timer_index = binhash_create(EVENT_TIMER_ALLOC_INCR);
     (void) time(&event_present);
 
     /*
@@ -670,7 +1157,7 @@ void    event_drain(int time_limit)
     (void) time(&event_present);
     max_time = event_present + time_limit;
     while (event_present < max_time
-	   && (event_timer_head.pred != &event_timer_head
+	   && (event_timer_count > 0
 	       || EVENT_MASK_CMP(&zero_mask, &event_xmask) != 0)) {
 	event_loop(1);
 #if (EVENTS_STYLE != EVENTS_STYLE_SELECT)
@@ -889,12 +1376,105 @@ void    event_disable_readwrite(int fd)
     fdp->context = 0;
 }
 
+/* event_timer_sift_up - restore heap order towards the root */
+
+static void event_timer_sift_up(ssize_t pos)
+{
+    EVENT_TIMER *timer = event_timer_heap[pos];
+    EVENT_TIMER *parent;
+    ssize_t parent_pos;
+
+    while (pos > 0) {
+	parent_pos = (pos - 1) / 2;
+	parent = event_timer_heap[parent_pos];
+	if (!EVENT_TIMER_BEFORE(timer, parent))
+	    break;
+	event_timer_heap[pos] = parent;
+	parent->heap_pos = pos;
+	pos = parent_pos;
+    }
+    event_timer_heap[pos] = timer;
+    timer->heap_pos = pos;
+}
+
+/* event_timer_sift_down - restore heap order towards the leaves */
+
+static void event_timer_sift_down(ssize_t pos)
+{
+    EVENT_TIMER *timer = event_timer_heap[pos];
+    EVENT_TIMER *child;
+    ssize_t child_pos;
+
+    while ((child_pos = 2 * pos + 1) < event_timer_count) {
+	child = event_timer_heap[child_pos];
+	if (child_pos + 1 < event_timer_count
+	    && EVENT_TIMER_BEFORE(event_timer_heap[child_pos + 1], child))
+	    child = event_timer_heap[++child_pos];
+	if (!EVENT_TIMER_BEFORE(child, timer))
+	    break;
+	event_timer_heap[pos] = child;
+	child->heap_pos = pos;
+	pos = child_pos;
+    }
+    event_timer_heap[pos] = timer;
+    timer->heap_pos = pos;
+}
+
+/* event_timer_insert - add request to timer heap */
+
+static void event_timer_insert(EVENT_TIMER *timer)
+{
+    if (event_timer_count >= event_timer_slots) {
+	event_timer_slots *= 2;
+	event_timer_heap = (EVENT_TIMER **)
+	    myrealloc((void *) event_timer_heap,
+		      sizeof(*event_timer_heap) * event_timer_slots);
+    }
+    event_timer_heap[event_timer_count] = timer;
+    timer->heap_pos = event_timer_count++;
+    event_timer_sift_up(timer->heap_pos);
+}
+
+/* event_timer_remove - remove request from timer heap */
+
+static void event_timer_remove(EVENT_TIMER *timer)
+{
+    const char *myname = "event_timer_remove";
+    ssize_t pos = timer->heap_pos;
+    EVENT_TIMER *last;
+
+    if (pos < 0 || pos >= event_timer_count || event_timer_heap[pos] != timer)
+	msg_panic("%s: bad heap position %ld", myname, (long) pos);
+    last = event_timer_heap[--event_timer_count];
+    if (last != timer) {
+	event_timer_heap[pos] = last;
+	last->heap_pos = pos;
+	if (pos > 0 && EVENT_TIMER_BEFORE(last, event_timer_heap[(pos - 1) / 2]))
+	    event_timer_sift_up(pos);
+	else
+	    event_timer_sift_down(pos);
+    }
+    timer->heap_pos = -1;
+}
+
+/* event_timer_unlink - remove request from timer heap and index */
+
+static void event_timer_unlink(EVENT_TIMER *timer)
+{
+    EVENT_TIMER_KEY key;
+
+    event_timer_remove(timer);
+    EVENT_TIMER_KEY_INIT(key, timer->callback, timer->context);
+    binhash_delete(event_timer_index, (void *) &key, sizeof(key),
+		   (void (*) (void *)) 0);
+}
+
 /* event_request_timer - (re)set timer */
 
 time_t  event_request_timer(EVENT_NOTIFY_TIME_FN callback, void *context, int delay)
 {
     const char *myname = "event_request_timer";
-    RING   *ring;
+    EVENT_TIMER_KEY key;
     EVENT_TIMER *timer;
 
     if (EVENT_INIT_NEEDED())
@@ -916,46 +1496,40 @@ time_t  event_request_timer(EVENT_NOTIFY_TIME_FN callback, void *context, int de
      * request away from the timer queue so that it can be inserted at the
      * right place.
      */
-    FOREACH_QUEUE_ENTRY(ring, &event_timer_head) {
-	timer = RING_TO_TIMER(ring);
-	if (timer->callback == callback && timer->context == context) {
-	    timer->when = event_present + delay;
-	    timer->loop_instance = event_loop_instance;
-	    ring_detach(ring);
-	    if (msg_verbose > 2)
-		msg_info("%s: reset 0x%lx 0x%lx %d", myname,
-			 (long) callback, (long) context, delay);
-	    break;
-	}
+    EVENT_TIMER_KEY_INIT(key, callback, context);
+    if ((timer = (EVENT_TIMER *) binhash_find(event_timer_index, (void *) &key,
+					      sizeof(key))) != 0) {
+	timer->when = event_present + delay;
+	timer->loop_instance = event_loop_instance;
+	event_timer_remove(timer);
+	if (msg_verbose > 2)
+	    msg_info("%s: reset 0x%lx 0x%lx %d", myname,
+		     (long) callback, (long) context, delay);
     }
 
     /*
      * If not found, schedule a new timer request.
      */
-    if (ring == &event_timer_head) {
+    else {
 	timer = (EVENT_TIMER *) mymalloc(sizeof(EVENT_TIMER));
 	timer->when = event_present + delay;
 	timer->callback = callback;
 	timer->context = context;
 	timer->loop_instance = event_loop_instance;
+	binhash_enter(event_timer_index, (void *) &key, sizeof(key),
+		      (void *) timer);
 	if (msg_verbose > 2)
 	    msg_info("%s: set 0x%lx 0x%lx %d", myname,
 		     (long) callback, (long) context, delay);
     }
 
     /*
-     * Timer requests are kept sorted to reduce lookup overhead in the event
-     * loop.
-     * 
-     * XXX Append the new request after existing requests for the same time
+     * XXX Order the new request after existing requests for the same time
      * slot. The event_loop() routine depends on this to avoid starving I/O
      * events when a call-back function schedules a zero-delay timer request.
      */
-    FOREACH_QUEUE_ENTRY(ring, &event_timer_head) {
-	if (timer->when < RING_TO_TIMER(ring)->when)
-	    break;
-    }
-    ring_prepend(ring, &timer->ring);
+    timer->seqno = event_timer_seqno++;
+    event_timer_insert(timer);
 
     return (timer->when);
 }
@@ -965,7 +1539,7 @@ time_t  event_request_timer(EVENT_NOTIFY_TIME_FN callback, void *context, int de
 int     event_cancel_timer(EVENT_NOTIFY_TIME_FN callback, void *context)
 {
     const char *myname = "event_cancel_timer";
-    RING   *ring;
+    EVENT_TIMER_KEY key;
     EVENT_TIMER *timer;
     int     time_left = -1;
 
@@ -977,15 +1551,13 @@ int     event_cancel_timer(EVENT_NOTIFY_TIME_FN callback, void *context)
      * when the request is not found. It might have been canceled from some
      * other thread.
      */
-    FOREACH_QUEUE_ENTRY(ring, &event_timer_head) {
-	timer = RING_TO_TIMER(ring);
-	if (timer->callback == callback && timer->context == context) {
-	    if ((time_left = timer->when - event_present) < 0)
-		time_left = 0;
-	    ring_detach(ring);
-	    myfree((void *) timer);
-	    break;
-	}
+    EVENT_TIMER_KEY_INIT(key, callback, context);
+    if ((timer = (EVENT_TIMER *) binhash_find(event_timer_index, (void *) &key,
+					      sizeof(key))) != 0) {
+	if ((time_left = timer->when - event_present) < 0)
+	    time_left = 0;
+	event_timer_unlink(timer);
+	myfree((void *) timer);
     }
     if (msg_verbose > 2)
 	msg_info("%s: 0x%lx 0x%lx %d", myname,
@@ -1026,10 +1598,10 @@ void    event_loop(int delay)
      * XXX Also print the select() masks?
      */
     if (msg_verbose > 2) {
-	RING   *ring;
+	ssize_t pos;
 
-	FOREACH_QUEUE_ENTRY(ring, &event_timer_head) {
-	    timer = RING_TO_TIMER(ring);
+	for (pos = 0; pos < event_timer_count; pos++) {
+	    timer = event_timer_heap[pos];
 	    msg_info("%s: time left %3d for 0x%lx 0x%lx", myname,
 		     (int) (timer->when - event_present),
 		     (long) timer->callback, (long) timer->context);
@@ -1037,10 +1609,11 @@ void    event_loop(int delay)
     }
 
     /*
-     * Find out when the next timer would go off. Timer requests are sorted.
+     * Find out when the next timer would go off. The earliest timer request
+     * is at the top of the heap.
      * If any timer is scheduled, adjust the delay appropriately.
      */
-    if ((timer = FIRST_TIMER(&event_timer_head)) != 0) {
+    if ((timer = FIRST_TIMER()) != 0) {
 	event_present = time((time_t *) 0);
 	if ((select_delay = timer->when - event_present) < 0) {
 	    select_delay = 0;
@@ -1102,9 +1675,9 @@ void    event_loop(int delay)
 
     /*
      * Deliver timer events. Allow the application to add/delete timer queue
-     * requests while it is being called back. Requests are sorted: we keep
-     * running over the timer request queue from the start, and stop when we
-     * reach the future or the list end. We also stop when we reach a timer
+     * requests while it is being called back. Requests are heap ordered: we
+     * keep taking the earliest request from the timer queue, and stop when we
+     * reach the future or the queue end. We also stop when we reach a timer
      * request that was added by a call-back that was invoked from this
      * event_loop() call instance, for reasons that are explained below.
      * 
@@ -1119,18 +1692,18 @@ void    event_loop(int delay)
      * instance that invoked the timer event call-back. We use this instance
      * label here to prevent zero-delay timer requests from running in a
      * tight loop and starving I/O events. To make this solution work,
-     * event_request_timer() appends a new request after existing requests
+     * event_request_timer() orders a new request after existing requests
      * for the same time slot.
      */
     event_present = time((time_t *) 0);
     event_loop_instance += 1;
 
-    while ((timer = FIRST_TIMER(&event_timer_head)) != 0) {
+    while ((timer = FIRST_TIMER()) != 0) {
 	if (timer->when > event_present)
 	    break;
 	if (timer->loop_instance == event_loop_instance)
 	    break;
-	ring_detach(&timer->ring);		/* first this */
+	event_timer_unlink(timer);		/* first this */
 	if (msg_verbose > 2)
 	    msg_info("%s: timer 0x%lx 0x%lx", myname,
 		     (long) timer->callback, (long) timer->context);
@@ -0,0 +1,188 @@
+/*++
+/* NAME
+/*	events_bench 1
+/* SUMMARY
+/*	measure event timer request overhead
+/* SYNOPSIS
+/* .fi
+/*	\fBevents_bench\fR [\fB-v\fR] [\fB-n \fItimer_count\fR]
+/*		[\fB-r \fIrounds\fR]
+/* DESCRIPTION
+/*	The \fBevents_bench\fR command measures the cost of adding,
+/*	resetting, canceling and expiring large numbers of concurrent
+/*	timer requests with the \fBevents\fR(3) module, as happens in
+/*	servers that maintain per-connection or per-destination timers.
+/*
+/*	Each round adds \fItimer_count\fR timer requests with random
+/*	delays, resets each request once with a different random delay,
+/*	and cancels half of the requests. It then replaces the remaining
+/*	requests with zero-delay requests, and runs the event loop until
+/*	all requests have expired, while verifying that requests with
+/*	the same expiration time are delivered in request order.
+/*
+/*	Options:
+/* .IP "\fB-n \fItimer_count\fR (default: 100000)"
+/*	The number of concurrent timer requests.
+/* .IP "\fB-r \fIrounds\fR (default: 1)"
+/*	The number of times to repeat the measurement.
+/* .IP \fB-v\fR
+/*	Increase verbosity.
+/* DIAGNOSTICS
+/*	Problems are reported to the standard error stream.
+/* LICENSE
+/* .ad
+/* .fi
+/*	The Secure Mailer license must be distributed with this software.
+/*--*/
+
+/* System library. */
+
+#include <sys_defs.h>
+#include <sys/time.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/* Utility library. */
+
+#include <msg.h>
+#include <msg_vstream.h>
+#include <mymalloc.h>
+#include <myrand.h>
+#include <vstream.h>
+#include <events.h>
+
+ /*
+  * Each timer request needs its own (callback, context) pair. We use the
+  * address of an array element as the context.
+  */
+static long *timer_ctx;
+static long expired_count;
+static long expired_last;
+
+#define MAX_DELAY	3600
+
+/* elapsed - return elapsed time in seconds */
+
+static double elapsed(struct timeval *start)
+{
+    struct timeval now;
+
+    if (gettimeofday(&now, (struct timezone *) 0) < 0)
+	msg_fatal("gettimeofday: %m");
+    return ((now.tv_sec - start->tv_sec)
+	    + (now.tv_usec - start->tv_usec) / 1000000.0);
+}
+
+/* report - report the cost of one phase */
+
+static void report(const char *phase, long count, struct timeval *start)
+{
+    double  secs = elapsed(start);
+
+    vstream_printf("%-8s %8ld requests %8.3f s %10.0f requests/s\n",
+		   phase, count, secs, secs > 0 ? count / secs : 0);
+    vstream_fflush(VSTREAM_OUT);
+}
+
+/* timer_event - count expired timer, and verify delivery order */
+
+static void timer_event(int unused_event, void *context)
+{
+    long    seqno = *(long *) context;
+
+    if (seqno <= expired_last)
+	msg_fatal("timer %ld expired after timer %ld", seqno, expired_last);
+    expired_last = seqno;
+    expired_count++;
+}
+
+/* run_round - one round of timer churn */
+
+static void run_round(long count)
+{
+    struct timeval start;
+    long    n;
+
+    /*
+     * Add requests with random delays.
+     */
+    gettimeofday(&start, (struct timezone *) 0);
+    for (n = 0; n < count; n++)
+	event_request_timer(timer_event, (void *) (timer_ctx + n),
+			    1 + myrand() % MAX_DELAY);
+    report("add", count, &start);
+
+    /*
+     * Reset each request to a different random delay.
+     */
+    gettimeofday(&start, (struct timezone *) 0);
+    for (n = 0; n < count; n++)
+	event_request_timer(timer_event, (void *) (timer_ctx + n),
+			    1 + myrand() % MAX_DELAY);
+    report("reset", count, &start);
+
+    /*
+     * Cancel every other request.
+     */
+    gettimeofday(&start, (struct timezone *) 0);
+    for (n = 0; n < count; n += 2)
+	if (event_cancel_timer(timer_event, (void *) (timer_ctx + n)) < 0)
+	    msg_fatal("timer %ld was not found", n);
+    report("cancel", (count + 1) / 2, &start);
+
+    /*
+     * Replace all requests with zero-delay requests, and run the event loop
+     * until all have expired. Requests must expire in request order.
+     */
+    for (n = 0; n < count; n++)
+	timer_ctx[n] = n;
+    for (n = 0; n < count; n++)
+	event_request_timer(timer_event, (void *) (timer_ctx + n), 0);
+    expired_count = 0;
+    expired_last = -1;
+    gettimeofday(&start, (struct timezone *) 0);
+    while (expired_count < count)
+	event_loop(0);
+    report("expire", count, &start);
+}
+
+/* usage - explain and terminate */
+
+static NORETURN usage(char *myname)
+{
+    msg_fatal("usage: %s [-v] [-n timer_count] [-r rounds]", myname);
+}
+
+int     main(int argc, char **argv)
+{
+    long    count = 100000;
+    int     rounds = 1;
+    int     ch;
+
+    msg_vstream_init(argv[0], VSTREAM_ERR);
+    while ((ch = GETOPT(argc, argv, "n:r:v")) > 0) {
+	switch (ch) {
+	case 'n':
+	    if ((count = atol(optarg)) <= 0)
+		usage(argv[0]);
+	    break;
+	case 'r':
+	    if ((rounds = atoi(optarg)) <= 0)
+		usage(argv[0]);
+	    break;
+	case 'v':
+	    msg_verbose++;
+	    break;
+	default:
+	    usage(argv[0]);
+	}
+    }
+    if (argc != optind)
+	usage(argv[0]);
+
+    timer_ctx = (long *) mymalloc(sizeof(*timer_ctx) * count);
+    while (rounds-- > 0)
+	run_round(count);
+    myfree((void *) timer_ctx);
+    exit(0);
+}
@@ -0,0 +1,250 @@
+/*++
+/* NAME
+/*	group_sync 3
+/* SUMMARY
+/*	coalesce file system sync operations across processes
+/* SYNOPSIS
+/*	#include <group_sync.h>
+/*
+/*	GROUP_SYNC *group_sync_open(path)
+/*	const char *path;
+/*
+/*	int	group_sync(gs, fd)
+/*	GROUP_SYNC *gs;
+/*	int	fd;
+/*
+/*	void	group_sync_close(gs)
+/*	GROUP_SYNC *gs;
+/* DESCRIPTION
+/*	This module implements a durability barrier that is shared
+/*	by unrelated processes ("group commit"). When many processes
+/*	need to make a file durable at the same time, one of them
+/*	flushes the entire file system with syncfs(2), and the other
+/*	processes that were waiting at that time don't have to flush
+/*	anything. This replaces one device flush per file with one
+/*	device flush per group of files.
+/*
+/*	The processes coordinate through a small shared file that
+/*	contains a counter of completed file system syncs. The file
+/*	is locked while a sync is in progress. A process that finds
+/*	that at least two syncs were completed on the same file
+/*	system after it wrote its file, knows that the last one
+/*	started after that write, and does not need to sync.
+/*
+/*	group_sync_open() opens or creates the named coordination
+/*	file. The result is a null pointer in case of error. All
+/*	processes that use the same file must run the same program
+/*	binaries.
+/*
+/*	group_sync() makes the content and attributes of the file
+/*	with the specified descriptor durable, like fsync(2) would.
+/*	The result is zero in case of success, -1 in case of error.
+/*	On systems without syncfs(2), this function calls fsync(2).
+/*
+/*	Before Linux 5.8, syncfs(2) does not report writeback errors,
+/*	so that a file may not be durable even when syncfs(2)
+/*	succeeds. On such systems, group_sync_open() logs a warning,
+/*	and group_sync() calls fsync(2) instead. group_sync() also
+/*	falls back to fsync(2) when syncfs(2) fails, and stops using
+/*	syncfs(2) when the kernel does not implement it.
+/*
+/*	group_sync_close() closes the coordination file and destroys
+/*	the handle.
+/*
+/*	The GROUP_SYNC structure provides the read-only counters
+/*	"calls" and "syncs", with the number of group_sync() calls
+/*	and the number of syncs made by the calling process.
+/*	GROUP_SYNC_COUNT() returns the number of syncs that were
+/*	made by all processes.
+/* DIAGNOSTICS
+/*	Warnings: the kernel is older than Linux 5.8; the coordination
+/*	file cannot be locked; syncfs(2) fails. group_sync() then
+/*	calls fsync(2). Fatal errors: out of memory, the coordination
+/*	file cannot be unlocked.
+/* SEE ALSO
+/*	fsync(2), syncfs(2), file synchronization
+/*	myflock(3), file locking
+/* LICENSE
+/* .ad
+/* .fi
+/*	The Secure Mailer license must be distributed with this software.
+/* AUTHOR(S)
+/*	agent
+/*	agent@local
+/*--*/
+
+/* System library. */
+
+#include <sys_defs.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+
+#ifdef HAS_SYNCFS
+#include <sys/utsname.h>
+#include <stdio.h>			/* sscanf() */
+
+extern int syncfs(int);			/* Needs _GNU_SOURCE. */
+
+#endif
+
+/* Utility library. */
+
+#include <msg.h>
+#include <mymalloc.h>
+#include <iostuff.h>
+#include <myflock.h>
+#include <group_sync.h>
+
+#ifdef HAS_SYNCFS
+
+/* group_sync_syncfs_ok - syncfs() reports writeback errors */
+
+static int group_sync_syncfs_ok(void)
+{
+    struct utsname uts;
+    int     major;
+    int     minor;
+
+    /*
+     * Before Linux 5.8, syncfs() returns success even when writeback
+     * failed. Then, a successful syncfs() call does not mean that a file is
+     * durable, and fsync() is the safer choice.
+     */
+    if (uname(&uts) < 0
+	|| sscanf(uts.release, "%d.%d", &major, &minor) != 2) {
+	msg_warn("cannot determine the kernel release -- using fsync()");
+	return (0);
+    }
+    if (major < 5 || (major == 5 && minor < 8)) {
+	msg_warn("kernel release %s: syncfs() does not report write "
+		 "errors before Linux 5.8 -- using fsync()", uts.release);
+	return (0);
+    }
+    return (1);
+}
+
+#endif
+
+/* group_sync_open - open coordination file */
+
+GROUP_SYNC *group_sync_open(const char *path)
+{
+    GROUP_SYNC *gs;
+    struct stat st;
+    void   *state;
+    int     fd;
+    int     saved_errno;
+
+    /*
+     * Concurrent processes may try to grow the file at the same time. That
+     * is harmless, because ftruncate() does not change the content of a
+     * file that is already large enough.
+     */
+    if ((fd = open(path, O_RDWR | O_CREAT, 0600)) < 0)
+	return (0);
+    if (fstat(fd, &st) < 0
+	|| (st.st_size < (off_t) sizeof(GROUP_SYNC_STATE)
+	    && ftruncate(fd, sizeof(GROUP_SYNC_STATE)) < 0)
+	|| (state = mmap((void *) 0, sizeof(GROUP_SYNC_STATE),
+			 PROT_READ | PROT_WRITE, MAP_SHARED,
+			 fd, (off_t) 0)) == MAP_FAILED) {
+	saved_errno = errno;
+	(void) close(fd);
+	errno = saved_errno;
+	return (0);
+    }
+    close_on_exec(fd, CLOSE_ON_EXEC);
+    gs = (GROUP_SYNC *) mymalloc(sizeof(*gs));
+    gs->path = mystrdup(path);
+    gs->fd = fd;
+    gs->state = (GROUP_SYNC_STATE *) state;
+    gs->calls = 0;
+    gs->syncs = 0;
+#ifdef HAS_SYNCFS
+    gs->use_syncfs = group_sync_syncfs_ok();
+#else
+    gs->use_syncfs = 0;
+#endif
+    return (gs);
+}
+
+/* group_sync - make file durable, with other processes */
+
+int     group_sync(GROUP_SYNC *gs, int fd)
+{
+#ifdef HAS_SYNCFS
+    const char *myname = "group_sync";
+    struct stat st;
+    unsigned seen;
+    int     ret;
+    int     saved_errno;
+
+    gs->calls += 1;
+    if (gs->use_syncfs == 0) {
+	gs->syncs += 1;
+	return (fsync(fd));
+    }
+
+    /*
+     * Remember how many syncs were completed. At most one sync can be in
+     * progress, and that one may have started before our file was written.
+     * The one after it, if any, started after this point in time.
+     */
+    seen = gs->state->count;
+    if (fstat(fd, &st) < 0)
+	return (-1);
+
+    /*
+     * Wait until no sync is in progress. If the file cannot be locked, we
+     * fall back to a private fsync() call.
+     */
+    if (myflock(gs->fd, INTERNAL_LOCK, MYFLOCK_OP_EXCLUSIVE) < 0) {
+	msg_warn("%s: lock %s: %m", myname, gs->path);
+	gs->syncs += 1;
+	return (fsync(fd));
+    }
+    if (gs->state->count - seen >= 2 && gs->state->dev == st.st_dev) {
+	ret = 0;
+    } else {
+	gs->syncs += 1;
+	if ((ret = syncfs(fd)) == 0) {
+	    gs->state->dev = st.st_dev;
+	    gs->state->count += 1;
+	}
+    }
+    saved_errno = errno;
+    if (myflock(gs->fd, INTERNAL_LOCK, MYFLOCK_OP_NONE) < 0)
+	msg_fatal("%s: unlock %s: %m", myname, gs->path);
+    errno = saved_errno;
+
+    /*
+     * If the file system sync failed, fall back to a private fsync() call,
+     * so that one file system problem does not reject every message. Don't
+     * keep trying a system call that the kernel does not implement.
+     */
+    if (ret < 0) {
+	msg_warn("%s: syncfs: %m -- using fsync()", myname);
+	if (errno == ENOSYS)
+	    gs->use_syncfs = 0;
+	ret = fsync(fd);
+    }
+    return (ret);
+#else
+    gs->calls += 1;
+    gs->syncs += 1;
+    return (fsync(fd));
+#endif
+}
+
+/* group_sync_close - destroy handle */
+
+void    group_sync_close(GROUP_SYNC *gs)
+{
+    (void) munmap((void *) gs->state, sizeof(GROUP_SYNC_STATE));
+    (void) close(gs->fd);
+    myfree(gs->path);
+    myfree((void *) gs);
+}
@@ -0,0 +1,147 @@
+ /*
+  * Tests to verify group_sync sanity checks. See PTEST_README for
+  * documentation.
+  */
+
+ /*
+  * System library.
+  */
+#include <sys_defs.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+ /*
+  * Utility library.
+  */
+#include <msg.h>
+#include <group_sync.h>
+
+ /*
+  * Test library.
+  */
+#include <ptest.h>
+
+ /*
+  * See <ptest_main.h>
+  */
+typedef struct PTEST_CASE {
+    const char *testname;		/* Human-readable description */
+    void    (*action) (PTEST_CTX *, const struct PTEST_CASE *);
+} PTEST_CASE;
+
+#define SYNC_FILE	"group_sync_test.tmp"
+#define DATA_FILE	"group_sync_test.dat"
+
+typedef struct {
+    GROUP_SYNC *gs1;
+    GROUP_SYNC *gs2;
+    int     fd;
+} TEST_STATE;
+
+/* cleanup - destroy handles and remove files */
+
+static void cleanup(void *context)
+{
+    TEST_STATE *state = (TEST_STATE *) context;
+
+    if (state->gs1)
+	group_sync_close(state->gs1);
+    if (state->gs2)
+	group_sync_close(state->gs2);
+    if (state->fd >= 0)
+	(void) close(state->fd);
+    (void) unlink(SYNC_FILE);
+    (void) unlink(DATA_FILE);
+}
+
+/* Test functions. */
+
+static void test_group_sync_open_error(PTEST_CTX *t, const PTEST_CASE *tp)
+{
+    GROUP_SYNC *gs;
+
+    if ((gs = group_sync_open("/nonexistent/" SYNC_FILE)) != 0) {
+	group_sync_close(gs);
+	ptest_error(t, "group_sync_open: unexpected success");
+    }
+}
+
+static void test_group_sync_shared(PTEST_CTX *t, const PTEST_CASE *tp)
+{
+    static TEST_STATE state;
+    unsigned count;
+
+    state.gs1 = state.gs2 = 0;
+    state.fd = -1;
+    (void) unlink(SYNC_FILE);
+    ptest_defer(t, cleanup, (void *) &state);
+    if ((state.gs1 = group_sync_open(SYNC_FILE)) == 0)
+	ptest_fatal(t, "group_sync_open %s: %m", SYNC_FILE);
+    if ((state.gs2 = group_sync_open(SYNC_FILE)) == 0)
+	ptest_fatal(t, "group_sync_open %s: %m", SYNC_FILE);
+    if ((state.fd = open(DATA_FILE, O_RDWR | O_CREAT | O_TRUNC, 0600)) < 0)
+	ptest_fatal(t, "open %s: %m", DATA_FILE);
+    if (write(state.fd, "hello", 5) != 5)
+	ptest_fatal(t, "write %s: %m", DATA_FILE);
+
+    /*
+     * Without concurrency, every call makes a sync, and all handles see the
+     * same counter.
+     */
+    if ((count = GROUP_SYNC_COUNT(state.gs1)) != 0)
+	ptest_error(t, "initial count: got %u, want 0", count);
+    if (group_sync(state.gs1, state.fd) != 0)
+	ptest_error(t, "group_sync: %m");
+    if (group_sync(state.gs2, state.fd) != 0)
+	ptest_error(t, "group_sync: %m");
+    if (state.gs1->calls != 1 || state.gs1->syncs != 1)
+	ptest_error(t, "gs1 calls/syncs: got %ld/%ld, want 1/1",
+		    state.gs1->calls, state.gs1->syncs);
+    if (state.gs2->calls != 1 || state.gs2->syncs != 1)
+	ptest_error(t, "gs2 calls/syncs: got %ld/%ld, want 1/1",
+		    state.gs2->calls, state.gs2->syncs);
+    if (state.gs1->use_syncfs
+	&& (count = GROUP_SYNC_COUNT(state.gs2)) != 2)
+	ptest_error(t, "shared count: got %u, want 2", count);
+}
+
+static void test_group_sync_fsync_fallback(PTEST_CTX *t, const PTEST_CASE *tp)
+{
+    static TEST_STATE state;
+    unsigned count;
+
+    state.gs1 = state.gs2 = 0;
+    state.fd = -1;
+    (void) unlink(SYNC_FILE);
+    ptest_defer(t, cleanup, (void *) &state);
+    if ((state.gs1 = group_sync_open(SYNC_FILE)) == 0)
+	ptest_fatal(t, "group_sync_open %s: %m", SYNC_FILE);
+    if ((state.fd = open(DATA_FILE, O_RDWR | O_CREAT | O_TRUNC, 0600)) < 0)
+	ptest_fatal(t, "open %s: %m", DATA_FILE);
+    if (write(state.fd, "hello", 5) != 5)
+	ptest_fatal(t, "write %s: %m", DATA_FILE);
+
+    /*
+     * Without a usable syncfs(), every call makes a private fsync(), and
+     * the shared counter does not change.
+     */
+    state.gs1->use_syncfs = 0;
+    if (group_sync(state.gs1, state.fd) != 0)
+	ptest_error(t, "group_sync: %m");
+    if (state.gs1->calls != 1 || state.gs1->syncs != 1)
+	ptest_error(t, "gs1 calls/syncs: got %ld/%ld, want 1/1",
+		    state.gs1->calls, state.gs1->syncs);
+    if ((count = GROUP_SYNC_COUNT(state.gs1)) != 0)
+	ptest_error(t, "shared count: got %u, want 0", count);
+}
+
+ /*
+  * Test cases.
+  */
+static const PTEST_CASE ptestcases[] = {
+    {"test group_sync open error", test_group_sync_open_error,},
+    {"test group_sync shared", test_group_sync_shared,},
+    {"test group_sync fsync fallback", test_group_sync_fsync_fallback,},
+};
+
+#include <ptest_main.h>
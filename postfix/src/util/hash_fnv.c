@@ -12,6 +12,13 @@
 /*
 /*	HASH_FNV_T hash_fnvz(
 /*	const char *src)
+/*
+/*	HASH_FNV_T hash_mum(
+/*	const void *src,
+/*	size_t	len)
+/*
+/*	HASH_FNV_T hash_mumz(
+/*	const char *src)
 /* DESCRIPTION
 /*	hash_fnv() implements a modified FNV type 1a hash function.
 /*
@@ -35,6 +42,21 @@
 /*	systems without <stdint.h>, define HASH_FNV_T on the compiler
 /*	command line as an unsigned 32-bit or 64-bit integer type,
 /*	and specify -DUSE_FNV_32BIT when HASH_FNV_T is a 32-bit type.
+/*
+/*	hash_mum() and hash_mumz() are faster alternatives for
+/*	in-memory hash tables. Instead of one multiplication per
+/*	input byte, they consume the input 16 bytes at a time, and
+/*	mix two 64-bit words with a 128-bit multiplication whose
+/*	upper and lower halves are folded together. Every step is
+/*	keyed with a 128-bit secret that is initialized once with
+/*	ldseed(), so that an attacker cannot construct inputs that
+/*	collide in every process; the NORANDOMIZE environment
+/*	variable disables this as with hash_fnv(). hash_mumz() uses
+/*	strlen(), which most C libraries implement with vector
+/*	instructions. Input is read in little-endian byte order on
+/*	all hosts, so that results with NORANDOMIZE are the same
+/*	everywhere. On systems without a 64-bit integer type, these
+/*	functions are the same as hash_fnv() and hash_fnvz().
 /* SEE ALSO
 /*	http://www.isthe.com/chongo/tech/comp/fnv/index.html
 /*	https://softwareengineering.stackexchange.com/questions/49550/
@@ -54,6 +76,7 @@
   */
 #include <sys_defs.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 
  /*
@@ -137,3 +160,153 @@ HASH_FNV_T hash_fnvz(const char *src)
     }
     return (hash);
 }
+
+ /*
+  * Word-at-a-time hash. The constants are arbitrary odd numbers with a
+  * balanced mix of zero and one bits; the key is XORed into them.
+  */
+#ifdef UINT64_MAX
+
+#define HASH_MUM_P0	0xa0761d6478bd642fULL
+#define HASH_MUM_P1	0xe7037ed1a0b428dbULL
+#define HASH_MUM_P2	0x8ebc6af09c88c6e3ULL
+
+static uint64_t hash_mum_key[2] = {HASH_MUM_P1, HASH_MUM_P2};
+static int hash_mum_must_init = 1;
+
+/* hash_mum_init - seed the hash */
+
+static void hash_mum_init(void)
+{
+    uint64_t seed[2];
+
+    if (!getenv("NORANDOMIZE")) {
+	ldseed(seed, sizeof(seed));
+	hash_mum_key[0] ^= seed[0];
+	hash_mum_key[1] ^= seed[1];
+    }
+    hash_mum_must_init = 0;
+}
+
+/* hash_mum_mix - 64x64 bit multiplication, fold the 128-bit product */
+
+static inline uint64_t hash_mum_mix(uint64_t a, uint64_t b)
+{
+#ifdef __SIZEOF_INT128__
+    __uint128_t r = (__uint128_t) a * b;
+
+    return ((uint64_t) (r >> 64) ^ (uint64_t) r);
+#else
+    uint64_t ha = a >> 32, la = (uint32_t) a;
+    uint64_t hb = b >> 32, lb = (uint32_t) b;
+    uint64_t hh = ha * hb, hl = ha * lb, lh = la * hb, ll = la * lb;
+    uint64_t t = ll + (hl << 32);
+    uint64_t lo = t + (lh << 32);
+    uint64_t hi = hh + (hl >> 32) + (lh >> 32) + (t < ll) + (lo < t);
+
+    return (hi ^ lo);
+#endif
+}
+
+/* hash_mum_read8 - unaligned little-endian 64-bit read */
+
+static inline uint64_t hash_mum_read8(const unsigned char *p)
+{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    uint64_t v;
+
+    memcpy(&v, p, sizeof(v));
+    return (v);
+#else
+    return ((uint64_t) p[0] | (uint64_t) p[1] << 8
+	    | (uint64_t) p[2] << 16 | (uint64_t) p[3] << 24
+	    | (uint64_t) p[4] << 32 | (uint64_t) p[5] << 40
+	    | (uint64_t) p[6] << 48 | (uint64_t) p[7] << 56);
+#endif
+}
+
+/* hash_mum_read4 - unaligned little-endian 32-bit read */
+
+static inline uint64_t hash_mum_read4(const unsigned char *p)
+{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    uint32_t v;
+
+    memcpy(&v, p, sizeof(v));
+    return (v);
+#else
+    return ((uint64_t) p[0] | (uint64_t) p[1] << 8
+	    | (uint64_t) p[2] << 16 | (uint64_t) p[3] << 24);
+#endif
+}
+
+/* hash_mum - keyed word-at-a-time hash */
+
+HASH_FNV_T hash_mum(const void *src, size_t len)
+{
+    const unsigned char *p = (const unsigned char *) src;
+    size_t  left = len;
+    uint64_t seed;
+    uint64_t a;
+    uint64_t b;
+    size_t  off;
+
+    if (hash_mum_must_init)
+	hash_mum_init();
+
+    seed = hash_mum_mix(hash_mum_key[0] ^ HASH_MUM_P0, hash_mum_key[1] ^ len);
+
+    /*
+     * Short inputs are read as (possibly overlapping) 32-bit words, so that
+     * every input byte is read at least once without reading past the end.
+     * Long inputs are consumed 16 bytes at a time; the last 16 bytes are
+     * read again, overlapping with the final full block if necessary.
+     */
+    if (len <= 16) {
+	if (len >= 4) {
+	    off = (len >> 3) << 2;
+	    a = (hash_mum_read4(p) << 32) | hash_mum_read4(p + off);
+	    b = (hash_mum_read4(p + len - 4) << 32)
+		| hash_mum_read4(p + len - 4 - off);
+	} else if (len > 0) {
+	    a = ((uint64_t) p[0] << 16) | ((uint64_t) p[len >> 1] << 8)
+		| p[len - 1];
+	    b = 0;
+	} else {
+	    a = b = 0;
+	}
+    } else {
+	while (left > 16) {
+	    seed = hash_mum_mix(hash_mum_read8(p) ^ hash_mum_key[1],
+				hash_mum_read8(p + 8) ^ seed);
+	    p += 16;
+	    left -= 16;
+	}
+	a = hash_mum_read8(p + left - 16);
+	b = hash_mum_read8(p + left - 8);
+    }
+    seed = hash_mum_mix(a ^ hash_mum_key[1], b ^ seed);
+    return ((HASH_FNV_T) hash_mum_mix(seed ^ HASH_MUM_P1,
+				      hash_mum_key[0] ^ len));
+}
+
+/* hash_mumz - keyed word-at-a-time hash for null-terminated strings */
+
+HASH_FNV_T hash_mumz(const char *src)
+{
+    return (hash_mum(src, strlen(src)));
+}
+
+#else					/* UINT64_MAX */
+
+HASH_FNV_T hash_mum(const void *src, size_t len)
+{
+    return (hash_fnv(src, len));
+}
+
+HASH_FNV_T hash_mumz(const char *src)
+{
+    return (hash_fnvz(src));
+}
+
+#endif					/* UINT64_MAX */
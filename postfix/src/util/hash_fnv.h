@@ -25,6 +25,8 @@
 
 extern HASH_FNV_T hash_fnv(const void *, size_t);
 extern HASH_FNV_T hash_fnvz(const char *);
+extern HASH_FNV_T hash_mum(const void *, size_t);
+extern HASH_FNV_T hash_mumz(const char *);
 
 /* LICENSE
 /* .ad
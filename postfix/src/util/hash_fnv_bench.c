@@ -0,0 +1,188 @@
+/*++
+/* NAME
+/*	hash_fnv_bench 1
+/* SUMMARY
+/*	measure hash function throughput
+/* SYNOPSIS
+/* .fi
+/*	\fBhash_fnv_bench\fR [\fB-v\fR] [\fB-n \fIcount\fR] [\fIlength ...\fR]
+/* DESCRIPTION
+/*	The \fBhash_fnv_bench\fR command measures the cost of the
+/*	\fBhash_fnv\fR(3) hash functions, for keys of each specified
+/*	length (default: 8 16 24 32 48 64 128 256 1024 bytes). For
+/*	each function and length, it hashes \fIcount\fR keys that
+/*	look like email addresses, and reports the time per key
+/*	and the throughput in megabytes per second.
+/*
+/*	Options:
+/* .IP "\fB-n \fIcount\fR (default: 1000000)"
+/*	The number of keys to hash per function and length.
+/* .IP \fB-v\fR
+/*	Increase verbosity.
+/* DIAGNOSTICS
+/*	Problems are reported to the standard error stream.
+/* LICENSE
+/* .ad
+/* .fi
+/*	The Secure Mailer license must be distributed with this software.
+/*--*/
+
+/* System library. */
+
+#include <sys_defs.h>
+#include <sys/time.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Utility library. */
+
+#include <msg.h>
+#include <msg_vstream.h>
+#include <mymalloc.h>
+#include <myrand.h>
+#include <vstream.h>
+#include <hash_fnv.h>
+
+ /*
+  * Each key length is measured with a small set of different keys, so that
+  * results cannot be cached and the key data stays in the CPU cache.
+  */
+#define KEY_SET_SIZE	64
+
+ /*
+  * The functions under test.
+  */
+typedef struct {
+    const char *name;
+    HASH_FNV_T (*hash) (const void *, size_t);
+    HASH_FNV_T (*hashz) (const char *);
+} BENCH_IMPL;
+
+static const BENCH_IMPL bench_impl[] = {
+    {"fnv", hash_fnv, 0},
+    {"fnvz", 0, hash_fnvz},
+    {"mum", hash_mum, 0},
+    {"mumz", 0, hash_mumz},
+    {0},
+};
+
+static const int default_lengths[] = {
+    8, 16, 24, 32, 48, 64, 128, 256, 1024, 0,
+};
+
+/* elapsed - return elapsed time in seconds */
+
+static double elapsed(struct timeval *start)
+{
+    struct timeval now;
+
+    if (gettimeofday(&now, (struct timezone *) 0) < 0)
+	msg_fatal("gettimeofday: %m");
+    return ((now.tv_sec - start->tv_sec)
+	    + (now.tv_usec - start->tv_usec) / 1000000.0);
+}
+
+/* make_keys - generate null-terminated keys of the specified length */
+
+static char **make_keys(int len)
+{
+    static const char chars[] = "abcdefghijklmnopqrstuvwxyz0123456789.";
+    char  **keys;
+    char   *cp;
+    int     n;
+    int     i;
+
+    keys = (char **) mymalloc(sizeof(*keys) * KEY_SET_SIZE);
+    for (n = 0; n < KEY_SET_SIZE; n++) {
+	keys[n] = cp = mymalloc(len + 1);
+	for (i = 0; i < len; i++)
+	    cp[i] = chars[myrand() % (sizeof(chars) - 1)];
+	if (len > 2)
+	    cp[len / 2] = '@';
+	cp[len] = 0;
+    }
+    return (keys);
+}
+
+/* free_keys - destroy keys */
+
+static void free_keys(char **keys)
+{
+    int     n;
+
+    for (n = 0; n < KEY_SET_SIZE; n++)
+	myfree(keys[n]);
+    myfree((void *) keys);
+}
+
+/* run_length - measure all functions with one key length */
+
+static void run_length(int len, long count)
+{
+    const BENCH_IMPL *ip;
+    struct timeval start;
+    char  **keys = make_keys(len);
+    HASH_FNV_T sum = 0;
+    double  secs;
+    long    n;
+
+    for (ip = bench_impl; ip->name; ip++) {
+	gettimeofday(&start, (struct timezone *) 0);
+	if (ip->hash) {
+	    for (n = 0; n < count; n++)
+		sum += ip->hash(keys[n % KEY_SET_SIZE], len);
+	} else {
+	    for (n = 0; n < count; n++)
+		sum += ip->hashz(keys[n % KEY_SET_SIZE]);
+	}
+	secs = elapsed(&start);
+	vstream_printf("%-6s %6d bytes %8.1f ns/key %10.1f MB/s\n",
+		       ip->name, len, secs * 1e9 / count,
+		       secs > 0 ? (double) len * count / secs / 1e6 : 0);
+	vstream_fflush(VSTREAM_OUT);
+    }
+    if (msg_verbose)
+	msg_info("checksum %lu", (unsigned long) sum);
+    free_keys(keys);
+}
+
+/* usage - explain and terminate */
+
+static NORETURN usage(char *myname)
+{
+    msg_fatal("usage: %s [-v] [-n count] [length ...]", myname);
+}
+
+int     main(int argc, char **argv)
+{
+    long    count = 1000000;
+    const int *lp;
+    int     len;
+    int     ch;
+
+    msg_vstream_init(argv[0], VSTREAM_ERR);
+    while ((ch = GETOPT(argc, argv, "n:v")) > 0) {
+	switch (ch) {
+	case 'n':
+	    if ((count = atol(optarg)) <= 0)
+		usage(argv[0]);
+	    break;
+	case 'v':
+	    msg_verbose++;
+	    break;
+	default:
+	    usage(argv[0]);
+	}
+    }
+    if (argc == optind) {
+	for (lp = default_lengths; *lp; lp++)
+	    run_length(*lp, count);
+    } else {
+	for ( /* void */ ; optind < argc; optind++) {
+	    if ((len = atoi(argv[optind])) < 0)
+		usage(argv[0]);
+	    run_length(len, count);
+	}
+    }
+    exit(0);
+}
@@ -62,6 +62,74 @@ static void test_known_input(PTEST_CTX *t, const PTEST_CASE *tp)
 		    (unsigned long) tp->want_hval);
 }
 
+#define MUM_BUFLEN	100
+
+static void test_mum_lengths(PTEST_CTX *t, const PTEST_CASE *tp)
+{
+    unsigned char buf[MUM_BUFLEN + 1];
+    HASH_FNV_T hval[MUM_BUFLEN + 1];
+    HASH_FNV_T got_hval;
+    size_t  len;
+    size_t  n;
+
+    setup_test();
+
+    /*
+     * The input is read in 4-byte, 8-byte and 16-byte chunks that may
+     * overlap. Each input length must produce a distinct result, and the
+     * hash of a null-terminated string must not depend on the alignment of
+     * its first byte.
+     */
+    for (n = 0; n < MUM_BUFLEN; n++)
+	buf[n] = 'a' + n % 26;
+    for (len = 0; len <= MUM_BUFLEN; len++) {
+	hval[len] = hash_mum(buf, len);
+	for (n = 0; n < len; n++)
+	    if (hval[n] == hval[len])
+		ptest_error(t, "hash_mum() length %lu and %lu: same result",
+			    (unsigned long) n, (unsigned long) len);
+    }
+    for (len = 0; len < MUM_BUFLEN; len++) {
+	memmove(buf + 1, buf, len);
+	buf[len + 1] = 0;
+	if ((got_hval = hash_mumz((char *) buf + 1)) != hval[len])
+	    ptest_error(t, "hash_mumz() length %lu: got %lu, want %lu",
+			(unsigned long) len, (unsigned long) got_hval,
+			(unsigned long) hval[len]);
+	memmove(buf, buf + 1, len);
+	buf[len] = 'a' + len % 26;
+    }
+}
+
+static void test_mum_bit_flips(PTEST_CTX *t, const PTEST_CASE *tp)
+{
+    unsigned char buf[MUM_BUFLEN];
+    HASH_FNV_T want_hval;
+    size_t  len;
+    size_t  n;
+    int     bit;
+
+    setup_test();
+
+    /*
+     * Flipping any one input bit must change the result, including bits in
+     * the bytes that are read only once.
+     */
+    memset(buf, 0, sizeof(buf));
+    for (len = 1; len <= MUM_BUFLEN; len++) {
+	want_hval = hash_mum(buf, len);
+	for (n = 0; n < len; n++) {
+	    for (bit = 0; bit < 8; bit++) {
+		buf[n] ^= (1 << bit);
+		if (hash_mum(buf, len) == want_hval)
+		    ptest_error(t, "hash_mum() length %lu: flipping bit %d"
+				" of byte %lu has no effect",
+				(unsigned long) len, bit, (unsigned long) n);
+		buf[n] ^= (1 << bit);
+	    }
+	}
+    }
+}
 
 static const PTEST_CASE ptestcases[] =
 {
@@ -76,6 +144,8 @@ static const PTEST_CASE ptestcases[] =
     "test_known_input_fanfold", test_known_input, 0xa50c585d385a2604ULL, "fanfold",
     "test_known_input_phrensied", test_known_input, 0x1ec3ef9bb2b734a4ULL, "phrensied",
 #endif
+    "test_mum_lengths", test_mum_lengths, 0, 0,
+    "test_mum_bit_flips", test_mum_bit_flips, 0, 0,
 };
 
 #include <ptest_main.h>
@@ -103,7 +103,7 @@
 /*	to delete a non-existent entry.
 /* SEE ALSO
 /*	mymalloc(3) memory management wrapper
-/*	hash_fnv(3) Fowler/Noll/Vo hash function
+/*	hash_fnv(3) Fowler/Noll/Vo and word-at-a-time hash functions
 /* LICENSE
 /* .ad
 /* .fi
@@ -136,7 +136,11 @@
 #ifndef NO_HASH_FNV
 #include "hash_fnv.h"
 
+#ifndef NO_HASH_MUM
+#define htable_hash(s, size) (hash_mumz(s) % (size))
+#else
 #define htable_hash(s, size) (hash_fnvz(s) % (size))
+#endif
 
 #else
 
@@ -0,0 +1,314 @@
+/*++
+/* NAME
+/*	marena 3
+/* SUMMARY
+/*	memory arena
+/* SYNOPSIS
+/*	#include <marena.h>
+/*
+/*	MARENA	*marena_create(chunk_size)
+/*	ssize_t	chunk_size;
+/*
+/*	void	*marena_alloc(arena, len)
+/*	MARENA	*arena;
+/*	ssize_t	len;
+/*
+/*	char	*marena_strdup(arena, str)
+/*	MARENA	*arena;
+/*	const char *str;
+/*
+/*	char	*marena_strndup(arena, str, len)
+/*	MARENA	*arena;
+/*	const char *str;
+/*	ssize_t	len;
+/*
+/*	void	*marena_memdup(arena, ptr, len)
+/*	MARENA	*arena;
+/*	const void *ptr;
+/*	ssize_t	len;
+/*
+/*	void	marena_reset(arena)
+/*	MARENA	*arena;
+/*
+/*	void	marena_free(arena)
+/*	MARENA	*arena;
+/* DESCRIPTION
+/*	This module manages memory for objects that are allocated
+/*	one at a time, but that are all released at the same time,
+/*	for example at the end of a message or session. Memory is
+/*	carved out of large chunks that are obtained with mymalloc(),
+/*	so that many small allocations cost only a few mymalloc()
+/*	and myfree() calls. Individual objects cannot be released
+/*	or resized.
+/*
+/*	marena_create() creates an empty arena. The chunk_size
+/*	argument specifies the size of memory chunks; specify 0
+/*	for the default (4096 bytes). The first chunk is allocated
+/*	upon the first allocation request.
+/*
+/*	marena_alloc() allocates the requested amount of memory with
+/*	the same alignment as mymalloc(). The memory is not set to
+/*	zero. A request for more than one quarter of the chunk size
+/*	is given its own chunk, so that it does not waste the free
+/*	space in the current chunk.
+/*
+/*	marena_strdup(), marena_strndup() and marena_memdup() are
+/*	arena-based versions of mystrdup(), mystrndup() and
+/*	mymemdup(). The results are not aligned.
+/*
+/*	marena_reset() releases all memory that was allocated from
+/*	the arena, but keeps one chunk for later use.
+/*
+/*	marena_free() releases all memory that was allocated from
+/*	the arena, and destroys the arena.
+/*
+/*	The MARENA structure provides read-only statistics:
+/*	alloc_count is the number of allocation requests, chunk_count
+/*	is the number of chunks obtained with mymalloc(), and bytes
+/*	is the amount of memory handed out. These counters are reset
+/*	with marena_reset().
+/* DIAGNOSTICS
+/*	Problems are reported via the msg(3) diagnostics routines:
+/*	the requested amount of memory is not available; improper use
+/*	is detected; other fatal errors. To help detect access to
+/*	released memory, marena_reset() and marena_free() overwrite
+/*	released memory.
+/* SEE ALSO
+/*	mymalloc(3) memory management wrapper
+/* LICENSE
+/* .ad
+/* .fi
+/*	The Secure Mailer license must be distributed with this software.
+/* AUTHOR(S)
+/*	agent
+/*	agent@local
+/*--*/
+
+/* System libraries. */
+
+#include <sys_defs.h>
+#include <stddef.h>
+#include <string.h>
+
+/* Utility library. */
+
+#include <msg.h>
+#include <mymalloc.h>
+#include <marena.h>
+
+ /*
+  * Structure of one memory chunk. The payload has the same alignment as
+  * mymalloc() results.
+  */
+typedef struct MARENA_CHUNK {
+    struct MARENA_CHUNK *next;		/* older chunk */
+    ssize_t size;			/* payload size */
+    union {
+	ALIGN_TYPE align;
+	char    payload[1];		/* actually a bunch of bytes */
+    }       u;
+} MARENA_CHUNK;
+
+#define MARENA_DEF_CHUNK_SIZE	4096
+#define MARENA_MIN_CHUNK_SIZE	64
+#define MARENA_FILLER		0xff
+
+#define MARENA_ALIGN_SIZE	(sizeof(ALIGN_TYPE))
+#define MARENA_ALIGN(len) \
+	(((len) + MARENA_ALIGN_SIZE - 1) & ~(MARENA_ALIGN_SIZE - 1))
+
+/* marena_create - create empty arena */
+
+MARENA *marena_create(ssize_t chunk_size)
+{
+    MARENA *arena;
+
+    if (chunk_size < 0)
+	msg_panic("marena_create: bad chunk size: %ld", (long) chunk_size);
+    if (chunk_size == 0)
+	chunk_size = MARENA_DEF_CHUNK_SIZE;
+    else if (chunk_size < MARENA_MIN_CHUNK_SIZE)
+	chunk_size = MARENA_MIN_CHUNK_SIZE;
+
+    arena = (MARENA *) mymalloc(sizeof(*arena));
+    arena->chunks = 0;
+    arena->ptr = 0;
+    arena->left = 0;
+    arena->chunk_size = MARENA_ALIGN(chunk_size);
+    arena->alloc_count = 0;
+    arena->chunk_count = 0;
+    arena->bytes = 0;
+    return (arena);
+}
+
+/* marena_new_chunk - allocate chunk, link after specified chunk */
+
+static MARENA_CHUNK *marena_new_chunk(MARENA *arena, ssize_t size,
+				              MARENA_CHUNK **where)
+{
+    MARENA_CHUNK *chunk;
+
+    chunk = (MARENA_CHUNK *)
+	mymalloc(offsetof(MARENA_CHUNK, u.payload[0]) + size);
+    chunk->size = size;
+    chunk->next = *where;
+    *where = chunk;
+    arena->chunk_count += 1;
+    return (chunk);
+}
+
+/* marena_space - allocate unaligned memory */
+
+static char *marena_space(MARENA *arena, ssize_t len)
+{
+    MARENA_CHUNK *chunk;
+    char   *ptr;
+
+    if (len < 1)
+	msg_panic("marena_alloc: requested length %ld", (long) len);
+    arena->alloc_count += 1;
+    arena->bytes += len;
+
+    /*
+     * Large requests get their own chunk. It is linked behind the current
+     * chunk, so that the free space in the current chunk remains available.
+     */
+    if (len > arena->chunk_size / 4) {
+	chunk = marena_new_chunk(arena, len, arena->chunks ?
+				 &arena->chunks->next : &arena->chunks);
+	if (arena->chunks == chunk) {
+	    arena->ptr = chunk->u.payload + len;
+	    arena->left = 0;
+	}
+	return (chunk->u.payload);
+    }
+
+    /*
+     * Small requests are carved out of the current chunk.
+     */
+    if (len > arena->left) {
+	chunk = marena_new_chunk(arena, arena->chunk_size, &arena->chunks);
+	arena->ptr = chunk->u.payload;
+	arena->left = chunk->size;
+    }
+    ptr = arena->ptr;
+    arena->ptr += len;
+    arena->left -= len;
+    return (ptr);
+}
+
+/* marena_alloc - allocate aligned memory */
+
+void   *marena_alloc(MARENA *arena, ssize_t len)
+{
+    ssize_t pad;
+
+    if (len < 1)
+	msg_panic("marena_alloc: requested length %ld", (long) len);
+
+    /*
+     * The free space in a chunk starts at an aligned address, unless an
+     * unaligned string was allocated before.
+     */
+    pad = (MARENA_ALIGN_SIZE - ((size_t) arena->ptr & (MARENA_ALIGN_SIZE - 1)))
+	& (MARENA_ALIGN_SIZE - 1);
+    if (pad > 0 && pad < arena->left) {
+	arena->ptr += pad;
+	arena->left -= pad;
+    } else if (pad > 0) {
+	arena->left = 0;
+    }
+    return ((void *) marena_space(arena, MARENA_ALIGN(len)));
+}
+
+/* marena_strdup - save string to arena */
+
+char   *marena_strdup(MARENA *arena, const char *str)
+{
+    size_t  len;
+
+    if (str == 0)
+	msg_panic("marena_strdup: null pointer argument");
+    len = strlen(str) + 1;
+    return (memcpy(marena_space(arena, len), str, len));
+}
+
+/* marena_strndup - save substring to arena */
+
+char   *marena_strndup(MARENA *arena, const char *str, ssize_t len)
+{
+    char   *result;
+    char   *cp;
+
+    if (str == 0)
+	msg_panic("marena_strndup: null pointer argument");
+    if (len < 0)
+	msg_panic("marena_strndup: requested length %ld", (long) len);
+    if ((cp = memchr(str, 0, len)) != 0)
+	len = cp - str;
+    result = memcpy(marena_space(arena, len + 1), str, len);
+    result[len] = 0;
+    return (result);
+}
+
+/* marena_memdup - copy memory to arena */
+
+void   *marena_memdup(MARENA *arena, const void *ptr, ssize_t len)
+{
+    if (ptr == 0)
+	msg_panic("marena_memdup: null pointer argument");
+    return (memcpy(marena_alloc(arena, len), ptr, len));
+}
+
+/* marena_release - release chunks after the specified one */
+
+static void marena_release(MARENA_CHUNK *chunk)
+{
+    MARENA_CHUNK *next;
+
+    for ( /* void */ ; chunk != 0; chunk = next) {
+	next = chunk->next;
+	memset(chunk->u.payload, MARENA_FILLER, chunk->size);
+	myfree((void *) chunk);
+    }
+}
+
+/* marena_reset - release all memory, keep one chunk */
+
+void    marena_reset(MARENA *arena)
+{
+    MARENA_CHUNK *keep;
+    MARENA_CHUNK **cpp;
+
+    /*
+     * Keep one chunk of the default size, if there is one.
+     */
+    for (keep = 0, cpp = &arena->chunks; *cpp; cpp = &(*cpp)->next) {
+	if ((*cpp)->size == arena->chunk_size) {
+	    keep = *cpp;
+	    *cpp = keep->next;
+	    break;
+	}
+    }
+    marena_release(arena->chunks);
+    if ((arena->chunks = keep) != 0) {
+	keep->next = 0;
+	memset(keep->u.payload, MARENA_FILLER, keep->size);
+	arena->ptr = keep->u.payload;
+	arena->left = keep->size;
+    } else {
+	arena->ptr = 0;
+	arena->left = 0;
+    }
+    arena->alloc_count = 0;
+    arena->chunk_count = 0;
+    arena->bytes = 0;
+}
+
+/* marena_free - destroy arena */
+
+void    marena_free(MARENA *arena)
+{
+    marena_release(arena->chunks);
+    myfree((void *) arena);
+}
@@ -0,0 +1,44 @@
+#ifndef _MARENA_H_INCLUDED_
+#define _MARENA_H_INCLUDED_
+
+/*++
+/* NAME
+/*	marena 3h
+/* SUMMARY
+/*	memory arena
+/* SYNOPSIS
+/*	#include <marena.h>
+/* DESCRIPTION
+/* .nf
+
+ /*
+  * External interface.
+  */
+typedef struct MARENA {
+    struct MARENA_CHUNK *chunks;	/* newest chunk first */
+    char   *ptr;			/* free space in newest chunk */
+    ssize_t left;			/* free space length */
+    ssize_t chunk_size;			/* default chunk size */
+    ssize_t alloc_count;		/* allocation requests */
+    ssize_t chunk_count;		/* mymalloc() calls */
+    ssize_t bytes;			/* bytes handed out */
+} MARENA;
+
+extern MARENA *marena_create(ssize_t);
+extern void *marena_alloc(MARENA *, ssize_t);
+extern char *marena_strdup(MARENA *, const char *);
+extern char *marena_strndup(MARENA *, const char *, ssize_t);
+extern void *marena_memdup(MARENA *, const void *, ssize_t);
+extern void marena_reset(MARENA *);
+extern void marena_free(MARENA *);
+
+/* LICENSE
+/* .ad
+/* .fi
+/*	The Secure Mailer license must be distributed with this software.
+/* AUTHOR(S)
+/*	agent
+/*	agent@local
+/*--*/
+
+#endif
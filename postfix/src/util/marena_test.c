@@ -0,0 +1,184 @@
+ /*
+  * Tests to verify marena sanity checks. See PTEST_README for
+  * documentation.
+  */
+
+ /*
+  * System library.
+  */
+#include <sys_defs.h>
+#include <string.h>
+
+ /*
+  * Utility library.
+  */
+#include <msg.h>
+#include <mymalloc.h>
+#include <marena.h>
+
+ /*
+  * Test library.
+  */
+#include <ptest.h>
+
+ /*
+  * See <ptest_main.h>
+  */
+typedef struct PTEST_CASE {
+    const char *testname;		/* Human-readable description */
+    void    (*action) (PTEST_CTX *, const struct PTEST_CASE *);
+} PTEST_CASE;
+
+/* wrap_marena_free - in case (void *) != (struct *) */
+
+static void wrap_marena_free(void *context)
+{
+    marena_free((MARENA *) context);
+}
+
+/* Test functions. */
+
+static void test_marena_small(PTEST_CTX *t, const PTEST_CASE *tp)
+{
+    MARENA *arena = marena_create(0);
+    char   *ptr[1000];
+    int     n;
+
+    /*
+     * Many small allocations share a few chunks, and do not overlap.
+     */
+    for (n = 0; n < 1000; n++) {
+	ptr[n] = marena_alloc(arena, 10);
+	if (((size_t) ptr[n]) % sizeof(ALIGN_TYPE) != 0)
+	    ptest_error(t, "marena_alloc: result %p is not aligned", ptr[n]);
+	memset(ptr[n], n & 0xff, 10);
+    }
+    for (n = 0; n < 1000; n++)
+	if (ptr[n][0] != (char) (n & 0xff) || ptr[n][9] != (char) (n & 0xff))
+	    ptest_error(t, "marena_alloc: result %d was overwritten", n);
+    if (arena->alloc_count != 1000)
+	ptest_error(t, "alloc_count: got %ld, want 1000",
+		    (long) arena->alloc_count);
+    if (arena->chunk_count > 1000 * sizeof(ALIGN_TYPE) * 2 / 4096 + 1)
+	ptest_error(t, "chunk_count: got %ld, want at most %ld",
+		    (long) arena->chunk_count,
+		    (long) (1000 * sizeof(ALIGN_TYPE) * 2 / 4096 + 1));
+    marena_free(arena);
+}
+
+static void test_marena_strings(PTEST_CTX *t, const PTEST_CASE *tp)
+{
+    MARENA *arena = marena_create(0);
+    const char *got;
+    void   *aligned;
+
+    if (strcmp(got = marena_strdup(arena, "foo"), "foo") != 0)
+	ptest_error(t, "marena_strdup: got \"%s\", want \"foo\"", got);
+    if (strcmp(got = marena_strdup(arena, ""), "") != 0)
+	ptest_error(t, "marena_strdup: got \"%s\", want \"\"", got);
+    if (strcmp(got = marena_strndup(arena, "foobar", 3), "foo") != 0)
+	ptest_error(t, "marena_strndup: got \"%s\", want \"foo\"", got);
+    if (strcmp(got = marena_strndup(arena, "foo", 10), "foo") != 0)
+	ptest_error(t, "marena_strndup: got \"%s\", want \"foo\"", got);
+    if (memcmp(got = marena_memdup(arena, "bar", 3), "bar", 3) != 0)
+	ptest_error(t, "marena_memdup: got \"%.3s\", want \"bar\"", got);
+
+    /*
+     * An aligned allocation after unaligned strings.
+     */
+    (void) marena_strdup(arena, "x");
+    aligned = marena_alloc(arena, 1);
+    if (((size_t) aligned) % sizeof(ALIGN_TYPE) != 0)
+	ptest_error(t, "marena_alloc: result %p is not aligned", aligned);
+    marena_free(arena);
+}
+
+static void test_marena_large(PTEST_CTX *t, const PTEST_CASE *tp)
+{
+    MARENA *arena = marena_create(0);
+    char   *small1;
+    char   *large;
+    char   *small2;
+
+    /*
+     * A large request gets its own chunk, and does not waste the free space
+     * in the current chunk.
+     */
+    small1 = marena_alloc(arena, 16);
+    large = marena_alloc(arena, 100000);
+    memset(large, 'x', 100000);
+    small2 = marena_alloc(arena, 16);
+    if (small2 != small1 + 16)
+	ptest_error(t, "small allocation after large allocation: "
+		    "got %p, want %p", small2, small1 + 16);
+    if (arena->chunk_count != 2)
+	ptest_error(t, "chunk_count: got %ld, want 2",
+		    (long) arena->chunk_count);
+
+    /*
+     * Reset keeps one chunk for reuse.
+     */
+    marena_reset(arena);
+    if (arena->alloc_count != 0 || arena->bytes != 0)
+	ptest_error(t, "marena_reset: statistics were not reset");
+    small2 = marena_alloc(arena, 16);
+    if (small2 != small1)
+	ptest_error(t, "marena_reset: got %p, want %p", small2, small1);
+    if (arena->chunk_count != 0)
+	ptest_error(t, "marena_reset: chunk_count: got %ld, want 0",
+		    (long) arena->chunk_count);
+    marena_free(arena);
+}
+
+static void test_marena_large_first(PTEST_CTX *t, const PTEST_CASE *tp)
+{
+    MARENA *arena = marena_create(0);
+    char   *small;
+
+    /*
+     * A large first request must not be mistaken for a small-object chunk.
+     */
+    (void) marena_alloc(arena, 10000);
+    small = marena_alloc(arena, 16);
+    memset(small, 0, 16);
+    if (arena->chunk_count != 2)
+	ptest_error(t, "chunk_count: got %ld, want 2",
+		    (long) arena->chunk_count);
+    marena_reset(arena);
+    marena_reset(arena);
+    marena_free(arena);
+}
+
+static void test_marena_panic_too_small(PTEST_CTX *t, const PTEST_CASE *tp)
+{
+    MARENA *arena = marena_create(0);
+
+    ptest_defer(t, wrap_marena_free, (void *) arena);
+    expect_ptest_log_event(t, "panic: marena_alloc: requested length 0");
+    (void) marena_alloc(arena, 0);
+    ptest_fatal(t, "marena_alloc() returned");
+}
+
+static void test_marena_panic_strdup_null(PTEST_CTX *t, const PTEST_CASE *tp)
+{
+    MARENA *arena = marena_create(0);
+
+    ptest_defer(t, wrap_marena_free, (void *) arena);
+    expect_ptest_log_event(t, "panic: marena_strdup: null pointer argument");
+    (void) marena_strdup(arena, (char *) 0);
+    ptest_fatal(t, "marena_strdup() returned");
+}
+
+ /*
+  * Test cases.
+  */
+static const PTEST_CASE ptestcases[] = {
+    {"test marena small", test_marena_small,},
+    {"test marena strings", test_marena_strings,},
+    {"test marena large", test_marena_large,},
+    {"test marena large first", test_marena_large_first,},
+    {"test marena panic too small", test_marena_panic_too_small,},
+    {"test marena panic strdup null", test_marena_panic_strdup_null,},
+};
+
+#include <ptest_main.h>
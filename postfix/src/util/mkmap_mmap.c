@@ -0,0 +1,48 @@
+/*++
+/* NAME
+/*	mkmap_mmap 3
+/* SUMMARY
+/*	create or open database, memory-mapped style
+/* SYNOPSIS
+/*	#include <dict_mmap.h>
+/*
+/*	MKMAP	*mkmap_mmap_open(path)
+/*	const char *path;
+/* DESCRIPTION
+/*	mkmap_mmap_open() is a helper for the more general mkmap_open()
+/*	interface. It is a dummy, because dict_mmap_open() already
+/*	builds the table in a temporary file under an exclusive
+/*	lock, and renames it into place when the table is closed.
+/*
+/*	All errors are fatal.
+/* SEE ALSO
+/*	dict_mmap(3), memory-mapped dictionary interface.
+/* LICENSE
+/* .ad
+/* .fi
+/*	The Secure Mailer license must be distributed with this software.
+/* AUTHOR(S)
+/*	agent
+/*	agent@local
+/*--*/
+
+/* System library. */
+
+#include <sys_defs.h>
+
+/* Utility library. */
+
+#include <mymalloc.h>
+#include <dict_mmap.h>
+
+/* mkmap_mmap_open - create or open database */
+
+MKMAP  *mkmap_mmap_open(const char *unused_path)
+{
+    MKMAP  *mkmap = (MKMAP *) mymalloc(sizeof(*mkmap));
+
+    mkmap->open = dict_mmap_open;
+    mkmap->after_open = 0;
+    mkmap->after_close = 0;
+    return (mkmap);
+}
@@ -0,0 +1,492 @@
+/*++
+/* NAME
+/*	ohtable 3
+/* SUMMARY
+/*	open-addressing hash table manager
+/* SYNOPSIS
+/*	#include <ohtable.h>
+/*
+/*	typedef	struct {
+/* .in +4
+/*		char	*key;
+/*		void	*value;
+/*		/* private fields... */
+/* .in -4
+/*	} OHTABLE_INFO;
+/*
+/*	OHTABLE	*ohtable_create(size, flags)
+/*	ssize_t	size;
+/*	int	flags;
+/*
+/*	OHTABLE_INFO *ohtable_enter(table, key, value)
+/*	OHTABLE	*table;
+/*	const char *key;
+/*	void	*value;
+/*
+/*	void	*ohtable_find(table, key)
+/*	OHTABLE	*table;
+/*	const char *key;
+/*
+/*	OHTABLE_INFO *ohtable_locate(table, key)
+/*	OHTABLE	*table;
+/*	const char *key;
+/*
+/*	void	ohtable_delete(table, key, free_fn)
+/*	OHTABLE	*table;
+/*	const char *key;
+/*	void	(*free_fn)(void *);
+/*
+/*	void	ohtable_free(table, free_fn)
+/*	OHTABLE	*table;
+/*	void	(*free_fn)(void *);
+/*
+/*	void	ohtable_walk(table, action, ptr)
+/*	OHTABLE	*table;
+/*	void	(*action)(OHTABLE_INFO *, void *ptr);
+/*	void	*ptr;
+/*
+/*	OHTABLE_INFO **ohtable_list(table)
+/*	OHTABLE	*table;
+/* DESCRIPTION
+/*	This module is an alternative to htable(3) for tables with
+/*	many entries. It has the same interface, except for the
+/*	lifetime of OHTABLE_INFO pointers (see below).
+/*
+/*	Table entries are stored in one array with open addressing
+/*	and linear probing, instead of one mymalloc() node per entry.
+/*	Each entry stores its key hash value, so that most mismatches
+/*	are found without touching the key string. When a table
+/*	fills up, it is resized incrementally: entries are moved
+/*	from the old array to the new array a few at a time with
+/*	each update, so that no single update pays the cost of
+/*	rehashing the entire table.
+/*
+/*	ohtable_create() creates a table of the specified size and
+/*	returns a pointer to the result. Specify OHTABLE_FLAG_NONE
+/*	to save lookup keys with mystrdup(), or OHTABLE_FLAG_INTERN
+/*	to intern keys in a table-owned string pool. The pool saves
+/*	one memory allocation per key; storage for deleted keys is
+/*	reclaimed when the table becomes empty.
+/*
+/*	ohtable_enter() stores a (key, value) pair into the specified
+/*	table and returns a pointer to the resulting entry. The code
+/*	does not check if an entry with that key already exists:
+/*	use ohtable_locate() for updating an existing entry.
+/*
+/*	ohtable_find() returns the value that was stored under the
+/*	given key, or a null pointer if it was not found. In order
+/*	to distinguish a null value from a non-existent value, use
+/*	ohtable_locate().
+/*
+/*	ohtable_locate() returns a pointer to the entry that was
+/*	stored for the given key, or a null pointer if it was not
+/*	found.
+/*
+/*	ohtable_delete() removes one entry that was stored under the
+/*	given key. If the free_fn argument is not a null pointer,
+/*	the corresponding function is called with as argument the
+/*	non-zero value stored under the key.
+/*
+/*	ohtable_free() destroys a hash table, including contents.
+/*	If the free_fn argument is not a null pointer, the corresponding
+/*	function is called for each table entry, with as argument
+/*	the non-zero value stored with the entry.
+/*
+/*	ohtable_walk() invokes the action function for each table
+/*	entry, with a pointer to the entry as its argument. The ptr
+/*	argument is passed on to the action function.
+/*
+/*	ohtable_list() returns a null-terminated list of pointers
+/*	to all elements in the named table. The list should be
+/*	passed to myfree().
+/* RESTRICTIONS
+/*	An OHTABLE_INFO pointer, and the result from ohtable_list(),
+/*	are valid only until the next ohtable_enter() or ohtable_delete()
+/*	call, because entries move when the table is updated. A key
+/*	or value pointer remains valid until its entry is deleted.
+/*
+/*	A callback function should not modify the hash table that
+/*	is specified to its caller.
+/* DIAGNOSTICS
+/*	The following conditions are reported and cause the program
+/*	to terminate immediately: memory allocation failure; an
+/*	attempt to delete a non-existent entry.
+/* SEE ALSO
+/*	htable(3) chained hash table manager
+/*	hash_fnv(3) Fowler/Noll/Vo and word-at-a-time hash functions
+/* LICENSE
+/* .ad
+/* .fi
+/*	The Secure Mailer license must be distributed with this software.
+/* AUTHOR(S)
+/*	agent
+/*	agent@local
+/*--*/
+
+/* System library. */
+
+#include <sys_defs.h>
+#include <stddef.h>
+#include <string.h>
+
+/* Utility library. */
+
+#include <mymalloc.h>
+#include <msg.h>
+#include <hash_fnv.h>
+#include <ohtable.h>
+
+ /*
+  * Interned keys are stored back to back in large chunks.
+  */
+typedef struct OHTABLE_POOL {
+    struct OHTABLE_POOL *next;		/* older chunk */
+    size_t  len;			/* bytes in use */
+    size_t  size;			/* bytes available */
+    char    data[1];			/* actually, data[size] */
+} OHTABLE_POOL;
+
+#define OHTABLE_POOL_SIZE	(64 * 1024)
+
+ /*
+  * Table sizes are a power of 2. A table is resized when it is 3/4 full.
+  * While a table is being resized, each update moves a few entries from the
+  * old array, where their slots are marked as moved, so that lookups in the
+  * old array continue to work.
+  */
+#define OHTABLE_MIN_SIZE	16
+#define OHTABLE_FULL(size)	((size) - ((size) >> 2))
+#define OHTABLE_MIGRATE_STEP	16
+
+static char ohtable_moved[1];		/* place holder for moved entry */
+
+#define OHTABLE_EMPTY(ip)	((ip)->key == 0)
+#define OHTABLE_LIVE(ip)	((ip)->key != 0 && (ip)->key != ohtable_moved)
+
+#define ohtable_hash(key)	((size_t) hash_mumz(key))
+
+#define	STREQ(x,y) (x == y || (x[0] == y[0] && strcmp(x,y) == 0))
+
+/* ohtable_alloc - allocate empty entries array */
+
+static OHTABLE_INFO *ohtable_alloc(ssize_t size)
+{
+    OHTABLE_INFO *data;
+
+    data = (OHTABLE_INFO *) mymalloc(size * sizeof(*data));
+    memset((void *) data, 0, size * sizeof(*data));
+    return (data);
+}
+
+/* ohtable_probe - find entry in one entries array */
+
+static OHTABLE_INFO *ohtable_probe(OHTABLE_INFO *data, ssize_t size,
+				           size_t hash, const char *key)
+{
+    size_t  mask = size - 1;
+    size_t  i;
+    OHTABLE_INFO *ip;
+
+    for (i = hash & mask; !OHTABLE_EMPTY(ip = data + i); i = (i + 1) & mask)
+	if (ip->hash == hash && ip->key != ohtable_moved && STREQ(key, ip->key))
+	    return (ip);
+    return (0);
+}
+
+/* ohtable_insert - store entry in the current entries array */
+
+static OHTABLE_INFO *ohtable_insert(OHTABLE *table, size_t hash,
+				            char *key, void *value)
+{
+    size_t  mask = table->size - 1;
+    size_t  i;
+    OHTABLE_INFO *ip;
+
+    for (i = hash & mask; !OHTABLE_EMPTY(ip = table->data + i); i = (i + 1) & mask)
+	 /* void */ ;
+    ip->key = key;
+    ip->value = value;
+    ip->hash = hash;
+    return (ip);
+}
+
+/* ohtable_remove - remove entry from the current entries array */
+
+static void ohtable_remove(OHTABLE *table, OHTABLE_INFO *ip)
+{
+    OHTABLE_INFO *data = table->data;
+    size_t  mask = table->size - 1;
+    size_t  hole = ip - data;
+    size_t  home;
+    size_t  i;
+
+    /*
+     * Instead of leaving a marker, move later entries in the same probe
+     * sequence into the hole, so that lookups stay short after many
+     * deletions.
+     */
+    for (i = (hole + 1) & mask; !OHTABLE_EMPTY(data + i); i = (i + 1) & mask) {
+	home = data[i].hash & mask;
+	if (((i - home) & mask) >= ((i - hole) & mask)) {
+	    data[hole] = data[i];
+	    hole = i;
+	}
+    }
+    data[hole].key = 0;
+}
+
+/* ohtable_migrate - move entries from the old entries array */
+
+static void ohtable_migrate(OHTABLE *table, ssize_t count)
+{
+    OHTABLE_INFO *ip;
+
+    while (table->old_data != 0) {
+	if (table->old_used == 0 || table->old_next >= table->old_size) {
+	    myfree((void *) table->old_data);
+	    table->old_data = 0;
+	    table->old_size = table->old_next = table->old_used = 0;
+	    break;
+	}
+	if (count-- <= 0)
+	    break;
+	ip = table->old_data + table->old_next++;
+	if (OHTABLE_LIVE(ip)) {
+	    (void) ohtable_insert(table, ip->hash, ip->key, ip->value);
+	    ip->key = ohtable_moved;
+	    table->old_used--;
+	}
+    }
+}
+
+/* ohtable_grow - start incremental resize */
+
+static void ohtable_grow(OHTABLE *table)
+{
+
+    /*
+     * Finish an unfinished resize first. This does not happen with the
+     * current constants, because a resize finishes long before the new
+     * array fills up.
+     */
+    if (table->old_data)
+	ohtable_migrate(table, table->old_size);
+    table->old_data = table->data;
+    table->old_size = table->size;
+    table->old_next = 0;
+    table->old_used = table->used;
+    table->size *= 2;
+    table->data = ohtable_alloc(table->size);
+}
+
+/* ohtable_save_key - save or intern key */
+
+static char *ohtable_save_key(OHTABLE *table, const char *key)
+{
+    OHTABLE_POOL *pool = table->pool;
+    size_t  len;
+    size_t  size;
+    char   *copy;
+
+    if ((table->flags & OHTABLE_FLAG_INTERN) == 0)
+	return (mystrdup(key));
+
+    len = strlen(key) + 1;
+    if (pool == 0 || pool->size - pool->len < len) {
+	size = len > OHTABLE_POOL_SIZE ? len : OHTABLE_POOL_SIZE;
+	pool = (OHTABLE_POOL *) mymalloc(offsetof(OHTABLE_POOL, data) + size);
+	pool->next = table->pool;
+	pool->len = 0;
+	pool->size = size;
+	table->pool = pool;
+    }
+    copy = pool->data + pool->len;
+    memcpy(copy, key, len);
+    pool->len += len;
+    return (copy);
+}
+
+/* ohtable_free_pool - destroy interned key storage */
+
+static void ohtable_free_pool(OHTABLE *table)
+{
+    OHTABLE_POOL *pool;
+
+    while ((pool = table->pool) != 0) {
+	table->pool = pool->next;
+	myfree((void *) pool);
+    }
+}
+
+/* ohtable_create - create initial hash table */
+
+OHTABLE *ohtable_create(ssize_t size, int flags)
+{
+    OHTABLE *table;
+    ssize_t want = OHTABLE_MIN_SIZE;
+
+    while (OHTABLE_FULL(want) < size)
+	want *= 2;
+    table = (OHTABLE *) mymalloc(sizeof(*table));
+    table->size = want;
+    table->used = 0;
+    table->data = ohtable_alloc(want);
+    table->old_data = 0;
+    table->old_size = table->old_next = table->old_used = 0;
+    table->flags = flags;
+    table->pool = 0;
+    return (table);
+}
+
+/* ohtable_enter - enter (key, value) pair */
+
+OHTABLE_INFO *ohtable_enter(OHTABLE *table, const char *key, void *value)
+{
+    OHTABLE_INFO *ip;
+
+    if (table->used >= OHTABLE_FULL(table->size))
+	ohtable_grow(table);
+    ohtable_migrate(table, OHTABLE_MIGRATE_STEP);
+    ip = ohtable_insert(table, ohtable_hash(key),
+			ohtable_save_key(table, key), value);
+    table->used++;
+    return (ip);
+}
+
+/* ohtable_locate - lookup entry */
+
+OHTABLE_INFO *ohtable_locate(OHTABLE *table, const char *key)
+{
+    OHTABLE_INFO *ip;
+    size_t  hash;
+
+    if (table == 0)
+	return (0);
+    hash = ohtable_hash(key);
+    if ((ip = ohtable_probe(table->data, table->size, hash, key)) == 0
+	&& table->old_data != 0)
+	ip = ohtable_probe(table->old_data, table->old_size, hash, key);
+    return (ip);
+}
+
+/* ohtable_find - lookup value */
+
+void   *ohtable_find(OHTABLE *table, const char *key)
+{
+    OHTABLE_INFO *ip;
+
+    return ((ip = ohtable_locate(table, key)) != 0 ? ip->value : 0);
+}
+
+/* ohtable_delete - delete one entry */
+
+void    ohtable_delete(OHTABLE *table, const char *key, void (*free_fn) (void *))
+{
+    OHTABLE_INFO *ip;
+    char   *saved_key;
+    void   *saved_value;
+    size_t  hash;
+
+    if (table) {
+	ohtable_migrate(table, OHTABLE_MIGRATE_STEP);
+	hash = ohtable_hash(key);
+	if ((ip = ohtable_probe(table->data, table->size, hash, key)) != 0) {
+	    saved_key = ip->key;
+	    saved_value = ip->value;
+	    ohtable_remove(table, ip);
+	} else if (table->old_data != 0
+		   && (ip = ohtable_probe(table->old_data, table->old_size,
+					  hash, key)) != 0) {
+	    saved_key = ip->key;
+	    saved_value = ip->value;
+	    ip->key = ohtable_moved;
+	    table->old_used--;
+	} else {
+	    msg_panic("ohtable_delete: unknown_key: \"%s\"", key);
+	}
+	table->used--;
+	if ((table->flags & OHTABLE_FLAG_INTERN) == 0)
+	    myfree(saved_key);
+	else if (table->used == 0)
+	    ohtable_free_pool(table);
+	if (free_fn && saved_value)
+	    (*free_fn) (saved_value);
+    }
+}
+
+/* ohtable_free - destroy hash table */
+
+void    ohtable_free(OHTABLE *table, void (*free_fn) (void *))
+{
+    OHTABLE_INFO *ip;
+    OHTABLE_INFO *data;
+    ssize_t size;
+    int     pass;
+
+    if (table) {
+	for (pass = 0; pass < 2; pass++) {
+	    if (pass == 0) {
+		data = table->old_data;
+		size = table->old_size;
+	    } else {
+		data = table->data;
+		size = table->size;
+	    }
+	    if (data == 0)
+		continue;
+	    for (ip = data; ip < data + size; ip++) {
+		if (!OHTABLE_LIVE(ip))
+		    continue;
+		if ((table->flags & OHTABLE_FLAG_INTERN) == 0)
+		    myfree(ip->key);
+		if (free_fn && ip->value)
+		    (*free_fn) (ip->value);
+	    }
+	    myfree((void *) data);
+	}
+	ohtable_free_pool(table);
+	myfree((void *) table);
+    }
+}
+
+/* ohtable_walk - iterate over hash table */
+
+void    ohtable_walk(OHTABLE *table, void (*action) (OHTABLE_INFO *, void *),
+		             void *ptr)
+{
+    OHTABLE_INFO *ip;
+
+    if (table) {
+	if (table->old_data)
+	    for (ip = table->old_data; ip < table->old_data + table->old_size; ip++)
+		if (OHTABLE_LIVE(ip))
+		    (*action) (ip, ptr);
+	for (ip = table->data; ip < table->data + table->size; ip++)
+	    if (OHTABLE_LIVE(ip))
+		(*action) (ip, ptr);
+    }
+}
+
+/* ohtable_list - list all table members */
+
+OHTABLE_INFO **ohtable_list(OHTABLE *table)
+{
+    OHTABLE_INFO **list;
+    OHTABLE_INFO *ip;
+    ssize_t count = 0;
+
+    if (table != 0) {
+	list = (OHTABLE_INFO **) mymalloc(sizeof(*list) * (table->used + 1));
+	if (table->old_data)
+	    for (ip = table->old_data; ip < table->old_data + table->old_size; ip++)
+		if (OHTABLE_LIVE(ip))
+		    list[count++] = ip;
+	for (ip = table->data; ip < table->data + table->size; ip++)
+	    if (OHTABLE_LIVE(ip))
+		list[count++] = ip;
+    } else {
+	list = (OHTABLE_INFO **) mymalloc(sizeof(*list));
+    }
+    list[count] = 0;
+    return (list);
+}
@@ -0,0 +1,349 @@
+/*++
+/* NAME
+/*	ohtable_bench 1
+/* SUMMARY
+/*	compare hash table implementations
+/* SYNOPSIS
+/* .fi
+/*	\fBohtable_bench\fR [\fB-iv\fR] [\fB-n \fIkey_count\fR]
+/*		[\fB-r \fIrounds\fR]
+/* DESCRIPTION
+/*	The \fBohtable_bench\fR command measures the cost of entering,
+/*	finding, walking and deleting large numbers of keys with the
+/*	\fBhtable\fR(3) chained hash table and with the \fBohtable\fR(3)
+/*	open-addressing hash table.
+/*
+/*	Each round generates \fIkey_count\fR keys that look like
+/*	email addresses. For each implementation, it enters all keys,
+/*	looks up each key once, looks up as many keys that do not
+/*	exist, walks the table, and deletes all keys in random order.
+/*	It also reports the slowest single insertion, which includes
+/*	the cost of resizing the table. Each implementation runs in
+/*	its own process.
+/*
+/*	Options:
+/* .IP \fB-i\fR
+/*	Intern ohtable keys in a table-owned string pool.
+/* .IP "\fB-n \fIkey_count\fR (default: 1000000)"
+/*	The number of keys.
+/* .IP "\fB-r \fIrounds\fR (default: 1)"
+/*	The number of times to repeat the measurement.
+/* .IP \fB-v\fR
+/*	Increase verbosity.
+/* DIAGNOSTICS
+/*	Problems are reported to the standard error stream.
+/* LICENSE
+/* .ad
+/* .fi
+/*	The Secure Mailer license must be distributed with this software.
+/*--*/
+
+/* System library. */
+
+#include <sys_defs.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/* Utility library. */
+
+#include <msg.h>
+#include <msg_vstream.h>
+#include <mymalloc.h>
+#include <myrand.h>
+#include <vstream.h>
+#include <vstring.h>
+#include <htable.h>
+#include <ohtable.h>
+
+ /*
+  * Each implementation is called through the same small interface.
+  */
+typedef struct {
+    const char *name;
+    void   *(*create) (ssize_t, int);
+    void    (*enter) (void *, const char *, void *);
+    void   *(*find) (void *, const char *);
+    long    (*walk) (void *);
+    void    (*delete) (void *, const char *);
+    void    (*free) (void *);
+} BENCH_IMPL;
+
+static void *bench_htable_create(ssize_t size, int unused_flags)
+{
+    return ((void *) htable_create(size));
+}
+
+static void bench_htable_enter(void *table, const char *key, void *value)
+{
+    (void) htable_enter((HTABLE *) table, key, value);
+}
+
+static void *bench_htable_find(void *table, const char *key)
+{
+    return (htable_find((HTABLE *) table, key));
+}
+
+static void bench_htable_count(HTABLE_INFO *unused_info, void *context)
+{
+    (*(long *) context)++;
+}
+
+static long bench_htable_walk(void *table)
+{
+    long    count = 0;
+
+    htable_walk((HTABLE *) table, bench_htable_count, (void *) &count);
+    return (count);
+}
+
+static void bench_htable_delete(void *table, const char *key)
+{
+    htable_delete((HTABLE *) table, key, (void (*) (void *)) 0);
+}
+
+static void bench_htable_free(void *table)
+{
+    htable_free((HTABLE *) table, (void (*) (void *)) 0);
+}
+
+static void *bench_ohtable_create(ssize_t size, int flags)
+{
+    return ((void *) ohtable_create(size, flags));
+}
+
+static void bench_ohtable_enter(void *table, const char *key, void *value)
+{
+    (void) ohtable_enter((OHTABLE *) table, key, value);
+}
+
+static void *bench_ohtable_find(void *table, const char *key)
+{
+    return (ohtable_find((OHTABLE *) table, key));
+}
+
+static void bench_ohtable_count(OHTABLE_INFO *unused_info, void *context)
+{
+    (*(long *) context)++;
+}
+
+static long bench_ohtable_walk(void *table)
+{
+    long    count = 0;
+
+    ohtable_walk((OHTABLE *) table, bench_ohtable_count, (void *) &count);
+    return (count);
+}
+
+static void bench_ohtable_delete(void *table, const char *key)
+{
+    ohtable_delete((OHTABLE *) table, key, (void (*) (void *)) 0);
+}
+
+static void bench_ohtable_free(void *table)
+{
+    ohtable_free((OHTABLE *) table, (void (*) (void *)) 0);
+}
+
+static const BENCH_IMPL bench_impl[] = {
+    {"htable", bench_htable_create, bench_htable_enter, bench_htable_find,
+    bench_htable_walk, bench_htable_delete, bench_htable_free},
+    {"ohtable", bench_ohtable_create, bench_ohtable_enter, bench_ohtable_find,
+    bench_ohtable_walk, bench_ohtable_delete, bench_ohtable_free},
+    {0},
+};
+
+/* elapsed - return elapsed time in seconds */
+
+static double elapsed(struct timeval *start)
+{
+    struct timeval now;
+
+    if (gettimeofday(&now, (struct timezone *) 0) < 0)
+	msg_fatal("gettimeofday: %m");
+    return ((now.tv_sec - start->tv_sec)
+	    + (now.tv_usec - start->tv_usec) / 1000000.0);
+}
+
+/* report - report the cost of one phase */
+
+static void report(const char *impl, const char *phase, long count,
+		           struct timeval *start)
+{
+    double  secs = elapsed(start);
+
+    vstream_printf("%-8s %-8s %8ld requests %8.3f s %10.0f requests/s\n",
+		   impl, phase, count, secs, secs > 0 ? count / secs : 0);
+    vstream_fflush(VSTREAM_OUT);
+}
+
+/* make_keys - generate keys */
+
+static char **make_keys(const char *fmt, long count)
+{
+    VSTRING *buf = vstring_alloc(100);
+    char  **keys;
+    long    n;
+
+    keys = (char **) mymalloc(sizeof(*keys) * count);
+    for (n = 0; n < count; n++) {
+	vstring_sprintf(buf, fmt, (long) myrand(), n, n % 1000);
+	keys[n] = mystrdup(vstring_str(buf));
+    }
+    vstring_free(buf);
+    return (keys);
+}
+
+/* free_keys - destroy keys */
+
+static void free_keys(char **keys, long count)
+{
+    while (count-- > 0)
+	myfree(keys[count]);
+    myfree((void *) keys);
+}
+
+/* run_impl - one round with one implementation */
+
+static void run_impl(const BENCH_IMPL *ip, char **keys, char **misses,
+		             long *order, long count, int flags)
+{
+    struct timeval start;
+    struct timeval op_start;
+    double  op_secs;
+    double  max_secs = 0;
+    void   *table;
+    long    walked;
+    long    n;
+
+    table = ip->create(0, flags);
+    gettimeofday(&start, (struct timezone *) 0);
+    for (n = 0; n < count; n++) {
+	gettimeofday(&op_start, (struct timezone *) 0);
+	ip->enter(table, keys[n], CAST_INT_TO_VOID_PTR(n + 1));
+	if ((op_secs = elapsed(&op_start)) > max_secs)
+	    max_secs = op_secs;
+    }
+    report(ip->name, "enter", count, &start);
+    vstream_printf("%-8s %-8s %8.3f ms\n", ip->name, "slowest",
+		   max_secs * 1000);
+
+    gettimeofday(&start, (struct timezone *) 0);
+    for (n = 0; n < count; n++)
+	if (ip->find(table, keys[n]) != CAST_INT_TO_VOID_PTR(n + 1))
+	    msg_fatal("%s: key %s: wrong result", ip->name, keys[n]);
+    report(ip->name, "find", count, &start);
+
+    gettimeofday(&start, (struct timezone *) 0);
+    for (n = 0; n < count; n++)
+	if (ip->find(table, misses[n]) != 0)
+	    msg_fatal("%s: key %s: unexpected result", ip->name, misses[n]);
+    report(ip->name, "miss", count, &start);
+
+    gettimeofday(&start, (struct timezone *) 0);
+    walked = ip->walk(table);
+    if (walked != count)
+	msg_fatal("%s: walk found %ld entries, want %ld",
+		  ip->name, walked, count);
+    report(ip->name, "walk", count, &start);
+
+    gettimeofday(&start, (struct timezone *) 0);
+    for (n = 0; n < count; n++)
+	ip->delete(table, keys[order[n]]);
+    report(ip->name, "delete", count, &start);
+    ip->free(table);
+}
+
+/* run_round - one round with all implementations */
+
+static void run_round(long count, int flags)
+{
+    const BENCH_IMPL *ip;
+    char  **keys;
+    char  **misses;
+    long   *order;
+    long    n;
+    long    r;
+    long    tmp;
+    pid_t   pid;
+    int     status;
+
+    keys = make_keys("user%ld.%ld@example%ld.com", count);
+    misses = make_keys("user%ld.%ld@example%ld.net", count);
+    order = (long *) mymalloc(sizeof(*order) * count);
+    for (n = 0; n < count; n++)
+	order[n] = n;
+    for (n = 0; n < count; n++) {
+	r = myrand() % count;
+	tmp = order[n];
+	order[n] = order[r];
+	order[r] = tmp;
+    }
+
+    /*
+     * Run each implementation in a child process, so that the memory that
+     * one implementation leaves behind in the malloc() arena does not
+     * affect the cost of the next.
+     */
+    for (ip = bench_impl; ip->name; ip++) {
+	switch (pid = fork()) {
+	case -1:
+	    msg_fatal("fork: %m");
+	case 0:
+	    run_impl(ip, keys, misses, order, count, flags);
+	    exit(0);
+	default:
+	    if (waitpid(pid, &status, 0) < 0)
+		msg_fatal("waitpid: %m");
+	    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+		msg_fatal("%s benchmark failed", ip->name);
+	}
+    }
+    myfree((void *) order);
+    free_keys(misses, count);
+    free_keys(keys, count);
+}
+
+/* usage - explain and terminate */
+
+static NORETURN usage(char *myname)
+{
+    msg_fatal("usage: %s [-iv] [-n key_count] [-r rounds]", myname);
+}
+
+int     main(int argc, char **argv)
+{
+    long    count = 1000000;
+    int     rounds = 1;
+    int     flags = OHTABLE_FLAG_NONE;
+    int     ch;
+
+    msg_vstream_init(argv[0], VSTREAM_ERR);
+    while ((ch = GETOPT(argc, argv, "in:r:v")) > 0) {
+	switch (ch) {
+	case 'i':
+	    flags |= OHTABLE_FLAG_INTERN;
+	    break;
+	case 'n':
+	    if ((count = atol(optarg)) <= 0)
+		usage(argv[0]);
+	    break;
+	case 'r':
+	    if ((rounds = atoi(optarg)) <= 0)
+		usage(argv[0]);
+	    break;
+	case 'v':
+	    msg_verbose++;
+	    break;
+	default:
+	    usage(argv[0]);
+	}
+    }
+    if (argc != optind)
+	usage(argv[0]);
+
+    while (rounds-- > 0)
+	run_round(count, flags);
+    exit(0);
+}
@@ -0,0 +1,235 @@
+ /*
+  * Test program to exercise ohtable.c. See PTEST_README for documentation.
+  */
+
+ /*
+  * System library.
+  */
+#include <sys_defs.h>
+#include <string.h>
+
+ /*
+  * Utility library.
+  */
+#include <mymalloc.h>
+#include <myrand.h>
+#include <vstring.h>
+#include <ohtable.h>
+
+ /*
+  * Test library.
+  */
+#include <ptest.h>
+
+typedef struct PTEST_CASE {
+    const char *testname;		/* identifies test case */
+    void    (*action) (PTEST_CTX *t, const struct PTEST_CASE *tp);
+    int     flags;			/* OHTABLE_FLAG_XXX */
+} PTEST_CASE;
+
+#define KEY_COUNT	20000
+
+/* make_keys - generate distinct keys */
+
+static char **make_keys(ssize_t count)
+{
+    VSTRING *buf = vstring_alloc(100);
+    char  **keys;
+    ssize_t n;
+
+    keys = (char **) mymalloc(sizeof(*keys) * count);
+    for (n = 0; n < count; n++) {
+	vstring_sprintf(buf, "user%ld@example%ld.com", (long) n, (long) n % 7);
+	keys[n] = mystrdup(vstring_str(buf));
+    }
+    vstring_free(buf);
+    return (keys);
+}
+
+/* free_keys - destroy keys */
+
+static void free_keys(char **keys, ssize_t count)
+{
+    while (count-- > 0)
+	myfree(keys[count]);
+    myfree((void *) keys);
+}
+
+/* check_all - verify that each present key has the expected value */
+
+static void check_all(PTEST_CTX *t, OHTABLE *table, char **keys,
+		              ssize_t count, const char *present)
+{
+    OHTABLE_INFO *ip;
+    ssize_t n;
+
+    for (n = 0; n < count; n++) {
+	ip = ohtable_locate(table, keys[n]);
+	if (present[n] && ip == 0) {
+	    ptest_error(t, "key \"%s\" was not found", keys[n]);
+	} else if (!present[n] && ip != 0) {
+	    ptest_error(t, "deleted key \"%s\" was found", keys[n]);
+	} else if (ip != 0 && (strcmp(ip->key, keys[n]) != 0
+			       || ip->value != CAST_INT_TO_VOID_PTR(n + 1))) {
+	    ptest_error(t, "key \"%s\": got key \"%s\" value %ld",
+			keys[n], ip->key, (long) ip->value);
+	}
+    }
+}
+
+static void test_enter_delete(PTEST_CTX *t, const PTEST_CASE *tp)
+{
+    OHTABLE *table = ohtable_create(0, tp->flags);
+    char  **keys = make_keys(KEY_COUNT);
+    char   *present = mymalloc(KEY_COUNT);
+    ssize_t order[KEY_COUNT];
+    ssize_t n;
+    ssize_t r;
+    ssize_t tmp;
+    int     migrating = 0;
+
+    /*
+     * Enter keys, and verify lookups while the table is being resized.
+     */
+    for (n = 0; n < KEY_COUNT; n++) {
+	(void) ohtable_enter(table, keys[n], CAST_INT_TO_VOID_PTR(n + 1));
+	if (table->old_data != 0 && migrating++ == 0) {
+	    memset(present, 0, KEY_COUNT);
+	    memset(present, 1, n + 1);
+	    check_all(t, table, keys, KEY_COUNT, present);
+	}
+    }
+    if (migrating == 0)
+	ptest_error(t, "table was never resized");
+    if (table->used != KEY_COUNT)
+	ptest_error(t, "used: got %ld, want %d", (long) table->used, KEY_COUNT);
+    memset(present, 1, KEY_COUNT);
+    check_all(t, table, keys, KEY_COUNT, present);
+
+    /*
+     * Delete keys in random order, and verify lookups half-way.
+     */
+    for (n = 0; n < KEY_COUNT; n++)
+	order[n] = n;
+    for (n = 0; n < KEY_COUNT; n++) {
+	r = myrand() % KEY_COUNT;
+	tmp = order[n];
+	order[n] = order[r];
+	order[r] = tmp;
+    }
+    for (n = 0; n < KEY_COUNT; n++) {
+	ohtable_delete(table, keys[order[n]], (void (*) (void *)) 0);
+	present[order[n]] = 0;
+	if (n == KEY_COUNT / 2)
+	    check_all(t, table, keys, KEY_COUNT, present);
+    }
+    if (table->used != 0)
+	ptest_error(t, "used: got %ld, want 0", (long) table->used);
+    if (table->pool != 0)
+	ptest_error(t, "key pool was not reclaimed");
+    check_all(t, table, keys, KEY_COUNT, present);
+
+    ohtable_free(table, (void (*) (void *)) 0);
+    myfree(present);
+    free_keys(keys, KEY_COUNT);
+}
+
+/* count_entry - ohtable_walk() call-back */
+
+static void count_entry(OHTABLE_INFO *ip, void *context)
+{
+    (*(ssize_t *) context)++;
+}
+
+static void test_walk_list(PTEST_CTX *t, const PTEST_CASE *tp)
+{
+    OHTABLE *table = ohtable_create(0, tp->flags);
+    char  **keys = make_keys(KEY_COUNT);
+    OHTABLE_INFO **list;
+    OHTABLE_INFO **lp;
+    ssize_t count;
+    ssize_t n;
+
+    /*
+     * Stop while a resize is in progress, so that entries are in both the
+     * old and the new array.
+     */
+    for (n = 0; n < KEY_COUNT; n++) {
+	(void) ohtable_enter(table, keys[n], mystrdup(keys[n]));
+	if (table->old_data != 0 && table->old_next > 0)
+	    break;
+    }
+    if (table->old_data == 0)
+	ptest_fatal(t, "no resize in progress");
+
+    count = 0;
+    ohtable_walk(table, count_entry, (void *) &count);
+    if (count != table->used)
+	ptest_error(t, "walk: got %ld entries, want %ld",
+		    (long) count, (long) table->used);
+
+    list = ohtable_list(table);
+    for (count = 0, lp = list; *lp; lp++, count++)
+	if (strcmp(lp[0]->key, (char *) lp[0]->value) != 0)
+	    ptest_error(t, "list: key \"%s\" has value \"%s\"",
+			lp[0]->key, (char *) lp[0]->value);
+    if (count != table->used)
+	ptest_error(t, "list: got %ld entries, want %ld",
+		    (long) count, (long) table->used);
+    myfree((void *) list);
+
+    ohtable_free(table, myfree);
+    free_keys(keys, KEY_COUNT);
+}
+
+static void test_empty_key(PTEST_CTX *t, const PTEST_CASE *tp)
+{
+    OHTABLE *table = ohtable_create(0, tp->flags);
+    char  **keys = make_keys(100);
+    ssize_t n;
+
+    /*
+     * An empty key must not match a slot that was moved during a resize.
+     */
+    for (n = 0; n < 100; n++)
+	(void) ohtable_enter(table, keys[n], CAST_INT_TO_VOID_PTR(n + 1));
+    if (ohtable_find(table, "") != 0)
+	ptest_error(t, "empty key was found before it was entered");
+    (void) ohtable_enter(table, "", CAST_INT_TO_VOID_PTR(1000));
+    if (ohtable_find(table, "") != CAST_INT_TO_VOID_PTR(1000))
+	ptest_error(t, "empty key was not found");
+    ohtable_delete(table, "", (void (*) (void *)) 0);
+    if (ohtable_find(table, "") != 0)
+	ptest_error(t, "empty key was found after it was deleted");
+
+    ohtable_free(table, (void (*) (void *)) 0);
+    free_keys(keys, 100);
+}
+
+/* wrap_ohtable_free - ptest_defer() call-back */
+
+static void wrap_ohtable_free(void *context)
+{
+    ohtable_free((OHTABLE *) context, (void (*) (void *)) 0);
+}
+
+static void test_delete_unknown(PTEST_CTX *t, const PTEST_CASE *tp)
+{
+    OHTABLE *table = ohtable_create(0, tp->flags);
+
+    ptest_defer(t, wrap_ohtable_free, (void *) table);
+    expect_ptest_log_event(t, "panic: ohtable_delete: unknown_key: \"foo\"");
+    ohtable_delete(table, "foo", (void (*) (void *)) 0);
+    ptest_fatal(t, "ohtable_delete() returned");
+}
+
+static const PTEST_CASE ptestcases[] = {
+    {"enter and delete", test_enter_delete, OHTABLE_FLAG_NONE,},
+    {"enter and delete interned", test_enter_delete, OHTABLE_FLAG_INTERN,},
+    {"walk and list", test_walk_list, OHTABLE_FLAG_NONE,},
+    {"walk and list interned", test_walk_list, OHTABLE_FLAG_INTERN,},
+    {"empty key", test_empty_key, OHTABLE_FLAG_NONE,},
+    {"delete unknown key", test_delete_unknown, OHTABLE_FLAG_NONE,},
+};
+
+#include <ptest_main.h>
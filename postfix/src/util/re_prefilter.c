@@ -0,0 +1,578 @@
+/*++
+/* NAME
+/*	re_prefilter 3
+/* SUMMARY
+/*	literal substring prefilter for regular expression tables
+/* SYNOPSIS
+/*	#include <re_prefilter.h>
+/*
+/*	int	re_prefilter_enable;
+/*
+/*	RE_PREFILTER *re_prefilter_create()
+/*
+/*	int	re_prefilter_add(pf, regexp, flags)
+/*	RE_PREFILTER *pf;
+/*	const char *regexp;
+/*	int	flags;
+/*
+/*	int	re_prefilter_count(pf)
+/*	RE_PREFILTER *pf;
+/*
+/*	void	re_prefilter_compile(pf)
+/*	RE_PREFILTER *pf;
+/*
+/*	void	re_prefilter_scan(pf, text)
+/*	RE_PREFILTER *pf;
+/*	const char *text;
+/*
+/*	int	re_prefilter_found(pf, id)
+/*	RE_PREFILTER *pf;
+/*	int	id;
+/*
+/*	void	re_prefilter_free(pf)
+/*	RE_PREFILTER *pf;
+/* AUXILIARY FUNCTIONS
+/*	char	*re_prefilter_literal(buf, regexp, flags)
+/*	VSTRING	*buf;
+/*	const char *regexp;
+/*	int	flags;
+/* DESCRIPTION
+/*	This module helps regular expression tables to avoid
+/*	executing patterns that cannot match. For each pattern, it
+/*	finds a literal substring that every match must contain,
+/*	and it compiles all those substrings into one Aho-Corasick
+/*	automaton. A single pass over the lookup string then reveals
+/*	which patterns need to be executed; other patterns can be
+/*	skipped as if they did not match. The automaton ignores
+/*	ASCII case, so that one prefilter works for case-sensitive
+/*	and case-insensitive patterns.
+/*
+/*	The global re_prefilter_enable variable (default: zero)
+/*	controls whether regexp: and pcre: tables use a prefilter.
+/*
+/*	re_prefilter_create() creates an empty prefilter.
+/*
+/*	re_prefilter_add() extracts a required literal substring
+/*	from the specified pattern, and adds it to the prefilter.
+/*	The result is a small non-negative integer that identifies
+/*	the literal, or RE_PREFILTER_NONE when the pattern has no
+/*	usable literal. Patterns that share a literal share its
+/*	identifier. The caller must not use this for patterns that
+/*	have a negative match, for POSIX basic regular expressions,
+/*	or for patterns with extended (whitespace-insensitive) syntax.
+/*
+/*	re_prefilter_count() returns the number of distinct literals
+/*	in the prefilter.
+/*
+/*	re_prefilter_compile() finishes construction of the
+/*	prefilter. Further re_prefilter_add() calls are not allowed.
+/*
+/*	re_prefilter_scan() finds all literals in the specified
+/*	text. This takes time proportional to the text length plus
+/*	the number of distinct literals found.
+/*
+/*	re_prefilter_found() returns non-zero if the literal with
+/*	the specified identifier was found by the most recent
+/*	re_prefilter_scan() call.
+/*
+/*	re_prefilter_free() destroys a prefilter.
+/*
+/*	re_prefilter_literal() is the literal extraction engine.
+/*	It stores the longest substring that every match of the
+/*	specified pattern must contain into the specified buffer,
+/*	converted to lower case, and returns the buffer content.
+/*	The result is a null pointer if no such substring of at
+/*	least RE_PREFILTER_MIN_LEN bytes was found. The analysis
+/*	is conservative: patterns with alternation, PCRE (?...)
+/*	constructs or \eQ...\eE quoting have no literal, and
+/*	analysis ends at the first escape sequence that does not
+/*	denote a punctuation character.
+/*
+/*	Arguments:
+/* .IP pf
+/*	Prefilter handle.
+/* .IP regexp
+/*	Pattern text, without delimiters or options.
+/* .IP flags
+/*	Specify RE_PREFILTER_FLAG_PCRE for PCRE syntax, or
+/*	RE_PREFILTER_FLAG_NONE for POSIX extended regular
+/*	expressions.
+/* .IP text
+/*	Null-terminated lookup string.
+/* .IP buf
+/*	Result buffer.
+/* DIAGNOSTICS
+/*	Panic: interface violation. Fatal error: out of memory.
+/* SEE ALSO
+/*	dict_regexp(3) POSIX regular expression table
+/*	dict_pcre(3) PCRE table
+/* LICENSE
+/* .ad
+/* .fi
+/*	The Secure Mailer license must be distributed with this software.
+/* AUTHOR(S)
+/*	agent
+/*	agent@local
+/*--*/
+
+/* System library. */
+
+#include <sys_defs.h>
+#include <string.h>
+#include <ctype.h>
+
+/* Utility library. */
+
+#include <msg.h>
+#include <mymalloc.h>
+#include <stringops.h>
+#include <vstring.h>
+#include <re_prefilter.h>
+
+ /*
+  * Global library.
+  */
+int     re_prefilter_enable = 0;
+
+ /*
+  * Automaton states. State 0 is the root; it has a dense transition table
+  * in the RE_PREFILTER structure. Other states keep their transitions in a
+  * list of children, which is short for all but the shallowest states.
+  */
+typedef struct RE_PREFILTER_STATE {
+    int     child;			/* first child state, or 0 */
+    int     sibling;			/* next sibling state, or 0 */
+    int     fail;			/* longest proper suffix state */
+    int     output;			/* literal ending here, or none */
+    int     out_link;			/* next suffix state with output */
+    unsigned char ch;			/* input that leads to this state */
+} RE_PREFILTER_STATE;
+
+ /*
+  * Literals longer than this are truncated. A prefix of a required literal
+  * is still a required literal.
+  */
+#define RE_PREFILTER_MAX_LEN	64
+
+#define STR(x)	vstring_str(x)
+#define LEN(x)	VSTRING_LEN(x)
+
+ /*
+  * ASCII-only case folding, independent of locale.
+  */
+#define RE_PREFILTER_FOLD(c) \
+    ((c) >= 'A' && (c) <= 'Z' ? (c) - 'A' + 'a' : (c))
+
+/* re_prefilter_skip_class - skip [...] expression */
+
+static const char *re_prefilter_skip_class(const char *cp, int flags)
+{
+    int     delim;
+
+    /*
+     * POSIX brackets don't support backslash escapes; PCRE brackets do.
+     * Both support [:name:] inside brackets, and both treat a leading ]
+     * as a literal.
+     */
+    if (*cp == '^')
+	cp++;
+    if (*cp == ']')
+	cp++;
+    for ( /* void */ ; *cp; cp++) {
+	if (*cp == ']')
+	    return (cp + 1);
+	if (*cp == '[' && (cp[1] == ':' || cp[1] == '.' || cp[1] == '=')) {
+	    delim = cp[1];
+	    for (cp += 2; *cp && !(cp[0] == delim && cp[1] == ']'); cp++)
+		 /* void */ ;
+	    if (*cp++ == 0)
+		return (0);
+	} else if (*cp == '\\' && (flags & RE_PREFILTER_FLAG_PCRE)) {
+	    if (*++cp == 0)
+		return (0);
+	}
+    }
+    return (0);
+}
+
+/* re_prefilter_skip_group - skip (...) expression */
+
+static const char *re_prefilter_skip_group(const char *cp, int flags)
+{
+    int     depth = 1;
+
+    while (*cp) {
+	switch (*cp) {
+	case '\\':
+	    if (cp[1] == 0)
+		return (0);
+	    cp += 2;
+	    continue;
+	case '[':
+	    if ((cp = re_prefilter_skip_class(cp + 1, flags)) == 0)
+		return (0);
+	    continue;
+	case '(':
+	    depth++;
+	    break;
+	case ')':
+	    if (--depth == 0)
+		return (cp + 1);
+	    break;
+	}
+	cp++;
+    }
+    return (0);
+}
+
+/* re_prefilter_literal - find longest required literal substring */
+
+char   *re_prefilter_literal(VSTRING *buf, const char *regexp, int flags)
+{
+    char    run[RE_PREFILTER_MAX_LEN];
+    int     run_len = 0;
+    int     last_lit = 0;
+    const char *cp;
+    const char *qp;
+    int     ch;
+    int     min;			/* minimum count is non-zero */
+    int     done;
+
+    VSTRING_RESET(buf);
+    VSTRING_TERMINATE(buf);
+
+    /*
+     * Give up on constructs that would make a literal optional, or that
+     * change the meaning of what follows.
+     */
+    if (strchr(regexp, '|') != 0)
+	return (0);
+    if ((flags & RE_PREFILTER_FLAG_PCRE)
+	&& (strstr(regexp, "(?") != 0 || strstr(regexp, "\\Q") != 0))
+	return (0);
+
+    /*
+     * Concatenation is the only top-level operator that remains. Collect
+     * runs of consecutive literal characters, and remember the longest.
+     * A quantifier that allows zero repetitions removes the preceding
+     * literal from the run.
+     */
+#define RE_PREFILTER_FLUSH() do { \
+	if (run_len > LEN(buf)) \
+	    vstring_strncpy(buf, run, run_len); \
+	run_len = 0; \
+	last_lit = 0; \
+    } while (0)
+
+    for (done = 0, cp = regexp; done == 0 && *cp; /* see below */ ) {
+	switch (ch = *(unsigned char *) cp) {
+	case '\\':
+	    ch = ((unsigned char *) cp)[1];
+	    if (ch == 0 || ISALNUM(ch)) {
+		done = 1;
+		continue;
+	    }
+	    cp += 2;
+	    if (ch >= 0x80 || ((flags & RE_PREFILTER_FLAG_PCRE) == 0
+			       && strchr("<>`'", ch) != 0)) {
+		RE_PREFILTER_FLUSH();
+		continue;
+	    }
+	    break;
+	case '[':
+	    RE_PREFILTER_FLUSH();
+	    if ((cp = re_prefilter_skip_class(cp + 1, flags)) == 0)
+		return (0);
+	    continue;
+	case '(':
+	    RE_PREFILTER_FLUSH();
+	    if ((cp = re_prefilter_skip_group(cp + 1, flags)) == 0)
+		return (0);
+	    continue;
+	case ')':
+	    done = 1;
+	    continue;
+	case '.':
+	case '^':
+	case '$':
+	    RE_PREFILTER_FLUSH();
+	    cp += 1;
+	    continue;
+	case '*':
+	case '?':
+	    if (last_lit)
+		run_len -= 1;
+	    RE_PREFILTER_FLUSH();
+	    cp += 1;
+	    continue;
+	case '+':
+	    RE_PREFILTER_FLUSH();
+	    cp += 1;
+	    continue;
+	case '{':
+	    for (min = 0, qp = cp + 1; ISDIGIT(*qp); qp++)
+		if (*qp != '0')
+		    min = 1;
+	    if (qp > cp + 1 && *qp == ',')
+		while (ISDIGIT(*++qp))
+		     /* void */ ;
+	    if (qp == cp + 1 || *qp != '}') {
+		/* Not a quantifier that we know of. */
+		if (last_lit)
+		    run_len -= 1;
+		done = 1;
+		continue;
+	    }
+	    if (min == 0 && last_lit)
+		run_len -= 1;
+	    RE_PREFILTER_FLUSH();
+	    cp = qp + 1;
+	    continue;
+	default:
+	    cp += 1;
+	    if (ch >= 0x80) {
+		RE_PREFILTER_FLUSH();
+		continue;
+	    }
+	    break;
+	}
+
+	/*
+	 * Append a literal character to the current run. When the run is
+	 * full, the run up to here is still a required literal, but a
+	 * quantifier must not remove its last character.
+	 */
+	if (run_len < RE_PREFILTER_MAX_LEN) {
+	    run[run_len++] = RE_PREFILTER_FOLD(ch);
+	    last_lit = 1;
+	} else {
+	    last_lit = 0;
+	}
+    }
+    RE_PREFILTER_FLUSH();
+    return (LEN(buf) >= RE_PREFILTER_MIN_LEN ? STR(buf) : 0);
+}
+
+/* re_prefilter_new_state - allocate automaton state */
+
+static int re_prefilter_new_state(RE_PREFILTER *pf, int ch)
+{
+    RE_PREFILTER_STATE *sp;
+
+    if (pf->state_count >= pf->state_size) {
+	pf->state_size *= 2;
+	pf->states = (RE_PREFILTER_STATE *)
+	    myrealloc((void *) pf->states, pf->state_size * sizeof(*sp));
+    }
+    sp = pf->states + pf->state_count;
+    sp->child = sp->sibling = sp->fail = sp->out_link = 0;
+    sp->output = RE_PREFILTER_NONE;
+    sp->ch = ch;
+    return (pf->state_count++);
+}
+
+/* re_prefilter_goto - look up transition, excluding the root */
+
+static inline int re_prefilter_goto(RE_PREFILTER *pf, int state, int ch)
+{
+    int     next;
+
+    for (next = pf->states[state].child; next != 0;
+	 next = pf->states[next].sibling)
+	if (pf->states[next].ch == ch)
+	    return (next);
+    return (0);
+}
+
+/* re_prefilter_create - create empty prefilter */
+
+RE_PREFILTER *re_prefilter_create(void)
+{
+    RE_PREFILTER *pf;
+
+    pf = (RE_PREFILTER *) mymalloc(sizeof(*pf));
+    pf->state_count = 0;
+    pf->state_size = 64;
+    pf->states = (RE_PREFILTER_STATE *)
+	mymalloc(pf->state_size * sizeof(*pf->states));
+    (void) re_prefilter_new_state(pf, 0);
+    memset(pf->root, 0, sizeof(pf->root));
+    pf->literal_count = 0;
+    pf->seen = 0;
+    pf->generation = 0;
+    pf->compiled = 0;
+    pf->buf = vstring_alloc(RE_PREFILTER_MAX_LEN);
+    return (pf);
+}
+
+/* re_prefilter_add - add pattern literal to prefilter */
+
+int     re_prefilter_add(RE_PREFILTER *pf, const char *regexp, int flags)
+{
+    const char *myname = "re_prefilter_add";
+    const unsigned char *cp;
+    int     state;
+    int     next;
+
+    if (pf->compiled)
+	msg_panic("%s: prefilter was already compiled", myname);
+    if (re_prefilter_literal(pf->buf, regexp, flags) == 0)
+	return (RE_PREFILTER_NONE);
+
+    /*
+     * Add the literal to the trie. Identical literals end in the same
+     * state, and share the same identifier.
+     */
+    for (state = 0, cp = (unsigned char *) STR(pf->buf); *cp; cp++) {
+	if (state == 0) {
+	    if ((next = pf->root[*cp]) == 0)
+		next = pf->root[*cp] = re_prefilter_new_state(pf, *cp);
+	} else if ((next = re_prefilter_goto(pf, state, *cp)) == 0) {
+	    next = re_prefilter_new_state(pf, *cp);
+	    pf->states[next].sibling = pf->states[state].child;
+	    pf->states[state].child = next;
+	}
+	state = next;
+    }
+    if (pf->states[state].output == RE_PREFILTER_NONE)
+	pf->states[state].output = pf->literal_count++;
+    if (msg_verbose)
+	msg_info("%s: \"%s\" -> \"%s\" id=%d", myname, regexp,
+		 STR(pf->buf), pf->states[state].output);
+    return (pf->states[state].output);
+}
+
+/* re_prefilter_compile - compute failure and output links */
+
+void    re_prefilter_compile(RE_PREFILTER *pf)
+{
+    const char *myname = "re_prefilter_compile";
+    RE_PREFILTER_STATE *states;
+    int    *queue;
+    int     head;
+    int     tail;
+    int     parent;
+    int     state;
+    int     fail;
+    int     next;
+    int     ch;
+
+    if (pf->compiled)
+	msg_panic("%s: prefilter was already compiled", myname);
+
+    /*
+     * Visit states in breadth-first order, so that the failure link of a
+     * state's parent is final before the state itself is visited.
+     */
+    states = pf->states;
+    queue = (int *) mymalloc(pf->state_count * sizeof(*queue));
+    for (head = tail = 0, ch = 0; ch < 256; ch++)
+	if ((state = pf->root[ch]) != 0)
+	    queue[tail++] = state;
+    while (head < tail) {
+	parent = queue[head++];
+	for (state = states[parent].child; state != 0;
+	     state = states[state].sibling) {
+	    ch = states[state].ch;
+	    for (fail = states[parent].fail; fail != 0
+		 && re_prefilter_goto(pf, fail, ch) == 0;
+		 fail = states[fail].fail)
+		 /* void */ ;
+	    next = (fail == 0 ? pf->root[ch] : re_prefilter_goto(pf, fail, ch));
+	    states[state].fail = next;
+	    states[state].out_link =
+		(states[next].output != RE_PREFILTER_NONE ?
+		 next : states[next].out_link);
+	    queue[tail++] = state;
+	}
+    }
+    myfree((void *) queue);
+
+    pf->seen = (unsigned *)
+	mymalloc((pf->literal_count + 1) * sizeof(*pf->seen));
+    memset((void *) pf->seen, 0,
+	   (pf->literal_count + 1) * sizeof(*pf->seen));
+    pf->generation = 0;
+    pf->compiled = 1;
+}
+
+/* re_prefilter_scan - find literals in text */
+
+void    re_prefilter_scan(RE_PREFILTER *pf, const char *text)
+{
+    const char *myname = "re_prefilter_scan";
+    RE_PREFILTER_STATE *states = pf->states;
+    const unsigned char *cp;
+    int     state;
+    int     next;
+    int     out;
+    int     ch;
+
+    if (pf->compiled == 0)
+	msg_panic("%s: prefilter was not compiled", myname);
+
+    /*
+     * Start a new generation, instead of clearing the per-literal flags.
+     */
+    if (++pf->generation == 0) {
+	memset((void *) pf->seen, 0,
+	       (pf->literal_count + 1) * sizeof(*pf->seen));
+	pf->generation = 1;
+    }
+    for (state = 0, cp = (const unsigned char *) text; (ch = *cp) != 0; cp++) {
+
+	/*
+	 * Fold ASCII case. Also fold the non-ASCII UTF-8 characters whose
+	 * Unicode case equivalent is ASCII: U+212A KELVIN SIGN, U+017F LATIN
+	 * SMALL LETTER LONG S, and the Turkish dotted and dotless I.
+	 */
+	if (ch < 0x80) {
+	    ch = RE_PREFILTER_FOLD(ch);
+	} else if (ch == 0xe2 && cp[1] == 0x84 && cp[2] == 0xaa) {
+	    ch = 'k';
+	    cp += 2;
+	} else if (ch == 0xc5 && cp[1] == 0xbf) {
+	    ch = 's';
+	    cp += 1;
+	} else if (ch == 0xc4 && (cp[1] == 0xb0 || cp[1] == 0xb1)) {
+	    ch = 'i';
+	    cp += 1;
+	}
+
+	/*
+	 * Follow failure links until there is a transition for this input.
+	 */
+	for (;;) {
+	    if (state == 0) {
+		state = pf->root[ch];
+		break;
+	    }
+	    if ((next = re_prefilter_goto(pf, state, ch)) != 0) {
+		state = next;
+		break;
+	    }
+	    state = states[state].fail;
+	}
+
+	/*
+	 * Report the literals that end here. If a literal was already
+	 * reported, then so were all literals on its output chain.
+	 */
+	for (out = (states[state].output != RE_PREFILTER_NONE ?
+		    state : states[state].out_link);
+	     out != 0 && pf->seen[states[out].output] != pf->generation;
+	     out = states[out].out_link)
+	    pf->seen[states[out].output] = pf->generation;
+    }
+}
+
+/* re_prefilter_free - destroy prefilter */
+
+void    re_prefilter_free(RE_PREFILTER *pf)
+{
+    myfree((void *) pf->states);
+    if (pf->seen)
+	myfree((void *) pf->seen);
+    vstring_free(pf->buf);
+    myfree((void *) pf);
+}
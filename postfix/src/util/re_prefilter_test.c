@@ -0,0 +1,139 @@
+ /*
+  * Test program to exercise re_prefilter.c. See PTEST_README for
+  * documentation.
+  */
+
+ /*
+  * System library.
+  */
+#include <sys_defs.h>
+#include <string.h>
+
+ /*
+  * Utility library.
+  */
+#include <vstring.h>
+#include <re_prefilter.h>
+
+ /*
+  * Test library.
+  */
+#include <ptest.h>
+
+typedef struct PTEST_CASE {
+    const char *testname;		/* identifies test case */
+    void    (*action) (PTEST_CTX *t, const struct PTEST_CASE *tp);
+    const char *regexp;			/* input pattern */
+    int     flags;			/* RE_PREFILTER_FLAG_XXX */
+    const char *want;			/* expected literal, or null */
+} PTEST_CASE;
+
+#define PCRE	RE_PREFILTER_FLAG_PCRE
+#define ERE	RE_PREFILTER_FLAG_NONE
+
+static void test_literal(PTEST_CTX *t, const PTEST_CASE *tp)
+{
+    VSTRING *buf = vstring_alloc(10);
+    const char *got;
+
+    got = re_prefilter_literal(buf, tp->regexp, tp->flags);
+    if (got == 0 && tp->want != 0)
+	ptest_error(t, "re_prefilter_literal(\"%s\"): got null, want \"%s\"",
+		    tp->regexp, tp->want);
+    else if (got != 0 && tp->want == 0)
+	ptest_error(t, "re_prefilter_literal(\"%s\"): got \"%s\", want null",
+		    tp->regexp, got);
+    else if (got != 0 && strcmp(got, tp->want) != 0)
+	ptest_error(t, "re_prefilter_literal(\"%s\"): got \"%s\", want \"%s\"",
+		    tp->regexp, got, tp->want);
+    vstring_free(buf);
+}
+
+ /*
+  * Literals that share a suffix or a prefix exercise the failure and output
+  * links.
+  */
+static const char *scan_patterns[] = {
+    "^Subject:.*viagra", "cialis", "CIALIS", "lisa+", "^From:",
+    "xyz\\.example", "[0-9]+ days", "no-literal|here",
+};
+
+typedef struct {
+    const char *text;
+    const char *want;			/* one 0/1 flag per pattern */
+} SCAN_CASE;
+
+static const SCAN_CASE scan_cases[] = {
+    {"subject: cheap VIAGRA", "10000000"},
+    {"Subject: CiAlIs", "11100000"},
+    {"lisa and lis", "00010000"},
+    {"from: lisa@xyz.example", "00011100"},
+    {"subject: 5 days", "10000010"},
+    {"nothing", "00000000"},
+    {"long \xc5\xbfubject: ", "10000000"},
+    {"ciali\xc5\xbf", "01100000"},
+    {0},
+};
+
+static void test_scan(PTEST_CTX *t, const PTEST_CASE *tp)
+{
+    RE_PREFILTER *pf = re_prefilter_create();
+    int     ids[sizeof(scan_patterns) / sizeof(scan_patterns[0])];
+    const SCAN_CASE *sp;
+    int     n;
+    int     got;
+    int     want;
+
+    for (n = 0; n < sizeof(ids) / sizeof(ids[0]); n++)
+	ids[n] = re_prefilter_add(pf, scan_patterns[n], PCRE);
+    if (ids[1] != ids[2])
+	ptest_error(t, "identical literals got different ids %d and %d",
+		    ids[1], ids[2]);
+    if (re_prefilter_count(pf) != 6)
+	ptest_error(t, "re_prefilter_count: got %d, want 6",
+		    re_prefilter_count(pf));
+    re_prefilter_compile(pf);
+
+    for (sp = scan_cases; sp->text; sp++) {
+	re_prefilter_scan(pf, sp->text);
+	for (n = 0; n < sizeof(ids) / sizeof(ids[0]); n++) {
+	    want = sp->want[n] == '1';
+	    got = ids[n] != RE_PREFILTER_NONE && re_prefilter_found(pf, ids[n]);
+	    if (got != want)
+		ptest_error(t, "text \"%s\" pattern \"%s\": got %d, want %d",
+			    sp->text, scan_patterns[n], got, want);
+	}
+    }
+    re_prefilter_free(pf);
+}
+
+static const PTEST_CASE ptestcases[] = {
+    {"plain literal", test_literal, "foobar", ERE, "foobar",},
+    {"too short", test_literal, "ab", ERE, 0,},
+    {"case folding", test_literal, "^Subject: FOO", ERE, "subject: foo",},
+    {"longest run", test_literal, "ab.cdef.ghi", ERE, "cdef",},
+    {"optional last char", test_literal, "abcdx?yz", ERE, "abcd",},
+    {"star last char", test_literal, "abcdx*yz", ERE, "abcd",},
+    {"plus keeps char", test_literal, "abcx+yz", ERE, "abcx",},
+    {"zero interval", test_literal, "abcdx{0,3}", ERE, "abcd",},
+    {"non-zero interval", test_literal, "abcx{2}yz", ERE, "abcx",},
+    {"unknown interval", test_literal, "abcdx{,3}yzzzzz", PCRE, "abcd",},
+    {"alternation", test_literal, "foobar|bazzz", ERE, 0,},
+    {"escaped punctuation", test_literal, "www\\.example\\.com", ERE,
+    "www.example.com",},
+    {"escape ends analysis", test_literal, "abc\\d+defghi", PCRE, "abc",},
+    {"posix word boundary", test_literal, "\\<abc\\>", ERE, "abc",},
+    {"group skipped", test_literal, "abc(d|e)fgh", ERE, 0,},
+    {"group no alternation", test_literal, "ab(cd)efgh", ERE, "efgh",},
+    {"pcre option group", test_literal, "(?x) a b c d", PCRE, 0,},
+    {"pcre quoting", test_literal, "\\Qa{2}\\E", PCRE, 0,},
+    {"posix class", test_literal, "[\\]abcd", ERE, "abcd",},
+    {"pcre class", test_literal, "[\\]abcd]xyz", PCRE, "xyz",},
+    {"named class", test_literal, "[[:alpha:]]abcd", ERE, "abcd",},
+    {"non-ascii", test_literal, "abc\xc3\xa9xyzw", ERE, "xyzw",},
+    {"unbalanced group", test_literal, "abcd(efg", ERE, 0,},
+    {"unbalanced class", test_literal, "abcd[efg", ERE, 0,},
+    {"scan", test_scan,},
+};
+
+#include <ptest_main.h>
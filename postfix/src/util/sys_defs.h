@@ -821,8 +821,12 @@ extern int initgroups(const char *, int);
 #endif
 #define PREFERRED_RAND_SOURCE	"dev:/dev/urandom"	/* introduced in 1.1 */
 #ifndef NO_EPOLL
+#ifdef USE_IO_URING
+#define EVENTS_STYLE	EVENTS_STYLE_IO_URING	/* falls back to epoll */
+#else
 #define EVENTS_STYLE	EVENTS_STYLE_EPOLL	/* introduced in 2.5 */
 #endif
+#endif
 #define USE_SYSV_POLL
 #ifndef NO_POSIX_GETPW_R
 #if (defined(_POSIX_C_SOURCE) && _POSIX_C_SOURCE >= 1) \
@@ -836,6 +840,9 @@ extern int initgroups(const char *, int);
 #if HAVE_GLIBC_API_VERSION_SUPPORT(2, 34)
 #define HAS_CLOSEFROM
 #endif
+#if HAVE_GLIBC_API_VERSION_SUPPORT(2, 14)
+#define HAS_SYNCFS
+#endif
 
 #endif
 
@@ -1412,6 +1419,7 @@ extern int inet_pton(int, const char *, void *);
 #define EVENTS_STYLE_KQUEUE	2	/* FreeBSD kqueue */
 #define EVENTS_STYLE_DEVPOLL	3	/* Solaris /dev/poll */
 #define EVENTS_STYLE_EPOLL	4	/* Linux epoll */
+#define EVENTS_STYLE_IO_URING	5	/* Linux io_uring */
 
  /*
   * We use poll() for read/write time limit enforcement on modern systems. We